@@ -0,0 +1,627 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+// Benchmarks of the IDNA processing functions
+//
+#include "upa/idna/batch.h"
+#include "upa/idna/cache.h"
+#include "upa/idna/idna.h"
+#include "upa/idna/nfc.h"
+#include "upa/idna/punycode.h"
+#include "upa/idna/stats.h"
+#include "upa/idna/detail/iterate_utf.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Prevents the compiler from optimizing away the benchmarked code
+std::size_t g_sink = 0;
+
+template <class Fn>
+void run(const char* name, std::size_t count, std::size_t bytes, Fn&& fn) {
+    constexpr int iterations = 50;
+
+    fn(); // warm up
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+        fn();
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    const double total_ns = elapsed.count() / iterations;
+    std::cout << name << ": "
+        << total_ns / static_cast<double>(count) << " ns/item, "
+        << static_cast<double>(bytes) * 1e3 / total_ns << " MB/s\n";
+}
+
+// BMP-only UTF-16 hostnames: ASCII, Latin, Cyrillic and CJK labels
+std::vector<std::u16string> utf16_hostnames(std::size_t count) {
+    static const char16_t* const labels[] = {
+        u"www", u"example", u"münchen", u"пример",
+        u"例え", u"日本語", u"bücher", u"com", u"org"
+    };
+    constexpr std::size_t labels_count = sizeof(labels) / sizeof(labels[0]);
+
+    std::vector<std::u16string> hostnames;
+    hostnames.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::u16string host;
+        for (std::size_t k = 0; k < 2 + i % 3; ++k) {
+            if (k != 0) host.push_back(u'.');
+            host += labels[(i * 7 + k * 3) % labels_count];
+        }
+        hostnames.push_back(std::move(host));
+    }
+    return hostnames;
+}
+
+void bench_utf16() {
+    const auto hostnames = utf16_hostnames(10000);
+    std::size_t bytes = 0;
+    for (const auto& host : hostnames)
+        bytes += host.length() * sizeof(char16_t);
+
+    std::cout << "UTF-16 decoding (" << hostnames.size() << " hostnames)\n";
+
+    std::u32string out;
+    run("  getCodePoint", hostnames.size(), bytes, [&] {
+        for (const auto& host : hostnames) {
+            out.clear();
+            const auto* it = host.data();
+            const auto* last = host.data() + host.length();
+            while (it != last)
+                out.push_back(upa::idna::util::getCodePoint(it, last));
+            g_sink += out.length();
+        }
+    });
+
+    char32_t block[64];
+    run("  decodeBlock", hostnames.size(), bytes, [&] {
+        for (const auto& host : hostnames) {
+            out.clear();
+            const auto* it = host.data();
+            const auto* last = host.data() + host.length();
+            while (it != last)
+                out.append(block, upa::idna::util::decodeBlock(it, last, block, std::size(block)));
+            g_sink += out.length();
+        }
+    });
+
+    std::string domain;
+    run("  to_ascii", hostnames.size(), bytes, [&] {
+        for (const auto& host : hostnames) {
+            upa::idna::to_ascii(domain, host.data(), host.data() + host.length(),
+                upa::idna::Option::Default);
+            g_sink += domain.length();
+        }
+    });
+}
+
+// Labels of distinct CJK ideographs and emoji
+std::vector<std::u32string> cjk_emoji_labels(std::size_t count, std::size_t length) {
+    std::vector<std::u32string> labels;
+    labels.reserve(count);
+    std::uint32_t seed = 1;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::u32string label;
+        for (std::size_t k = 0; k < length; ++k) {
+            seed = seed * 1103515245 + 12345;
+            const auto rnd = seed >> 8;
+            label.push_back(rnd % 4 == 0
+                ? static_cast<char32_t>(0x1F300 + rnd % 0x300)
+                : static_cast<char32_t>(0x4E00 + rnd % 0x5200));
+        }
+        labels.push_back(std::move(label));
+    }
+    return labels;
+}
+
+void bench_punycode(std::size_t length) {
+    const auto labels = cjk_emoji_labels(2000, length);
+    std::size_t bytes = 0;
+    for (const auto& label : labels)
+        bytes += label.length() * sizeof(char32_t);
+
+    std::cout << "Punycode (" << labels.size() << " CJK/emoji labels of "
+        << length << " code points)\n";
+
+    std::string encoded;
+    run("  encode", labels.size(), bytes, [&] {
+        for (const auto& label : labels) {
+            encoded.clear();
+            upa::idna::punycode::encode(encoded, label.data(), label.data() + label.length());
+            g_sink += encoded.length();
+        }
+    });
+
+    std::vector<std::u32string> encoded_labels;
+    for (const auto& label : labels) {
+        encoded.clear();
+        upa::idna::punycode::encode(encoded, label.data(), label.data() + label.length());
+        encoded_labels.emplace_back(encoded.begin(), encoded.end());
+    }
+    std::u32string decoded;
+    run("  decode", labels.size(), bytes, [&] {
+        for (const auto& label : encoded_labels) {
+            decoded.clear();
+            upa::idna::punycode::decode(decoded, label.data(), label.data() + label.length());
+            g_sink += decoded.length();
+        }
+    });
+}
+
+// Mixed ASCII and Punycode heavy UTF-8 hostnames
+std::vector<std::string> utf8_hostnames(std::size_t count) {
+    static const char* const labels[] = {
+        "www", "example", "mail", "m\xC3\xBCnchen", "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xBC\xD0\xB5\xD1\x80",
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E", "\xF0\x9F\x98\x80\xF0\x9F\x8E\x89", "com", "org"
+    };
+    constexpr std::size_t labels_count = sizeof(labels) / sizeof(labels[0]);
+
+    std::vector<std::string> hostnames;
+    hostnames.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string host;
+        for (std::size_t k = 0; k < 2 + i % 3; ++k) {
+            if (k != 0) host.push_back('.');
+            host += labels[(i * 5 + k * 7) % labels_count];
+        }
+        hostnames.push_back(std::move(host));
+    }
+    return hostnames;
+}
+
+void bench_batch() {
+    const auto hostnames = utf8_hostnames(200000);
+    const std::vector<std::string_view> views(hostnames.begin(), hostnames.end());
+    std::size_t bytes = 0;
+    for (const auto& host : hostnames)
+        bytes += host.length();
+
+    std::cout << "Batch to_ascii (" << hostnames.size() << " UTF-8 hostnames)\n";
+
+    std::string domain;
+    run("  to_ascii", hostnames.size(), bytes, [&] {
+        for (const auto& host : hostnames) {
+            upa::idna::to_ascii(domain, host.data(), host.data() + host.length(),
+                upa::idna::Option::Default);
+            g_sink += domain.length();
+        }
+    });
+
+    upa::idna::batch_result result;
+    run("  to_ascii_batch", hostnames.size(), bytes, [&] {
+        g_sink += upa::idna::to_ascii_batch(result, views.data(), views.size(),
+            upa::idna::Option::Default);
+    });
+    for (const unsigned thread_count : { 2u, 4u, 0u }) {
+        const std::string name = "  to_ascii_batch_parallel (threads: " +
+            (thread_count ? std::to_string(thread_count) : std::string("all")) + ")";
+        run(name.c_str(), hostnames.size(), bytes, [&] {
+            g_sink += upa::idna::to_ascii_batch_parallel(result, views.data(), views.size(),
+                upa::idna::Option::Default, thread_count);
+        });
+    }
+}
+
+// Oversized hostnames, which fail the DNS length check
+void bench_oversized(std::size_t length) {
+    std::string ascii_host;
+    std::string unicode_host;
+    while (ascii_host.length() < length)
+        ascii_host += "abcdefghij.";
+    while (unicode_host.length() < length)
+        unicode_host += "\xC3\xBC" "abcdefghijklmnopqrstuvwxyz0123456789"; // one long label
+    const auto options = upa::idna::domain_options(true, false);
+
+    std::cout << "Oversized hostnames (" << length << " bytes), strict options\n";
+
+    std::string domain;
+    const std::pair<const char*, const std::string*> inputs[] = {
+        { "  to_ascii (ASCII)", &ascii_host },
+        { "  to_ascii (Unicode)", &unicode_host },
+    };
+    for (const auto& input : inputs) {
+        const auto& host = *input.second;
+        run(input.first, 1, host.length(), [&] {
+            g_sink += upa::idna::to_ascii(domain, host.data(), host.data() + host.length(), options);
+            g_sink += domain.length() + 1;
+        });
+    }
+    run("  to_ascii (ASCII, InputASCII)", 1, ascii_host.length(), [&] {
+        g_sink += upa::idna::to_ascii(domain, ascii_host.data(), ascii_host.data() + ascii_host.length(),
+            options | upa::idna::Option::InputASCII);
+        g_sink += domain.length() + 1;
+    });
+}
+
+void bench_cache() {
+    // Zipfian distribution of 10000 distinct hostnames
+    auto hostnames = utf8_hostnames(10000);
+    for (std::size_t ind = 0; ind < hostnames.size(); ++ind)
+        hostnames[ind].insert(0, "h" + std::to_string(ind) + ".");
+    std::vector<double> weights(hostnames.size());
+    for (std::size_t ind = 0; ind < weights.size(); ++ind)
+        weights[ind] = 1.0 / static_cast<double>(ind + 1);
+    std::mt19937 gen(1);
+    std::discrete_distribution<std::size_t> dist(weights.begin(), weights.end());
+    std::vector<const std::string*> requests(200000);
+    std::size_t bytes = 0;
+    for (auto& req : requests) {
+        req = &hostnames[dist(gen)];
+        bytes += req->length();
+    }
+
+    std::cout << "Cached to_ascii (" << requests.size() << " Zipfian requests)\n";
+
+    std::string domain;
+    run("  to_ascii", requests.size(), bytes, [&] {
+        for (const auto* host : requests) {
+            upa::idna::to_ascii(domain, host->data(), host->data() + host->length(),
+                upa::idna::Option::Default);
+            g_sink += domain.length();
+        }
+    });
+    for (const std::size_t capacity : { 1000u, 10000u }) {
+        upa::idna::result_cache cache(capacity);
+        const std::string name = "  result_cache (capacity: " + std::to_string(capacity) + ")";
+        run(name.c_str(), requests.size(), bytes, [&] {
+            for (const auto* host : requests) {
+                cache.to_ascii(domain, host->data(), host->data() + host->length(),
+                    upa::idna::Option::Default);
+                g_sink += domain.length();
+            }
+        });
+        const auto stats = cache.stats();
+        std::cout << "    hits: " << stats.hits << ", misses: " << stats.misses << '\n';
+    }
+}
+
+// Generated hostname corpora
+
+struct corpus {
+    const char* name;
+    std::vector<std::string> hostnames; // UTF-8
+    std::size_t bytes = 0;
+};
+
+// Generates the hostnames of 2 to 4 labels: the last label is taken from `tlds`,
+// the other labels have 3 to 12 code points generated by `next_cp`
+corpus make_corpus(const char* name, std::size_t count, const std::vector<std::u32string>& tlds,
+    const std::function<char32_t(std::mt19937&, std::size_t)>& next_cp) {
+    std::mt19937 gen(12345);
+    corpus res{ name, {} };
+    res.hostnames.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string host;
+        const std::size_t label_count = 1 + gen() % 3;
+        for (std::size_t k = 0; k < label_count; ++k) {
+            const std::size_t length = 3 + gen() % 10;
+            for (std::size_t pos = 0; pos < length; ++pos)
+                upa::idna::util::appendCodePoint(host, next_cp(gen, pos));
+            host.push_back('.');
+        }
+        for (const auto cp : tlds[gen() % tlds.size()])
+            upa::idna::util::appendCodePoint(host, cp);
+        res.bytes += host.length();
+        res.hostnames.push_back(std::move(host));
+    }
+    return res;
+}
+
+std::vector<corpus> make_corpora(std::size_t count) {
+    const auto in_range = [](std::mt19937& gen, char32_t first, char32_t last) {
+        return static_cast<char32_t>(first + gen() % (last - first + 1));
+    };
+    const auto ascii_cp = [&](std::mt19937& gen, std::size_t pos) {
+        const auto r = gen() % 40;
+        if (r < 26) return static_cast<char32_t>('a' + r);
+        if (r < 36) return static_cast<char32_t>('0' + r - 26);
+        // hyphen is not allowed at the start of the label
+        return pos == 0 ? U'x' : U'-';
+    };
+
+    std::vector<corpus> res;
+    // Pure ASCII, some upper case
+    res.push_back(make_corpus("ASCII", count, { U"com", U"org", U"net", U"DE" },
+        [&](std::mt19937& gen, std::size_t pos) {
+            const char32_t cp = ascii_cp(gen, pos);
+            return (cp >= 'a' && cp <= 'z' && gen() % 8 == 0) ? cp - 0x20 : cp;
+        }));
+    // Latin with diacritics: U+00E0..U+00FF (except U+00F7), upper case U+00C0..U+00DE
+    res.push_back(make_corpus("Latin", count, { U"com", U"de", U"fr", U"xn--p1ai" },
+        [&](std::mt19937& gen, std::size_t) {
+            switch (gen() % 4) {
+            case 0: {
+                const char32_t cp = in_range(gen, 0xE0, 0xFF);
+                return cp == 0xF7 ? U'é' : cp;
+            }
+            case 1: {
+                const char32_t cp = in_range(gen, 0xC0, 0xDE);
+                return cp == 0xD7 ? U'É' : cp;
+            }
+            default:
+                return in_range(gen, 'a', 'z');
+            }
+        }));
+    // Cyrillic and Greek letters: U+0430..U+044F, U+03B1..U+03C9, upper case U+0410..U+042F
+    res.push_back(make_corpus("Cyrillic/Greek", count, { U"com", U"рф", U"ελ", U"bg" },
+        [&](std::mt19937& gen, std::size_t) {
+            switch (gen() % 4) {
+            case 0: return in_range(gen, 0x03B1, 0x03C9);
+            case 1: return in_range(gen, 0x0410, 0x042F);
+            default: return in_range(gen, 0x0430, 0x044F);
+            }
+        }));
+    // CJK Unified Ideographs
+    res.push_back(make_corpus("CJK", count, { U"com", U"中国", U"日本", U"jp" },
+        [&](std::mt19937& gen, std::size_t) {
+            return in_range(gen, 0x4E00, 0x9FFF);
+        }));
+    // Arabic and Hebrew letters (RTL labels), LTR and RTL top-level domains
+    res.push_back(make_corpus("Arabic/Hebrew", count,
+        { U"com", U"مصر", U"ישראל", U"il" },
+        [&](std::mt19937& gen, std::size_t) {
+            return gen() % 2 == 0
+                ? in_range(gen, 0x0628, 0x063A)
+                : in_range(gen, 0x05D0, 0x05EA);
+        }));
+    // Emoji mixed with ASCII letters
+    res.push_back(make_corpus("Emoji", count, { U"com", U"ws", U"to" },
+        [&](std::mt19937& gen, std::size_t) {
+            return gen() % 3 == 0
+                ? in_range(gen, 'a', 'z')
+                : in_range(gen, 0x1F600, 0x1F64F);
+        }));
+    return res;
+}
+
+void bench_corpus(const corpus& corp) {
+    using upa::idna::Option;
+    const auto& hostnames = corp.hostnames;
+    const std::size_t count = hostnames.size();
+
+    std::cout << corp.name << " (" << count << " hostnames, " << corp.bytes << " bytes)\n";
+
+    // Per-stage benchmarks
+
+    std::u32string mapped;
+    run("  map (P1, P2)", count, corp.bytes, [&] {
+        for (const auto& host : hostnames) {
+            mapped.clear();
+            upa::idna::detail::map(mapped, host.data(), host.data() + host.length(), Option::Default);
+            g_sink += mapped.length();
+        }
+    });
+
+    std::vector<std::u32string> mapped_hosts;
+    std::vector<std::u32string> labels;         // non-ASCII labels
+    std::vector<std::u32string> encoded_labels; // their Punycode encodings
+    std::vector<std::u32string> decomposed_hosts;
+    std::size_t labels_bytes = 0; // Punycode encoded
+    for (const auto& host : hostnames) {
+        mapped.clear();
+        upa::idna::detail::map(mapped, host.data(), host.data() + host.length(), Option::Default);
+        mapped_hosts.push_back(mapped);
+        auto decomposed = mapped;
+        upa::idna::canonical_decompose(decomposed);
+        decomposed_hosts.push_back(std::move(decomposed));
+        std::size_t start = 0;
+        while (start <= mapped.length()) {
+            std::size_t end = mapped.find(U'.', start);
+            if (end == std::u32string::npos) end = mapped.length();
+            std::u32string label = mapped.substr(start, end - start);
+            if (std::any_of(label.begin(), label.end(), [](char32_t cp) { return cp >= 0x80; })) {
+                std::string encoded;
+                upa::idna::punycode::encode(encoded, label.data(), label.data() + label.length());
+                encoded_labels.emplace_back(encoded.begin(), encoded.end());
+                labels.push_back(std::move(label));
+                labels_bytes += encoded.length();
+            }
+            start = end + 1;
+        }
+    }
+
+    run("  is_normalized_nfc", count, corp.bytes, [&] {
+        for (const auto& host : mapped_hosts)
+            g_sink += upa::idna::is_normalized_nfc(host.data(), host.data() + host.length());
+    });
+
+    std::u32string work;
+    run("  canonical_decompose", count, corp.bytes, [&] {
+        for (const auto& host : mapped_hosts) {
+            work = host;
+            upa::idna::canonical_decompose(work);
+            g_sink += work.length();
+        }
+    });
+    run("  compose", count, corp.bytes, [&] {
+        for (const auto& host : decomposed_hosts) {
+            work = host;
+            upa::idna::compose(work);
+            g_sink += work.length();
+        }
+    });
+
+    if (!labels.empty()) {
+        std::string encoded;
+        run("  punycode::encode (per label)", labels.size(), labels_bytes, [&] {
+            for (const auto& label : labels) {
+                encoded.clear();
+                upa::idna::punycode::encode(encoded, label.data(), label.data() + label.length());
+                g_sink += encoded.length();
+            }
+        });
+        std::u32string decoded;
+        run("  punycode::decode (per label)", labels.size(), labels_bytes, [&] {
+            for (const auto& label : encoded_labels) {
+                decoded.clear();
+                upa::idna::punycode::decode(decoded, label.data(), label.data() + label.length());
+                g_sink += decoded.length();
+            }
+        });
+    }
+
+    // The validation of labels (V1 - V8) and the bidi rules (V9) is measured by
+    // to_unicode_mapped, which validates and copies the mapped domain
+    std::u32string unicode;
+    run("  validate (to_unicode_mapped)", count, corp.bytes, [&] {
+        for (const auto& host : mapped_hosts) {
+            unicode.clear();
+            g_sink += upa::idna::detail::to_unicode_mapped(unicode, host, Option::CheckJoiners);
+        }
+    });
+    run("  validate + bidi (to_unicode_mapped)", count, corp.bytes, [&] {
+        for (const auto& host : mapped_hosts) {
+            unicode.clear();
+            g_sink += upa::idna::detail::to_unicode_mapped(unicode, host,
+                Option::CheckJoiners | Option::CheckBidi);
+        }
+    });
+
+    // End-to-end benchmarks
+
+    const auto options = upa::idna::domain_options(false, false);
+    std::string domain;
+    run("  to_ascii", count, corp.bytes, [&] {
+        for (const auto& host : hostnames) {
+            g_sink += upa::idna::to_ascii(domain, host.data(), host.data() + host.length(), options);
+            g_sink += domain.length();
+        }
+    });
+    upa::idna::context ctx;
+    run("  to_ascii (context)", count, corp.bytes, [&] {
+        for (const auto& host : hostnames) {
+            g_sink += upa::idna::to_ascii(ctx, domain, host.data(), host.data() + host.length(), options);
+            g_sink += domain.length();
+        }
+    });
+    run("  to_unicode", count, corp.bytes, [&] {
+        for (const auto& host : hostnames) {
+            domain.clear();
+            g_sink += upa::idna::to_unicode(domain, host.data(), host.data() + host.length(), options);
+            g_sink += domain.length();
+        }
+    });
+}
+
+// Loads the newline-delimited hostnames, for example generated by unitool-hostgen
+bool load_corpus(const char* file_name, corpus& corp) {
+    std::ifstream file(file_name, std::ios_base::in | std::ios_base::binary);
+    if (!file.is_open()) {
+        std::cerr << "Can't open hostnames file: " << file_name << std::endl;
+        return false;
+    }
+    corp.name = file_name;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        corp.bytes += line.length();
+        corp.hostnames.push_back(line);
+    }
+    return !corp.hostnames.empty();
+}
+
+void bench_corpora() {
+    for (const auto& corp : make_corpora(10000))
+        bench_corpus(corp);
+}
+
+#ifdef UPA_IDNA_STATS
+
+// Prints the per stage breakdown of to_ascii on each corpus
+void bench_stats() {
+    using upa::idna::stats_stage;
+    using upa::idna::stats_quick_check;
+
+    const auto options = upa::idna::domain_options(false, false);
+    std::string domain;
+    upa::idna::set_stats_timing(true);
+    for (const auto& corp : make_corpora(10000)) {
+        upa::idna::reset_stats();
+        for (const auto& host : corp.hostnames) {
+            g_sink += upa::idna::to_ascii(domain, host.data(), host.data() + host.length(), options);
+            g_sink += domain.length();
+        }
+        const auto st = upa::idna::get_stats();
+
+        std::cout << "== stats: " << corp.name << " (to_ascii) ==\n";
+        for (unsigned ind = 0; ind < static_cast<unsigned>(stats_stage::count); ++ind) {
+            const auto stage = static_cast<stats_stage>(ind);
+            const auto& cnt = st[stage];
+            std::cout << "  " << std::left << std::setw(22) << upa::idna::stats_stage_name(stage)
+                << std::right << std::setw(10) << cnt.calls << " calls"
+                << std::setw(12) << cnt.bytes << " bytes"
+                << std::setw(14) << cnt.cycles << " cycles\n";
+        }
+        std::cout << "  NFC quick check: yes " << st[stats_quick_check::yes]
+            << ", maybe " << st[stats_quick_check::maybe]
+            << ", no " << st[stats_quick_check::no] << std::endl;
+    }
+    upa::idna::set_stats_timing(false);
+}
+
+#endif // UPA_IDNA_STATS
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // The hostnames files given by "-f <file>" are benchmarked as corpora
+    std::vector<const char*> group_names;
+    bool has_files = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            corpus corp;
+            if (!load_corpus(argv[++i], corp))
+                return 2;
+            bench_corpus(corp);
+            has_files = true;
+        } else {
+            group_names.push_back(argv[i]);
+        }
+    }
+
+    // Benchmark groups; the command line arguments select the groups to run
+    const std::pair<const char*, std::function<void()>> groups[] = {
+        { "corpora", bench_corpora },
+        { "utf16", bench_utf16 },
+        { "punycode", [] {
+            bench_punycode(20);
+            bench_punycode(60);
+            bench_punycode(500);
+        } },
+        { "batch", bench_batch },
+        { "oversized", [] {
+            bench_oversized(4096);
+            bench_oversized(65536);
+        } },
+        { "cache", bench_cache },
+#ifdef UPA_IDNA_STATS
+        { "stats", bench_stats },
+#endif
+    };
+    for (const auto& group : groups) {
+        bool selected = group_names.empty() && !has_files;
+        for (const char* name : group_names)
+            selected = selected || std::strcmp(name, group.first) == 0;
+        if (selected)
+            group.second();
+    }
+    return g_sink == 0 ? 1 : 0;
+}
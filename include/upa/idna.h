@@ -6,7 +6,10 @@
 #define UPA_IDNA_H
 
 #include "idna/idna.h" // IWYU pragma: export
+#include "idna/batch.h"
+#include "idna/cache.h"
 #include "idna/nfc.h"
 #include "idna/punycode.h"
+#include "idna/stats.h"
 
 #endif // UPA_IDNA_H
@@ -0,0 +1,118 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_BATCH_H
+#define UPA_IDNA_BATCH_H
+
+#include "idna.h"
+
+#ifndef UPA_MODULE
+# include <cstddef>
+# include <string>
+# include <string_view>
+# include <vector>
+#endif // UPA_MODULE
+
+namespace upa::idna {
+
+UPA_EXPORT_BEGIN
+
+/// @brief Results of the batch conversion
+///
+/// The converted hostnames are stored one after another in the single string
+/// (arena); each item refers to its part of the arena by offset and length.
+/// The object can be reused for the next batch: its memory and the processing
+/// buffers are kept.
+class batch_result {
+public:
+    /// @brief Result of one input hostname
+    struct item {
+        std::size_t offset; ///< offset of the result in the arena
+        std::size_t length; ///< length of the result; 0 if conversion failed
+        bool ok;            ///< `true` if the hostname was converted successfully
+    };
+
+    /// @return the number of items
+    [[nodiscard]] std::size_t size() const noexcept { return items_.size(); }
+
+    /// @return the result item of the input with index @a ind
+    [[nodiscard]] const item& operator[](std::size_t ind) const { return items_[ind]; }
+
+    /// @return the converted hostname of the input with index @a ind
+    [[nodiscard]] std::string_view value(std::size_t ind) const {
+        const auto& it = items_[ind];
+        return { output_.data() + it.offset, it.length };
+    }
+
+    /// @return the arena of converted hostnames
+    [[nodiscard]] const std::string& output() const noexcept { return output_; }
+
+    /// @brief Removes all results, but keeps the allocated memory
+    void clear() noexcept {
+        output_.clear();
+        items_.clear();
+    }
+
+    // for internal use
+    struct worker_buffers {
+        std::string output; // chunk results of the parallel conversion
+        context ctx;
+    };
+    std::string& output() noexcept { return output_; }
+    std::vector<item>& items() noexcept { return items_; }
+    context& ctx() noexcept { return ctx_; }
+    std::vector<worker_buffers>& workers() noexcept { return workers_; }
+private:
+    std::string output_;
+    std::vector<item> items_;
+    context ctx_;
+    std::vector<worker_buffers> workers_; // kept for the next parallel batch
+};
+
+/// @brief Implements the Unicode IDNA ToASCII for the array of hostnames
+///
+/// Converts each input as `to_ascii` does and replaces the content of @a result
+/// with the results: the item with index `i` corresponds to `inputs[i]`. The
+/// options are decoded, the output memory is reserved and the processing
+/// buffers are set up once for the whole batch.
+///
+/// @param[in,out] result object to store results
+/// @param[in]  inputs array of input hostnames
+/// @param[in]  count the number of input hostnames
+/// @param[in]  options
+/// @return the number of successfully converted hostnames
+template <typename CharT>
+std::size_t to_ascii_batch(batch_result& result, const std::basic_string_view<CharT>* inputs,
+    std::size_t count, Option options);
+
+/// @brief Implements the Unicode IDNA ToASCII for the array of hostnames using several threads
+///
+/// Gives the same results in the same order as `to_ascii_batch`. The inputs are
+/// split into chunks which are distributed among threads with work stealing, so
+/// the threads stay busy even if the conversion cost of hostnames differs a lot.
+/// The calling thread is one of the workers.
+///
+/// @param[in,out] result object to store results
+/// @param[in]  inputs array of input hostnames
+/// @param[in]  count the number of input hostnames
+/// @param[in]  options
+/// @param[in]  thread_count the number of threads to use; if 0, then
+///   `std::thread::hardware_concurrency()` is used
+/// @return the number of successfully converted hostnames
+template <typename CharT>
+std::size_t to_ascii_batch_parallel(batch_result& result, const std::basic_string_view<CharT>* inputs,
+    std::size_t count, Option options, unsigned thread_count = 0);
+
+UPA_EXPORT_END
+
+extern template UPA_IDNA_API std::size_t to_ascii_batch(batch_result&, const std::string_view*, std::size_t, Option);
+extern template UPA_IDNA_API std::size_t to_ascii_batch(batch_result&, const std::u16string_view*, std::size_t, Option);
+extern template UPA_IDNA_API std::size_t to_ascii_batch(batch_result&, const std::u32string_view*, std::size_t, Option);
+extern template UPA_IDNA_API std::size_t to_ascii_batch_parallel(batch_result&, const std::string_view*, std::size_t, Option, unsigned);
+extern template UPA_IDNA_API std::size_t to_ascii_batch_parallel(batch_result&, const std::u16string_view*, std::size_t, Option, unsigned);
+extern template UPA_IDNA_API std::size_t to_ascii_batch_parallel(batch_result&, const std::u32string_view*, std::size_t, Option, unsigned);
+
+} // namespace upa::idna
+
+#endif // UPA_IDNA_BATCH_H
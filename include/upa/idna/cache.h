@@ -0,0 +1,106 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_CACHE_H
+#define UPA_IDNA_CACHE_H
+
+#include "idna.h"
+
+#ifndef UPA_MODULE
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <string>
+#endif // UPA_MODULE
+
+namespace upa::idna {
+
+UPA_EXPORT_BEGIN
+
+/// @brief Thread-safe cache of the `to_ascii` and `to_unicode` results
+///
+/// Results are keyed by the input code units, the options and the output type,
+/// so a cached conversion gives exactly the same result as the uncached one.
+/// The cache is split into shards, each guarded by its own mutex and evicting
+/// its least recently used entries, so concurrent lookups rarely contend.
+///
+/// Inputs longer than `max_input_size` bytes are converted, but not cached;
+/// together with the capacity this bounds the memory used by the cache.
+class UPA_IDNA_API result_cache {
+public:
+    /// @brief The maximum size of the cached input in bytes
+    static constexpr std::size_t max_input_size = 1024;
+
+    /// @brief Cache usage counters
+    struct statistics {
+        std::uint64_t hits;   ///< the number of lookups that found a result
+        std::uint64_t misses; ///< the number of lookups that did not find a result
+        std::size_t size;     ///< the number of cached results
+    };
+
+    /// @brief Constructs an empty cache
+    ///
+    /// @param[in] capacity the maximum number of cached results
+    /// @param[in] shard_count the number of independently locked parts
+    explicit result_cache(std::size_t capacity, std::size_t shard_count = 16);
+    ~result_cache();
+
+    result_cache(const result_cache&) = delete;
+    result_cache& operator=(const result_cache&) = delete;
+
+    /// @brief Implements the Unicode IDNA ToASCII using the cache
+    ///
+    /// Same as `upa::idna::to_ascii(domain, input, input_end, options)`.
+    template <typename CharT>
+    bool to_ascii(std::string& domain, const CharT* input, const CharT* input_end, Option options);
+
+    /// @brief Implements the Unicode IDNA ToUnicode using the cache
+    ///
+    /// Same as `upa::idna::to_unicode(domain, input, input_end, options)`; the
+    /// result is appended to @a domain.
+    template <typename CharT>
+    bool to_unicode(std::u32string& domain, const CharT* input, const CharT* input_end, Option options);
+
+    /// @brief Implements the Unicode IDNA ToUnicode with the UTF-8 output using the cache
+    template <typename CharT>
+    bool to_unicode(std::string& domain, const CharT* input, const CharT* input_end, Option options);
+
+    /// @brief Implements the Unicode IDNA ToUnicode with the UTF-16 output using the cache
+    template <typename CharT>
+    bool to_unicode(std::u16string& domain, const CharT* input, const CharT* input_end, Option options);
+
+    /// @return the counters summed over all shards
+    [[nodiscard]] statistics stats() const;
+
+    /// @brief Removes all cached results and resets the counters
+    void clear();
+
+private:
+    struct shard;
+
+    template <unsigned kind, class StrT, typename CharT>
+    bool convert(StrT& domain, const CharT* input, const CharT* input_end, Option options);
+
+    std::unique_ptr<shard[]> shards_;
+    std::size_t shard_count_;
+};
+
+UPA_EXPORT_END
+
+extern template UPA_IDNA_API bool result_cache::to_ascii(std::string&, const char*, const char*, Option);
+extern template UPA_IDNA_API bool result_cache::to_ascii(std::string&, const char16_t*, const char16_t*, Option);
+extern template UPA_IDNA_API bool result_cache::to_ascii(std::string&, const char32_t*, const char32_t*, Option);
+extern template UPA_IDNA_API bool result_cache::to_unicode(std::u32string&, const char*, const char*, Option);
+extern template UPA_IDNA_API bool result_cache::to_unicode(std::u32string&, const char16_t*, const char16_t*, Option);
+extern template UPA_IDNA_API bool result_cache::to_unicode(std::u32string&, const char32_t*, const char32_t*, Option);
+extern template UPA_IDNA_API bool result_cache::to_unicode(std::string&, const char*, const char*, Option);
+extern template UPA_IDNA_API bool result_cache::to_unicode(std::string&, const char16_t*, const char16_t*, Option);
+extern template UPA_IDNA_API bool result_cache::to_unicode(std::string&, const char32_t*, const char32_t*, Option);
+extern template UPA_IDNA_API bool result_cache::to_unicode(std::u16string&, const char*, const char*, Option);
+extern template UPA_IDNA_API bool result_cache::to_unicode(std::u16string&, const char16_t*, const char16_t*, Option);
+extern template UPA_IDNA_API bool result_cache::to_unicode(std::u16string&, const char32_t*, const char32_t*, Option);
+
+} // namespace upa::idna
+
+#endif // UPA_IDNA_CACHE_H
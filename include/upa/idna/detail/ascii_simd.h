@@ -0,0 +1,130 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_ASCII_SIMD_H
+#define UPA_IDNA_ASCII_SIMD_H
+
+// SSE2 is always available on x86-64
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define UPA_IDNA_SSE2
+#endif
+
+#ifndef UPA_MODULE
+# include <cstddef>
+# include <cstdint>
+# ifdef UPA_IDNA_SSE2
+#  include <emmintrin.h>
+# endif
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#endif // UPA_MODULE
+
+namespace upa::idna::util {
+
+// Number of code units processed at once by the block functions
+inline constexpr std::size_t ascii_block_size = 16;
+
+// Bit masks of the block's code units; bit i corresponds to the code unit i
+struct ascii_block_info {
+    unsigned non_ascii;  // code units >= 0x80
+    unsigned disallowed; // ASCII characters other than [A-Za-z0-9.-], i.e. STD3 disallowed
+    unsigned dots;       // U+002E FULL STOP
+};
+
+// Returns the number of trailing zero bits; `mask` must be non-zero
+inline unsigned count_trailing_zeros(unsigned mask) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index; // NOLINT(cppcoreguidelines-init-variables)
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+// Returns the bit mask of non-ASCII bytes among ascii_block_size bytes of `input`
+inline unsigned non_ascii_mask(const char* input) noexcept {
+#ifdef UPA_IDNA_SSE2
+    return static_cast<unsigned>(_mm_movemask_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input))));
+#else
+    unsigned mask = 0;
+    for (std::size_t i = 0; i < ascii_block_size; ++i) {
+        if (static_cast<unsigned char>(input[i]) >= 0x80)
+            mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+// Copies ascii_block_size bytes from `input` to `output`, converting A-Z to
+// lowercase, and classifies the input bytes
+inline ascii_block_info ascii_lower_block(const char* input, char* output) noexcept {
+#ifdef UPA_IDNA_SSE2
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+    // Bytes >= 0x80 are negative in the signed comparisons below, so they never
+    // fall into the ranges of ASCII characters
+    const auto in_range = [](__m128i x, char lo, char hi) {
+        return _mm_and_si128(
+            _mm_cmpgt_epi8(x, _mm_set1_epi8(static_cast<char>(lo - 1))),
+            _mm_cmplt_epi8(x, _mm_set1_epi8(static_cast<char>(hi + 1))));
+    };
+    const __m128i upper = in_range(v, 'A', 'Z');
+    const __m128i lower = _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output), lower);
+
+    const __m128i dots = _mm_cmpeq_epi8(v, _mm_set1_epi8('.'));
+    const __m128i allowed = _mm_or_si128(
+        _mm_or_si128(in_range(lower, 'a', 'z'), in_range(v, '0', '9')),
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('-')), dots));
+
+    const auto non_ascii = static_cast<unsigned>(_mm_movemask_epi8(v));
+    return {
+        non_ascii,
+        ~static_cast<unsigned>(_mm_movemask_epi8(allowed)) & ~non_ascii & 0xFFFF,
+        static_cast<unsigned>(_mm_movemask_epi8(dots))
+    };
+#else
+    ascii_block_info info{ 0, 0, 0 };
+    for (std::size_t i = 0; i < ascii_block_size; ++i) {
+        const auto c = static_cast<unsigned char>(input[i]);
+        const unsigned bit = 1u << i;
+        if (c >= 0x80) {
+            info.non_ascii |= bit;
+            output[i] = static_cast<char>(c);
+            continue;
+        }
+        const auto lc = static_cast<unsigned char>((c <= 'Z' && c >= 'A') ? (c | 0x20) : c);
+        output[i] = static_cast<char>(lc);
+        if (lc == '.')
+            info.dots |= bit;
+        else if (!((lc >= 'a' && lc <= 'z') || (lc >= '0' && lc <= '9') || lc == '-'))
+            info.disallowed |= bit;
+    }
+    return info;
+#endif
+}
+
+// Widens ascii_block_size ASCII characters to UTF-32
+inline void ascii_widen_block(const char* input, char32_t* output) noexcept {
+#ifdef UPA_IDNA_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+    const __m128i lo = _mm_unpacklo_epi8(v, zero);
+    const __m128i hi = _mm_unpackhi_epi8(v, zero);
+    auto* out = reinterpret_cast<__m128i*>(output);
+    _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+#else
+    for (std::size_t i = 0; i < ascii_block_size; ++i)
+        output[i] = static_cast<unsigned char>(input[i]);
+#endif
+}
+
+} // namespace upa::idna::util
+
+#endif // UPA_IDNA_ASCII_SIMD_H
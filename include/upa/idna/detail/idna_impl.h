@@ -0,0 +1,641 @@
+// Copyright 2017-2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_IDNA_IMPL_H
+#define UPA_IDNA_IDNA_IMPL_H
+
+#include "../config.h"
+
+#ifndef UPA_MODULE
+# include "../idna.h"
+# include <algorithm>
+# include <cstddef>
+# include <cstdint>
+# include <iterator>
+# include <stdexcept>
+# include <string>
+#endif // UPA_MODULE
+
+#include "idna_table.h"
+#include "iterate_utf.h"
+#include "nfc_impl.h"
+#include "props_table.h"
+#include "punycode_impl.h"
+#include "stats.h"
+
+// The IDNA processing steps shared by the library and the compile-time
+// conversion (see upa/idna/static.h)
+
+namespace upa::idna::detail {
+
+// Split
+
+template<class InputIt, class T, class FunT>
+constexpr void split(InputIt first, InputIt last, const T& delim, FunT output) {
+    auto start = first;
+    while (true) {
+        auto it = std::find(start, last, delim);
+        output(start, it);
+        if (it == last) break;
+        start = ++it; // skip delimiter
+    }
+}
+
+// Processing
+
+// Size of the on-stack Punycode label buffers; fits the 63 octets DNS label
+constexpr std::size_t kLabelBufferSize = 64;
+
+constexpr int IsBidiDomain = 0x01;
+constexpr int IsBidiError = 0x02;
+
+// The validation functions report the failed rule to *perr, if it is not nullptr
+UPA_IDNA_CONSTEXPR_20 bool validate_label(const char32_t* label, const char32_t* label_end, Option options, bool full_check,
+    int& bidiRes, std::u32string& nfc_buff, error_info* perr = nullptr);
+UPA_IDNA_CONSTEXPR_20 bool validate_bidi(const char32_t* label, const char32_t* label_end, int& bidiRes,
+    error_info* perr = nullptr);
+
+// Records the failed rule and the offset of the offending code point in the
+// label; returns false. It is called on the failure branches only.
+constexpr bool set_error(error_info* perr, error_code code, std::size_t offset = 0) noexcept {
+    if (perr != nullptr) {
+        perr->code = code;
+        perr->offset = offset;
+    }
+    return false;
+}
+
+// Adds the bidi classification bits of the label, validated with the initial
+// zero state, to the state of the preceding labels. It gives the same result as
+// validating the label with the state of the preceding labels: a label which
+// fails the rules in the RTL domain sets IsBidiError, a valid RTL label sets
+// IsBidiDomain, and the domain with both is invalid.
+constexpr bool merge_bidi(int& bidiRes, int label_bidi) noexcept {
+    if (((bidiRes | label_bidi) & (IsBidiDomain | IsBidiError)) == (IsBidiDomain | IsBidiError))
+        return false;
+    bidiRes |= label_bidi;
+    return true;
+}
+
+// P4 - Convert/Validate the label of mapped and normalized domain; sets `error`
+// on failure and reports the failed rule to *perr, if it is not nullptr. Decoded
+// label is appended to *pdecoded (if not nullptr) encoded in UTF-8, UTF-16 or
+// UTF-32, depending on the StrT
+template <class StrT>
+UPA_IDNA_CONSTEXPR_20 void process_label(StrT* pdecoded, const char32_t* label, const char32_t* label_end, Option options,
+    int& bidiRes, bool& error, buffers& buff, error_info* perr = nullptr) {
+    if (label_end - label >= 4 && label[0] == 'x' && label[1] == 'n' && label[2] == '-' && label[3] == '-') {
+        if (*(label_end - 1) == '-' && label_end - label != 5) {
+            // > 4. Processing - 4. - 3. If (after Punycode decode) the label is empty, or if the label
+            // > contains only ASCII code points, record that there was an error.
+            // 1) "xn--" is decoded to empty label
+            // 2) "xn--ascii-" is decoded to "ascii"
+            // Note: "xn---" is ignored here, because it will fail punycode::decode
+            error = true;
+            set_error(perr, error_code::punycode_invalid);
+            // Decode "xn--ascii-" to "ascii" for to_unicode:
+            if (pdecoded && label_end - label > 5) {
+                if (std::all_of(label + 4, label_end - 1, [](char32_t ch) { return ch < 0x80; }))
+                    util::appendCodePoints(*pdecoded, label + 4, label_end - 1);
+                else
+                    util::appendCodePoints(*pdecoded, label, label_end); // contains non-ASCII - leave original label
+            }
+        } else {
+            // decode to the stack buffer; longer labels go to buff.label
+            char32_t stack_label[kLabelBufferSize];
+            const char32_t* ulabel = stack_label;
+            std::size_t ulabel_length = kLabelBufferSize;
+            auto res = punycode::detail::decode(stack_label, ulabel_length, label + 4, label_end);
+            if (res == punycode::status::big_output) {
+                buff.label.clear();
+                res = punycode::detail::decode(buff.label, label + 4, label_end);
+                ulabel = buff.label.data();
+                ulabel_length = buff.label.length();
+            }
+            if (res == punycode::status::success) {
+                error = error || !validate_label(ulabel, ulabel + ulabel_length,
+                    options & ~Option::Transitional, true, bidiRes, buff.nfc, perr);
+                if (pdecoded) util::appendCodePoints(*pdecoded, ulabel, ulabel + ulabel_length);
+            } else {
+                error = true; // punycode decode error
+                set_error(perr, res == punycode::status::bad_input
+                    ? error_code::punycode_invalid : error_code::punycode_overflow);
+                if (pdecoded) util::appendCodePoints(*pdecoded, label, label_end);
+            }
+        }
+    } else {
+        error = error || !validate_label(label, label_end, options, false, bidiRes, buff.nfc, perr);
+        if (pdecoded) util::appendCodePoints(*pdecoded, label, label_end);
+    }
+}
+
+// Decoded domain is appended to *pdecoded (if not nullptr) encoded in UTF-8, UTF-16
+// or UTF-32, depending on the StrT
+template <class StrT>
+UPA_IDNA_CONSTEXPR_20 bool processing_mapped(StrT* pdecoded, const std::u32string& mapped, Option options,
+    buffers& buff) {
+    bool error = false;
+
+    // P3 - Break
+    int bidiRes = 0;
+    bool first_label = true;
+    split(mapped.data(), mapped.data() + mapped.length(), 0x002E, [&](const char32_t* label, const char32_t* label_end) {
+        if (first_label) {
+            first_label = false;
+        } else {
+            if (pdecoded) pdecoded->push_back('.');
+        }
+        // P4 - Convert/Validate
+        process_label(pdecoded, label, label_end, options, bidiRes, error, buff);
+    });
+
+    return !error;
+}
+
+UPA_IDNA_CONSTEXPR_20 bool validate_label(const char32_t* label, const char32_t* label_end, Option options, bool full_check,
+    int& bidiRes, std::u32string& nfc_buff, error_info* perr) {
+    UPA_IDNA_STATS_SCOPE(validate_label, (label_end - label) * sizeof(char32_t));
+    if (label != label_end) {
+        // V1 - The label must be in Unicode Normalization Form NFC
+        if (full_check && !normalize::is_normalized_nfc(label, label_end, nfc_buff))
+            return set_error(perr, error_code::not_nfc);
+
+        if (has(options, Option::CheckHyphens)) {
+            // V2
+            const std::size_t label_length = label_end - label;
+            if (label_length >= 4 && label[2] == '-' && label[3] == '-')
+                return set_error(perr, error_code::hyphen_3_4, 2);
+            // V3
+            if (label[0] == '-')
+                return set_error(perr, error_code::hyphen_start_end);
+            if (*(label_end - 1) == '-')
+                return set_error(perr, error_code::hyphen_start_end, label_length - 1);
+        } else if (full_check) {
+            // V4: If not CheckHyphens, the label must not begin with “xn--”
+            // https://github.com/whatwg/url/issues/603#issuecomment-842625331
+            const std::size_t label_length = label_end - label;
+            if (label_length >= 4 && label[0] == 'x' && label[1] == 'n' && label[2] == '-' && label[3] == '-')
+                return set_error(perr, error_code::xn_prefix);
+        }
+
+        // V5 - can be ignored (todo)
+
+        // V6
+        const std::uint32_t cpflags = util::getCharInfo(label[0]); // label != label_end
+        if (cpflags & util::CAT_MARK)
+            return set_error(perr, error_code::leading_mark);
+
+        // V7
+        // TODO: if (full_check)
+        const std::uint32_t valid_mask = util::getValidMask(
+            has(options, Option::UseSTD3ASCIIRules),
+            has(options, Option::Transitional));
+        for (auto it = label; it != label_end;) {
+            const std::uint32_t cpflags = util::getCharInfo(*it++); // it != label_end
+            if ((cpflags & valid_mask) != util::CP_VALID) {
+                return set_error(perr, error_code::disallowed, it - label - 1);
+            }
+        }
+
+        // V8
+        if (has(options, Option::CheckJoiners)) {
+            // https://tools.ietf.org/html/rfc5892#appendix-A
+            for (auto it = label; it != label_end;) {
+                auto start = it;
+                const std::uint32_t cp = *it++; // it != label_end
+                if (cp == 0x200C) {
+                    // ZERO WIDTH NON-JOINER
+                    const std::size_t offset = start - label;
+                    if (start == label)
+                        return set_error(perr, error_code::joiner);
+                    std::uint32_t cpflags = util::getCharInfo(*(--start)); // label != start
+                    if (!(cpflags & util::CAT_Virama)) {
+                        // {R,D} is required on the right
+                        if (it == label_end)
+                            return set_error(perr, error_code::joiner, offset);
+                        // (Joining_Type:{L,D})(Joining_Type:T)* \u200C
+                        while (!(cpflags & (util::CAT_Joiner_L | util::CAT_Joiner_D))) {
+                            if (!(cpflags & util::CAT_Joiner_T) || start == label)
+                                return set_error(perr, error_code::joiner, offset);
+                            cpflags = util::getCharInfo(*(--start)); // label != start
+                        }
+                        // \u200C (Joining_Type:T)*(Joining_Type:{R,D})
+                        cpflags = util::getCharInfo(*it++); // it != label_end
+                        while (!(cpflags & (util::CAT_Joiner_R | util::CAT_Joiner_D))) {
+                            if (!(cpflags & util::CAT_Joiner_T) || it == label_end)
+                                return set_error(perr, error_code::joiner, offset);
+                            cpflags = util::getCharInfo(*it++); // it != label_end
+                        }
+                        // HACK: because 0x200C is Non_Joining (U); 0x200D is Join_Causing (C), i.e.
+                        // not L, D, R, T; then the cycle can be continued with `it` increased here
+                    }
+                } else if (cp == 0x200D) {
+                    //  ZERO WIDTH JOINER
+                    const std::size_t offset = start - label;
+                    if (start == label ||
+                        !(util::getCharInfo(*(--start)) & util::CAT_Virama)  // label != start
+                        ) {
+                        return set_error(perr, error_code::joiner, offset);
+                    }
+                }
+            }
+        }
+
+        // V9
+        if (has(options, Option::CheckBidi)) {
+            if (!validate_bidi(label, label_end, bidiRes, perr))
+                return false;
+        }
+    }
+    return true;
+}
+
+// Returns the first character of type R, AL, or AN, or `last` if there is none
+UPA_IDNA_CONSTEXPR_20 const char32_t* find_bidi(const char32_t* first, const char32_t* last) {
+    return std::find_if(first, last, [](char32_t cp) {
+        return (util::getCharInfo(cp) & (util::CAT_Bidi_R_AL | util::CAT_Bidi_AN)) != 0;
+    });
+}
+
+UPA_IDNA_CONSTEXPR_20 bool is_bidi(const char32_t* first, const char32_t* last) {
+    // https://tools.ietf.org/html/rfc5893#section-2
+    // A "Bidi domain name" is a domain name that contains at least one RTL
+    // label. An RTL label is a label that contains at least one character
+    // of type R, AL, or AN.
+    return find_bidi(first, last) != last;
+}
+
+// Returns the offset of the last character which is not of type NSM; the label
+// must have at least one character
+constexpr std::size_t last_non_nsm_offset(const char32_t* label, const char32_t* label_end) {
+    auto it = label_end - 1;
+    while (it != label && (util::getCharInfo(*it) & util::CAT_Bidi_NSM))
+        --it;
+    return it - label;
+}
+
+// Returns the offset of the first character which makes the label to contain both
+// EN and AN characters
+constexpr std::size_t en_an_offset(const char32_t* label, const char32_t* label_end) {
+    std::uint32_t all_cpflags = 0;
+    for (auto it = label; it != label_end; ++it) {
+        all_cpflags |= util::getCharInfo(*it);
+        if ((all_cpflags & (util::CAT_Bidi_AN | util::CAT_Bidi_EN)) == (util::CAT_Bidi_AN | util::CAT_Bidi_EN))
+            return it - label;
+    }
+    return 0;
+}
+
+UPA_IDNA_CONSTEXPR_20 bool validate_bidi(const char32_t* label, const char32_t* label_end, int& bidiRes,
+    error_info* perr) {
+    UPA_IDNA_STATS_SCOPE(validate_bidi, (label_end - label) * sizeof(char32_t));
+    // To check rules the label must have at least one character
+    if (label == label_end)
+        return true;
+
+    // if there is a bidi error, then only check domain is bidi
+    if (bidiRes & IsBidiError) {
+        // error if bidi domain
+        const auto* bidi_it = find_bidi(label, label_end);
+        if (bidi_it != label_end)
+            return set_error(perr, error_code::bidi, bidi_it - label);
+        return true;
+    }
+
+    // 1. The first character must be a character with Bidi property L, R, or AL
+    const char32_t* const label_start = label;
+    std::uint32_t cpflags = util::getCharInfo(*label++); // label != label_end
+    if (cpflags & util::CAT_Bidi_R_AL) {
+        // RTL
+        std::uint32_t end_cpflags = cpflags;
+        std::uint32_t all_cpflags = 0;
+        for (auto it = label; it != label_end;) {
+            cpflags = util::getCharInfo(*it++); // it != label_end
+            // 2. R, AL, AN, EN, ES, CS, ET, ON, BN, NSM
+            if (!(cpflags & (util::CAT_Bidi_R_AL | util::CAT_Bidi_AN | util::CAT_Bidi_EN |
+                util::CAT_Bidi_ES_CS_ET_ON_BN | util::CAT_Bidi_NSM)))
+                return set_error(perr, error_code::bidi, it - label_start - 1);
+            // 3. NSM
+            if (!(cpflags & util::CAT_Bidi_NSM))
+                end_cpflags = cpflags;
+            // 4. EN, AN
+            all_cpflags |= cpflags;
+        }
+        // 3. R, AL, AN, EN
+        if (!(end_cpflags & (util::CAT_Bidi_R_AL | util::CAT_Bidi_AN | util::CAT_Bidi_EN)))
+            return set_error(perr, error_code::bidi, last_non_nsm_offset(label_start, label_end));
+        // 4. EN, AN
+        if ((all_cpflags & (util::CAT_Bidi_AN | util::CAT_Bidi_EN)) == (util::CAT_Bidi_AN | util::CAT_Bidi_EN))
+            return set_error(perr, error_code::bidi, en_an_offset(label_start, label_end));
+        // is bidi domain
+        bidiRes |= IsBidiDomain;
+    } else if (cpflags & util::CAT_Bidi_L) {
+        // LTR
+        std::uint32_t end_cpflags = cpflags;
+        for (auto it = label; it != label_end;) {
+            cpflags = util::getCharInfo(*it++); // it != label_end
+#if 0
+            // 5. L, EN, ES, CS, ET, ON, BN, NSM
+            if (!(cpflags & (CAT_Bidi_L | CAT_Bidi_EN | CAT_Bidi_ES_CS_ET_ON_BN | CAT_Bidi_NSM))) {
+                // error if bidi domain
+                if ((bidiRes & IsBidiDomain) || (cpflags & (CAT_Bidi_R_AL | CAT_Bidi_AN)) || is_bidi(it, label_end)) {
+                    return false;
+                } else {
+                    bidiRes |= IsBidiError;
+                }
+            }
+            // 6. NSM
+            if (!(cpflags & CAT_Bidi_NSM))
+                end_cpflags = cpflags;
+#else
+            // 5. L, EN, ES, CS, ET, ON, BN, NSM; 6. NSM
+            if (cpflags & (util::CAT_Bidi_L | util::CAT_Bidi_EN | util::CAT_Bidi_ES_CS_ET_ON_BN)) {
+                end_cpflags = cpflags;
+            } else if (!(cpflags & util::CAT_Bidi_NSM)) {
+                // error if bidi domain
+                if ((bidiRes & IsBidiDomain) || (cpflags & (util::CAT_Bidi_R_AL | util::CAT_Bidi_AN))
+                    || is_bidi(it, label_end)) {
+                    return set_error(perr, error_code::bidi, it - label_start - 1);
+                }
+                bidiRes |= IsBidiError;
+            }
+#endif
+        }
+        // 6. L, EN
+        if (!(end_cpflags & (util::CAT_Bidi_L | util::CAT_Bidi_EN))) {
+            // error if bidi domain
+            if (bidiRes & IsBidiDomain) {
+                return set_error(perr, error_code::bidi, last_non_nsm_offset(label_start, label_end));
+            }
+            bidiRes |= IsBidiError;
+        }
+    } else {
+        // error if bidi domain
+        if ((bidiRes & IsBidiDomain) || (cpflags & (util::CAT_Bidi_R_AL | util::CAT_Bidi_AN))
+            || is_bidi(label, label_end)) {
+            return set_error(perr, error_code::bidi);
+        }
+        bidiRes |= IsBidiError;
+    }
+    return true;
+}
+
+// This function does not reduce the capacity of the string if it is greater
+// than new_cap, to avoid unnecessary memory reallocations in some cases.
+template <class CharT>
+UPA_IDNA_CONSTEXPR_20 void reserve(std::basic_string<CharT>& str, std::size_t new_cap) {
+#ifndef UPA_IDNA_CPP_20
+    if (str.capacity() < new_cap)
+#endif
+        str.reserve(new_cap);
+}
+
+template <class InputIt>
+UPA_IDNA_CONSTEXPR_20 void str_append(std::string& dest, InputIt first, InputIt last) {
+#ifdef _MSC_VER
+    const std::size_t input_size = std::distance(first, last);
+    if (dest.max_size() - dest.size() < input_size)
+        throw std::length_error("too big size");
+    // now it is safe to add sizes
+    reserve(dest, dest.size() + input_size);
+    for (auto it = first; it != last; ++it)
+        dest.push_back(static_cast<char>(*it));
+#else
+    dest.append(first, last);
+#endif
+}
+
+// NFC Quick Check of the mapped code points, done with the property lookups
+// of the mapping; `yes` is true if the Quick Check Algorithm result is YES, so
+// the normalization can be skipped
+struct nfc_quick_check {
+    std::uint8_t last_ccc = 0;
+    bool yes = true;
+
+    constexpr void add(const props::char_props& cp_props) noexcept {
+        if ((last_ccc > cp_props.ccc && cp_props.ccc != 0) ||
+            static_cast<normalize::qc>(cp_props.qc) != normalize::qc::yes)
+            yes = false;
+        last_ccc = cp_props.ccc;
+    }
+    constexpr void add(const char32_t* first, const char32_t* last) noexcept {
+        for (auto it = first; it != last; ++it)
+            add(props::get_char_props(*it));
+    }
+};
+
+// P1 - Map the code point; `status_mask` is the util::getStatusMask result.
+// Returns `false` if the code point is disallowed and Option::FailFast is set.
+UPA_IDNA_CONSTEXPR_20 bool map_code_point(std::uint32_t cp, Option options, std::uint32_t status_mask,
+    std::u32string& mapped, nfc_quick_check& nfc_check) {
+    // one lookup for the mapping and the NFC Quick Check
+    const auto props_index = props::get_props_index(cp);
+    const auto& cp_props = props::props_data[props_index];
+    const std::uint32_t value = cp_props.info;
+    const std::size_t mapped_len = mapped.length();
+
+    switch (value & status_mask) {
+    case util::CP_VALID:
+        mapped.push_back(cp);
+        nfc_check.add(cp_props);
+        break;
+    case util::CP_MAPPED:
+        if (has(options, Option::Transitional) && cp == 0x1E9E) {
+            // replace U+1E9E capital sharp s by “ss”
+            mapped.append(U"ss", 2);
+        } else {
+            util::apply_mapping(value, props::props_mapping[props_index], mapped);
+        }
+        nfc_check.add(mapped.data() + mapped_len, mapped.data() + mapped.length());
+        break;
+    case util::CP_DEVIATION:
+        if (has(options, Option::Transitional)) {
+            util::apply_mapping(value, props::props_mapping[props_index], mapped);
+            nfc_check.add(mapped.data() + mapped_len, mapped.data() + mapped.length());
+        } else {
+            mapped.push_back(cp);
+            nfc_check.add(cp_props);
+        }
+        break;
+    default:
+        // CP_DISALLOWED or
+        // CP_NO_STD3_VALID if Option::UseSTD3ASCIIRules
+        // Starting with Unicode 15.1.0, disallowed characters are checked after NFC
+        // normalization. However, normalization is expensive. Most disallowed characters
+        // are not normalized, so they remain after normalization. Analysis in
+        // unitool-idna.cpp shows that only three STD3 disallowed characters can be
+        // normalized: 0x3C, 0x3D, and 0x3E (see upa::idna::util::comp_disallowed_std3).
+        // So, for other disallowed characters, failure can be returned here, avoiding the
+        // normalization step.
+        if (has(options, Option::FailFast) &&
+            ((value & util::CP_DISALLOWED_STD3) == 0 || cp > 0x3E || cp < 0x3C))
+            return false;
+        mapped.push_back(cp);
+        nfc_check.add(cp_props);
+        break;
+    }
+    return true;
+}
+
+// A4 - DNS length restrictions of the label appended to the domain. `domain_len`
+// is the DNS length of the domain, minus one. The failed rule is reported to
+// *perr, if it is not nullptr.
+constexpr bool check_dns_length(Option options, std::size_t label_length, std::size_t& domain_len,
+    error_info* perr = nullptr) {
+    if (has(options, Option::VerifyDnsLength)) {
+        // A4_1
+        domain_len += (1 + label_length); // dot & label
+        // A4_2
+        if (label_length < 1 || label_length > max_label_length)
+            return set_error(perr, error_code::label_length);
+        // A4_1 early detect
+        if (domain_len > max_domain_length)
+            return set_error(perr, error_code::domain_length);
+    }
+    return true;
+}
+
+// A4 - Detects the DNS length violation before the label is validated and
+// converted. The label is converted to at least as many characters as it has
+// code points: ASCII labels are copied (A-labels are encoded back to the same
+// string), and the other labels get the "xn--" prefix and at least one Punycode
+// character per code point. `domain_len` is the DNS length of the preceding
+// labels, minus one.
+constexpr bool may_fit_dns_length(Option options, std::size_t label_cp_count, std::size_t domain_len) noexcept {
+    return !has(options, Option::VerifyDnsLength) || (
+        label_cp_count <= max_label_length &&
+        domain_len + 1 + label_cp_count <= max_domain_length);
+}
+
+// Checks the mapped label against the label length and combining marks limits
+constexpr bool within_label_limits(const char32_t* label, const char32_t* label_end, const limits& lim) {
+    if (static_cast<std::size_t>(label_end - label) > lim.max_label_length)
+        return false;
+    if (lim.max_combining_length != limits::unlimited) {
+        std::size_t marks = 0;
+        for (auto it = label; it != label_end; ++it) {
+            if ((util::getCharInfo(*it) & util::CAT_MARK) == 0)
+                marks = 0;
+            else if (++marks > lim.max_combining_length)
+                return false;
+        }
+    }
+    return true;
+}
+
+// A3, A4 - Appends the label converted to Punycode (if it has non-ASCII code
+// points) to the domain and checks DNS length restrictions. `domain_len` is the
+// DNS length of the domain, minus one. Returns `false` on error and reports the
+// failed rule to *perr, if it is not nullptr; the label is not appended if it
+// cannot be Punycode encoded.
+UPA_IDNA_CONSTEXPR_20 bool append_label(std::string& domain, const char32_t* label, const char32_t* label_end,
+    Option options, std::size_t& domain_len, buffers& buff, error_info* perr = nullptr) {
+    // A3 - to Punycode
+    const std::size_t label_start_ind = domain.length();
+    if (std::any_of(label, label_end, [](char32_t ch) { return ch >= 0x80; })) {
+        // has non-ASCII; encode to the stack buffer, longer labels go to buff.alabel
+        char stack_alabel[kLabelBufferSize];
+        std::size_t alabel_length = kLabelBufferSize;
+        auto res = punycode::detail::encode(stack_alabel, alabel_length, label, label_end);
+        const char* alabel = stack_alabel;
+        if (res == punycode::status::big_output) {
+            // A4_2 - the encoding was stopped when it exceeded the DNS label length
+            if (has(options, Option::VerifyDnsLength))
+                return set_error(perr, error_code::label_length);
+            buff.alabel.clear();
+            res = punycode::detail::encode(buff.alabel, label, label_end);
+            alabel = buff.alabel.data();
+            alabel_length = buff.alabel.length();
+        }
+        if (res == punycode::status::success) {
+            domain.push_back('x');
+            domain.push_back('n');
+            domain.push_back('-');
+            domain.push_back('-');
+            domain.append(alabel, alabel_length);
+        } else {
+            // ignore label if it cannot be punycode encoded and record an error
+            return set_error(perr, error_code::punycode_overflow);
+        }
+    } else {
+        str_append(domain, label, label_end);
+    }
+
+    // A4 - DNS length restrictions
+    return check_dns_length(options, domain.length() - label_start_ind, domain_len, perr);
+}
+
+// P1, P2 - Map and normalize to NFC the input, decoding it one code point at a
+// time. It is the portable variant of `map`, usable in constant expressions;
+// Option::InputASCII is ignored.
+template <typename CharT>
+UPA_IDNA_CONSTEXPR_20 bool map_code_points(std::u32string& mapped, const CharT* input, const CharT* input_end,
+    Option options, std::u32string& nfc_buff) {
+    const std::uint32_t status_mask = util::getStatusMask(has(options, Option::UseSTD3ASCIIRules));
+    nfc_quick_check nfc_check;
+    for (auto it = input; it != input_end; ) {
+        if (!map_code_point(util::getCodePoint(it, input_end), options, status_mask, mapped, nfc_check))
+            return false;
+    }
+    if (!nfc_check.yes)
+        normalize::normalize_nfc(mapped, nfc_buff);
+    return true;
+}
+
+// Performs ToASCII on IDNA-mapped and normalized to NFC input, see `to_ascii_mapped`
+UPA_IDNA_CONSTEXPR_20 bool mapped_to_ascii(std::string& domain, const std::u32string& mapped, Option options,
+    buffers& buff) {
+    // The processing limits
+    if (mapped.length() > buff.lim.max_mapped_length)
+        return set_limit_exceeded(buff);
+    if (buff.lim.max_label_length != limits::unlimited || buff.lim.max_combining_length != limits::unlimited) {
+        bool ok = true;
+        split(mapped.data(), mapped.data() + mapped.length(), 0x002E, [&](const char32_t* label, const char32_t* label_end) {
+            ok = ok && within_label_limits(label, label_end, buff.lim);
+        });
+        if (!ok) return set_limit_exceeded(buff);
+    }
+
+    // A4_1 - the domain is converted to at least as many characters as it has
+    // code points (see may_fit_dns_length), so the too long domain fails here
+    if (has(options, Option::VerifyDnsLength) && mapped.length() > max_domain_length)
+        return false;
+
+    // A1
+    bool ok = processing_mapped<std::u32string>(nullptr, mapped, options, buff);
+    if (!ok) return ok;
+
+    // A2 - Break the result into labels at U+002E FULL STOP
+    if (mapped.empty()) {
+        if (has(options, Option::VerifyDnsLength))
+            ok = false;
+    } else {
+        const char32_t* first = mapped.data();
+        const char32_t* last = mapped.data() + mapped.length();
+        std::size_t domain_len = static_cast<std::size_t>(-1);
+        bool first_label = true;
+        split(first, last, 0x002E, [&](const char32_t* label, const char32_t* label_end) {
+            // join
+            if (first_label) {
+                first_label = false;
+            } else {
+                domain.push_back('.');
+            }
+
+            // A3, A4
+            if (!append_label(domain, label, label_end, options, domain_len, buff))
+                ok = false;
+        });
+
+        // A4_1
+        if (has(options, Option::VerifyDnsLength) && domain_len == 0)
+            ok = false;
+    }
+
+    return ok;
+}
+
+} // namespace upa::idna::detail
+
+#endif // UPA_IDNA_IDNA_IMPL_H
@@ -0,0 +1,326 @@
+// Copyright 2017-2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_IDNA_TABLE_H
+#define UPA_IDNA_IDNA_TABLE_H
+
+#ifndef UPA_MODULE
+# include <cstddef>
+# include <cstdint>
+#endif // UPA_MODULE
+
+#include "../config.h"
+#include "props_table.h"
+
+namespace upa::idna::util {
+
+// ASCII
+const std::uint8_t AC_VALID = 0x01;
+const std::uint8_t AC_MAPPED = 0x02;
+const std::uint8_t AC_DISALLOWED_STD3 = 0x04;
+
+// Unicode
+// The code point properties are stored in 16 bits (props::char_props::info):
+// bits 0..5 are the status and flags below, bits 6..8 the Joining_Type and
+// bits 9..11 the Bidi_Class value. The mapping is in props::props_mapping.
+const std::uint32_t CP_DISALLOWED = 0;
+const std::uint32_t CP_VALID = 0x0001;
+const std::uint32_t CP_MAPPED = 0x0002;
+const std::uint32_t CP_DEVIATION = CP_VALID | CP_MAPPED; // 0x0003
+const std::uint32_t CP_DISALLOWED_STD3 = 0x0004;
+const std::uint32_t CP_NO_STD3_VALID = CP_VALID | CP_DISALLOWED_STD3;
+const std::uint32_t MAP_TO_ONE = 0x0008;
+// General_Category=Mark
+const std::uint32_t CAT_MARK = 0x0010;
+// ContextJ
+const std::uint32_t CAT_Virama = 0x0020;
+// Joining_Type values
+const std::uint32_t JT_SHIFT = 6;
+const std::uint32_t JT_D = 1 << JT_SHIFT;
+const std::uint32_t JT_L = 2 << JT_SHIFT;
+const std::uint32_t JT_R = 3 << JT_SHIFT;
+const std::uint32_t JT_T = 4 << JT_SHIFT;
+// Bidi_Class values
+const std::uint32_t BC_SHIFT = 9;
+const std::uint32_t BC_L = 1 << BC_SHIFT;
+const std::uint32_t BC_R_AL = 2 << BC_SHIFT;
+const std::uint32_t BC_AN = 3 << BC_SHIFT;
+const std::uint32_t BC_EN = 4 << BC_SHIFT;
+const std::uint32_t BC_ES_CS_ET_ON_BN = 5 << BC_SHIFT;
+const std::uint32_t BC_NSM = 6 << BC_SHIFT;
+
+// The getCharInfo flags: the Joining_Type and Bidi_Class values are expanded
+// to one bit each, so a set of them is tested with one mask
+const std::uint32_t CAT_Joiner_D = 0x0100;
+const std::uint32_t CAT_Joiner_L = 0x0200;
+const std::uint32_t CAT_Joiner_R = 0x0400;
+const std::uint32_t CAT_Joiner_T = 0x0800;
+const std::uint32_t CAT_Bidi_L    = 0x010000;
+const std::uint32_t CAT_Bidi_R_AL = 0x020000;
+const std::uint32_t CAT_Bidi_AN   = 0x040000;
+const std::uint32_t CAT_Bidi_EN   = 0x080000;
+const std::uint32_t CAT_Bidi_ES_CS_ET_ON_BN = 0x100000;
+const std::uint32_t CAT_Bidi_NSM  = 0x200000;
+
+// BEGIN-GENERATED
+inline constexpr char32_t uni_chars_to[] = {
+  0x635, 0x644, 0x649, 0x20, 0x627, 0x644, 0x644, 0x647, 0x20, 0x639, 0x644, 0x64A, 0x647, 0x20,
+  0x648, 0x633, 0x644, 0x645, 0x62C, 0x644, 0x20, 0x62C, 0x644, 0x627, 0x644, 0x647, 0x30AD, 0x30ED,
+  0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x32, 0x30A8, 0x30B9, 0x30AF,
+  0x30FC, 0x30C9, 0x30AD, 0x30ED, 0x30B0, 0x30E9, 0x30E0, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8,
+  0x30B0, 0x30E9, 0x30E0, 0x30C8, 0x30F3, 0x30AF, 0x30EB, 0x30BC, 0x30A4, 0x30ED, 0x30B5, 0x30F3,
+  0x30C1, 0x30FC, 0x30E0, 0x30D1, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x30D4, 0x30A2, 0x30B9, 0x30C8,
+  0x30EB, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C9, 0x30D6, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x30D8,
+  0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x30DF, 0x30EA, 0x30D0,
+  0x30FC, 0x30EB, 0x30EC, 0x30F3, 0x30C8, 0x30B2, 0x30F3, 0x2032, 0x2032, 0x2032, 0x2032, 0x31,
+  0x2044, 0x31, 0x30, 0x76, 0x69, 0x69, 0x69, 0x28, 0x31, 0x30, 0x29, 0x28, 0x31, 0x31, 0x29, 0x28,
+  0x31, 0x32, 0x29, 0x28, 0x31, 0x33, 0x29, 0x28, 0x31, 0x34, 0x29, 0x28, 0x31, 0x35, 0x29, 0x28,
+  0x31, 0x36, 0x29, 0x28, 0x31, 0x37, 0x29, 0x28, 0x31, 0x38, 0x29, 0x28, 0x31, 0x39, 0x29, 0x28,
+  0x32, 0x30, 0x29, 0x222B, 0x222B, 0x222B, 0x222B, 0x28, 0xC624, 0xC804, 0x29, 0x28, 0xC624,
+  0xD6C4, 0x29, 0x30A2, 0x30D1, 0x30FC, 0x30C8, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x30A2, 0x30F3,
+  0x30DA, 0x30A2, 0x30A4, 0x30CB, 0x30F3, 0x30B0, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x30AB, 0x30E9,
+  0x30C3, 0x30C8, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x30AE, 0x30EB,
+  0x30C0, 0x30FC, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x30B7, 0x30EA,
+  0x30F3, 0x30B0, 0x30D0, 0x30FC, 0x30EC, 0x30EB, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x30DD, 0x30A4,
+  0x30F3, 0x30C8, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x30E1, 0x30AC,
+  0x30C8, 0x30F3, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x30EB, 0x30FC, 0x30D6, 0x30EB, 0x682A, 0x5F0F,
+  0x4F1A, 0x793E, 0x6B, 0x63, 0x61, 0x6C, 0x6D, 0x2215, 0x73, 0x32, 0x63, 0x2215, 0x6B, 0x67, 0x627,
+  0x643, 0x628, 0x631, 0x645, 0x62D, 0x645, 0x62F, 0x635, 0x644, 0x639, 0x645, 0x631, 0x633, 0x648,
+  0x644, 0x631, 0x6CC, 0x627, 0x644, 0x31, 0x2044, 0x34, 0x31, 0x2044, 0x32, 0x33, 0x2044, 0x34,
+  0x20, 0x308, 0x301, 0xFB2, 0xF71, 0xF80, 0xFB3, 0xF71, 0xF80, 0x20, 0x308, 0x342, 0x20, 0x313,
+  0x300, 0x20, 0x313, 0x301, 0x20, 0x313, 0x342, 0x20, 0x314, 0x300, 0x20, 0x314, 0x301, 0x20,
+  0x314, 0x342, 0x20, 0x308, 0x300, 0x2035, 0x2035, 0x2035, 0x61, 0x2F, 0x63, 0x61, 0x2F, 0x73,
+  0x63, 0x2F, 0x6F, 0x63, 0x2F, 0x75, 0x74, 0x65, 0x6C, 0x66, 0x61, 0x78, 0x31, 0x2044, 0x37, 0x31,
+  0x2044, 0x39, 0x31, 0x2044, 0x33, 0x32, 0x2044, 0x33, 0x31, 0x2044, 0x35, 0x32, 0x2044, 0x35,
+  0x33, 0x2044, 0x35, 0x34, 0x2044, 0x35, 0x31, 0x2044, 0x36, 0x35, 0x2044, 0x36, 0x31, 0x2044,
+  0x38, 0x33, 0x2044, 0x38, 0x35, 0x2044, 0x38, 0x37, 0x2044, 0x38, 0x78, 0x69, 0x69, 0x30, 0x2044,
+  0x33, 0x222E, 0x222E, 0x222E, 0x28, 0x31, 0x29, 0x28, 0x32, 0x29, 0x28, 0x33, 0x29, 0x28, 0x34,
+  0x29, 0x28, 0x35, 0x29, 0x28, 0x36, 0x29, 0x28, 0x37, 0x29, 0x28, 0x38, 0x29, 0x28, 0x39, 0x29,
+  0x28, 0x61, 0x29, 0x28, 0x62, 0x29, 0x28, 0x63, 0x29, 0x28, 0x64, 0x29, 0x28, 0x65, 0x29, 0x28,
+  0x66, 0x29, 0x28, 0x67, 0x29, 0x28, 0x68, 0x29, 0x28, 0x69, 0x29, 0x28, 0x6A, 0x29, 0x28, 0x6B,
+  0x29, 0x28, 0x6C, 0x29, 0x28, 0x6D, 0x29, 0x28, 0x6E, 0x29, 0x28, 0x6F, 0x29, 0x28, 0x70, 0x29,
+  0x28, 0x71, 0x29, 0x28, 0x72, 0x29, 0x28, 0x73, 0x29, 0x28, 0x74, 0x29, 0x28, 0x75, 0x29, 0x28,
+  0x76, 0x29, 0x28, 0x77, 0x29, 0x28, 0x78, 0x29, 0x28, 0x79, 0x29, 0x28, 0x7A, 0x29, 0x3A, 0x3A,
+  0x3D, 0x3D, 0x3D, 0x3D, 0x28, 0x1100, 0x29, 0x28, 0x1102, 0x29, 0x28, 0x1103, 0x29, 0x28, 0x1105,
+  0x29, 0x28, 0x1106, 0x29, 0x28, 0x1107, 0x29, 0x28, 0x1109, 0x29, 0x28, 0x110B, 0x29, 0x28,
+  0x110C, 0x29, 0x28, 0x110E, 0x29, 0x28, 0x110F, 0x29, 0x28, 0x1110, 0x29, 0x28, 0x1111, 0x29,
+  0x28, 0x1112, 0x29, 0x28, 0xAC00, 0x29, 0x28, 0xB098, 0x29, 0x28, 0xB2E4, 0x29, 0x28, 0xB77C,
+  0x29, 0x28, 0xB9C8, 0x29, 0x28, 0xBC14, 0x29, 0x28, 0xC0AC, 0x29, 0x28, 0xC544, 0x29, 0x28,
+  0xC790, 0x29, 0x28, 0xCC28, 0x29, 0x28, 0xCE74, 0x29, 0x28, 0xD0C0, 0x29, 0x28, 0xD30C, 0x29,
+  0x28, 0xD558, 0x29, 0x28, 0xC8FC, 0x29, 0x28, 0x4E00, 0x29, 0x28, 0x4E8C, 0x29, 0x28, 0x4E09,
+  0x29, 0x28, 0x56DB, 0x29, 0x28, 0x4E94, 0x29, 0x28, 0x516D, 0x29, 0x28, 0x4E03, 0x29, 0x28,
+  0x516B, 0x29, 0x28, 0x4E5D, 0x29, 0x28, 0x5341, 0x29, 0x28, 0x6708, 0x29, 0x28, 0x706B, 0x29,
+  0x28, 0x6C34, 0x29, 0x28, 0x6728, 0x29, 0x28, 0x91D1, 0x29, 0x28, 0x571F, 0x29, 0x28, 0x65E5,
+  0x29, 0x28, 0x682A, 0x29, 0x28, 0x6709, 0x29, 0x28, 0x793E, 0x29, 0x28, 0x540D, 0x29, 0x28,
+  0x7279, 0x29, 0x28, 0x8CA1, 0x29, 0x28, 0x795D, 0x29, 0x28, 0x52B4, 0x29, 0x28, 0x4EE3, 0x29,
+  0x28, 0x547C, 0x29, 0x28, 0x5B66, 0x29, 0x28, 0x76E3, 0x29, 0x28, 0x4F01, 0x29, 0x28, 0x8CC7,
+  0x29, 0x28, 0x5354, 0x29, 0x28, 0x796D, 0x29, 0x28, 0x4F11, 0x29, 0x28, 0x81EA, 0x29, 0x28,
+  0x81F3, 0x29, 0x70, 0x74, 0x65, 0x31, 0x30, 0x6708, 0x31, 0x31, 0x6708, 0x31, 0x32, 0x6708, 0x65,
+  0x72, 0x67, 0x6C, 0x74, 0x64, 0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30F3, 0x30C1, 0x30A6, 0x30A9,
+  0x30F3, 0x30AA, 0x30F3, 0x30B9, 0x30AA, 0x30FC, 0x30E0, 0x30AB, 0x30A4, 0x30EA, 0x30AC, 0x30ED,
+  0x30F3, 0x30AC, 0x30F3, 0x30DE, 0x30AE, 0x30CB, 0x30FC, 0x30B1, 0x30FC, 0x30B9, 0x30B3, 0x30EB,
+  0x30CA, 0x30B3, 0x30FC, 0x30DD, 0x30BB, 0x30F3, 0x30C1, 0x30C0, 0x30FC, 0x30B9, 0x30CE, 0x30C3,
+  0x30C8, 0x30CF, 0x30A4, 0x30C4, 0x30D1, 0x30FC, 0x30C4, 0x30D4, 0x30AF, 0x30EB, 0x30D5, 0x30E9,
+  0x30F3, 0x30DA, 0x30CB, 0x30D2, 0x30D8, 0x30EB, 0x30C4, 0x30DA, 0x30F3, 0x30B9, 0x30DA, 0x30FC,
+  0x30B8, 0x30D9, 0x30FC, 0x30BF, 0x30DC, 0x30EB, 0x30C8, 0x30DD, 0x30F3, 0x30C9, 0x30DB, 0x30FC,
+  0x30EB, 0x30DB, 0x30FC, 0x30F3, 0x30DE, 0x30A4, 0x30EB, 0x30DE, 0x30C3, 0x30CF, 0x30DE, 0x30EB,
+  0x30AF, 0x30E4, 0x30FC, 0x30C9, 0x30E4, 0x30FC, 0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EB, 0x30D4,
+  0x30FC, 0x31, 0x30, 0x70B9, 0x31, 0x31, 0x70B9, 0x31, 0x32, 0x70B9, 0x31, 0x33, 0x70B9, 0x31,
+  0x34, 0x70B9, 0x31, 0x35, 0x70B9, 0x31, 0x36, 0x70B9, 0x31, 0x37, 0x70B9, 0x31, 0x38, 0x70B9,
+  0x31, 0x39, 0x70B9, 0x32, 0x30, 0x70B9, 0x32, 0x31, 0x70B9, 0x32, 0x32, 0x70B9, 0x32, 0x33,
+  0x70B9, 0x32, 0x34, 0x70B9, 0x68, 0x70, 0x61, 0x62, 0x61, 0x72, 0x64, 0x6D, 0x32, 0x64, 0x6D,
+  0x33, 0x6B, 0x68, 0x7A, 0x6D, 0x68, 0x7A, 0x67, 0x68, 0x7A, 0x74, 0x68, 0x7A, 0x6D, 0x6D, 0x32,
+  0x63, 0x6D, 0x32, 0x6B, 0x6D, 0x32, 0x6D, 0x6D, 0x33, 0x63, 0x6D, 0x33, 0x6B, 0x6D, 0x33, 0x6B,
+  0x70, 0x61, 0x6D, 0x70, 0x61, 0x67, 0x70, 0x61, 0x6C, 0x6F, 0x67, 0x6D, 0x69, 0x6C, 0x6D, 0x6F,
+  0x6C, 0x70, 0x70, 0x6D, 0x76, 0x2215, 0x6D, 0x61, 0x2215, 0x6D, 0x31, 0x30, 0x65E5, 0x31, 0x31,
+  0x65E5, 0x31, 0x32, 0x65E5, 0x31, 0x33, 0x65E5, 0x31, 0x34, 0x65E5, 0x31, 0x35, 0x65E5, 0x31,
+  0x36, 0x65E5, 0x31, 0x37, 0x65E5, 0x31, 0x38, 0x65E5, 0x31, 0x39, 0x65E5, 0x32, 0x30, 0x65E5,
+  0x32, 0x31, 0x65E5, 0x32, 0x32, 0x65E5, 0x32, 0x33, 0x65E5, 0x32, 0x34, 0x65E5, 0x32, 0x35,
+  0x65E5, 0x32, 0x36, 0x65E5, 0x32, 0x37, 0x65E5, 0x32, 0x38, 0x65E5, 0x32, 0x39, 0x65E5, 0x33,
+  0x30, 0x65E5, 0x33, 0x31, 0x65E5, 0x67, 0x61, 0x6C, 0x66, 0x66, 0x69, 0x66, 0x66, 0x6C, 0x5E9,
+  0x5BC, 0x5C1, 0x5E9, 0x5BC, 0x5C2, 0x20, 0x64C, 0x651, 0x20, 0x64D, 0x651, 0x20, 0x64E, 0x651,
+  0x20, 0x64F, 0x651, 0x20, 0x650, 0x651, 0x20, 0x651, 0x670, 0x640, 0x64E, 0x651, 0x640, 0x64F,
+  0x651, 0x640, 0x650, 0x651, 0x62A, 0x62C, 0x645, 0x62A, 0x62D, 0x62C, 0x62A, 0x62D, 0x645, 0x62A,
+  0x62E, 0x645, 0x62A, 0x645, 0x62C, 0x62A, 0x645, 0x62D, 0x62A, 0x645, 0x62E, 0x62C, 0x645, 0x62D,
+  0x62D, 0x645, 0x64A, 0x62D, 0x645, 0x649, 0x633, 0x62D, 0x62C, 0x633, 0x62C, 0x62D, 0x633, 0x62C,
+  0x649, 0x633, 0x645, 0x62D, 0x633, 0x645, 0x62C, 0x633, 0x645, 0x645, 0x635, 0x62D, 0x62D, 0x635,
+  0x645, 0x645, 0x634, 0x62D, 0x645, 0x634, 0x62C, 0x64A, 0x634, 0x645, 0x62E, 0x634, 0x645, 0x645,
+  0x636, 0x62D, 0x649, 0x636, 0x62E, 0x645, 0x637, 0x645, 0x62D, 0x637, 0x645, 0x645, 0x637, 0x645,
+  0x64A, 0x639, 0x62C, 0x645, 0x639, 0x645, 0x645, 0x639, 0x645, 0x649, 0x63A, 0x645, 0x645, 0x63A,
+  0x645, 0x64A, 0x63A, 0x645, 0x649, 0x641, 0x62E, 0x645, 0x642, 0x645, 0x62D, 0x642, 0x645, 0x645,
+  0x644, 0x62D, 0x645, 0x644, 0x62D, 0x64A, 0x644, 0x62D, 0x649, 0x644, 0x62C, 0x62C, 0x644, 0x62E,
+  0x645, 0x644, 0x645, 0x62D, 0x645, 0x62D, 0x62C, 0x645, 0x62D, 0x64A, 0x645, 0x62C, 0x62D, 0x645,
+  0x62C, 0x645, 0x645, 0x62E, 0x645, 0x645, 0x62C, 0x62E, 0x647, 0x645, 0x62C, 0x647, 0x645, 0x645,
+  0x646, 0x62D, 0x645, 0x646, 0x62D, 0x649, 0x646, 0x62C, 0x645, 0x646, 0x62C, 0x649, 0x646, 0x645,
+  0x64A, 0x646, 0x645, 0x649, 0x64A, 0x645, 0x645, 0x628, 0x62E, 0x64A, 0x62A, 0x62C, 0x64A, 0x62A,
+  0x62C, 0x649, 0x62A, 0x62E, 0x64A, 0x62A, 0x62E, 0x649, 0x62A, 0x645, 0x64A, 0x62A, 0x645, 0x649,
+  0x62C, 0x645, 0x64A, 0x62C, 0x62D, 0x649, 0x62C, 0x645, 0x649, 0x633, 0x62E, 0x649, 0x635, 0x62D,
+  0x64A, 0x634, 0x62D, 0x64A, 0x636, 0x62D, 0x64A, 0x644, 0x62C, 0x64A, 0x644, 0x645, 0x64A, 0x64A,
+  0x62D, 0x64A, 0x64A, 0x62C, 0x64A, 0x64A, 0x645, 0x64A, 0x645, 0x645, 0x64A, 0x642, 0x645, 0x64A,
+  0x646, 0x62D, 0x64A, 0x639, 0x645, 0x64A, 0x643, 0x645, 0x64A, 0x646, 0x62C, 0x62D, 0x645, 0x62E,
+  0x64A, 0x644, 0x62C, 0x645, 0x643, 0x645, 0x645, 0x62C, 0x62D, 0x64A, 0x62D, 0x62C, 0x64A, 0x645,
+  0x62C, 0x64A, 0x641, 0x645, 0x64A, 0x628, 0x62D, 0x64A, 0x633, 0x62E, 0x64A, 0x646, 0x62C, 0x64A,
+  0x635, 0x644, 0x6D2, 0x642, 0x644, 0x6D2, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F,
+  0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165,
+  0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x3014,
+  0x73, 0x3015, 0x70, 0x70, 0x76, 0x3014, 0x672C, 0x3015, 0x3014, 0x4E09, 0x3015, 0x3014, 0x4E8C,
+  0x3015, 0x3014, 0x5B89, 0x3015, 0x3014, 0x70B9, 0x3015, 0x3014, 0x6253, 0x3015, 0x3014, 0x76D7,
+  0x3015, 0x3014, 0x52DD, 0x3015, 0x3014, 0x6557, 0x3015, 0x20, 0x304, 0x20, 0x301, 0x20, 0x327,
+  0x73, 0x73, 0x69, 0x307, 0x69, 0x6A, 0x6C, 0xB7, 0x2BC, 0x6E, 0x64, 0x17E, 0x6C, 0x6A, 0x6E, 0x6A,
+  0x64, 0x7A, 0x20, 0x306, 0x20, 0x307, 0x20, 0x30A, 0x20, 0x328, 0x20, 0x303, 0x20, 0x30B, 0x20,
+  0x3B9, 0x565, 0x582, 0x627, 0x674, 0x648, 0x674, 0x6C7, 0x674, 0x64A, 0x674, 0x915, 0x93C, 0x916,
+  0x93C, 0x917, 0x93C, 0x91C, 0x93C, 0x921, 0x93C, 0x922, 0x93C, 0x92B, 0x93C, 0x92F, 0x93C, 0x9A1,
+  0x9BC, 0x9A2, 0x9BC, 0x9AF, 0x9BC, 0xA32, 0xA3C, 0xA38, 0xA3C, 0xA16, 0xA3C, 0xA17, 0xA3C, 0xA1C,
+  0xA3C, 0xA2B, 0xA3C, 0xB21, 0xB3C, 0xB22, 0xB3C, 0xE4D, 0xE32, 0xECD, 0xEB2, 0xEAB, 0xE99, 0xEAB,
+  0xEA1, 0xF42, 0xFB7, 0xF4C, 0xFB7, 0xF51, 0xFB7, 0xF56, 0xFB7, 0xF5B, 0xFB7, 0xF40, 0xFB5, 0xF71,
+  0xF72, 0xF71, 0xF74, 0xFB2, 0xF80, 0xFB3, 0xF80, 0xF92, 0xFB7, 0xF9C, 0xFB7, 0xFA1, 0xFB7, 0xFA6,
+  0xFB7, 0xFAB, 0xFB7, 0xF90, 0xFB5, 0x61, 0x2BE, 0x1F00, 0x3B9, 0x1F01, 0x3B9, 0x1F02, 0x3B9,
+  0x1F03, 0x3B9, 0x1F04, 0x3B9, 0x1F05, 0x3B9, 0x1F06, 0x3B9, 0x1F07, 0x3B9, 0x1F20, 0x3B9, 0x1F21,
+  0x3B9, 0x1F22, 0x3B9, 0x1F23, 0x3B9, 0x1F24, 0x3B9, 0x1F25, 0x3B9, 0x1F26, 0x3B9, 0x1F27, 0x3B9,
+  0x1F60, 0x3B9, 0x1F61, 0x3B9, 0x1F62, 0x3B9, 0x1F63, 0x3B9, 0x1F64, 0x3B9, 0x1F65, 0x3B9, 0x1F66,
+  0x3B9, 0x1F67, 0x3B9, 0x1F70, 0x3B9, 0x3B1, 0x3B9, 0x3AC, 0x3B9, 0x1FB6, 0x3B9, 0x20, 0x342,
+  0x1F74, 0x3B9, 0x3B7, 0x3B9, 0x3AE, 0x3B9, 0x1FC6, 0x3B9, 0x1F7C, 0x3B9, 0x3C9, 0x3B9, 0x3CE,
+  0x3B9, 0x1FF6, 0x3B9, 0x20, 0x333, 0x21, 0x21, 0x20, 0x305, 0x3F, 0x3F, 0x3F, 0x21, 0x21, 0x3F,
+  0x72, 0x73, 0xB0, 0x63, 0xB0, 0x66, 0x6E, 0x6F, 0x73, 0x6D, 0x74, 0x6D, 0x69, 0x76, 0x69, 0x78,
+  0x2ADD, 0x338, 0x20, 0x3099, 0x20, 0x309A, 0x3088, 0x308A, 0x30B3, 0x30C8, 0x33, 0x33, 0x33, 0x34,
+  0x33, 0x35, 0xCC38, 0xACE0, 0xC8FC, 0xC758, 0x33, 0x36, 0x33, 0x37, 0x33, 0x38, 0x33, 0x39, 0x34,
+  0x30, 0x34, 0x32, 0x34, 0x34, 0x34, 0x35, 0x34, 0x36, 0x34, 0x37, 0x34, 0x38, 0x34, 0x39, 0x35,
+  0x30, 0x33, 0x6708, 0x34, 0x6708, 0x35, 0x6708, 0x36, 0x6708, 0x37, 0x6708, 0x38, 0x6708, 0x39,
+  0x6708, 0x68, 0x67, 0x65, 0x76, 0x4EE4, 0x548C, 0x30AE, 0x30AC, 0x30C7, 0x30B7, 0x30C9, 0x30EB,
+  0x30CA, 0x30CE, 0x30D4, 0x30B3, 0x30D3, 0x30EB, 0x30DA, 0x30BD, 0x30DB, 0x30F3, 0x30EA, 0x30E9,
+  0x30EC, 0x30E0, 0x64, 0x61, 0x61, 0x75, 0x6F, 0x76, 0x70, 0x63, 0x69, 0x75, 0x5E73, 0x6210,
+  0x662D, 0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB, 0x6E, 0x61, 0x3BC, 0x61, 0x6B, 0x61, 0x6B, 0x62,
+  0x6D, 0x62, 0x67, 0x62, 0x70, 0x66, 0x6E, 0x66, 0x3BC, 0x66, 0x3BC, 0x67, 0x6D, 0x67, 0x3BC, 0x6C,
+  0x6D, 0x6C, 0x64, 0x6C, 0x6B, 0x6C, 0x66, 0x6D, 0x6E, 0x6D, 0x3BC, 0x6D, 0x70, 0x73, 0x6E, 0x73,
+  0x3BC, 0x73, 0x6D, 0x73, 0x6E, 0x76, 0x3BC, 0x76, 0x6B, 0x76, 0x70, 0x77, 0x6E, 0x77, 0x3BC, 0x77,
+  0x6D, 0x77, 0x6B, 0x77, 0x6B, 0x3C9, 0x6D, 0x3C9, 0x62, 0x71, 0x63, 0x63, 0x63, 0x64, 0x64, 0x62,
+  0x67, 0x79, 0x68, 0x61, 0x69, 0x6E, 0x6B, 0x6B, 0x6B, 0x74, 0x6C, 0x6E, 0x6C, 0x78, 0x70, 0x68,
+  0x70, 0x72, 0x73, 0x72, 0x73, 0x76, 0x77, 0x62, 0x73, 0x74, 0x574, 0x576, 0x574, 0x565, 0x574,
+  0x56B, 0x57E, 0x576, 0x574, 0x56D, 0x5D9, 0x5B4, 0x5F2, 0x5B7, 0x5E9, 0x5C1, 0x5E9, 0x5C2, 0x5D0,
+  0x5B7, 0x5D0, 0x5B8, 0x5D0, 0x5BC, 0x5D1, 0x5BC, 0x5D2, 0x5BC, 0x5D3, 0x5BC, 0x5D4, 0x5BC, 0x5D5,
+  0x5BC, 0x5D6, 0x5BC, 0x5D8, 0x5BC, 0x5D9, 0x5BC, 0x5DA, 0x5BC, 0x5DB, 0x5BC, 0x5DC, 0x5BC, 0x5DE,
+  0x5BC, 0x5E0, 0x5BC, 0x5E1, 0x5BC, 0x5E3, 0x5BC, 0x5E4, 0x5BC, 0x5E6, 0x5BC, 0x5E7, 0x5BC, 0x5E8,
+  0x5BC, 0x5EA, 0x5BC, 0x5D5, 0x5B9, 0x5D1, 0x5BF, 0x5DB, 0x5BF, 0x5E4, 0x5BF, 0x5D0, 0x5DC, 0x626,
+  0x627, 0x626, 0x6D5, 0x626, 0x648, 0x626, 0x6C7, 0x626, 0x6C6, 0x626, 0x6C8, 0x626, 0x6D0, 0x626,
+  0x649, 0x626, 0x62C, 0x626, 0x62D, 0x626, 0x645, 0x626, 0x64A, 0x628, 0x62C, 0x628, 0x645, 0x628,
+  0x649, 0x628, 0x64A, 0x62A, 0x649, 0x62A, 0x64A, 0x62B, 0x62C, 0x62B, 0x645, 0x62B, 0x649, 0x62B,
+  0x64A, 0x62E, 0x62D, 0x636, 0x62C, 0x636, 0x645, 0x637, 0x62D, 0x638, 0x645, 0x63A, 0x62C, 0x641,
+  0x62C, 0x641, 0x62D, 0x641, 0x649, 0x641, 0x64A, 0x642, 0x62D, 0x642, 0x649, 0x642, 0x64A, 0x643,
+  0x627, 0x643, 0x62C, 0x643, 0x62D, 0x643, 0x62E, 0x643, 0x644, 0x643, 0x649, 0x643, 0x64A, 0x646,
+  0x62E, 0x646, 0x649, 0x646, 0x64A, 0x647, 0x62C, 0x647, 0x649, 0x647, 0x64A, 0x64A, 0x649, 0x630,
+  0x670, 0x631, 0x670, 0x649, 0x670, 0x626, 0x631, 0x626, 0x632, 0x626, 0x646, 0x628, 0x632, 0x628,
+  0x646, 0x62A, 0x631, 0x62A, 0x632, 0x62A, 0x646, 0x62B, 0x631, 0x62B, 0x632, 0x62B, 0x646, 0x645,
+  0x627, 0x646, 0x631, 0x646, 0x632, 0x646, 0x646, 0x64A, 0x631, 0x64A, 0x632, 0x626, 0x62E, 0x626,
+  0x647, 0x628, 0x647, 0x62A, 0x647, 0x635, 0x62E, 0x646, 0x647, 0x647, 0x670, 0x62B, 0x647, 0x633,
+  0x647, 0x634, 0x647, 0x637, 0x649, 0x637, 0x64A, 0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649, 0x63A,
+  0x64A, 0x633, 0x649, 0x633, 0x64A, 0x634, 0x649, 0x634, 0x64A, 0x635, 0x649, 0x635, 0x64A, 0x636,
+  0x649, 0x636, 0x64A, 0x634, 0x62E, 0x634, 0x631, 0x633, 0x631, 0x635, 0x631, 0x636, 0x631, 0x627,
+  0x64B, 0x20, 0x64B, 0x640, 0x64B, 0x640, 0x651, 0x20, 0x652, 0x640, 0x652, 0x644, 0x622, 0x644,
+  0x623, 0x644, 0x625, 0x1D157, 0x1D165, 0x30, 0x2C, 0x31, 0x2C, 0x32, 0x2C, 0x33, 0x2C, 0x34, 0x2C,
+  0x35, 0x2C, 0x36, 0x2C, 0x37, 0x2C, 0x38, 0x2C, 0x39, 0x2C, 0x77, 0x7A, 0x68, 0x76, 0x73, 0x64,
+  0x77, 0x63, 0x6D, 0x63, 0x6D, 0x64, 0x6D, 0x72, 0x64, 0x6A, 0x307B, 0x304B, 0x30B3, 0x30B3,
+  0x242EE, 0x2284A, 0x22844, 0x233D5, 0x25249, 0x25CD0, 0x27ED3, 0x10428, 0x10429, 0x1042A, 0x1042B,
+  0x1042C, 0x1042D, 0x1042E, 0x1042F, 0x10430, 0x10431, 0x10432, 0x10433, 0x10434, 0x10435, 0x10436,
+  0x10437, 0x10438, 0x10439, 0x1043A, 0x1043B, 0x1043C, 0x1043D, 0x1043E, 0x1043F, 0x10440, 0x10441,
+  0x10442, 0x10443, 0x10444, 0x10445, 0x10446, 0x10447, 0x10448, 0x10449, 0x1044A, 0x1044B, 0x1044C,
+  0x1044D, 0x1044E, 0x1044F, 0x104D8, 0x104D9, 0x104DA, 0x104DB, 0x104DC, 0x104DD, 0x104DE, 0x104DF,
+  0x104E0, 0x104E1, 0x104E2, 0x104E3, 0x104E4, 0x104E5, 0x104E6, 0x104E7, 0x104E8, 0x104E9, 0x104EA,
+  0x104EB, 0x104EC, 0x104ED, 0x104EE, 0x104EF, 0x104F0, 0x104F1, 0x104F2, 0x104F3, 0x104F4, 0x104F5,
+  0x104F6, 0x104F7, 0x104F8, 0x104F9, 0x104FA, 0x104FB, 0x10597, 0x10598, 0x10599, 0x1059A, 0x1059B,
+  0x1059C, 0x1059D, 0x1059E, 0x1059F, 0x105A0, 0x105A1, 0x105A3, 0x105A4, 0x105A5, 0x105A6, 0x105A7,
+  0x105A8, 0x105A9, 0x105AA, 0x105AB, 0x105AC, 0x105AD, 0x105AE, 0x105AF, 0x105B0, 0x105B1, 0x105B3,
+  0x105B4, 0x105B5, 0x105B6, 0x105B7, 0x105B8, 0x105B9, 0x105BB, 0x105BC, 0x1DF04, 0x1DF05, 0x1DF06,
+  0x1DF08, 0x1DF0A, 0x1DF1E, 0x10CC0, 0x10CC1, 0x10CC2, 0x10CC3, 0x10CC4, 0x10CC5, 0x10CC6, 0x10CC7,
+  0x10CC8, 0x10CC9, 0x10CCA, 0x10CCB, 0x10CCC, 0x10CCD, 0x10CCE, 0x10CCF, 0x10CD0, 0x10CD1, 0x10CD2,
+  0x10CD3, 0x10CD4, 0x10CD5, 0x10CD6, 0x10CD7, 0x10CD8, 0x10CD9, 0x10CDA, 0x10CDB, 0x10CDC, 0x10CDD,
+  0x10CDE, 0x10CDF, 0x10CE0, 0x10CE1, 0x10CE2, 0x10CE3, 0x10CE4, 0x10CE5, 0x10CE6, 0x10CE7, 0x10CE8,
+  0x10CE9, 0x10CEA, 0x10CEB, 0x10CEC, 0x10CED, 0x10CEE, 0x10CEF, 0x10CF0, 0x10CF1, 0x10CF2, 0x10D70,
+  0x10D71, 0x10D72, 0x10D73, 0x10D74, 0x10D75, 0x10D76, 0x10D77, 0x10D78, 0x10D79, 0x10D7A, 0x10D7B,
+  0x10D7C, 0x10D7D, 0x10D7E, 0x10D7F, 0x10D80, 0x10D81, 0x10D82, 0x10D83, 0x10D84, 0x10D85, 0x118C0,
+  0x118C1, 0x118C2, 0x118C3, 0x118C4, 0x118C5, 0x118C6, 0x118C7, 0x118C8, 0x118C9, 0x118CA, 0x118CB,
+  0x118CC, 0x118CD, 0x118CE, 0x118CF, 0x118D0, 0x118D1, 0x118D2, 0x118D3, 0x118D4, 0x118D5, 0x118D6,
+  0x118D7, 0x118D8, 0x118D9, 0x118DA, 0x118DB, 0x118DC, 0x118DD, 0x118DE, 0x118DF, 0x16E60, 0x16E61,
+  0x16E62, 0x16E63, 0x16E64, 0x16E65, 0x16E66, 0x16E67, 0x16E68, 0x16E69, 0x16E6A, 0x16E6B, 0x16E6C,
+  0x16E6D, 0x16E6E, 0x16E6F, 0x16E70, 0x16E71, 0x16E72, 0x16E73, 0x16E74, 0x16E75, 0x16E76, 0x16E77,
+  0x16E78, 0x16E79, 0x16E7A, 0x16E7B, 0x16E7C, 0x16E7D, 0x16E7E, 0x16E7F, 0x16EBB, 0x16EBC, 0x16EBD,
+  0x16EBE, 0x16EBF, 0x16EC0, 0x16EC1, 0x16EC2, 0x16EC3, 0x16EC4, 0x16EC5, 0x16EC6, 0x16EC7, 0x16EC8,
+  0x16EC9, 0x16ECA, 0x16ECB, 0x16ECC, 0x16ECD, 0x16ECE, 0x16ECF, 0x16ED0, 0x16ED1, 0x16ED2, 0x16ED3,
+  0x1E922, 0x1E923, 0x1E924, 0x1E925, 0x1E926, 0x1E927, 0x1E928, 0x1E929, 0x1E92A, 0x1E92B, 0x1E92C,
+  0x1E92D, 0x1E92E, 0x1E92F, 0x1E930, 0x1E931, 0x1E932, 0x1E933, 0x1E934, 0x1E935, 0x1E936, 0x1E937,
+  0x1E938, 0x1E939, 0x1E93A, 0x1E93B, 0x1E93C, 0x1E93D, 0x1E93E, 0x1E93F, 0x1E940, 0x1E941, 0x1E942,
+  0x1E943, 0x20122, 0x2063A, 0x2051C, 0x2054B, 0x291DF, 0x20A2C, 0x20B63, 0x214E4, 0x216A8, 0x216EA,
+  0x219C8, 0x21B18, 0x21DE4, 0x21DE6, 0x22183, 0x2A392, 0x22331, 0x232B8, 0x261DA, 0x226D4, 0x22B0C,
+  0x22BF1, 0x2300A, 0x233C3, 0x2346D, 0x236A3, 0x238A7, 0x23A8D, 0x21D0B, 0x23AFA, 0x23CBC, 0x23D1E,
+  0x23ED1, 0x23F5E, 0x23F8E, 0x20525, 0x24263, 0x243AB, 0x24608, 0x24735, 0x24814, 0x24C36, 0x24C92,
+  0x2219F, 0x24FA1, 0x24FB8, 0x25044, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x2541D, 0x25626, 0x2569A,
+  0x256C5, 0x2597C, 0x25AA7, 0x25BAB, 0x25C80, 0x25F86, 0x26228, 0x26247, 0x262D9, 0x2633E, 0x264DA,
+  0x26523, 0x265A8, 0x2335F, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x26B3C, 0x26C36, 0x26D6B, 0x26CD5,
+  0x273CA, 0x26F2C, 0x26FB1, 0x270D2, 0x27667, 0x278AE, 0x27966, 0x27CA8, 0x27F2F, 0x20804, 0x208DE,
+  0x285D2, 0x285ED, 0x2872E, 0x28BFA, 0x28D77, 0x29145, 0x2921A, 0x2940A, 0x29496, 0x295B6, 0x29B30,
+  0x2A0CE, 0x2A105, 0x2A20E, 0x2A291, 0x2A600
+};
+
+inline constexpr std::uint8_t comp_disallowed_std3[3] = {
+  0x3C, 0x3D, 0x3E
+};
+
+inline constexpr std::uint8_t ascii_data[128] = {
+  0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+  0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+  0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x1, 0x1, 0x5, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+  0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x5, 0x5, 0x5, 0x5,
+  0x5, 0x5, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x5, 0x5, 0x5, 0x5, 0x5
+};
+// END-GENERATED
+
+
+constexpr std::uint32_t getStatusMask(bool useSTD3ASCIIRules) noexcept {
+    return useSTD3ASCIIRules ? 0x0007 : 0x0003;
+}
+
+constexpr std::uint32_t getValidMask(bool useSTD3ASCIIRules, bool transitional) noexcept {
+    const std::uint32_t status_mask = getStatusMask(useSTD3ASCIIRules);
+    // (CP_DEVIATION = CP_VALID | CP_MAPPED) & ~CP_MAPPED ==> CP_VALID
+    return transitional ? status_mask : (status_mask & ~CP_MAPPED);
+}
+
+// Returns the status and flags of the code point: CP_..., MAP_TO_ONE,
+// CAT_MARK, CAT_Virama, CAT_Joiner_... and CAT_Bidi_...
+constexpr std::uint32_t getCharInfo(std::uint32_t cp) {
+    const std::uint32_t info = props::get_char_props(cp).info;
+    // value 0 (no Joining_Type or Bidi_Class of interest) goes to the unused bit 7 or 15
+    return (info & 0x003F) |
+        (std::uint32_t{ 0x80 } << ((info >> JT_SHIFT) & 0x7)) |
+        (std::uint32_t{ 0x8000 } << ((info >> BC_SHIFT) & 0x7));
+}
+
+// Appends the mapping of the code point to the `output`; `info` and `mapping`
+// are the props::char_props::info and props::props_mapping values
+template <class StrT>
+UPA_IDNA_CONSTEXPR_20 std::size_t apply_mapping(std::uint32_t info, std::uint32_t mapping, StrT& output) {
+    if (info & MAP_TO_ONE) {
+        output.push_back(mapping);
+        return 1;
+    }
+    if (mapping) {
+        std::size_t len = mapping >> 13;
+        std::size_t ind = mapping & 0x1FFF;
+        if (len == 7) {
+            len += ind >> 8;
+            ind &= 0xFF;
+        }
+        // Not output.append(ptr, len): with -fsanitize=undefined GCC 12 can not
+        // evaluate its null pointer check at compile time
+        for (std::size_t i = 0; i < len; ++i)
+            output.push_back(uni_chars_to[ind + i]);
+        return len;
+    }
+    return 0;
+}
+
+} // namespace upa::idna::util
+
+#endif // UPA_IDNA_IDNA_TABLE_H
@@ -0,0 +1,279 @@
+// Copyright 2017-2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_ITERATE_UTF_H
+#define UPA_IDNA_ITERATE_UTF_H
+
+#ifndef UPA_MODULE
+# include <cstddef>
+# include <cstdint>
+# include <string>
+#endif // UPA_MODULE
+
+#include "../config.h"
+#include "ascii_simd.h"
+
+namespace upa::idna::util {
+
+// Get code point from UTF-8
+
+inline constexpr char32_t kReplacementCharacter = 0xFFFD;
+
+// https://encoding.spec.whatwg.org/#utf-8-decoder
+constexpr std::uint32_t getCodePoint(const char*& it, const char* last) noexcept {
+    const auto uchar = [](char c) { return static_cast<unsigned char>(c); };
+    // assume it != last
+    std::uint32_t c1 = uchar(*it++);
+    if (c1 >= 0x80) {
+        if (c1 < 0xC2 || c1 > 0xF4)
+            return kReplacementCharacter;
+        if (c1 <= 0xDF) {
+            // 2-bytes
+            if (it == last || uchar(*it) < 0x80 || uchar(*it) > 0xBF)
+                return kReplacementCharacter;
+            c1 = ((c1 & 0x1F) << 6) | (uchar(*it++) & 0x3F);
+        } else if (c1 <= 0xEF) {
+            // 3-bytes
+            const unsigned char clb = c1 == 0xE0 ? 0xA0 : 0x80;
+            const unsigned char cub = c1 == 0xED ? 0x9F : 0xBF;
+            if (it == last || uchar(*it) < clb || uchar(*it) > cub)
+                return kReplacementCharacter;
+            c1 = ((c1 & 0x0F) << 6) | (uchar(*it++) & 0x3F);
+            if (it == last || uchar(*it) < 0x80 || uchar(*it) > 0xBF)
+                return kReplacementCharacter;
+            c1 = (c1 << 6) | (uchar(*it++) & 0x3F);
+        } else {
+            // 4-bytes
+            const unsigned char clb = c1 == 0xF0 ? 0x90 : 0x80;
+            const unsigned char cub = c1 == 0xF4 ? 0x8F : 0xBF;
+            if (it == last || uchar(*it) < clb || uchar(*it) > cub)
+                return kReplacementCharacter;
+            c1 = ((c1 & 0x07) << 6) | (uchar(*it++) & 0x3F);
+            if (it == last || uchar(*it) < 0x80 || uchar(*it) > 0xBF)
+                return kReplacementCharacter;
+            c1 = (c1 << 6) | (uchar(*it++) & 0x3F);
+            if (it == last || uchar(*it) < 0x80 || uchar(*it) > 0xBF)
+                return kReplacementCharacter;
+            c1 = (c1 << 6) | (uchar(*it++) & 0x3F);
+        }
+    }
+    return c1;
+}
+
+// Decode UTF-8 to UTF-32 by blocks
+
+// Decodes code points from [it, last) to `output` until the end of input or until
+// `capacity` code points are stored; returns the number of stored code points.
+// Invalid sequences are decoded as in getCodePoint. Runs of ASCII characters
+// are widened ascii_block_size bytes at once.
+inline std::size_t decodeBlock(const char*& it, const char* last, char32_t* output, std::size_t capacity) noexcept {
+    char32_t* out = output;
+    char32_t* const out_end = output + capacity;
+    while (it != last && out != out_end) {
+        if (static_cast<unsigned char>(*it) < 0x80) {
+            // ASCII run
+            while (last - it >= static_cast<std::ptrdiff_t>(ascii_block_size) &&
+                out_end - out >= static_cast<std::ptrdiff_t>(ascii_block_size)) {
+                const unsigned mask = non_ascii_mask(it);
+                if (mask) {
+                    // widen the ASCII prefix of the block
+                    const auto* prefix_end = it + count_trailing_zeros(mask);
+                    while (it != prefix_end)
+                        *out++ = static_cast<unsigned char>(*it++);
+                    break;
+                }
+                ascii_widen_block(it, out);
+                it += ascii_block_size;
+                out += ascii_block_size;
+            }
+            while (it != last && out != out_end && static_cast<unsigned char>(*it) < 0x80)
+                *out++ = static_cast<unsigned char>(*it++);
+        } else {
+            *out++ = getCodePoint(it, last);
+        }
+    }
+    return out - output;
+}
+
+// Get code point from UTF-16
+
+template <class T>
+constexpr bool is_surrogate_lead(T ch) noexcept {
+    return (ch & 0xFFFFFC00) == 0xD800;
+}
+
+template <class T>
+constexpr bool is_surrogate_trail(T ch) noexcept {
+    return (ch & 0xFFFFFC00) == 0xDC00;
+}
+
+// Get a supplementary code point value(U + 10000..U + 10ffff)
+// from its lead and trail surrogates.
+constexpr std::uint32_t get_suplementary(std::uint32_t lead, std::uint32_t trail) noexcept {
+    constexpr std::uint32_t surrogate_offset = (static_cast<std::uint32_t>(0xD800) << 10) + 0xDC00 - 0x10000;
+    return (lead << 10) + trail - surrogate_offset;
+}
+
+// assumes it != last
+
+constexpr std::uint32_t getCodePoint(const char16_t*& it, const char16_t* last) noexcept {
+    // assume it != last
+    const std::uint32_t c1 = *it++;
+    if (is_surrogate_lead(c1) && it != last) {
+        const std::uint32_t c2 = *it;
+        if (is_surrogate_trail(c2)) {
+            ++it;
+            return get_suplementary(c1, c2);
+        }
+    }
+    return c1;
+}
+
+// Get code point from UTF-32
+
+constexpr std::uint32_t getCodePoint(const char32_t*& it, const char32_t*) noexcept {
+    // assume it != last
+    return *it++;
+}
+
+// Decode UTF-16 to UTF-32 by blocks
+
+// Number of UTF-16 code units checked for surrogates at once
+inline constexpr std::size_t utf16_block_size = 8;
+
+// Returns the bit mask of surrogates among utf16_block_size code units of `input`
+inline unsigned surrogate_mask(const char16_t* input) noexcept {
+#ifdef UPA_IDNA_SSE2
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+    const __m128i surrogates = _mm_cmpeq_epi16(
+        _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xF800))),
+        _mm_set1_epi16(static_cast<short>(0xD800)));
+    // keep one bit of each 16-bit lane
+    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_packs_epi16(surrogates, surrogates)));
+    return mask & 0xFF;
+#else
+    unsigned mask = 0;
+    for (std::size_t i = 0; i < utf16_block_size; ++i) {
+        if ((input[i] & 0xF800) == 0xD800)
+            mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+// Widens utf16_block_size code units to UTF-32
+inline void utf16_widen_block(const char16_t* input, char32_t* output) noexcept {
+#ifdef UPA_IDNA_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+    auto* out = reinterpret_cast<__m128i*>(output);
+    _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(v, zero));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(v, zero));
+#else
+    for (std::size_t i = 0; i < utf16_block_size; ++i)
+        output[i] = input[i];
+#endif
+}
+
+// Decodes code points from [it, last) to `output` until the end of input or until
+// `capacity` code points are stored; returns the number of stored code points.
+// Unpaired surrogates are decoded as in getCodePoint. Runs without surrogates
+// are widened utf16_block_size code units at once.
+inline std::size_t decodeBlock(const char16_t*& it, const char16_t* last, char32_t* output, std::size_t capacity) noexcept {
+    char32_t* out = output;
+    char32_t* const out_end = output + capacity;
+    while (it != last && out != out_end) {
+        while (last - it >= static_cast<std::ptrdiff_t>(utf16_block_size) &&
+            out_end - out >= static_cast<std::ptrdiff_t>(utf16_block_size)) {
+            const unsigned mask = surrogate_mask(it);
+            if (mask) {
+                // widen the prefix of the block without surrogates
+                const auto* prefix_end = it + count_trailing_zeros(mask);
+                while (it != prefix_end)
+                    *out++ = *it++;
+                break;
+            }
+            utf16_widen_block(it, out);
+            it += utf16_block_size;
+            out += utf16_block_size;
+        }
+        if (it != last && out != out_end)
+            *out++ = getCodePoint(it, last);
+    }
+    return out - output;
+}
+
+// Decode UTF-32 to UTF-32 by blocks; see decodeBlock for UTF-8
+
+template <class CharT>
+inline std::size_t decodeBlock(const CharT*& it, const CharT* last, char32_t* output, std::size_t capacity) noexcept {
+    char32_t* out = output;
+    char32_t* const out_end = output + capacity;
+    while (it != last && out != out_end)
+        *out++ = getCodePoint(it, last);
+    return out - output;
+}
+
+// Append code point as UTF-8, UTF-16 or UTF-32
+//
+// Surrogates and values above U+10FFFF are not scalar values; they are
+// appended as U+FFFD to UTF-8 and UTF-16 strings.
+
+UPA_IDNA_CONSTEXPR_20 void appendCodePoint(std::string& str, char32_t cp) {
+    if (cp < 0x80) {
+        str.push_back(static_cast<char>(cp));
+        return;
+    }
+    if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF)
+        cp = kReplacementCharacter;
+    char buff[4]; // NOLINT(cppcoreguidelines-init-variables)
+    std::size_t len = 0;
+    if (cp < 0x800) {
+        buff[len++] = static_cast<char>(0xC0 | (cp >> 6));
+    } else {
+        if (cp < 0x10000) {
+            buff[len++] = static_cast<char>(0xE0 | (cp >> 12));
+        } else {
+            buff[len++] = static_cast<char>(0xF0 | (cp >> 18));
+            buff[len++] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        }
+        buff[len++] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+    }
+    buff[len++] = static_cast<char>(0x80 | (cp & 0x3F));
+    str.append(buff, len);
+}
+
+UPA_IDNA_CONSTEXPR_20 void appendCodePoint(std::u16string& str, char32_t cp) {
+    if (cp < 0x10000) {
+        str.push_back((cp & 0xF800) == 0xD800
+            ? static_cast<char16_t>(kReplacementCharacter)
+            : static_cast<char16_t>(cp));
+    } else if (cp <= 0x10FFFF) {
+        cp -= 0x10000;
+        str.push_back(static_cast<char16_t>(0xD800 | (cp >> 10)));
+        str.push_back(static_cast<char16_t>(0xDC00 | (cp & 0x3FF)));
+    } else {
+        str.push_back(static_cast<char16_t>(kReplacementCharacter));
+    }
+}
+
+UPA_IDNA_CONSTEXPR_20 void appendCodePoint(std::u32string& str, char32_t cp) {
+    str.push_back(cp);
+}
+
+// Append UTF-32 string [first, last) to UTF-8, UTF-16 or UTF-32 string
+
+template <class StrT>
+UPA_IDNA_CONSTEXPR_20 void appendCodePoints(StrT& str, const char32_t* first, const char32_t* last) {
+    for (auto it = first; it != last; ++it)
+        appendCodePoint(str, *it);
+}
+
+UPA_IDNA_CONSTEXPR_20 void appendCodePoints(std::u32string& str, const char32_t* first, const char32_t* last) {
+    str.append(first, last);
+}
+
+} // namespace upa::idna::util
+
+#endif // UPA_IDNA_ITERATE_UTF_H
@@ -0,0 +1,264 @@
+// Copyright 2024-2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_NFC_IMPL_H
+#define UPA_IDNA_NFC_IMPL_H
+
+#include "../config.h"
+
+#ifndef UPA_MODULE
+# include <algorithm>
+# include <cstddef>
+# include <cstdint>
+# include <string>
+# include <utility> // std::move
+#endif // UPA_MODULE
+
+#include "nfc_table.h"
+#include "stats.h"
+
+// The NFC normalization algorithms; they are defined in the header, so they
+// can be evaluated at compile time in C++20 (see upa/idna/static.h)
+
+namespace upa::idna::hangul {
+    constexpr char32_t SBase = 0xAC00;
+    constexpr char32_t LBase = 0x1100;
+    constexpr char32_t VBase = 0x1161;
+    constexpr char32_t TBase = 0x11A7;
+    constexpr char32_t LCount = 19;
+    constexpr char32_t VCount = 21;
+    constexpr char32_t TCount = 28;
+    constexpr char32_t NCount = VCount * TCount; // 588
+    constexpr char32_t SCount = LCount * NCount; // 11172
+} // namespace upa::idna::hangul
+
+namespace upa::idna::normalize {
+
+UPA_IDNA_CONSTEXPR_20 void compose(std::u32string& str)
+{
+    UPA_IDNA_STATS_SCOPE(compose, str.length() * sizeof(char32_t));
+    if (str.empty())
+        return;
+    std::size_t dest = 0;
+
+    std::size_t i = 1;
+    for (; i < str.length(); ++i) {
+        auto last = str[i - 1];
+        const auto ch = str[i];
+
+        // 1. check to see if two current characters are L and V
+        if (last >= hangul::LBase && last < hangul::LBase + hangul::LCount) {
+            if (ch >= hangul::VBase && ch < hangul::VBase + hangul::VCount) {
+                const auto LIndex = last - hangul::LBase;
+                const auto VIndex = ch - hangul::VBase;
+                // make syllable of form LV
+                last = hangul::SBase + (LIndex * hangul::VCount + VIndex) * hangul::TCount;
+                ++i; // ch consumed
+                // check to see if the next character is T
+                if (i < str.length()) {
+                    const auto next_ch = str[i];
+                    if (next_ch > hangul::TBase && next_ch < hangul::TBase + hangul::TCount) {
+                        // make syllable of form LVT
+                        last += next_ch - hangul::TBase; // TIndex
+                        ++i; // next_ch consumed
+                    }
+                }
+            }
+            str[dest++] = last;
+        }
+        // 2. check to see if two current characters are LV and T
+        else if (last >= hangul::SBase && last < hangul::SBase + hangul::SCount) {
+            // SIndex = last - hangul::SBase
+            if ((last - hangul::SBase) % hangul::TCount == 0 &&
+                ch > hangul::TBase && ch < hangul::TBase + hangul::TCount) {
+                // make syllable of form LVT
+                last += ch - hangul::TBase; // TIndex
+                ++i; // ch consumed
+            }
+            str[dest++] = last;
+        }
+        else {
+            const auto L_dest = dest++;
+            auto L_info = get_composition_info(last);
+            int prev_ccc = -1;
+            for (; i < str.length(); ++i) {
+                const auto C = str[i];
+                const int C_ccc = get_ccc(C);
+                if (L_info != 0 && prev_ccc < C_ccc) {
+                    // Check <last, C> has canonically equivalent Primary Composite
+                    const auto* comp_arr = get_composition_data(L_info);
+                    const auto* comp_arr_end = comp_arr + get_composition_len(L_info);
+                    const auto* comp = std::lower_bound(comp_arr, comp_arr_end, C,
+                        [](const codepoint_key_val& a, char32_t b) { return a.key < b; });
+                    if (comp != comp_arr_end && comp->key == C) {
+                        last = comp->val;
+                        L_info = get_composition_info(last);
+                        continue;
+                    }
+                }
+
+                if (C_ccc == 0)
+                    break;
+                prev_ccc = C_ccc;
+                str[dest++] = C;
+            }
+            str[L_dest] = last;
+        }
+    }
+    if (i == str.length())
+        str[dest++] = str[i - 1];
+    str.resize(dest);
+}
+
+// Appends the canonical decomposition of [first, last) to `out` and puts the
+// appended code points into canonical order
+UPA_IDNA_CONSTEXPR_20 void canonical_decompose(const char32_t* first, const char32_t* last, std::u32string& out)
+{
+    UPA_IDNA_STATS_SCOPE(canonical_decompose, (last - first) * sizeof(char32_t));
+    const std::size_t start = out.length();
+
+    for (auto it = first; it != last; ++it) {
+        const auto cp = *it;
+        if (cp >= hangul::SBase && cp < hangul::SBase + hangul::SCount) {
+            // Hangul Decomposition Algorithm
+            const auto SIndex = cp - hangul::SBase;
+            out += static_cast<char32_t>(hangul::LBase + SIndex / hangul::NCount); // L
+            out += static_cast<char32_t>(hangul::VBase + (SIndex % hangul::NCount) / hangul::TCount); // V
+            if (SIndex % hangul::TCount != 0)
+                out += static_cast<char32_t>(hangul::TBase + SIndex % hangul::TCount); // T
+        } else {
+            const auto cp_info = get_decomposition_info(cp);
+            if (cp_info) {
+                // decompose
+                out.append(
+                    get_decomposition_chars(cp_info),
+                    get_decomposition_len(cp_info)
+                );
+            } else {
+                // no decomposition
+                out += cp;
+            }
+        }
+    }
+
+    // Canonical Ordering Algorithm
+    // Use Insertion sort:
+    // https://en.wikipedia.org/wiki/Insertion_sort
+    for (std::size_t i = start + 1; i < out.length(); ++i) {
+        const auto ccc = get_ccc(out[i]);
+
+        // is there a need to sort?
+        if (ccc != 0 && get_ccc(out[i - 1]) > ccc) {
+            // sort
+            const auto cp = out[i];
+            std::size_t j = i;
+            do {
+                out[j] = out[j - 1]; --j;
+            } while (j != start && get_ccc(out[j - 1]) > ccc);
+            out[j] = cp;
+        }
+    }
+}
+
+UPA_IDNA_CONSTEXPR_20 void canonical_decompose(std::u32string& str)
+{
+    std::u32string out;
+    canonical_decompose(str.data(), str.data() + str.length(), out);
+    str = std::move(out);
+}
+
+UPA_IDNA_CONSTEXPR_20 void canonical_decompose(std::u32string& str, std::u32string& buff)
+{
+    buff.clear();
+    canonical_decompose(str.data(), str.data() + str.length(), buff);
+    str.swap(buff);
+}
+
+// Quick Check Algorithm
+// https://unicode.org/reports/tr15/#Detecting_Normalization_Forms
+template <bool return_on_maybe>
+constexpr qc quick_check(const char32_t* first, const char32_t* last) {
+    std::uint8_t last_canonical_class = 0;
+    auto result = qc::yes;
+    for (const char32_t* it = first; it != last; ++it) {
+        // one lookup for both properties
+        const auto& props = props::get_char_props(*it);
+        const std::uint8_t canonical_class = props.ccc;
+        if (last_canonical_class > canonical_class && canonical_class != 0)
+            return qc::no;
+        const auto check = static_cast<qc>(props.qc);
+        if constexpr (return_on_maybe) {
+            if (check != qc::yes)
+                return check;
+        } else {
+            if (check == qc::no)
+                return qc::no;
+            if (check == qc::maybe)
+                result = qc::maybe;
+        }
+        last_canonical_class = canonical_class;
+    }
+    return result;
+}
+
+#ifdef UPA_IDNA_STATS
+UPA_IDNA_CONSTEXPR_20 void count_quick_check(qc check) noexcept {
+    switch (check) {
+    case qc::yes: UPA_IDNA_STATS_QUICK_CHECK(yes); break;
+    case qc::maybe: UPA_IDNA_STATS_QUICK_CHECK(maybe); break;
+    default: UPA_IDNA_STATS_QUICK_CHECK(no); break;
+    }
+}
+#else
+constexpr void count_quick_check(qc) noexcept {}
+#endif
+
+UPA_IDNA_CONSTEXPR_20 void normalize_nfc(std::u32string& str) {
+    UPA_IDNA_STATS_SCOPE(normalize_nfc, str.length() * sizeof(char32_t));
+    const auto check = quick_check<true>(str.data(), str.data() + str.size());
+    count_quick_check(check);
+    if (check != qc::yes) {
+        canonical_decompose(str);
+        compose(str);
+    }
+}
+
+UPA_IDNA_CONSTEXPR_20 void normalize_nfc(std::u32string& str, std::u32string& buff) {
+    UPA_IDNA_STATS_SCOPE(normalize_nfc, str.length() * sizeof(char32_t));
+    const auto check = quick_check<true>(str.data(), str.data() + str.size());
+    count_quick_check(check);
+    if (check != qc::yes) {
+        canonical_decompose(str, buff);
+        compose(str);
+    }
+}
+
+UPA_IDNA_CONSTEXPR_20 bool normalize_nfc_to(const char32_t* first, const char32_t* last, std::u32string& out) {
+    UPA_IDNA_STATS_SCOPE(normalize_nfc, (last - first) * sizeof(char32_t));
+    const auto check = quick_check<true>(first, last);
+    count_quick_check(check);
+    if (check == qc::yes)
+        return false;
+    out.clear();
+    canonical_decompose(first, last, out);
+    compose(out);
+    return true;
+}
+
+UPA_IDNA_CONSTEXPR_20 bool is_normalized_nfc(const char32_t* first, const char32_t* last, std::u32string& buff) {
+    UPA_IDNA_STATS_SCOPE(normalize_nfc, (last - first) * sizeof(char32_t));
+    const auto check = quick_check<false>(first, last);
+    count_quick_check(check);
+    if (check == qc::maybe) {
+        buff.clear();
+        canonical_decompose(first, last, buff);
+        compose(buff);
+        return std::equal(first, last, buff.data(), buff.data() + buff.length());
+    }
+    return check == qc::yes;
+}
+
+} // namespace upa::idna::normalize
+
+#endif // UPA_IDNA_NFC_IMPL_H
@@ -0,0 +1,4175 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_PROPS_TABLE_H
+#define UPA_IDNA_PROPS_TABLE_H
+
+#ifndef UPA_MODULE
+# include <cstddef>
+# include <cstdint>
+#endif // UPA_MODULE
+
+namespace upa::idna::props {
+
+// The IDNA and NFC properties of the code point, so one lookup serves both
+// the mapping and the normalization. The table is made by unitool-props from
+// the properties output by unitool-idna and unitool-nfc, and is copied here by
+// unitool/update-tables.sh. By default it has the two-level layout with the
+// fast lookup; if UPA_IDNA_SMALL_TABLES is defined, the smaller three-level
+// layout is used. The code points below props_hot_end are looked up in the
+// direct table. The tables are defined in this header, so the lookups can be
+// evaluated at compile time.
+//
+// The IDNA mapping is not needed for most code points, so it is kept in the
+// props_mapping table of the same index as props_data.
+struct char_props {
+    std::uint16_t info;   // util::getCharInfo
+    std::uint16_t comp;   // normalize::get_composition_info
+    std::uint16_t decomp; // normalize::get_decomposition_info
+    std::uint8_t ccc;     // normalize::get_ccc
+    std::uint8_t qc;      // normalize::get_quick_check
+};
+
+
+// BEGIN-GENERATED
+const std::uint32_t props_default_start = 0x3347A;
+const std::uint16_t props_default_index = 0;
+const std::uint32_t props_spec_range1 = 0xE0100;
+const std::uint32_t props_spec_range2 = 0xE01EF;
+const std::uint16_t props_spec_index = 63;
+
+inline constexpr char_props props_data[] = {
+  { 0, 0, 0, 0, 0 }, { 0xA05, 0, 0, 0, 0 }, { 0x5, 0, 0, 0, 0 }, { 0xA01, 0, 0, 0, 0 },
+  { 0x801, 0, 0, 0, 0 }, { 0xA05, 0x800, 0, 0, 0 }, { 0xA05, 0x801, 0, 0, 0 },
+  { 0xA05, 0x802, 0, 0, 0 }, { 0xA, 0x8003, 0, 0, 0 }, { 0xA, 0x1813, 0, 0, 0 },
+  { 0xA, 0x2816, 0, 0, 0 }, { 0xA, 0x301B, 0, 0, 0 }, { 0xA, 0x8821, 0, 0, 0 },
+  { 0xA, 0x832, 0, 0, 0 }, { 0xA, 0x3833, 0, 0, 0 }, { 0xA, 0x383A, 0, 0, 0 },
+  { 0xA, 0x7841, 0, 0, 0 }, { 0xA, 0x850, 0, 0, 0 }, { 0xA, 0x2851, 0, 0, 0 },
+  { 0xA, 0x3056, 0, 0, 0 }, { 0xA, 0x185C, 0, 0, 0 }, { 0xA, 0x485F, 0, 0, 0 },
+  { 0xA, 0x8068, 0, 0, 0 }, { 0xA, 0x1078, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x407A, 0, 0, 0 },
+  { 0xA, 0x3882, 0, 0, 0 }, { 0xA, 0x3889, 0, 0, 0 }, { 0xA, 0x9890, 0, 0, 0 },
+  { 0xA, 0x10A3, 0, 0, 0 }, { 0xA, 0x30A5, 0, 0, 0 }, { 0xA, 0x10AB, 0, 0, 0 },
+  { 0xA, 0x48AD, 0, 0, 0 }, { 0xA, 0x30B6, 0, 0, 0 }, { 0x201, 0x80BC, 0, 0, 0 },
+  { 0x201, 0x18CC, 0, 0, 0 }, { 0x201, 0x28CF, 0, 0, 0 }, { 0x201, 0x30D4, 0, 0, 0 },
+  { 0x201, 0x88DA, 0, 0, 0 }, { 0x201, 0x8EB, 0, 0, 0 }, { 0x201, 0x38EC, 0, 0, 0 },
+  { 0x201, 0x40F3, 0, 0, 0 }, { 0x201, 0x70FB, 0, 0, 0 }, { 0x201, 0x1109, 0, 0, 0 },
+  { 0x201, 0x290B, 0, 0, 0 }, { 0x201, 0x3110, 0, 0, 0 }, { 0x201, 0x1916, 0, 0, 0 },
+  { 0x201, 0x4919, 0, 0, 0 }, { 0x201, 0x8122, 0, 0, 0 }, { 0x201, 0x1132, 0, 0, 0 },
+  { 0x201, 0, 0, 0, 0 }, { 0x201, 0x4134, 0, 0, 0 }, { 0x201, 0x393C, 0, 0, 0 },
+  { 0x201, 0x4143, 0, 0, 0 }, { 0x201, 0x994B, 0, 0, 0 }, { 0x201, 0x115E, 0, 0, 0 },
+  { 0x201, 0x3960, 0, 0, 0 }, { 0x201, 0x1167, 0, 0, 0 }, { 0x201, 0x5169, 0, 0, 0 },
+  { 0x201, 0x3173, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0x1979, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0xA, 0, 0x2000, 0, 0 }, { 0xA, 0, 0x2002, 0, 0 }, { 0xA, 0x217C, 0x2004, 0, 0 },
+  { 0xA, 0, 0x2006, 0, 0 }, { 0xA, 0x980, 0x2008, 0, 0 }, { 0xA, 0x981, 0x200A, 0, 0 },
+  { 0xA, 0x1182, 0, 0, 0 }, { 0xA, 0x984, 0x200C, 0, 0 }, { 0xA, 0, 0x200E, 0, 0 },
+  { 0xA, 0, 0x2010, 0, 0 }, { 0xA, 0x2185, 0x2012, 0, 0 }, { 0xA, 0, 0x2014, 0, 0 },
+  { 0xA, 0, 0x2016, 0, 0 }, { 0xA, 0, 0x2018, 0, 0 }, { 0xA, 0, 0x201A, 0, 0 },
+  { 0xA, 0x989, 0x201C, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x201E, 0, 0 },
+  { 0xA, 0, 0x2020, 0, 0 }, { 0xA, 0, 0x2022, 0, 0 }, { 0xA, 0x218A, 0x2024, 0, 0 },
+  { 0xA, 0x198E, 0x2026, 0, 0 }, { 0xA, 0x991, 0x2028, 0, 0 }, { 0xA, 0x992, 0, 0, 0 },
+  { 0xA, 0, 0x202A, 0, 0 }, { 0xA, 0, 0x202C, 0, 0 }, { 0xA, 0, 0x202E, 0, 0 },
+  { 0xA, 0x2193, 0x2030, 0, 0 }, { 0xA, 0, 0x2032, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x203, 0, 0, 0, 0 }, { 0x201, 0, 0x2034, 0, 0 }, { 0x201, 0, 0x2036, 0, 0 },
+  { 0x201, 0x2197, 0x2038, 0, 0 }, { 0x201, 0, 0x203A, 0, 0 }, { 0x201, 0x99B, 0x203C, 0, 0 },
+  { 0x201, 0x99C, 0x203E, 0, 0 }, { 0x201, 0x119D, 0, 0, 0 }, { 0x201, 0x99F, 0x2040, 0, 0 },
+  { 0x201, 0, 0x2042, 0, 0 }, { 0x201, 0, 0x2044, 0, 0 }, { 0x201, 0x21A0, 0x2046, 0, 0 },
+  { 0x201, 0, 0x2048, 0, 0 }, { 0x201, 0, 0x204A, 0, 0 }, { 0x201, 0, 0x204C, 0, 0 },
+  { 0x201, 0, 0x204E, 0, 0 }, { 0x201, 0x9A4, 0x2050, 0, 0 }, { 0x201, 0, 0x2052, 0, 0 },
+  { 0x201, 0, 0x2054, 0, 0 }, { 0x201, 0, 0x2056, 0, 0 }, { 0x201, 0x21A5, 0x2058, 0, 0 },
+  { 0x201, 0x19A9, 0x205A, 0, 0 }, { 0x201, 0x9AC, 0x205C, 0, 0 }, { 0x201, 0x9AD, 0, 0, 0 },
+  { 0x201, 0, 0x205E, 0, 0 }, { 0x201, 0, 0x2060, 0, 0 }, { 0x201, 0, 0x2062, 0, 0 },
+  { 0x201, 0x21AE, 0x2064, 0, 0 }, { 0x201, 0, 0x2066, 0, 0 }, { 0x201, 0, 0x2068, 0, 0 },
+  { 0xA, 0, 0x206A, 0, 0 }, { 0x201, 0, 0x206C, 0, 0 }, { 0xA, 0x21B2, 0x206E, 0, 0 },
+  { 0x201, 0x21B6, 0x2070, 0, 0 }, { 0xA, 0, 0x2072, 0, 0 }, { 0x201, 0, 0x2074, 0, 0 },
+  { 0xA, 0, 0x2076, 0, 0 }, { 0x201, 0, 0x2078, 0, 0 }, { 0xA, 0, 0x207A, 0, 0 },
+  { 0x201, 0, 0x207C, 0, 0 }, { 0xA, 0, 0x207E, 0, 0 }, { 0x201, 0, 0x2080, 0, 0 },
+  { 0xA, 0, 0x2082, 0, 0 }, { 0x201, 0, 0x2084, 0, 0 }, { 0xA, 0, 0x2086, 0, 0 },
+  { 0x201, 0, 0x2088, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x11BA, 0x208A, 0, 0 },
+  { 0x201, 0x11BC, 0x208C, 0, 0 }, { 0xA, 0, 0x208E, 0, 0 }, { 0x201, 0, 0x2090, 0, 0 },
+  { 0xA, 0, 0x2092, 0, 0 }, { 0x201, 0, 0x2094, 0, 0 }, { 0xA, 0, 0x2096, 0, 0 },
+  { 0x201, 0, 0x2098, 0, 0 }, { 0xA, 0, 0x209A, 0, 0 }, { 0x201, 0, 0x209C, 0, 0 },
+  { 0xA, 0, 0x209E, 0, 0 }, { 0x201, 0, 0x20A0, 0, 0 }, { 0xA, 0, 0x20A2, 0, 0 },
+  { 0x201, 0, 0x20A4, 0, 0 }, { 0xA, 0, 0x20A6, 0, 0 }, { 0x201, 0, 0x20A8, 0, 0 },
+  { 0xA, 0, 0x20AA, 0, 0 }, { 0x201, 0, 0x20AC, 0, 0 }, { 0xA, 0, 0x20AE, 0, 0 },
+  { 0x201, 0, 0x20B0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x20B2, 0, 0 },
+  { 0x201, 0, 0x20B4, 0, 0 }, { 0xA, 0, 0x20B6, 0, 0 }, { 0x201, 0, 0x20B8, 0, 0 },
+  { 0xA, 0, 0x20BA, 0, 0 }, { 0x201, 0, 0x20BC, 0, 0 }, { 0xA, 0, 0x20BE, 0, 0 },
+  { 0x201, 0, 0x20C0, 0, 0 }, { 0x2, 0, 0x20C2, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0xA, 0, 0x20C4, 0, 0 }, { 0x201, 0, 0x20C6, 0, 0 }, { 0xA, 0, 0x20C8, 0, 0 },
+  { 0x201, 0, 0x20CA, 0, 0 }, { 0xA, 0, 0x20CC, 0, 0 }, { 0x201, 0, 0x20CE, 0, 0 },
+  { 0xA, 0, 0x20D0, 0, 0 }, { 0x201, 0, 0x20D2, 0, 0 }, { 0xA, 0, 0x20D4, 0, 0 },
+  { 0x201, 0, 0x20D6, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x20D8, 0, 0 },
+  { 0x201, 0, 0x20DA, 0, 0 }, { 0xA, 0, 0x20DC, 0, 0 }, { 0x201, 0, 0x20DE, 0, 0 },
+  { 0xA, 0, 0x20E0, 0, 0 }, { 0x201, 0, 0x20E2, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0x11BE, 0x20E4, 0, 0 }, { 0x201, 0x11C0, 0x20E6, 0, 0 }, { 0xA, 0, 0x20E8, 0, 0 },
+  { 0x201, 0, 0x20EA, 0, 0 }, { 0xA, 0, 0x20EC, 0, 0 }, { 0x201, 0, 0x20EE, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x20F0, 0, 0 }, { 0x201, 0, 0x20F2, 0, 0 },
+  { 0xA, 0, 0x20F4, 0, 0 }, { 0x201, 0, 0x20F6, 0, 0 }, { 0xA, 0, 0x20F8, 0, 0 },
+  { 0x201, 0, 0x20FA, 0, 0 }, { 0xA, 0x9C2, 0x20FC, 0, 0 }, { 0x201, 0x9C3, 0x20FE, 0, 0 },
+  { 0xA, 0, 0x2100, 0, 0 }, { 0x201, 0, 0x2102, 0, 0 }, { 0xA, 0, 0x2104, 0, 0 },
+  { 0x201, 0, 0x2106, 0, 0 }, { 0xA, 0x9C4, 0x2108, 0, 0 }, { 0x201, 0x9C5, 0x210A, 0, 0 },
+  { 0xA, 0, 0x210C, 0, 0 }, { 0x201, 0, 0x210E, 0, 0 }, { 0xA, 0, 0x2110, 0, 0 },
+  { 0x201, 0, 0x2112, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x9C6, 0x2114, 0, 0 },
+  { 0x201, 0x9C7, 0x2116, 0, 0 }, { 0xA, 0x9C8, 0x2118, 0, 0 }, { 0x201, 0x9C9, 0x211A, 0, 0 },
+  { 0xA, 0, 0x211C, 0, 0 }, { 0x201, 0, 0x211E, 0, 0 }, { 0xA, 0, 0x2120, 0, 0 },
+  { 0x201, 0, 0x2122, 0, 0 }, { 0xA, 0, 0x2124, 0, 0 }, { 0x201, 0, 0x2126, 0, 0 },
+  { 0xA, 0, 0x2128, 0, 0 }, { 0x201, 0, 0x212A, 0, 0 }, { 0xA, 0, 0x212C, 0, 0 },
+  { 0x201, 0, 0x212E, 0, 0 }, { 0xA, 0, 0x2130, 0, 0 }, { 0x201, 0, 0x2132, 0, 0 },
+  { 0xA, 0, 0x2134, 0, 0 }, { 0xA, 0, 0x2136, 0, 0 }, { 0x201, 0, 0x2138, 0, 0 },
+  { 0xA, 0, 0x213A, 0, 0 }, { 0x201, 0, 0x213C, 0, 0 }, { 0xA, 0, 0x213E, 0, 0 },
+  { 0x201, 0, 0x2140, 0, 0 }, { 0xA, 0x9CA, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x29CB, 0x2142, 0, 0 },
+  { 0x201, 0x29D0, 0x2144, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0x29D5, 0x2146, 0, 0 }, { 0x201, 0x29DA, 0x2148, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x9DF, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0x214A, 0, 0 }, { 0x201, 0, 0x214C, 0, 0 },
+  { 0xA, 0, 0x214E, 0, 0 }, { 0x201, 0, 0x2150, 0, 0 }, { 0xA, 0, 0x2152, 0, 0 },
+  { 0x201, 0, 0x2154, 0, 0 }, { 0xA, 0, 0x2156, 0, 0 }, { 0x201, 0, 0x2158, 0, 0 },
+  { 0xA, 0, 0x315A, 0, 0 }, { 0x201, 0, 0x315D, 0, 0 }, { 0xA, 0, 0x3160, 0, 0 },
+  { 0x201, 0, 0x3163, 0, 0 }, { 0xA, 0, 0x3166, 0, 0 }, { 0x201, 0, 0x3169, 0, 0 },
+  { 0xA, 0, 0x316C, 0, 0 }, { 0x201, 0, 0x316F, 0, 0 }, { 0xA, 0, 0x3172, 0, 0 },
+  { 0x201, 0, 0x3175, 0, 0 }, { 0xA, 0, 0x3178, 0, 0 }, { 0x201, 0, 0x317B, 0, 0 },
+  { 0xA, 0, 0x217E, 0, 0 }, { 0x201, 0, 0x2180, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0x2182, 0, 0 }, { 0x201, 0, 0x2184, 0, 0 }, { 0xA, 0, 0x2186, 0, 0 },
+  { 0x201, 0, 0x2188, 0, 0 }, { 0xA, 0x9E0, 0x218A, 0, 0 }, { 0x201, 0x9E1, 0x218C, 0, 0 },
+  { 0xA, 0, 0x318E, 0, 0 }, { 0x201, 0, 0x3191, 0, 0 }, { 0xA, 0, 0x2194, 0, 0 },
+  { 0x201, 0, 0x2196, 0, 0 }, { 0x201, 0, 0x2198, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0xA, 0, 0x219A, 0, 0 }, { 0x201, 0, 0x219C, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0x219E, 0, 0 }, { 0x201, 0, 0x21A0, 0, 0 }, { 0xA, 0, 0x31A2, 0, 0 },
+  { 0x201, 0, 0x31A5, 0, 0 }, { 0xA, 0, 0x21A8, 0, 0 }, { 0x201, 0, 0x21AA, 0, 0 },
+  { 0xA, 0, 0x21AC, 0, 0 }, { 0x201, 0, 0x21AE, 0, 0 }, { 0xA, 0, 0x21B0, 0, 0 },
+  { 0x201, 0, 0x21B2, 0, 0 }, { 0xA, 0, 0x21B4, 0, 0 }, { 0x201, 0, 0x21B6, 0, 0 },
+  { 0xA, 0, 0x21B8, 0, 0 }, { 0x201, 0, 0x21BA, 0, 0 }, { 0xA, 0, 0x21BC, 0, 0 },
+  { 0x201, 0, 0x21BE, 0, 0 }, { 0xA, 0, 0x21C0, 0, 0 }, { 0x201, 0, 0x21C2, 0, 0 },
+  { 0xA, 0, 0x21C4, 0, 0 }, { 0x201, 0, 0x21C6, 0, 0 }, { 0xA, 0, 0x21C8, 0, 0 },
+  { 0x201, 0, 0x21CA, 0, 0 }, { 0xA, 0, 0x21CC, 0, 0 }, { 0x201, 0, 0x21CE, 0, 0 },
+  { 0xA, 0, 0x21D0, 0, 0 }, { 0x201, 0, 0x21D2, 0, 0 }, { 0xA, 0, 0x21D4, 0, 0 },
+  { 0x201, 0, 0x21D6, 0, 0 }, { 0xA, 0, 0x21D8, 0, 0 }, { 0x201, 0, 0x21DA, 0, 0 },
+  { 0xA, 0, 0x21DC, 0, 0 }, { 0x201, 0, 0x21DE, 0, 0 }, { 0xA, 0, 0x21E0, 0, 0 },
+  { 0x201, 0, 0x21E2, 0, 0 }, { 0xA, 0, 0x21E4, 0, 0 }, { 0x201, 0, 0x21E6, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x21E8, 0, 0 }, { 0x201, 0, 0x21EA, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x9E2, 0x2178, 0, 0 },
+  { 0x201, 0x9E3, 0x217B, 0, 0 }, { 0xA, 0x9E4, 0x21EC, 0, 0 }, { 0x201, 0x9E5, 0x21EE, 0, 0 },
+  { 0xA, 0, 0x31F0, 0, 0 }, { 0x201, 0, 0x31F3, 0, 0 }, { 0xA, 0, 0x31F6, 0, 0 },
+  { 0x201, 0, 0x31F9, 0, 0 }, { 0xA, 0x9E6, 0x21FC, 0, 0 }, { 0x201, 0x9E7, 0x21FE, 0, 0 },
+  { 0xA, 0, 0x3200, 0, 0 }, { 0x201, 0, 0x3203, 0, 0 }, { 0xA, 0, 0x2206, 0, 0 },
+  { 0x201, 0, 0x2208, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x201, 0x9E8, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xD11, 0, 0, 230, 2 }, { 0xD11, 0, 0, 230, 0 },
+  { 0xD11, 0, 0, 232, 0 }, { 0xD11, 0, 0, 220, 0 }, { 0xD11, 0, 0, 216, 2 },
+  { 0xD11, 0, 0, 202, 0 }, { 0xD11, 0, 0, 220, 2 }, { 0xD11, 0, 0, 202, 2 }, { 0xD11, 0, 0, 1, 0 },
+  { 0xD11, 0, 0, 1, 2 }, { 0xA, 0, 0x1001, 230, 1 }, { 0xA, 0, 0x1003, 230, 1 },
+  { 0xA, 0, 0x120A, 230, 1 }, { 0x2, 0, 0x2161, 230, 1 }, { 0xA, 0, 0, 240, 2 },
+  { 0xD11, 0, 0, 233, 0 }, { 0xD11, 0, 0, 234, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0x120B, 0, 1 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0x120C, 0, 1 },
+  { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0x220D, 0, 0 }, { 0xA, 0, 0x220F, 0, 0 }, { 0xA, 0, 0x1211, 0, 1 },
+  { 0xA, 0, 0x2212, 0, 0 }, { 0xA, 0, 0x2214, 0, 0 }, { 0xA, 0, 0x2216, 0, 0 },
+  { 0xA, 0, 0x2218, 0, 0 }, { 0xA, 0, 0x221A, 0, 0 }, { 0xA, 0, 0x221C, 0, 0 },
+  { 0x201, 0, 0x321E, 0, 0 }, { 0xA, 0x39E9, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0x21F0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x29F4, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0x39F9, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x2200, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0xA04, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x3205, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x2A0B, 0, 0, 0 },
+  { 0xA, 0, 0x2221, 0, 0 }, { 0xA, 0, 0x2223, 0, 0 }, { 0x201, 0xA10, 0x2225, 0, 0 },
+  { 0x201, 0, 0x2227, 0, 0 }, { 0x201, 0xA11, 0x2229, 0, 0 }, { 0x201, 0, 0x222B, 0, 0 },
+  { 0x201, 0, 0x322D, 0, 0 }, { 0x201, 0x4212, 0, 0, 0 }, { 0x201, 0x221A, 0, 0, 0 },
+  { 0x201, 0x321E, 0, 0, 0 }, { 0x201, 0x4224, 0, 0, 0 }, { 0x201, 0x222C, 0, 0, 0 },
+  { 0x201, 0x1230, 0, 0, 0 }, { 0x20B, 0, 0, 0, 0 }, { 0x201, 0x4232, 0, 0, 0 },
+  { 0x201, 0x323A, 0, 0, 0 }, { 0x201, 0x1A40, 0x221E, 0, 0 }, { 0x201, 0x1A43, 0x222D, 0, 0 },
+  { 0x201, 0, 0x2230, 0, 0 }, { 0x201, 0, 0x2232, 0, 0 }, { 0x201, 0xA46, 0x2234, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0x1247, 0, 0, 0 }, { 0xA, 0, 0x2236, 0, 0 }, { 0xA, 0, 0x2238, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x223A, 0, 0 },
+  { 0xA, 0, 0x223C, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x223E, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0xA49, 0, 0, 0 }, { 0xA, 0, 0x2240, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x2242, 0, 0 },
+  { 0xA, 0, 0x2244, 0, 0 }, { 0xA, 0, 0x2246, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x124A, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0xA4C, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0x1A4D, 0, 0, 0 }, { 0xA, 0x1250, 0, 0, 0 }, { 0xA, 0xA52, 0, 0, 0 },
+  { 0xA, 0x2253, 0, 0, 0 }, { 0xA, 0, 0x2248, 0, 0 }, { 0xA, 0xA57, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0xA58, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0x2259, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0xA5D, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0xA5E, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0xA5F, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x201, 0x1260, 0, 0, 0 }, { 0x201, 0xA62, 0, 0, 0 }, { 0x201, 0x1A63, 0, 0, 0 },
+  { 0x201, 0x1266, 0, 0, 0 }, { 0x201, 0xA68, 0, 0, 0 }, { 0x201, 0x2269, 0, 0, 0 },
+  { 0x201, 0, 0x224A, 0, 0 }, { 0x201, 0xA6D, 0, 0, 0 }, { 0x201, 0xA6E, 0, 0, 0 },
+  { 0x201, 0x226F, 0, 0, 0 }, { 0x201, 0xA73, 0, 0, 0 }, { 0x201, 0xA74, 0, 0, 0 },
+  { 0x201, 0xA75, 0, 0, 0 }, { 0x201, 0, 0x224C, 0, 0 }, { 0x201, 0, 0x224E, 0, 0 },
+  { 0x201, 0, 0x2250, 0, 0 }, { 0x201, 0xA76, 0, 0, 0 }, { 0x201, 0, 0x2252, 0, 0 },
+  { 0x201, 0, 0x2254, 0, 0 }, { 0x201, 0, 0x2256, 0, 0 }, { 0x201, 0, 0x2258, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0xA77, 0, 0, 0 }, { 0x201, 0xA78, 0, 0, 0 },
+  { 0xA, 0, 0x225A, 0, 0 }, { 0x201, 0, 0x225C, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xD11, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0x225E, 0, 0 }, { 0x201, 0, 0x2260, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0x2262, 0, 0 }, { 0x201, 0, 0x2264, 0, 0 }, { 0xA, 0, 0x2266, 0, 0 },
+  { 0x201, 0, 0x2268, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x226A, 0, 0 },
+  { 0x201, 0, 0x226C, 0, 0 }, { 0xA, 0xA79, 0, 0, 0 }, { 0x201, 0xA7A, 0, 0, 0 },
+  { 0xA, 0, 0x226E, 0, 0 }, { 0x201, 0, 0x2270, 0, 0 }, { 0xA, 0, 0x2272, 0, 0 },
+  { 0x201, 0, 0x2274, 0, 0 }, { 0xA, 0, 0x2276, 0, 0 }, { 0x201, 0, 0x2278, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x227A, 0, 0 }, { 0x201, 0, 0x227C, 0, 0 },
+  { 0xA, 0, 0x227E, 0, 0 }, { 0x201, 0, 0x2280, 0, 0 }, { 0xA, 0, 0x2282, 0, 0 },
+  { 0x201, 0, 0x2284, 0, 0 }, { 0xA, 0xA7B, 0, 0, 0 }, { 0x201, 0xA7C, 0, 0, 0 },
+  { 0xA, 0, 0x2286, 0, 0 }, { 0x201, 0, 0x2288, 0, 0 }, { 0xA, 0, 0x228A, 0, 0 },
+  { 0x201, 0, 0x228C, 0, 0 }, { 0xA, 0, 0x228E, 0, 0 }, { 0x201, 0, 0x2290, 0, 0 },
+  { 0xA, 0, 0x2292, 0, 0 }, { 0x201, 0, 0x2294, 0, 0 }, { 0xA, 0, 0x2296, 0, 0 },
+  { 0x201, 0, 0x2298, 0, 0 }, { 0xA, 0, 0x229A, 0, 0 }, { 0x201, 0, 0x229C, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x229E, 0, 0 }, { 0x201, 0, 0x22A0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0xD11, 0, 0, 222, 0 }, { 0xD11, 0, 0, 228, 0 }, { 0xD11, 0, 0, 10, 0 },
+  { 0xD11, 0, 0, 11, 0 }, { 0xD11, 0, 0, 12, 0 }, { 0xD11, 0, 0, 13, 0 }, { 0xD11, 0, 0, 14, 0 },
+  { 0xD11, 0, 0, 15, 0 }, { 0xD11, 0, 0, 16, 0 }, { 0xD11, 0, 0, 17, 0 }, { 0xD11, 0, 0, 18, 0 },
+  { 0xD11, 0, 0, 19, 0 }, { 0xD11, 0, 0, 20, 0 }, { 0xD11, 0, 0, 21, 0 }, { 0xD11, 0, 0, 22, 0 },
+  { 0x401, 0, 0, 0, 0 }, { 0xD11, 0, 0, 23, 0 }, { 0xD11, 0, 0, 24, 0 }, { 0xD11, 0, 0, 25, 0 },
+  { 0xD11, 0, 0, 30, 0 }, { 0xD11, 0, 0, 31, 0 }, { 0xD11, 0, 0, 32, 0 }, { 0x441, 0, 0, 0, 0 },
+  { 0x4C1, 0, 0x22A2, 0, 0 }, { 0x4C1, 0, 0x22A4, 0, 0 }, { 0x4C1, 0, 0x22A6, 0, 0 },
+  { 0x4C1, 0, 0x22A8, 0, 0 }, { 0x441, 0, 0x22AA, 0, 0 }, { 0x4C1, 0x1A7D, 0, 0, 0 },
+  { 0x4C1, 0, 0, 0, 0 }, { 0x4C1, 0xA80, 0, 0, 0 }, { 0x441, 0xA81, 0, 0, 0 },
+  { 0xD11, 0, 0, 27, 0 }, { 0xD11, 0, 0, 28, 0 }, { 0xD11, 0, 0, 29, 0 }, { 0xD11, 0, 0, 33, 0 },
+  { 0xD11, 0, 0, 34, 0 }, { 0x601, 0, 0, 0, 0 }, { 0xD11, 0, 0, 35, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x4C1, 0, 0x22AC, 0, 0 },
+  { 0x441, 0xA82, 0, 0, 0 }, { 0x441, 0, 0x22AE, 0, 0 }, { 0x4C1, 0xA83, 0, 0, 0 },
+  { 0x4C1, 0, 0x22B0, 0, 0 }, { 0x4C1, 0xA84, 0, 0, 0 }, { 0xD11, 0, 0, 36, 0 },
+  { 0x211, 0, 0, 0, 0 }, { 0x201, 0xA85, 0, 0, 0 }, { 0x201, 0, 0x22B2, 0, 0 },
+  { 0x201, 0xA86, 0, 0, 0 }, { 0x201, 0, 0x22B4, 0, 0 }, { 0x201, 0xA87, 0, 0, 0 },
+  { 0x201, 0, 0x22B6, 0, 0 }, { 0xD11, 0, 0, 7, 2 }, { 0xD31, 0, 0, 9, 0 },
+  { 0x2, 0, 0x22B8, 0, 1 }, { 0x2, 0, 0x22BA, 0, 1 }, { 0x2, 0, 0x22BC, 0, 1 },
+  { 0x2, 0, 0x22BE, 0, 1 }, { 0x2, 0, 0x22C0, 0, 1 }, { 0x2, 0, 0x22C2, 0, 1 },
+  { 0x2, 0, 0x22C4, 0, 1 }, { 0x2, 0, 0x22C6, 0, 1 }, { 0xD11, 0, 0, 7, 0 }, { 0x211, 0, 0, 0, 2 },
+  { 0x211, 0x1288, 0, 0, 0 }, { 0x211, 0, 0x22C8, 0, 0 }, { 0x211, 0, 0x22CA, 0, 0 },
+  { 0x2, 0, 0x22CC, 0, 1 }, { 0x2, 0, 0x22CE, 0, 1 }, { 0x2, 0, 0x22D0, 0, 1 },
+  { 0x2, 0, 0x22D2, 0, 1 }, { 0x2, 0, 0x22D4, 0, 1 }, { 0x2, 0, 0x22D6, 0, 1 },
+  { 0x2, 0, 0x22D8, 0, 1 }, { 0x2, 0, 0x22DA, 0, 1 }, { 0x2, 0, 0x22DC, 0, 1 },
+  { 0x211, 0x1A8A, 0, 0, 0 }, { 0x211, 0, 0x22DE, 0, 0 }, { 0x211, 0, 0x22E0, 0, 0 },
+  { 0x211, 0, 0x22E2, 0, 0 }, { 0xD11, 0, 0, 0, 2 }, { 0x2, 0, 0x22E4, 0, 1 },
+  { 0x2, 0, 0x22E6, 0, 1 }, { 0x201, 0xA8D, 0, 0, 0 }, { 0x201, 0, 0x22E8, 0, 0 },
+  { 0x211, 0x128E, 0, 0, 0 }, { 0x211, 0xA90, 0, 0, 0 }, { 0x211, 0, 0x22EA, 0, 0 },
+  { 0x211, 0, 0x22EC, 0, 0 }, { 0x211, 0, 0x22EE, 0, 0 }, { 0xD11, 0xA91, 0, 0, 0 },
+  { 0xD11, 0, 0x22F0, 0, 0 }, { 0xD11, 0, 0, 84, 0 }, { 0xD11, 0, 0, 91, 2 },
+  { 0x311, 0xA92, 0, 0, 0 }, { 0x211, 0, 0x22F2, 0, 0 }, { 0x311, 0x1A93, 0, 0, 0 },
+  { 0x211, 0, 0x22F4, 0, 0 }, { 0x211, 0, 0x22F6, 0, 0 }, { 0x211, 0xA96, 0x22F8, 0, 0 },
+  { 0x211, 0, 0x32FA, 0, 0 }, { 0x211, 0x1297, 0, 0, 0 }, { 0x211, 0xA99, 0, 0, 0 },
+  { 0x211, 0, 0x22FD, 0, 0 }, { 0x211, 0, 0x22FF, 0, 0 }, { 0x211, 0, 0x2301, 0, 0 },
+  { 0xD31, 0, 0, 9, 2 }, { 0x211, 0x1A9A, 0, 0, 0 }, { 0x211, 0, 0x2303, 0, 0 },
+  { 0x211, 0xA9D, 0x2305, 0, 0 }, { 0x211, 0, 0x3307, 0, 0 }, { 0x211, 0, 0x230A, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0xD11, 0, 0, 103, 0 }, { 0xD11, 0, 0, 107, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0xD11, 0, 0, 118, 0 }, { 0xD11, 0, 0, 122, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xD11, 0, 0, 216, 0 }, { 0x2, 0, 0x230C, 0, 1 }, { 0x2, 0, 0x230E, 0, 1 },
+  { 0x2, 0, 0x2310, 0, 1 }, { 0x2, 0, 0x2312, 0, 1 }, { 0x2, 0, 0x2314, 0, 1 },
+  { 0x2, 0, 0x2316, 0, 1 }, { 0xD11, 0, 0, 129, 0 }, { 0xD11, 0, 0, 130, 0 },
+  { 0x2, 0, 0x2318, 0, 1 }, { 0xD11, 0, 0, 132, 0 }, { 0x2, 0, 0x231A, 0, 1 },
+  { 0x2, 0, 0x231C, 0, 1 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0x231E, 0, 1 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0x2320, 0, 1 }, { 0x2, 0, 0x2322, 0, 1 }, { 0x2, 0, 0x2324, 0, 1 },
+  { 0x2, 0, 0x2326, 0, 1 }, { 0x2, 0, 0x2328, 0, 1 }, { 0x2, 0, 0x232A, 0, 1 },
+  { 0x2, 0, 0x232C, 0, 1 }, { 0x201, 0xA9E, 0, 0, 0 }, { 0x201, 0, 0x232E, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x201, 0, 0, 0, 2 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x231, 0, 0, 9, 0 }, { 0xA41, 0, 0, 0, 0 }, { 0x241, 0, 0, 0, 0 }, { 0x201, 0xA9F, 0, 0, 0 },
+  { 0x201, 0, 0x2330, 0, 0 }, { 0x201, 0xAA0, 0, 0, 0 }, { 0x201, 0, 0x2332, 0, 0 },
+  { 0x201, 0xAA1, 0, 0, 0 }, { 0x201, 0, 0x2334, 0, 0 }, { 0x201, 0xAA2, 0, 0, 0 },
+  { 0x201, 0, 0x2336, 0, 0 }, { 0x201, 0xAA3, 0, 0, 0 }, { 0x201, 0, 0x2338, 0, 0 },
+  { 0x201, 0xAA4, 0, 0, 0 }, { 0x201, 0, 0x233A, 0, 0 }, { 0xD11, 0xAA5, 0, 0, 0 },
+  { 0x211, 0, 0x233C, 0, 0 }, { 0xD11, 0xAA6, 0, 0, 0 }, { 0x211, 0, 0x233E, 0, 0 },
+  { 0x211, 0xAA7, 0, 0, 0 }, { 0x211, 0xAA8, 0, 0, 0 }, { 0x211, 0, 0x2340, 0, 0 },
+  { 0x211, 0, 0x2342, 0, 0 }, { 0xD11, 0xAA9, 0, 0, 0 }, { 0x211, 0, 0x2344, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xD11, 0, 0, 214, 0 }, { 0xD11, 0, 0, 218, 0 },
+  { 0xA, 0, 0x2346, 0, 0 }, { 0x201, 0, 0x2348, 0, 0 }, { 0xA, 0, 0x234A, 0, 0 },
+  { 0x201, 0, 0x234C, 0, 0 }, { 0xA, 0, 0x234E, 0, 0 }, { 0x201, 0, 0x2350, 0, 0 },
+  { 0xA, 0, 0x2352, 0, 0 }, { 0x201, 0, 0x2354, 0, 0 }, { 0xA, 0, 0x3356, 0, 0 },
+  { 0x201, 0, 0x3359, 0, 0 }, { 0xA, 0, 0x235C, 0, 0 }, { 0x201, 0, 0x235E, 0, 0 },
+  { 0xA, 0, 0x2360, 0, 0 }, { 0x201, 0, 0x2362, 0, 0 }, { 0xA, 0, 0x2364, 0, 0 },
+  { 0x201, 0, 0x2366, 0, 0 }, { 0xA, 0, 0x2368, 0, 0 }, { 0x201, 0, 0x236A, 0, 0 },
+  { 0xA, 0, 0x236C, 0, 0 }, { 0x201, 0, 0x236E, 0, 0 }, { 0xA, 0, 0x3370, 0, 0 },
+  { 0x201, 0, 0x3373, 0, 0 }, { 0xA, 0, 0x3376, 0, 0 }, { 0x201, 0, 0x3379, 0, 0 },
+  { 0xA, 0, 0x237C, 0, 0 }, { 0x201, 0, 0x237E, 0, 0 }, { 0xA, 0, 0x2380, 0, 0 },
+  { 0x201, 0, 0x2382, 0, 0 }, { 0xA, 0, 0x3384, 0, 0 }, { 0x201, 0, 0x3387, 0, 0 },
+  { 0xA, 0, 0x238A, 0, 0 }, { 0x201, 0, 0x238C, 0, 0 }, { 0xA, 0, 0x238E, 0, 0 },
+  { 0x201, 0, 0x2390, 0, 0 }, { 0xA, 0, 0x2392, 0, 0 }, { 0x201, 0, 0x2394, 0, 0 },
+  { 0xA, 0, 0x2396, 0, 0 }, { 0x201, 0, 0x2398, 0, 0 }, { 0xA, 0, 0x239A, 0, 0 },
+  { 0x201, 0, 0x239C, 0, 0 }, { 0xA, 0, 0x239E, 0, 0 }, { 0x201, 0, 0x23A0, 0, 0 },
+  { 0xA, 0, 0x23A2, 0, 0 }, { 0x201, 0, 0x23A4, 0, 0 }, { 0xA, 0, 0x23A6, 0, 0 },
+  { 0x201, 0, 0x23A8, 0, 0 }, { 0xA, 0, 0x33AA, 0, 0 }, { 0x201, 0, 0x33AD, 0, 0 },
+  { 0xA, 0, 0x23B0, 0, 0 }, { 0x201, 0, 0x23B2, 0, 0 }, { 0xA, 0, 0x23B4, 0, 0 },
+  { 0x201, 0, 0x23B6, 0, 0 }, { 0xA, 0, 0x23B8, 0, 0 }, { 0x201, 0, 0x23BA, 0, 0 },
+  { 0xA, 0xAAA, 0x23BC, 0, 0 }, { 0x201, 0xAAB, 0x23BE, 0, 0 }, { 0xA, 0, 0x33C0, 0, 0 },
+  { 0x201, 0, 0x33C3, 0, 0 }, { 0xA, 0, 0x23C6, 0, 0 }, { 0x201, 0, 0x23C8, 0, 0 },
+  { 0xA, 0, 0x23CA, 0, 0 }, { 0x201, 0, 0x23CC, 0, 0 }, { 0xA, 0, 0x23CE, 0, 0 },
+  { 0x201, 0, 0x23D0, 0, 0 }, { 0xA, 0, 0x23D2, 0, 0 }, { 0x201, 0, 0x23D4, 0, 0 },
+  { 0xA, 0, 0x23D6, 0, 0 }, { 0x201, 0, 0x23D8, 0, 0 }, { 0xA, 0, 0x23DA, 0, 0 },
+  { 0x201, 0, 0x23DC, 0, 0 }, { 0xA, 0, 0x23DE, 0, 0 }, { 0x201, 0, 0x23E0, 0, 0 },
+  { 0xA, 0, 0x23E2, 0, 0 }, { 0x201, 0, 0x23E4, 0, 0 }, { 0xA, 0, 0x23E6, 0, 0 },
+  { 0x201, 0, 0x23E8, 0, 0 }, { 0xA, 0, 0x33EA, 0, 0 }, { 0x201, 0, 0x33ED, 0, 0 },
+  { 0xA, 0, 0x33F0, 0, 0 }, { 0x201, 0, 0x33F3, 0, 0 }, { 0xA, 0, 0x33F6, 0, 0 },
+  { 0x201, 0, 0x33F9, 0, 0 }, { 0xA, 0, 0x33FC, 0, 0 }, { 0x201, 0, 0x33FF, 0, 0 },
+  { 0xA, 0, 0x2402, 0, 0 }, { 0x201, 0, 0x2404, 0, 0 }, { 0xA, 0, 0x2406, 0, 0 },
+  { 0x201, 0, 0x2408, 0, 0 }, { 0xA, 0, 0x240A, 0, 0 }, { 0x201, 0, 0x240C, 0, 0 },
+  { 0xA, 0xAAC, 0x240E, 0, 0 }, { 0x201, 0xAAD, 0x2410, 0, 0 }, { 0xA, 0, 0x3412, 0, 0 },
+  { 0x201, 0, 0x3415, 0, 0 }, { 0xA, 0, 0x2418, 0, 0 }, { 0x201, 0, 0x241A, 0, 0 },
+  { 0xA, 0, 0x241C, 0, 0 }, { 0x201, 0, 0x241E, 0, 0 }, { 0xA, 0xAAE, 0x2420, 0, 0 },
+  { 0x201, 0xAAF, 0x2422, 0, 0 }, { 0xA, 0, 0x3424, 0, 0 }, { 0x201, 0, 0x3427, 0, 0 },
+  { 0xA, 0, 0x342A, 0, 0 }, { 0x201, 0, 0x342D, 0, 0 }, { 0xA, 0, 0x3430, 0, 0 },
+  { 0x201, 0, 0x3433, 0, 0 }, { 0xA, 0, 0x2436, 0, 0 }, { 0x201, 0, 0x2438, 0, 0 },
+  { 0xA, 0, 0x243A, 0, 0 }, { 0x201, 0, 0x243C, 0, 0 }, { 0xA, 0, 0x243E, 0, 0 },
+  { 0x201, 0, 0x2440, 0, 0 }, { 0xA, 0, 0x2442, 0, 0 }, { 0x201, 0, 0x2444, 0, 0 },
+  { 0xA, 0, 0x2446, 0, 0 }, { 0x201, 0, 0x2448, 0, 0 }, { 0xA, 0, 0x244A, 0, 0 },
+  { 0x201, 0, 0x244C, 0, 0 }, { 0xA, 0, 0x244E, 0, 0 }, { 0x201, 0, 0x2450, 0, 0 },
+  { 0xA, 0, 0x3452, 0, 0 }, { 0x201, 0, 0x3455, 0, 0 }, { 0xA, 0, 0x3458, 0, 0 },
+  { 0x201, 0, 0x345B, 0, 0 }, { 0xA, 0, 0x245E, 0, 0 }, { 0x201, 0, 0x2460, 0, 0 },
+  { 0xA, 0, 0x2462, 0, 0 }, { 0x201, 0, 0x2464, 0, 0 }, { 0xA, 0, 0x2466, 0, 0 },
+  { 0x201, 0, 0x2468, 0, 0 }, { 0xA, 0, 0x246A, 0, 0 }, { 0x201, 0, 0x246C, 0, 0 },
+  { 0xA, 0, 0x246E, 0, 0 }, { 0x201, 0, 0x2470, 0, 0 }, { 0xA, 0, 0x2472, 0, 0 },
+  { 0x201, 0, 0x2474, 0, 0 }, { 0xA, 0, 0x2476, 0, 0 }, { 0x201, 0, 0x2478, 0, 0 },
+  { 0xA, 0, 0x247A, 0, 0 }, { 0x201, 0, 0x247C, 0, 0 }, { 0xA, 0, 0x247E, 0, 0 },
+  { 0x201, 0, 0x2480, 0, 0 }, { 0xA, 0, 0x2482, 0, 0 }, { 0x201, 0, 0x2484, 0, 0 },
+  { 0xA, 0, 0x2486, 0, 0 }, { 0x201, 0, 0x2488, 0, 0 }, { 0xA, 0, 0x248A, 0, 0 },
+  { 0x201, 0, 0x248C, 0, 0 }, { 0xA, 0, 0x248E, 0, 0 }, { 0x201, 0, 0x2490, 0, 0 },
+  { 0x201, 0, 0x2492, 0, 0 }, { 0x201, 0, 0x2494, 0, 0 }, { 0x201, 0, 0x2496, 0, 0 },
+  { 0x201, 0, 0x2498, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0x249A, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0x12B0, 0x249C, 0, 0 }, { 0x201, 0x12B2, 0x249E, 0, 0 }, { 0xA, 0, 0x24A0, 0, 0 },
+  { 0x201, 0, 0x24A2, 0, 0 }, { 0xA, 0, 0x34A4, 0, 0 }, { 0x201, 0, 0x34A7, 0, 0 },
+  { 0xA, 0, 0x34AA, 0, 0 }, { 0x201, 0, 0x34AD, 0, 0 }, { 0xA, 0, 0x34B0, 0, 0 },
+  { 0x201, 0, 0x34B3, 0, 0 }, { 0xA, 0, 0x34B6, 0, 0 }, { 0x201, 0, 0x34B9, 0, 0 },
+  { 0xA, 0, 0x34BC, 0, 0 }, { 0x201, 0, 0x34BF, 0, 0 }, { 0xA, 0, 0x34C2, 0, 0 },
+  { 0x201, 0, 0x34C5, 0, 0 }, { 0xA, 0, 0x34C8, 0, 0 }, { 0x201, 0, 0x34CB, 0, 0 },
+  { 0xA, 0, 0x34CE, 0, 0 }, { 0x201, 0, 0x34D1, 0, 0 }, { 0xA, 0, 0x34D4, 0, 0 },
+  { 0x201, 0, 0x34D7, 0, 0 }, { 0xA, 0, 0x34DA, 0, 0 }, { 0x201, 0, 0x34DD, 0, 0 },
+  { 0xA, 0xAB4, 0x24E0, 0, 0 }, { 0x201, 0xAB5, 0x24E2, 0, 0 }, { 0xA, 0, 0x24E4, 0, 0 },
+  { 0x201, 0, 0x24E6, 0, 0 }, { 0xA, 0, 0x24E8, 0, 0 }, { 0x201, 0, 0x24EA, 0, 0 },
+  { 0xA, 0, 0x34EC, 0, 0 }, { 0x201, 0, 0x34EF, 0, 0 }, { 0xA, 0, 0x34F2, 0, 0 },
+  { 0x201, 0, 0x34F5, 0, 0 }, { 0xA, 0, 0x34F8, 0, 0 }, { 0x201, 0, 0x34FB, 0, 0 },
+  { 0xA, 0, 0x34FE, 0, 0 }, { 0x201, 0, 0x3501, 0, 0 }, { 0xA, 0, 0x3504, 0, 0 },
+  { 0x201, 0, 0x3507, 0, 0 }, { 0xA, 0, 0x250A, 0, 0 }, { 0x201, 0, 0x250C, 0, 0 },
+  { 0xA, 0, 0x250E, 0, 0 }, { 0x201, 0, 0x2510, 0, 0 }, { 0xA, 0xAB6, 0x2512, 0, 0 },
+  { 0x201, 0xAB7, 0x2514, 0, 0 }, { 0xA, 0, 0x2516, 0, 0 }, { 0x201, 0, 0x2518, 0, 0 },
+  { 0xA, 0, 0x351A, 0, 0 }, { 0x201, 0, 0x351D, 0, 0 }, { 0xA, 0, 0x3520, 0, 0 },
+  { 0x201, 0, 0x3523, 0, 0 }, { 0xA, 0, 0x3526, 0, 0 }, { 0x201, 0, 0x3529, 0, 0 },
+  { 0xA, 0, 0x352C, 0, 0 }, { 0x201, 0, 0x352F, 0, 0 }, { 0xA, 0, 0x3532, 0, 0 },
+  { 0x201, 0, 0x3535, 0, 0 }, { 0xA, 0, 0x3538, 0, 0 }, { 0x201, 0, 0x353B, 0, 0 },
+  { 0xA, 0, 0x353E, 0, 0 }, { 0x201, 0, 0x3541, 0, 0 }, { 0xA, 0, 0x3544, 0, 0 },
+  { 0x201, 0, 0x3547, 0, 0 }, { 0xA, 0, 0x354A, 0, 0 }, { 0x201, 0, 0x354D, 0, 0 },
+  { 0xA, 0, 0x3550, 0, 0 }, { 0x201, 0, 0x3553, 0, 0 }, { 0xA, 0, 0x2556, 0, 0 },
+  { 0x201, 0, 0x2558, 0, 0 }, { 0xA, 0, 0x255A, 0, 0 }, { 0x201, 0, 0x255C, 0, 0 },
+  { 0xA, 0, 0x355E, 0, 0 }, { 0x201, 0, 0x3561, 0, 0 }, { 0xA, 0, 0x3564, 0, 0 },
+  { 0x201, 0, 0x3567, 0, 0 }, { 0xA, 0, 0x356A, 0, 0 }, { 0x201, 0, 0x356D, 0, 0 },
+  { 0xA, 0, 0x3570, 0, 0 }, { 0x201, 0, 0x3573, 0, 0 }, { 0xA, 0, 0x3576, 0, 0 },
+  { 0x201, 0, 0x3579, 0, 0 }, { 0xA, 0, 0x257C, 0, 0 }, { 0x201, 0, 0x257E, 0, 0 },
+  { 0xA, 0, 0x2580, 0, 0 }, { 0x201, 0, 0x2582, 0, 0 }, { 0xA, 0, 0x2584, 0, 0 },
+  { 0x201, 0, 0x2586, 0, 0 }, { 0xA, 0, 0x2588, 0, 0 }, { 0x201, 0, 0x258A, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x201, 0x22B8, 0x258C, 0, 0 },
+  { 0x201, 0x22BC, 0x258E, 0, 0 }, { 0x201, 0xAC0, 0x3590, 0, 0 }, { 0x201, 0xAC1, 0x3593, 0, 0 },
+  { 0x201, 0xAC2, 0x3596, 0, 0 }, { 0x201, 0xAC3, 0x3599, 0, 0 }, { 0x201, 0xAC4, 0x359C, 0, 0 },
+  { 0x201, 0xAC5, 0x359F, 0, 0 }, { 0xA, 0x22C6, 0x25A2, 0, 0 }, { 0xA, 0x22CA, 0x25A4, 0, 0 },
+  { 0xA, 0xACE, 0x35A6, 0, 0 }, { 0xA, 0xACF, 0x35A9, 0, 0 }, { 0xA, 0xAD0, 0x35AC, 0, 0 },
+  { 0xA, 0xAD1, 0x35AF, 0, 0 }, { 0xA, 0xAD2, 0x35B2, 0, 0 }, { 0xA, 0xAD3, 0x35B5, 0, 0 },
+  { 0x201, 0x12D4, 0x25B8, 0, 0 }, { 0x201, 0x12D6, 0x25BA, 0, 0 }, { 0x201, 0, 0x35BC, 0, 0 },
+  { 0x201, 0, 0x35BF, 0, 0 }, { 0x201, 0, 0x35C2, 0, 0 }, { 0x201, 0, 0x35C5, 0, 0 },
+  { 0xA, 0x12D8, 0x25C8, 0, 0 }, { 0xA, 0x12DA, 0x25CA, 0, 0 }, { 0xA, 0, 0x35CC, 0, 0 },
+  { 0xA, 0, 0x35CF, 0, 0 }, { 0xA, 0, 0x35D2, 0, 0 }, { 0xA, 0, 0x35D5, 0, 0 },
+  { 0x201, 0x22DC, 0x25D8, 0, 0 }, { 0x201, 0x22E0, 0x25DA, 0, 0 }, { 0x201, 0xAE4, 0x35DC, 0, 0 },
+  { 0x201, 0xAE5, 0x35DF, 0, 0 }, { 0x201, 0xAE6, 0x35E2, 0, 0 }, { 0x201, 0xAE7, 0x35E5, 0, 0 },
+  { 0x201, 0xAE8, 0x35E8, 0, 0 }, { 0x201, 0xAE9, 0x35EB, 0, 0 }, { 0xA, 0x22EA, 0x25EE, 0, 0 },
+  { 0xA, 0x22EE, 0x25F0, 0, 0 }, { 0xA, 0xAF2, 0x35F2, 0, 0 }, { 0xA, 0xAF3, 0x35F5, 0, 0 },
+  { 0xA, 0xAF4, 0x35F8, 0, 0 }, { 0xA, 0xAF5, 0x35FB, 0, 0 }, { 0xA, 0xAF6, 0x35FE, 0, 0 },
+  { 0xA, 0xAF7, 0x3601, 0, 0 }, { 0x201, 0x1AF8, 0x2604, 0, 0 }, { 0x201, 0x1AFB, 0x2606, 0, 0 },
+  { 0x201, 0, 0x3608, 0, 0 }, { 0x201, 0, 0x360B, 0, 0 }, { 0x201, 0, 0x360E, 0, 0 },
+  { 0x201, 0, 0x3611, 0, 0 }, { 0x201, 0, 0x3614, 0, 0 }, { 0x201, 0, 0x3617, 0, 0 },
+  { 0xA, 0x1AFE, 0x261A, 0, 0 }, { 0xA, 0x1B01, 0x261C, 0, 0 }, { 0xA, 0, 0x361E, 0, 0 },
+  { 0xA, 0, 0x3621, 0, 0 }, { 0xA, 0, 0x3624, 0, 0 }, { 0xA, 0, 0x3627, 0, 0 },
+  { 0xA, 0, 0x362A, 0, 0 }, { 0xA, 0, 0x362D, 0, 0 }, { 0x201, 0x1304, 0x2630, 0, 0 },
+  { 0x201, 0x1306, 0x2632, 0, 0 }, { 0x201, 0, 0x3634, 0, 0 }, { 0x201, 0, 0x3637, 0, 0 },
+  { 0x201, 0, 0x363A, 0, 0 }, { 0x201, 0, 0x363D, 0, 0 }, { 0xA, 0x1308, 0x2640, 0, 0 },
+  { 0xA, 0x130A, 0x2642, 0, 0 }, { 0xA, 0, 0x3644, 0, 0 }, { 0xA, 0, 0x3647, 0, 0 },
+  { 0xA, 0, 0x364A, 0, 0 }, { 0xA, 0, 0x364D, 0, 0 }, { 0x201, 0x1B0C, 0x2650, 0, 0 },
+  { 0x201, 0x1B0F, 0x2652, 0, 0 }, { 0x201, 0, 0x3654, 0, 0 }, { 0x201, 0, 0x3657, 0, 0 },
+  { 0x201, 0, 0x365A, 0, 0 }, { 0x201, 0, 0x365D, 0, 0 }, { 0x201, 0, 0x3660, 0, 0 },
+  { 0x201, 0, 0x3663, 0, 0 }, { 0xA, 0x1B12, 0x2666, 0, 0 }, { 0xA, 0, 0x3668, 0, 0 },
+  { 0xA, 0, 0x366B, 0, 0 }, { 0xA, 0, 0x366E, 0, 0 }, { 0x201, 0x2315, 0x2671, 0, 0 },
+  { 0x201, 0x2319, 0x2673, 0, 0 }, { 0x201, 0xB1D, 0x3675, 0, 0 }, { 0x201, 0xB1E, 0x3678, 0, 0 },
+  { 0x201, 0xB1F, 0x367B, 0, 0 }, { 0x201, 0xB20, 0x367E, 0, 0 }, { 0x201, 0xB21, 0x3681, 0, 0 },
+  { 0x201, 0xB22, 0x3684, 0, 0 }, { 0xA, 0x2323, 0x2687, 0, 0 }, { 0xA, 0x2327, 0x2689, 0, 0 },
+  { 0xA, 0xB2B, 0x368B, 0, 0 }, { 0xA, 0xB2C, 0x368E, 0, 0 }, { 0xA, 0xB2D, 0x3691, 0, 0 },
+  { 0xA, 0xB2E, 0x3694, 0, 0 }, { 0xA, 0xB2F, 0x3697, 0, 0 }, { 0xA, 0xB30, 0x369A, 0, 0 },
+  { 0x201, 0xB31, 0x269D, 0, 0 }, { 0xA, 0, 0x2225, 0, 1 }, { 0x201, 0, 0x269F, 0, 0 },
+  { 0xA, 0, 0x2227, 0, 1 }, { 0x201, 0xB32, 0x26A1, 0, 0 }, { 0xA, 0, 0x2229, 0, 1 },
+  { 0x201, 0, 0x26A3, 0, 0 }, { 0xA, 0, 0x222B, 0, 1 }, { 0x201, 0, 0x26A5, 0, 0 },
+  { 0xA, 0, 0x2230, 0, 1 }, { 0x201, 0, 0x26A7, 0, 0 }, { 0xA, 0, 0x2232, 0, 1 },
+  { 0x201, 0xB33, 0x26A9, 0, 0 }, { 0xA, 0, 0x2234, 0, 1 }, { 0x2, 0, 0x36AB, 0, 0 },
+  { 0x2, 0, 0x36AE, 0, 0 }, { 0x2, 0, 0x46B1, 0, 0 }, { 0x2, 0, 0x46B5, 0, 0 },
+  { 0x2, 0, 0x46B9, 0, 0 }, { 0x2, 0, 0x46BD, 0, 0 }, { 0x2, 0, 0x46C1, 0, 0 },
+  { 0x2, 0, 0x46C5, 0, 0 }, { 0x2, 0, 0x36C9, 0, 0 }, { 0x2, 0, 0x36CC, 0, 0 },
+  { 0x2, 0, 0x46CF, 0, 0 }, { 0x2, 0, 0x46D3, 0, 0 }, { 0x2, 0, 0x46D7, 0, 0 },
+  { 0x2, 0, 0x46DB, 0, 0 }, { 0x2, 0, 0x46DF, 0, 0 }, { 0x2, 0, 0x46E3, 0, 0 },
+  { 0x2, 0, 0x36E7, 0, 0 }, { 0x2, 0, 0x36EA, 0, 0 }, { 0x2, 0, 0x46ED, 0, 0 },
+  { 0x2, 0, 0x46F1, 0, 0 }, { 0x2, 0, 0x46F5, 0, 0 }, { 0x2, 0, 0x46F9, 0, 0 },
+  { 0x2, 0, 0x46FD, 0, 0 }, { 0x2, 0, 0x4701, 0, 0 }, { 0x2, 0, 0x3705, 0, 0 },
+  { 0x2, 0, 0x3708, 0, 0 }, { 0x2, 0, 0x470B, 0, 0 }, { 0x2, 0, 0x470F, 0, 0 },
+  { 0x2, 0, 0x4713, 0, 0 }, { 0x2, 0, 0x4717, 0, 0 }, { 0x2, 0, 0x471B, 0, 0 },
+  { 0x2, 0, 0x471F, 0, 0 }, { 0x2, 0, 0x3723, 0, 0 }, { 0x2, 0, 0x3726, 0, 0 },
+  { 0x2, 0, 0x4729, 0, 0 }, { 0x2, 0, 0x472D, 0, 0 }, { 0x2, 0, 0x4731, 0, 0 },
+  { 0x2, 0, 0x4735, 0, 0 }, { 0x2, 0, 0x4739, 0, 0 }, { 0x2, 0, 0x473D, 0, 0 },
+  { 0x2, 0, 0x3741, 0, 0 }, { 0x2, 0, 0x3744, 0, 0 }, { 0x2, 0, 0x4747, 0, 0 },
+  { 0x2, 0, 0x474B, 0, 0 }, { 0x2, 0, 0x474F, 0, 0 }, { 0x2, 0, 0x4753, 0, 0 },
+  { 0x2, 0, 0x4757, 0, 0 }, { 0x2, 0, 0x475B, 0, 0 }, { 0x201, 0, 0x275F, 0, 0 },
+  { 0x201, 0, 0x2761, 0, 0 }, { 0x2, 0, 0x3763, 0, 0 }, { 0x2, 0, 0x2766, 0, 0 },
+  { 0x2, 0, 0x3768, 0, 0 }, { 0x201, 0xB34, 0x276B, 0, 0 }, { 0x2, 0, 0x376D, 0, 0 },
+  { 0xA, 0, 0x2770, 0, 0 }, { 0xA, 0, 0x2772, 0, 0 }, { 0xA, 0, 0x2774, 0, 0 },
+  { 0xA, 0, 0x220F, 0, 1 }, { 0x2, 0, 0x2776, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0x121E, 0, 1 },
+  { 0x2, 0x1B35, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0x2778, 0, 0 }, { 0x2, 0, 0x377A, 0, 0 },
+  { 0x2, 0, 0x277D, 0, 0 }, { 0x2, 0, 0x377F, 0, 0 }, { 0x201, 0xB38, 0x2782, 0, 0 },
+  { 0x2, 0, 0x3784, 0, 0 }, { 0xA, 0, 0x2787, 0, 0 }, { 0xA, 0, 0x2212, 0, 1 },
+  { 0xA, 0, 0x2789, 0, 0 }, { 0xA, 0, 0x2214, 0, 1 }, { 0x2, 0, 0x278B, 0, 0 },
+  { 0x2, 0, 0x278D, 0, 0 }, { 0x2, 0, 0x278F, 0, 0 }, { 0x2, 0, 0x2791, 0, 0 },
+  { 0x201, 0, 0x2793, 0, 0 }, { 0x201, 0, 0x2795, 0, 0 }, { 0x201, 0, 0x3797, 0, 0 },
+  { 0xA, 0, 0x321E, 0, 1 }, { 0x201, 0, 0x279A, 0, 0 }, { 0x201, 0, 0x379C, 0, 0 },
+  { 0xA, 0, 0x279F, 0, 0 }, { 0xA, 0, 0x27A1, 0, 0 }, { 0xA, 0, 0x27A3, 0, 0 },
+  { 0xA, 0, 0x2216, 0, 1 }, { 0x2, 0, 0x27A5, 0, 0 }, { 0x2, 0, 0x27A7, 0, 0 },
+  { 0x2, 0, 0x27A9, 0, 0 }, { 0x201, 0, 0x27AB, 0, 0 }, { 0x201, 0, 0x27AD, 0, 0 },
+  { 0x201, 0, 0x37AF, 0, 0 }, { 0xA, 0, 0x322D, 0, 1 }, { 0x201, 0, 0x27B2, 0, 0 },
+  { 0x201, 0, 0x27B4, 0, 0 }, { 0x201, 0, 0x27B6, 0, 0 }, { 0x201, 0, 0x37B8, 0, 0 },
+  { 0xA, 0, 0x27BB, 0, 0 }, { 0xA, 0, 0x27BD, 0, 0 }, { 0xA, 0, 0x27BF, 0, 0 },
+  { 0xA, 0, 0x221A, 0, 1 }, { 0xA, 0, 0x27C1, 0, 0 }, { 0x2, 0, 0x27C3, 0, 0 },
+  { 0x2, 0, 0x220D, 0, 1 }, { 0xA, 0, 0x17C5, 0, 1 }, { 0x2, 0, 0x37C6, 0, 0 },
+  { 0x2, 0, 0x27C9, 0, 0 }, { 0x2, 0, 0x37CB, 0, 0 }, { 0x201, 0xB39, 0x27CE, 0, 0 },
+  { 0x2, 0, 0x37D0, 0, 0 }, { 0xA, 0, 0x27D3, 0, 0 }, { 0xA, 0, 0x2218, 0, 1 },
+  { 0xA, 0, 0x27D5, 0, 0 }, { 0xA, 0, 0x221C, 0, 1 }, { 0x2, 0, 0x27D7, 0, 0 },
+  { 0x2, 0, 0x17D9, 0, 1 }, { 0x2, 0x1B3A, 0, 0, 0 }, { 0xA, 0, 0x17DA, 0, 1 },
+  { 0xA, 0, 0x17DB, 0, 1 }, { 0xA03, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0x121C, 0, 1 }, { 0xA, 0, 0x10C8, 0, 1 }, { 0xA, 0, 0x200A, 0, 1 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA01, 0xB3D, 0, 0, 0 }, { 0xA01, 0xB3E, 0, 0, 0 },
+  { 0xA01, 0xB3F, 0, 0, 0 }, { 0xA01, 0, 0x27DC, 0, 0 }, { 0xA01, 0, 0x27DE, 0, 0 },
+  { 0xA01, 0, 0x27E0, 0, 0 }, { 0xA01, 0, 0x27E2, 0, 0 }, { 0xA01, 0, 0x27E4, 0, 0 },
+  { 0xA01, 0, 0x27E6, 0, 0 }, { 0xA01, 0xB40, 0, 0, 0 }, { 0xA01, 0xB41, 0, 0, 0 },
+  { 0xA01, 0xB42, 0, 0, 0 }, { 0xA01, 0xB43, 0, 0, 0 }, { 0xA01, 0, 0x27E8, 0, 0 },
+  { 0xA01, 0xB44, 0, 0, 0 }, { 0xA01, 0, 0x27EA, 0, 0 }, { 0xA01, 0xB45, 0, 0, 0 },
+  { 0xA01, 0, 0x27EC, 0, 0 }, { 0xA01, 0xB46, 0, 0, 0 }, { 0xA01, 0, 0x27EE, 0, 0 },
+  { 0xA01, 0xB47, 0, 0, 0 }, { 0xA01, 0, 0x27F0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA01, 0xB48, 0, 0, 0 }, { 0xA01, 0, 0x27F2, 0, 0 },
+  { 0xA01, 0xB49, 0, 0, 0 }, { 0xA01, 0, 0x27F4, 0, 0 }, { 0xA01, 0xB4A, 0, 0, 0 },
+  { 0xA01, 0, 0x27F6, 0, 0 }, { 0xA01, 0xB4B, 0, 0, 0 }, { 0xA01, 0, 0x27F8, 0, 0 },
+  { 0xA01, 0xB4C, 0, 0, 0 }, { 0xA01, 0, 0x27FA, 0, 0 }, { 0xA01, 0xB4D, 0, 0, 0 },
+  { 0xA01, 0, 0x27FC, 0, 0 }, { 0xA01, 0xB4E, 0, 0, 0 }, { 0xA01, 0xB4F, 0, 0, 0 },
+  { 0xA01, 0, 0x27FE, 0, 0 }, { 0xA01, 0, 0x2800, 0, 0 }, { 0xA01, 0, 0x2802, 0, 0 },
+  { 0xA01, 0, 0x2804, 0, 0 }, { 0xA01, 0, 0x2806, 0, 0 }, { 0xA01, 0xB50, 0, 0, 0 },
+  { 0xA01, 0xB51, 0, 0, 0 }, { 0xA01, 0, 0x2808, 0, 0 }, { 0xA01, 0, 0x280A, 0, 0 },
+  { 0xA01, 0xB52, 0, 0, 0 }, { 0xA01, 0xB53, 0, 0, 0 }, { 0xA01, 0, 0x280C, 0, 0 },
+  { 0xA01, 0, 0x280E, 0, 0 }, { 0xA01, 0xB54, 0, 0, 0 }, { 0xA01, 0xB55, 0, 0, 0 },
+  { 0xA01, 0xB56, 0, 0, 0 }, { 0xA01, 0xB57, 0, 0, 0 }, { 0xA01, 0, 0x2810, 0, 0 },
+  { 0xA01, 0, 0x2812, 0, 0 }, { 0xA01, 0xB58, 0, 0, 0 }, { 0xA01, 0xB59, 0, 0, 0 },
+  { 0xA01, 0, 0x2814, 0, 0 }, { 0xA01, 0, 0x2816, 0, 0 }, { 0xA01, 0xB5A, 0, 0, 0 },
+  { 0xA01, 0xB5B, 0, 0, 0 }, { 0xA01, 0, 0x2818, 0, 0 }, { 0xA01, 0, 0x281A, 0, 0 },
+  { 0xA01, 0xB5C, 0, 0, 0 }, { 0xA01, 0xB5D, 0, 0, 0 }, { 0xA01, 0xB5E, 0, 0, 0 },
+  { 0xA01, 0xB5F, 0, 0, 0 }, { 0xA01, 0xB60, 0, 0, 0 }, { 0xA01, 0xB61, 0, 0, 0 },
+  { 0xA01, 0, 0x281C, 0, 0 }, { 0xA01, 0, 0x281E, 0, 0 }, { 0xA01, 0, 0x2820, 0, 0 },
+  { 0xA01, 0, 0x2822, 0, 0 }, { 0xA01, 0xB62, 0, 0, 0 }, { 0xA01, 0xB63, 0, 0, 0 },
+  { 0xA01, 0xB64, 0, 0, 0 }, { 0xA01, 0xB65, 0, 0, 0 }, { 0xA01, 0, 0x2824, 0, 0 },
+  { 0xA01, 0, 0x2826, 0, 0 }, { 0xA01, 0, 0x2828, 0, 0 }, { 0xA01, 0, 0x282A, 0, 0 },
+  { 0xA01, 0, 0x282C, 0, 0 }, { 0xA01, 0, 0x282E, 0, 0 }, { 0xA01, 0, 0x2830, 0, 0 },
+  { 0xA01, 0, 0x2832, 0, 0 }, { 0xA, 0, 0x1834, 0, 1 }, { 0xA, 0, 0x1835, 0, 1 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0x2836, 0, 1 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x211, 0, 0, 224, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x201, 0xB66, 0, 0, 0 }, { 0x201, 0xB67, 0, 0, 0 }, { 0x201, 0, 0x2838, 0, 0 },
+  { 0x201, 0xB68, 0, 0, 0 }, { 0x201, 0, 0x283A, 0, 0 }, { 0x201, 0xB69, 0, 0, 0 },
+  { 0x201, 0, 0x283C, 0, 0 }, { 0x201, 0xB6A, 0, 0, 0 }, { 0x201, 0, 0x283E, 0, 0 },
+  { 0x201, 0xB6B, 0, 0, 0 }, { 0x201, 0, 0x2840, 0, 0 }, { 0x201, 0xB6C, 0, 0, 0 },
+  { 0x201, 0, 0x2842, 0, 0 }, { 0x201, 0xB6D, 0, 0, 0 }, { 0x201, 0, 0x2844, 0, 0 },
+  { 0x201, 0xB6E, 0, 0, 0 }, { 0x201, 0, 0x2846, 0, 0 }, { 0x201, 0xB6F, 0, 0, 0 },
+  { 0x201, 0, 0x2848, 0, 0 }, { 0x201, 0xB70, 0, 0, 0 }, { 0x201, 0, 0x284A, 0, 0 },
+  { 0x201, 0xB71, 0, 0, 0 }, { 0x201, 0, 0x284C, 0, 0 }, { 0x201, 0xB72, 0, 0, 0 },
+  { 0x201, 0, 0x284E, 0, 0 }, { 0x201, 0xB73, 0, 0, 0 }, { 0x201, 0, 0x2850, 0, 0 },
+  { 0x201, 0xB74, 0, 0, 0 }, { 0x201, 0, 0x2852, 0, 0 }, { 0x201, 0xB75, 0, 0, 0 },
+  { 0x201, 0, 0x2854, 0, 0 }, { 0x201, 0x1376, 0, 0, 0 }, { 0x201, 0, 0x2856, 0, 0 },
+  { 0x201, 0, 0x2858, 0, 0 }, { 0x201, 0x1378, 0, 0, 0 }, { 0x201, 0, 0x285A, 0, 0 },
+  { 0x201, 0, 0x285C, 0, 0 }, { 0x201, 0x137A, 0, 0, 0 }, { 0x201, 0, 0x285E, 0, 0 },
+  { 0x201, 0, 0x2860, 0, 0 }, { 0x201, 0x137C, 0, 0, 0 }, { 0x201, 0, 0x2862, 0, 0 },
+  { 0x201, 0, 0x2864, 0, 0 }, { 0x201, 0x137E, 0, 0, 0 }, { 0x201, 0, 0x2866, 0, 0 },
+  { 0x201, 0, 0x2868, 0, 0 }, { 0x201, 0, 0x286A, 0, 0 }, { 0xD11, 0, 0, 8, 2 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x201, 0xB80, 0, 0, 0 }, { 0x201, 0, 0x286C, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x201, 0xB81, 0, 0, 0 }, { 0x201, 0xB82, 0, 0, 0 },
+  { 0x201, 0, 0x286E, 0, 0 }, { 0x201, 0xB83, 0, 0, 0 }, { 0x201, 0, 0x2870, 0, 0 },
+  { 0x201, 0xB84, 0, 0, 0 }, { 0x201, 0, 0x2872, 0, 0 }, { 0x201, 0xB85, 0, 0, 0 },
+  { 0x201, 0, 0x2874, 0, 0 }, { 0x201, 0xB86, 0, 0, 0 }, { 0x201, 0, 0x2876, 0, 0 },
+  { 0x201, 0xB87, 0, 0, 0 }, { 0x201, 0, 0x2878, 0, 0 }, { 0x201, 0xB88, 0, 0, 0 },
+  { 0x201, 0, 0x287A, 0, 0 }, { 0x201, 0xB89, 0, 0, 0 }, { 0x201, 0, 0x287C, 0, 0 },
+  { 0x201, 0xB8A, 0, 0, 0 }, { 0x201, 0, 0x287E, 0, 0 }, { 0x201, 0xB8B, 0, 0, 0 },
+  { 0x201, 0, 0x2880, 0, 0 }, { 0x201, 0xB8C, 0, 0, 0 }, { 0x201, 0, 0x2882, 0, 0 },
+  { 0x201, 0xB8D, 0, 0, 0 }, { 0x201, 0, 0x2884, 0, 0 }, { 0x201, 0xB8E, 0, 0, 0 },
+  { 0x201, 0, 0x2886, 0, 0 }, { 0x201, 0xB8F, 0, 0, 0 }, { 0x201, 0, 0x2888, 0, 0 },
+  { 0x201, 0xB90, 0, 0, 0 }, { 0x201, 0, 0x288A, 0, 0 }, { 0x201, 0x1391, 0, 0, 0 },
+  { 0x201, 0, 0x288C, 0, 0 }, { 0x201, 0, 0x288E, 0, 0 }, { 0x201, 0x1393, 0, 0, 0 },
+  { 0x201, 0, 0x2890, 0, 0 }, { 0x201, 0, 0x2892, 0, 0 }, { 0x201, 0x1395, 0, 0, 0 },
+  { 0x201, 0, 0x2894, 0, 0 }, { 0x201, 0, 0x2896, 0, 0 }, { 0x201, 0x1397, 0, 0, 0 },
+  { 0x201, 0, 0x2898, 0, 0 }, { 0x201, 0, 0x289A, 0, 0 }, { 0x201, 0x1399, 0, 0, 0 },
+  { 0x201, 0, 0x289C, 0, 0 }, { 0x201, 0, 0x289E, 0, 0 }, { 0x201, 0xB9B, 0, 0, 0 },
+  { 0x201, 0xB9C, 0, 0, 0 }, { 0x201, 0xB9D, 0, 0, 0 }, { 0x201, 0xB9E, 0, 0, 0 },
+  { 0x201, 0, 0x28A0, 0, 0 }, { 0x201, 0, 0x28A2, 0, 0 }, { 0x201, 0, 0x28A4, 0, 0 },
+  { 0x201, 0, 0x28A6, 0, 0 }, { 0x201, 0, 0x28A8, 0, 0 }, { 0x201, 0xB9F, 0, 0, 0 },
+  { 0x201, 0, 0x28AA, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x281, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x18AC, 0, 1 }, { 0xA, 0, 0x18AD, 0, 1 }, { 0xA, 0, 0x18AE, 0, 1 },
+  { 0xA, 0, 0x18AF, 0, 1 }, { 0xA, 0, 0x18B0, 0, 1 }, { 0xA, 0, 0x18B1, 0, 1 },
+  { 0xA, 0, 0x18B2, 0, 1 }, { 0xA, 0, 0x18B3, 0, 1 }, { 0xA, 0, 0x18B4, 0, 1 },
+  { 0xA, 0, 0x18B5, 0, 1 }, { 0xA, 0, 0x18B6, 0, 1 }, { 0xA, 0, 0x18B7, 0, 1 },
+  { 0xA, 0, 0x18B8, 0, 1 }, { 0xA, 0, 0x18B9, 0, 1 }, { 0xA, 0, 0x18BA, 0, 1 },
+  { 0xA, 0, 0x18BB, 0, 1 }, { 0xA, 0, 0x18BC, 0, 1 }, { 0xA, 0, 0x18BD, 0, 1 },
+  { 0xA, 0, 0x18BE, 0, 1 }, { 0xA, 0, 0x18BF, 0, 1 }, { 0xA, 0, 0x18C0, 0, 1 },
+  { 0xA, 0, 0x18C1, 0, 1 }, { 0xA, 0, 0x18C2, 0, 1 }, { 0xA, 0, 0x18C3, 0, 1 },
+  { 0xA, 0, 0x18C4, 0, 1 }, { 0xA, 0, 0x18C5, 0, 1 }, { 0xA, 0, 0x18C6, 0, 1 },
+  { 0xA, 0, 0x18C7, 0, 1 }, { 0xA, 0, 0x18C8, 0, 1 }, { 0xA, 0, 0x18C9, 0, 1 },
+  { 0xA, 0, 0x18CA, 0, 1 }, { 0xA, 0, 0x18CB, 0, 1 }, { 0xA, 0, 0x18CC, 0, 1 },
+  { 0xA, 0, 0x18CD, 0, 1 }, { 0xA, 0, 0x18CE, 0, 1 }, { 0xA, 0, 0x18CF, 0, 1 },
+  { 0xA, 0, 0x18D0, 0, 1 }, { 0xA, 0, 0x18D1, 0, 1 }, { 0xA, 0, 0x18D2, 0, 1 },
+  { 0xA, 0, 0x18D3, 0, 1 }, { 0xA, 0, 0x18D4, 0, 1 }, { 0xA, 0, 0x18D5, 0, 1 },
+  { 0xA, 0, 0x18D6, 0, 1 }, { 0xA, 0, 0x18D7, 0, 1 }, { 0xA, 0, 0x18D8, 0, 1 },
+  { 0xA, 0, 0x18D9, 0, 1 }, { 0xA, 0, 0x18DA, 0, 1 }, { 0xA, 0, 0x18DB, 0, 1 },
+  { 0xA, 0, 0x18DC, 0, 1 }, { 0xA, 0, 0x18DD, 0, 1 }, { 0xA, 0, 0x18DE, 0, 1 },
+  { 0xA, 0, 0x18DF, 0, 1 }, { 0xA, 0, 0x18E0, 0, 1 }, { 0xA, 0, 0x18E1, 0, 1 },
+  { 0xA, 0, 0x18E2, 0, 1 }, { 0xA, 0, 0x18E3, 0, 1 }, { 0xA, 0, 0x18E4, 0, 1 },
+  { 0xA, 0, 0x18E5, 0, 1 }, { 0xA, 0, 0x18E6, 0, 1 }, { 0xA, 0, 0x18E7, 0, 1 },
+  { 0xA, 0, 0x18E8, 0, 1 }, { 0xA, 0, 0x18E9, 0, 1 }, { 0xA, 0, 0x18EA, 0, 1 },
+  { 0xA, 0, 0x18EB, 0, 1 }, { 0xA, 0, 0x18EC, 0, 1 }, { 0xA, 0, 0x18ED, 0, 1 },
+  { 0xA, 0, 0x18EE, 0, 1 }, { 0xA, 0, 0x18EF, 0, 1 }, { 0xA, 0, 0x18F0, 0, 1 },
+  { 0xA, 0, 0x18F1, 0, 1 }, { 0xA, 0, 0x18F2, 0, 1 }, { 0xA, 0, 0x18F3, 0, 1 },
+  { 0xA, 0, 0x18F4, 0, 1 }, { 0xA, 0, 0x18F5, 0, 1 }, { 0xA, 0, 0x18F6, 0, 1 },
+  { 0xA, 0, 0x18F7, 0, 1 }, { 0xA, 0, 0x18F8, 0, 1 }, { 0xA, 0, 0x18F9, 0, 1 },
+  { 0xA, 0, 0x18FA, 0, 1 }, { 0xA, 0, 0x18FB, 0, 1 }, { 0xA, 0, 0x18FC, 0, 1 },
+  { 0xA, 0, 0x18FD, 0, 1 }, { 0xA, 0, 0x18FE, 0, 1 }, { 0xA, 0, 0x18FF, 0, 1 },
+  { 0xA, 0, 0x1900, 0, 1 }, { 0xA, 0, 0x1901, 0, 1 }, { 0xA, 0, 0x1902, 0, 1 },
+  { 0xA, 0, 0x1903, 0, 1 }, { 0xA, 0, 0x1904, 0, 1 }, { 0xA, 0, 0x1905, 0, 1 },
+  { 0xA, 0, 0x1906, 0, 1 }, { 0xA, 0, 0x1907, 0, 1 }, { 0xA, 0, 0x1908, 0, 1 },
+  { 0xA, 0, 0x1909, 0, 1 }, { 0xA, 0, 0x190A, 0, 1 }, { 0xA, 0, 0x190B, 0, 1 },
+  { 0xA, 0, 0x190C, 0, 1 }, { 0xA, 0, 0x190D, 0, 1 }, { 0xA, 0, 0x190E, 0, 1 },
+  { 0xA, 0, 0x190F, 0, 1 }, { 0xA, 0, 0x1910, 0, 1 }, { 0xA, 0, 0x1911, 0, 1 },
+  { 0xA, 0, 0x1912, 0, 1 }, { 0xA, 0, 0x1913, 0, 1 }, { 0xA, 0, 0x1914, 0, 1 },
+  { 0xA, 0, 0x1915, 0, 1 }, { 0xA, 0, 0x1916, 0, 1 }, { 0xA, 0, 0x1917, 0, 1 },
+  { 0xA, 0, 0x1918, 0, 1 }, { 0xA, 0, 0x1919, 0, 1 }, { 0xA, 0, 0x191A, 0, 1 },
+  { 0xA, 0, 0x191B, 0, 1 }, { 0xA, 0, 0x191C, 0, 1 }, { 0xA, 0, 0x191D, 0, 1 },
+  { 0xA, 0, 0x191E, 0, 1 }, { 0xA, 0, 0x191F, 0, 1 }, { 0xA, 0, 0x1920, 0, 1 },
+  { 0xA, 0, 0x1921, 0, 1 }, { 0xA, 0, 0x1922, 0, 1 }, { 0xA, 0, 0x1923, 0, 1 },
+  { 0xA, 0, 0x1924, 0, 1 }, { 0xA, 0, 0x1925, 0, 1 }, { 0xA, 0, 0x1926, 0, 1 },
+  { 0xA, 0, 0x1927, 0, 1 }, { 0xA, 0, 0x1928, 0, 1 }, { 0xA, 0, 0x1929, 0, 1 },
+  { 0xA, 0, 0x192A, 0, 1 }, { 0xA, 0, 0x192B, 0, 1 }, { 0xA, 0, 0x192C, 0, 1 },
+  { 0xA, 0, 0x192D, 0, 1 }, { 0xA, 0, 0x192E, 0, 1 }, { 0xA, 0, 0x192F, 0, 1 },
+  { 0xA, 0, 0x1930, 0, 1 }, { 0xA, 0, 0x1931, 0, 1 }, { 0xA, 0, 0x1932, 0, 1 },
+  { 0xA, 0, 0x1933, 0, 1 }, { 0xA, 0, 0x1934, 0, 1 }, { 0xA, 0, 0x1935, 0, 1 },
+  { 0xA, 0, 0x1936, 0, 1 }, { 0xA, 0, 0x1937, 0, 1 }, { 0xA, 0, 0x1938, 0, 1 },
+  { 0xA, 0, 0x1939, 0, 1 }, { 0xA, 0, 0x193A, 0, 1 }, { 0xA, 0, 0x193B, 0, 1 },
+  { 0xA, 0, 0x193C, 0, 1 }, { 0xA, 0, 0x193D, 0, 1 }, { 0xA, 0, 0x193E, 0, 1 },
+  { 0xA, 0, 0x193F, 0, 1 }, { 0xA, 0, 0x1940, 0, 1 }, { 0xA, 0, 0x1941, 0, 1 },
+  { 0xA, 0, 0x1942, 0, 1 }, { 0xA, 0, 0x1943, 0, 1 }, { 0xA, 0, 0x1944, 0, 1 },
+  { 0xA, 0, 0x1945, 0, 1 }, { 0xA, 0, 0x1946, 0, 1 }, { 0xA, 0, 0x1947, 0, 1 },
+  { 0xA, 0, 0x1948, 0, 1 }, { 0xA, 0, 0x1949, 0, 1 }, { 0xA, 0, 0x194A, 0, 1 },
+  { 0xA, 0, 0x194B, 0, 1 }, { 0xA, 0, 0x194C, 0, 1 }, { 0xA, 0, 0x194D, 0, 1 },
+  { 0xA, 0, 0x194E, 0, 1 }, { 0xA, 0, 0x194F, 0, 1 }, { 0xA, 0, 0x1950, 0, 1 },
+  { 0xA, 0, 0x1951, 0, 1 }, { 0xA, 0, 0x1952, 0, 1 }, { 0xA, 0, 0x1953, 0, 1 },
+  { 0xA, 0, 0x1954, 0, 1 }, { 0xA, 0, 0x1955, 0, 1 }, { 0xA, 0, 0x1956, 0, 1 },
+  { 0xA, 0, 0x1957, 0, 1 }, { 0xA, 0, 0x1958, 0, 1 }, { 0xA, 0, 0x1959, 0, 1 },
+  { 0xA, 0, 0x195A, 0, 1 }, { 0xA, 0, 0x195B, 0, 1 }, { 0xA, 0, 0x195C, 0, 1 },
+  { 0xA, 0, 0x195D, 0, 1 }, { 0xA, 0, 0x195E, 0, 1 }, { 0xA, 0, 0x195F, 0, 1 },
+  { 0xA, 0, 0x1960, 0, 1 }, { 0xA, 0, 0x1961, 0, 1 }, { 0xA, 0, 0x1962, 0, 1 },
+  { 0xA, 0, 0x1963, 0, 1 }, { 0xA, 0, 0x1964, 0, 1 }, { 0xA, 0, 0x1965, 0, 1 },
+  { 0xA, 0, 0x1966, 0, 1 }, { 0xA, 0, 0x1967, 0, 1 }, { 0xA, 0, 0x1968, 0, 1 },
+  { 0xA, 0, 0x1969, 0, 1 }, { 0xA, 0, 0x196A, 0, 1 }, { 0xA, 0, 0x196B, 0, 1 },
+  { 0xA, 0, 0x196C, 0, 1 }, { 0xA, 0, 0x196D, 0, 1 }, { 0xA, 0, 0x196E, 0, 1 },
+  { 0xA, 0, 0x196F, 0, 1 }, { 0xA, 0, 0x1970, 0, 1 }, { 0xA, 0, 0x1971, 0, 1 },
+  { 0xA, 0, 0x1972, 0, 1 }, { 0xA, 0, 0x1973, 0, 1 }, { 0xA, 0, 0x1974, 0, 1 },
+  { 0xA, 0, 0x1975, 0, 1 }, { 0xA, 0, 0x1976, 0, 1 }, { 0xA, 0, 0x1977, 0, 1 },
+  { 0xA, 0, 0x1978, 0, 1 }, { 0xA, 0, 0x1979, 0, 1 }, { 0xA, 0, 0x197A, 0, 1 },
+  { 0xA, 0, 0x197B, 0, 1 }, { 0xA, 0, 0x197C, 0, 1 }, { 0xA, 0, 0x197D, 0, 1 },
+  { 0xA, 0, 0x197E, 0, 1 }, { 0xA, 0, 0x197F, 0, 1 }, { 0xA, 0, 0x1980, 0, 1 },
+  { 0xA, 0, 0x1981, 0, 1 }, { 0xA, 0, 0x1982, 0, 1 }, { 0xA, 0, 0x1983, 0, 1 },
+  { 0xA, 0, 0x1984, 0, 1 }, { 0xA, 0, 0x1985, 0, 1 }, { 0xA, 0, 0x1986, 0, 1 },
+  { 0xA, 0, 0x1987, 0, 1 }, { 0xA, 0, 0x1988, 0, 1 }, { 0xA, 0, 0x1989, 0, 1 },
+  { 0xA, 0, 0x198A, 0, 1 }, { 0xA, 0, 0x198B, 0, 1 }, { 0xA, 0, 0x198C, 0, 1 },
+  { 0xA, 0, 0x198D, 0, 1 }, { 0xA, 0, 0x198E, 0, 1 }, { 0xA, 0, 0x198F, 0, 1 },
+  { 0xA, 0, 0x1990, 0, 1 }, { 0xA, 0, 0x1991, 0, 1 }, { 0xA, 0, 0x1992, 0, 1 },
+  { 0xA, 0, 0x1993, 0, 1 }, { 0xA, 0, 0x1994, 0, 1 }, { 0xA, 0, 0x1995, 0, 1 },
+  { 0xA, 0, 0x1996, 0, 1 }, { 0xA, 0, 0x1997, 0, 1 }, { 0xA, 0, 0x1998, 0, 1 },
+  { 0xA, 0, 0x1999, 0, 1 }, { 0xA, 0, 0x199A, 0, 1 }, { 0xA, 0, 0x199B, 0, 1 },
+  { 0xA, 0, 0x199C, 0, 1 }, { 0xA, 0, 0x199D, 0, 1 }, { 0xA, 0, 0x199E, 0, 1 },
+  { 0xA, 0, 0x199F, 0, 1 }, { 0xA, 0, 0x19A0, 0, 1 }, { 0xA, 0, 0x19A1, 0, 1 },
+  { 0xA, 0, 0x19A2, 0, 1 }, { 0xA, 0, 0x19A3, 0, 1 }, { 0xA, 0, 0x19A4, 0, 1 },
+  { 0xA, 0, 0x19A5, 0, 1 }, { 0xA, 0, 0x19A6, 0, 1 }, { 0xA, 0, 0x19A7, 0, 1 },
+  { 0xA, 0, 0x19A8, 0, 1 }, { 0xA, 0, 0x19A9, 0, 1 }, { 0xA, 0, 0x19AA, 0, 1 },
+  { 0xA, 0, 0x19AB, 0, 1 }, { 0xA, 0, 0x19AC, 0, 1 }, { 0xA, 0, 0x19AD, 0, 1 },
+  { 0xA, 0, 0x19AE, 0, 1 }, { 0xA, 0, 0x19AF, 0, 1 }, { 0xA, 0, 0x19B0, 0, 1 },
+  { 0xA, 0, 0x19B1, 0, 1 }, { 0xA, 0, 0x19B2, 0, 1 }, { 0xA, 0, 0x19B3, 0, 1 },
+  { 0xA, 0, 0x19B4, 0, 1 }, { 0xA, 0, 0x19B5, 0, 1 }, { 0xA, 0, 0x19B6, 0, 1 },
+  { 0xA, 0, 0x19B7, 0, 1 }, { 0xA, 0, 0x19B8, 0, 1 }, { 0xA, 0, 0x19B9, 0, 1 },
+  { 0xA, 0, 0x19BA, 0, 1 }, { 0xA, 0, 0x19BB, 0, 1 }, { 0xA, 0, 0x19BC, 0, 1 },
+  { 0xA, 0, 0x19BD, 0, 1 }, { 0xA, 0, 0x19BE, 0, 1 }, { 0xA, 0, 0x19BF, 0, 1 },
+  { 0xA, 0, 0x19C0, 0, 1 }, { 0xA, 0, 0x19C1, 0, 1 }, { 0xA, 0, 0x19C2, 0, 1 },
+  { 0xA, 0, 0x19C3, 0, 1 }, { 0xA, 0, 0x19C4, 0, 1 }, { 0xA, 0, 0x19C5, 0, 1 },
+  { 0xA, 0, 0x19C6, 0, 1 }, { 0xA, 0, 0x19C7, 0, 1 }, { 0xA, 0, 0x19C8, 0, 1 },
+  { 0xA, 0, 0x19C9, 0, 1 }, { 0xA, 0, 0x19CA, 0, 1 }, { 0xA, 0, 0x19CB, 0, 1 },
+  { 0xA, 0, 0x19CC, 0, 1 }, { 0xA, 0, 0x19CD, 0, 1 }, { 0xA, 0, 0x19CE, 0, 1 },
+  { 0xA, 0, 0x19CF, 0, 1 }, { 0xA, 0, 0x19D0, 0, 1 }, { 0xA, 0, 0x19D1, 0, 1 },
+  { 0xA, 0, 0x19D2, 0, 1 }, { 0xA, 0, 0x19D3, 0, 1 }, { 0xA, 0, 0x19D4, 0, 1 },
+  { 0xA, 0, 0x19D5, 0, 1 }, { 0xA, 0, 0x19D6, 0, 1 }, { 0xA, 0, 0x19D7, 0, 1 },
+  { 0xA, 0, 0x19D8, 0, 1 }, { 0xA, 0, 0x19D9, 0, 1 }, { 0xA, 0, 0x19DA, 0, 1 },
+  { 0xA, 0, 0x19DB, 0, 1 }, { 0xA, 0, 0x19DC, 0, 1 }, { 0xA, 0, 0x19DD, 0, 1 },
+  { 0xA, 0, 0x19DE, 0, 1 }, { 0xA, 0, 0x19DF, 0, 1 }, { 0xA, 0, 0x19E0, 0, 1 },
+  { 0xA, 0, 0x19E1, 0, 1 }, { 0xA, 0, 0x19E2, 0, 1 }, { 0xA, 0, 0x19E3, 0, 1 },
+  { 0xA, 0, 0x19E4, 0, 1 }, { 0xA, 0, 0x19E5, 0, 1 }, { 0xA, 0, 0x19E6, 0, 1 },
+  { 0xA, 0, 0x19E7, 0, 1 }, { 0xA, 0, 0x19E8, 0, 1 }, { 0xA, 0, 0x19E9, 0, 1 },
+  { 0xA, 0, 0x19EA, 0, 1 }, { 0xA, 0, 0x19EB, 0, 1 }, { 0xA, 0, 0x19EC, 0, 1 },
+  { 0xA, 0, 0x19ED, 0, 1 }, { 0xA, 0, 0x19EE, 0, 1 }, { 0xA, 0, 0x19EF, 0, 1 },
+  { 0xA, 0, 0x19F0, 0, 1 }, { 0xA, 0, 0x19F1, 0, 1 }, { 0xA, 0, 0x19F2, 0, 1 },
+  { 0xA, 0, 0x19F3, 0, 1 }, { 0xA, 0, 0x19F4, 0, 1 }, { 0xA, 0, 0x19F5, 0, 1 },
+  { 0xA, 0, 0x19F6, 0, 1 }, { 0xA, 0, 0x19F7, 0, 1 }, { 0xA, 0, 0x19F8, 0, 1 },
+  { 0xA, 0, 0x19F9, 0, 1 }, { 0xA, 0, 0x19FA, 0, 1 }, { 0xA, 0, 0x19FB, 0, 1 },
+  { 0xA, 0, 0x19FC, 0, 1 }, { 0xA, 0, 0x19FD, 0, 1 }, { 0xA, 0, 0x19FE, 0, 1 },
+  { 0xA, 0, 0x19FF, 0, 1 }, { 0xA, 0, 0x1A00, 0, 1 }, { 0xA, 0, 0x1A01, 0, 1 },
+  { 0xA, 0, 0x1A02, 0, 1 }, { 0x2, 0, 0x1A03, 0, 1 }, { 0xA, 0, 0x1A04, 0, 1 },
+  { 0xA, 0, 0x1A05, 0, 1 }, { 0xA, 0, 0x1A06, 0, 1 }, { 0xA, 0, 0x1A07, 0, 1 },
+  { 0xA, 0, 0x1A08, 0, 1 }, { 0xA, 0, 0x1A09, 0, 1 }, { 0xA, 0, 0x1A0A, 0, 1 },
+  { 0xA, 0, 0x1A0B, 0, 1 }, { 0xA, 0, 0x1A0C, 0, 1 }, { 0xA, 0, 0x1A0D, 0, 1 },
+  { 0xA, 0, 0x1A0E, 0, 1 }, { 0xA, 0, 0x1A0F, 0, 1 }, { 0xA, 0, 0x1A10, 0, 1 },
+  { 0xA, 0, 0x1A11, 0, 1 }, { 0xA, 0, 0x1A12, 0, 1 }, { 0xA, 0, 0x1A13, 0, 1 },
+  { 0xA, 0, 0x1A14, 0, 1 }, { 0xA, 0, 0x1A15, 0, 1 }, { 0xA, 0, 0x1A16, 0, 1 },
+  { 0xA, 0, 0x1A17, 0, 1 }, { 0xA, 0, 0x1A18, 0, 1 }, { 0xA, 0, 0x1A19, 0, 1 },
+  { 0xA, 0, 0x1A1A, 0, 1 }, { 0xA, 0, 0x1A1B, 0, 1 }, { 0xA, 0, 0x1A1C, 0, 1 },
+  { 0xA, 0, 0x1A1D, 0, 1 }, { 0xA, 0, 0x1A1E, 0, 1 }, { 0xA, 0, 0x1A1F, 0, 1 },
+  { 0xA, 0, 0x1A20, 0, 1 }, { 0xA, 0, 0x1A21, 0, 1 }, { 0xA, 0, 0x1A22, 0, 1 },
+  { 0xA, 0, 0x1A23, 0, 1 }, { 0xA, 0, 0x1A24, 0, 1 }, { 0xA, 0, 0x1A25, 0, 1 },
+  { 0xA, 0, 0x1A26, 0, 1 }, { 0xA, 0, 0x1A27, 0, 1 }, { 0xA, 0, 0x1A28, 0, 1 },
+  { 0xA, 0, 0x1A29, 0, 1 }, { 0xA, 0, 0x1A2A, 0, 1 }, { 0xA, 0, 0x1A2B, 0, 1 },
+  { 0xA, 0, 0x1A2C, 0, 1 }, { 0xA, 0, 0x1A2D, 0, 1 }, { 0xA, 0, 0x1A2E, 0, 1 },
+  { 0xA, 0, 0x1A2F, 0, 1 }, { 0xA, 0, 0x1A30, 0, 1 }, { 0xA, 0, 0x1A31, 0, 1 },
+  { 0xA, 0, 0x1A32, 0, 1 }, { 0xA, 0, 0x1A33, 0, 1 }, { 0xA, 0, 0x1A34, 0, 1 },
+  { 0xA, 0, 0x1A35, 0, 1 }, { 0xA, 0, 0x1A36, 0, 1 }, { 0xA, 0, 0x1A37, 0, 1 },
+  { 0xA, 0, 0x1A38, 0, 1 }, { 0xA, 0, 0x1A39, 0, 1 }, { 0xA, 0, 0x1A3A, 0, 1 },
+  { 0xA, 0, 0x1A3B, 0, 1 }, { 0xA, 0, 0x1A3C, 0, 1 }, { 0xA, 0, 0x1A3D, 0, 1 },
+  { 0xA, 0, 0x1A3E, 0, 1 }, { 0xA, 0, 0x1A3F, 0, 1 }, { 0xA, 0, 0x1A40, 0, 1 },
+  { 0xA, 0, 0x1A41, 0, 1 }, { 0xA, 0, 0x1A42, 0, 1 }, { 0xA, 0, 0x1A43, 0, 1 },
+  { 0xA, 0, 0x1A44, 0, 1 }, { 0xA, 0, 0x1A45, 0, 1 }, { 0xA, 0, 0x1A46, 0, 1 },
+  { 0xA, 0, 0x1A47, 0, 1 }, { 0xA, 0, 0x1A48, 0, 1 }, { 0xA, 0, 0x1A49, 0, 1 },
+  { 0x2, 0, 0x1A4A, 0, 1 }, { 0x2, 0, 0x1A4B, 0, 1 }, { 0x2, 0, 0x1A4C, 0, 1 },
+  { 0xA, 0, 0x1A4D, 0, 1 }, { 0xA, 0, 0x1A4E, 0, 1 }, { 0xA, 0, 0x1A4F, 0, 1 },
+  { 0x2, 0, 0x1A50, 0, 1 }, { 0x2, 0, 0x1A51, 0, 1 }, { 0x2, 0, 0x1A52, 0, 1 },
+  { 0xA, 0, 0x1A53, 0, 1 }, { 0xA, 0, 0x1A54, 0, 1 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0x2A55, 0, 1 }, { 0xD11, 0, 0, 26, 0 }, { 0x2, 0, 0x2A57, 0, 1 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0x2A59, 0, 1 },
+  { 0x2, 0, 0x2A5B, 0, 1 }, { 0x2, 0, 0x3A5D, 0, 1 }, { 0x2, 0, 0x3A60, 0, 1 },
+  { 0x2, 0, 0x2A63, 0, 1 }, { 0x2, 0, 0x2A65, 0, 1 }, { 0x2, 0, 0x2A67, 0, 1 },
+  { 0x2, 0, 0x2A69, 0, 1 }, { 0x2, 0, 0x2A6B, 0, 1 }, { 0x2, 0, 0x2A6D, 0, 1 },
+  { 0x2, 0, 0x2A6F, 0, 1 }, { 0x2, 0, 0x2A71, 0, 1 }, { 0x2, 0, 0x2A73, 0, 1 },
+  { 0x2, 0, 0x2A75, 0, 1 }, { 0x2, 0, 0x2A77, 0, 1 }, { 0x2, 0, 0x2A79, 0, 1 },
+  { 0x2, 0, 0x2A7B, 0, 1 }, { 0x2, 0, 0x2A7D, 0, 1 }, { 0x2, 0, 0x2A7F, 0, 1 },
+  { 0x2, 0, 0x2A81, 0, 1 }, { 0x2, 0, 0x2A83, 0, 1 }, { 0x2, 0, 0x2A85, 0, 1 },
+  { 0x2, 0, 0x2A87, 0, 1 }, { 0x2, 0, 0x2A89, 0, 1 }, { 0x2, 0, 0x2A8B, 0, 1 },
+  { 0x2, 0, 0x2A8D, 0, 1 }, { 0x2, 0, 0x2A5D, 0, 1 }, { 0x2, 0, 0x2A8F, 0, 1 },
+  { 0x2, 0, 0x2A91, 0, 1 }, { 0x2, 0, 0x2A93, 0, 1 }, { 0x2, 0, 0x2A95, 0, 1 },
+  { 0x2, 0, 0x2A97, 0, 1 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x201, 0, 0x2A99, 0, 0 }, { 0x201, 0xBA0, 0, 0, 0 }, { 0x201, 0xBA1, 0, 0, 0 },
+  { 0x201, 0, 0x2A9B, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x481, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x201, 0xBA2, 0, 0, 0 },
+  { 0x201, 0, 0x2A9D, 0, 0 }, { 0x201, 0xBA3, 0, 0, 0 }, { 0x201, 0, 0x2A9F, 0, 0 },
+  { 0x201, 0xBA4, 0, 0, 0 }, { 0x201, 0, 0x2AA1, 0, 0 }, { 0xD11, 0, 0x2AA3, 0, 0 },
+  { 0xD11, 0, 0x2AA5, 0, 0 }, { 0xD11, 0xBA5, 0, 0, 0 }, { 0xD11, 0xBA6, 0, 0, 0 },
+  { 0x211, 0x13A7, 0, 0, 0 }, { 0x211, 0, 0x2AA7, 0, 0 }, { 0x211, 0, 0x2AA9, 0, 0 },
+  { 0x201, 0xBA9, 0, 0, 0 }, { 0x201, 0, 0x2AAB, 0, 0 }, { 0x201, 0xBAA, 0, 0, 0 },
+  { 0x201, 0, 0x2AAD, 0, 0 }, { 0x201, 0xBAB, 0, 0, 0 }, { 0x201, 0, 0x2AAF, 0, 0 },
+  { 0x201, 0xBAC, 0, 0, 0 }, { 0x201, 0, 0x2AB1, 0, 0 }, { 0x211, 0x1BAD, 0, 0, 2 },
+  { 0x211, 0, 0x2AB3, 0, 2 }, { 0x211, 0, 0x2AB5, 0, 2 }, { 0x211, 0, 0x2AB7, 0, 2 },
+  { 0x211, 0x1BB0, 0, 0, 0 }, { 0x211, 0, 0x2AB9, 0, 0 }, { 0x211, 0, 0x2ABB, 0, 0 },
+  { 0x211, 0, 0x2ABD, 0, 0 }, { 0x211, 0xBB3, 0, 0, 0 }, { 0x211, 0xBB4, 0, 0, 0 },
+  { 0x211, 0, 0x2ABF, 0, 0 }, { 0x211, 0, 0x2AC1, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x211, 0xBB5, 0, 0, 0 }, { 0x211, 0, 0x2AC3, 0, 0 },
+  { 0x311, 0, 0, 0, 0 }, { 0x331, 0, 0, 9, 0 }, { 0xD11, 0x23B6, 0, 0, 2 },
+  { 0xD11, 0x13BA, 0x2AC5, 0, 2 }, { 0xD11, 0xBBC, 0x2AC7, 0, 2 }, { 0xD11, 0, 0x2AC9, 0, 2 },
+  { 0xD11, 0, 0x2ACB, 0, 2 }, { 0xD11, 0, 0x2ACD, 0, 2 }, { 0xD11, 0, 0x3ACF, 0, 2 },
+  { 0xD11, 0, 0x3AD2, 0, 2 }, { 0xD11, 0, 0x3AD5, 0, 2 }, { 0xD11, 0xBBD, 0, 0, 2 },
+  { 0x201, 0xBBE, 0, 0, 0 }, { 0x201, 0xBBF, 0, 0, 2 }, { 0x201, 0, 0x2AD8, 0, 2 },
+  { 0x201, 0xBC0, 0x2ADA, 0, 0 }, { 0x201, 0, 0x3ADC, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x211, 0, 0, 6, 0 }, { 0x2, 0, 0x2ADF, 0, 1 }, { 0x2, 0, 0x2AE1, 0, 1 },
+  { 0x2, 0, 0x3AE3, 0, 1 }, { 0x2, 0, 0x3AE6, 0, 1 }, { 0x2, 0, 0x3AE9, 0, 1 },
+  { 0x2, 0, 0x3AEC, 0, 1 }, { 0x2, 0, 0x3AEF, 0, 1 }, { 0x211, 0, 0, 216, 0 },
+  { 0x211, 0, 0, 226, 0 }, { 0x2, 0, 0x2AF2, 0, 1 }, { 0x2, 0, 0x2AF4, 0, 1 },
+  { 0x2, 0, 0x3AF6, 0, 1 }, { 0x2, 0, 0x3AF9, 0, 1 }, { 0x2, 0, 0x3AFC, 0, 1 },
+  { 0x2, 0, 0x3AFF, 0, 1 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x501, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 },
+  { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0x2, 0, 0, 0, 0 }, { 0xA, 0, 0, 0, 0 },
+  { 0xA, 0, 0, 0, 0 }, { 0xA, 0, 0x1B02, 0, 1 }, { 0xA, 0, 0x1B03, 0, 1 }, { 0xA, 0, 0x1B04, 0, 1 },
+  { 0x2, 0, 0x1B05, 0, 1 }, { 0xA, 0, 0x1B06, 0, 1 }, { 0xA, 0, 0x1B07, 0, 1 },
+  { 0xA, 0, 0x1B08, 0, 1 }, { 0xA, 0, 0x1B09, 0, 1 }, { 0xA, 0, 0x1B0A, 0, 1 },
+  { 0xA, 0, 0x1B0B, 0, 1 }, { 0xA, 0, 0x1B0C, 0, 1 }, { 0x2, 0, 0x1B0D, 0, 1 },
+  { 0xA, 0, 0x1B0E, 0, 1 }, { 0xA, 0, 0x1B0F, 0, 1 }, { 0xA, 0, 0x1B10, 0, 1 },
+  { 0x2, 0, 0x1B11, 0, 1 }, { 0xA, 0, 0x1B12, 0, 1 }, { 0xA, 0, 0x1B13, 0, 1 },
+  { 0xA, 0, 0x1B14, 0, 1 }, { 0x2, 0, 0x1B15, 0, 1 }, { 0xA, 0, 0x1B16, 0, 1 },
+  { 0xA, 0, 0x1B17, 0, 1 }, { 0xA, 0, 0x1B18, 0, 1 }, { 0xA, 0, 0x1B19, 0, 1 },
+  { 0x2, 0, 0x1B1A, 0, 1 }, { 0xA, 0, 0x1B1B, 0, 1 }, { 0xA, 0, 0x1B1C, 0, 1 },
+  { 0xA, 0, 0x1B1D, 0, 1 }, { 0xA, 0, 0x1B1E, 0, 1 }, { 0xA, 0, 0x1B1F, 0, 1 },
+  { 0xA, 0, 0x1B20, 0, 1 }, { 0xA, 0, 0x1B21, 0, 1 }, { 0xA, 0, 0x1B22, 0, 1 },
+  { 0xA, 0, 0x1B23, 0, 1 }, { 0xA, 0, 0x1B24, 0, 1 }, { 0xA, 0, 0x1B25, 0, 1 },
+  { 0xA, 0, 0x1B26, 0, 1 }, { 0xA, 0, 0x1B27, 0, 1 }, { 0xA, 0, 0x1B28, 0, 1 },
+  { 0xA, 0, 0x1B29, 0, 1 }, { 0x2, 0, 0x1B2A, 0, 1 }, { 0xA, 0, 0x1B2B, 0, 1 },
+  { 0xA, 0, 0x1B2C, 0, 1 }, { 0xA, 0, 0x1B2D, 0, 1 }, { 0x2, 0, 0x1B2E, 0, 1 },
+  { 0xA, 0, 0x1B2F, 0, 1 }, { 0xA, 0, 0x1B30, 0, 1 }, { 0xA, 0, 0x1B31, 0, 1 },
+  { 0xA, 0, 0x1B32, 0, 1 }, { 0xA, 0, 0x1B33, 0, 1 }, { 0xA, 0, 0x1B34, 0, 1 },
+  { 0xA, 0, 0x1B35, 0, 1 }, { 0xA, 0, 0x1B36, 0, 1 }, { 0xA, 0, 0x1B37, 0, 1 },
+  { 0xA, 0, 0x1B38, 0, 1 }, { 0xA, 0, 0x1B39, 0, 1 }, { 0xA, 0, 0x1B3A, 0, 1 },
+  { 0xA, 0, 0x1B3B, 0, 1 }, { 0xA, 0, 0x1B3C, 0, 1 }, { 0xA, 0, 0x1B3D, 0, 1 },
+  { 0xA, 0, 0x1B3E, 0, 1 }, { 0xA, 0, 0x1B3F, 0, 1 }, { 0xA, 0, 0x1B40, 0, 1 },
+  { 0xA, 0, 0x1B41, 0, 1 }, { 0xA, 0, 0x1B42, 0, 1 }, { 0xA, 0, 0x1B43, 0, 1 },
+  { 0xA, 0, 0x1B44, 0, 1 }, { 0xA, 0, 0x1B45, 0, 1 }, { 0xA, 0, 0x1B46, 0, 1 },
+  { 0xA, 0, 0x1B47, 0, 1 }, { 0xA, 0, 0x1B48, 0, 1 }, { 0xA, 0, 0x1B49, 0, 1 },
+  { 0xA, 0, 0x1B4A, 0, 1 }, { 0x2, 0, 0x1B4B, 0, 1 }, { 0xA, 0, 0x1B4C, 0, 1 },
+  { 0xA, 0, 0x1B4D, 0, 1 }, { 0xA, 0, 0x1B4E, 0, 1 }, { 0xA, 0, 0x1B4F, 0, 1 },
+  { 0xA, 0, 0x1B50, 0, 1 }, { 0xA, 0, 0x1B51, 0, 1 }, { 0x2, 0, 0x1B52, 0, 1 },
+  { 0x2, 0, 0x1B53, 0, 1 }, { 0xA, 0, 0x1B54, 0, 1 }, { 0xA, 0, 0x1B55, 0, 1 },
+  { 0xA, 0, 0x1B56, 0, 1 }, { 0xA, 0, 0x1B57, 0, 1 }, { 0xA, 0, 0x1B58, 0, 1 },
+  { 0xA, 0, 0x1B59, 0, 1 }, { 0xA, 0, 0x1B5A, 0, 1 }, { 0xA, 0, 0x1B5B, 0, 1 },
+  { 0xA, 0, 0x1B5C, 0, 1 }, { 0x2, 0, 0x1B5D, 0, 1 }, { 0xA, 0, 0x1B5E, 0, 1 },
+  { 0xA, 0, 0x1B5F, 0, 1 }, { 0xA, 0, 0x1B60, 0, 1 }, { 0x2, 0, 0x1B61, 0, 1 },
+  { 0xA, 0, 0x1B62, 0, 1 }, { 0xA, 0, 0x1B63, 0, 1 }, { 0xA, 0, 0x1B64, 0, 1 },
+  { 0xA, 0, 0x1B65, 0, 1 }, { 0xA, 0, 0x1B66, 0, 1 }, { 0xA, 0, 0x1B67, 0, 1 },
+  { 0xA, 0, 0x1B68, 0, 1 }, { 0xA, 0, 0x1B69, 0, 1 }, { 0x2, 0, 0x1B6A, 0, 1 },
+  { 0xA, 0, 0x1B6B, 0, 1 }, { 0x2, 0, 0x1B6C, 0, 1 }, { 0xA, 0, 0x1B6D, 0, 1 },
+  { 0xA, 0, 0x1B6E, 0, 1 }, { 0xA, 0, 0x1B6F, 0, 1 }, { 0xA, 0, 0x1B70, 0, 1 },
+  { 0xA, 0, 0x1B71, 0, 1 }, { 0xA, 0, 0x1B72, 0, 1 }, { 0xA, 0, 0x1B73, 0, 1 },
+  { 0xA, 0, 0x1B74, 0, 1 }, { 0xA, 0, 0x1B75, 0, 1 }, { 0xA, 0, 0x1B76, 0, 1 },
+  { 0xA, 0, 0x1B77, 0, 1 }, { 0x2, 0, 0x1B78, 0, 1 }, { 0xA, 0, 0x1B79, 0, 1 },
+  { 0xA, 0, 0x1B7A, 0, 1 }, { 0xA, 0, 0x1B7B, 0, 1 }, { 0xA, 0, 0x1B7C, 0, 1 },
+  { 0x2, 0, 0x1B7D, 0, 1 }, { 0xA, 0, 0x1B7E, 0, 1 }, { 0x2, 0, 0x1B7F, 0, 1 },
+  { 0xA, 0, 0x1B80, 0, 1 }, { 0xA, 0, 0x1B81, 0, 1 }, { 0xA, 0, 0x1B82, 0, 1 },
+  { 0x2, 0, 0x1B83, 0, 1 }, { 0x2, 0, 0x1B84, 0, 1 }, { 0xA, 0, 0x1B85, 0, 1 },
+  { 0xA, 0, 0x1B86, 0, 1 }, { 0xA, 0, 0x1B87, 0, 1 }, { 0xA, 0, 0x1B88, 0, 1 },
+  { 0xA, 0, 0x1B89, 0, 1 }, { 0xA, 0, 0x1B8A, 0, 1 }, { 0xA, 0, 0x1B8B, 0, 1 },
+  { 0xA, 0, 0x1B8C, 0, 1 }, { 0xA, 0, 0x1B8D, 0, 1 }, { 0xA, 0, 0x1B8E, 0, 1 },
+  { 0x2, 0, 0x1B8F, 0, 1 }, { 0xA, 0, 0x1B90, 0, 1 }, { 0xA, 0, 0x1B91, 0, 1 },
+  { 0xA, 0, 0x1B92, 0, 1 }, { 0xA, 0, 0x1B93, 0, 1 }, { 0xA, 0, 0x1B94, 0, 1 },
+  { 0xA, 0, 0x1B95, 0, 1 }, { 0xA, 0, 0x1B96, 0, 1 }, { 0xA, 0, 0x1B97, 0, 1 },
+  { 0xA, 0, 0x1B98, 0, 1 }, { 0xA, 0, 0x1B99, 0, 1 }, { 0xA, 0, 0x1B9A, 0, 1 },
+  { 0xA, 0, 0x1B9B, 0, 1 }, { 0xA, 0, 0x1B9C, 0, 1 }, { 0xA, 0, 0x1B9D, 0, 1 },
+  { 0x2, 0, 0x1B9E, 0, 1 }, { 0xA, 0, 0x1B9F, 0, 1 }, { 0xA, 0, 0x1BA0, 0, 1 },
+  { 0xA, 0, 0x1BA1, 0, 1 }, { 0xA, 0, 0x1BA2, 0, 1 }, { 0xA, 0, 0x1BA3, 0, 1 },
+  { 0x2, 0, 0x1BA4, 0, 1 }, { 0xA, 0, 0x1BA5, 0, 1 }, { 0xA, 0, 0x1BA6, 0, 1 },
+  { 0xA, 0, 0x1BA7, 0, 1 }, { 0xA, 0, 0x1BA8, 0, 1 }, { 0xA, 0, 0x1BA9, 0, 1 },
+  { 0xA, 0, 0x1BAA, 0, 1 }, { 0xA, 0, 0x1BAB, 0, 1 }, { 0xA, 0, 0x1BAC, 0, 1 },
+  { 0xA, 0, 0x1BAD, 0, 1 }, { 0xA, 0, 0x1BAE, 0, 1 }, { 0x2, 0, 0x1BAF, 0, 1 },
+  { 0xA, 0, 0x1BB0, 0, 1 }, { 0xA, 0, 0x1BB1, 0, 1 }, { 0xA, 0, 0x1BB2, 0, 1 },
+  { 0xA, 0, 0x1BB3, 0, 1 }, { 0xA, 0, 0x1BB4, 0, 1 }, { 0xA, 0, 0x1BB5, 0, 1 },
+  { 0xA, 0, 0x1BB6, 0, 1 }, { 0xA, 0, 0x1BB7, 0, 1 }, { 0xA, 0, 0x1BB8, 0, 1 },
+  { 0xA, 0, 0x1BB9, 0, 1 }, { 0xA, 0, 0x1BBA, 0, 1 }, { 0xA, 0, 0x1BBB, 0, 1 },
+  { 0xA, 0, 0x1BBC, 0, 1 }, { 0xA, 0, 0x1BBD, 0, 1 }, { 0xA, 0, 0x1BBE, 0, 1 },
+  { 0x2, 0, 0x1BBF, 0, 1 }, { 0xA, 0, 0x1BC0, 0, 1 }, { 0xA, 0, 0x1BC1, 0, 1 },
+  { 0xA, 0, 0x1BC2, 0, 1 }, { 0xA, 0, 0x1BC3, 0, 1 }, { 0x2, 0, 0x1BC4, 0, 1 },
+  { 0xA, 0, 0x1BC5, 0, 1 }, { 0xA, 0, 0x1BC6, 0, 1 }, { 0xA, 0, 0x1BC7, 0, 1 },
+  { 0xA, 0, 0x1BC8, 0, 1 }, { 0xA, 0, 0x1BC9, 0, 1 }, { 0xA, 0, 0x1BCA, 0, 1 },
+  { 0xA, 0, 0x1BCB, 0, 1 }, { 0x2, 0, 0x1BCC, 0, 1 }, { 0xA, 0, 0x1BCD, 0, 1 },
+  { 0xA, 0, 0x1BCE, 0, 1 }, { 0xA, 0, 0x1BCF, 0, 1 }, { 0x2, 0, 0x1BD0, 0, 1 },
+  { 0xA, 0, 0x1BD1, 0, 1 }, { 0xA, 0, 0x1BD2, 0, 1 }, { 0xA, 0, 0x1BD3, 0, 1 },
+  { 0xA, 0, 0x1BD4, 0, 1 }, { 0xA, 0, 0x1BD5, 0, 1 }, { 0x2, 0, 0x1BD6, 0, 1 },
+  { 0x2, 0, 0x1BD7, 0, 1 }, { 0x2, 0, 0x1BD8, 0, 1 }, { 0xA, 0, 0x1BD9, 0, 1 },
+  { 0x2, 0, 0x1BDA, 0, 1 }, { 0xA, 0, 0x1BDB, 0, 1 }, { 0xA, 0, 0x1BDC, 0, 1 },
+  { 0xA, 0, 0x1BDD, 0, 1 }, { 0xA, 0, 0x1BDE, 0, 1 }, { 0xA, 0, 0x1BDF, 0, 1 },
+  { 0xA, 0, 0x1BE0, 0, 1 }, { 0xA, 0, 0x1BE1, 0, 1 }, { 0xA, 0, 0x1BE2, 0, 1 },
+  { 0x2, 0, 0x1BE3, 0, 1 }, { 0xA, 0, 0x1BE4, 0, 1 }, { 0xA, 0, 0x1BE5, 0, 1 },
+  { 0xA, 0, 0x1BE6, 0, 1 }, { 0xA, 0, 0x1BE7, 0, 1 }, { 0xA, 0, 0x1BE8, 0, 1 },
+  { 0x2, 0, 0x1BE9, 0, 1 }, { 0xA, 0, 0x1BEA, 0, 1 }, { 0xA, 0, 0x1BEB, 0, 1 },
+  { 0x2, 0, 0x1BEC, 0, 1 }, { 0x2, 0, 0x1BED, 0, 1 }, { 0xA, 0, 0x1BEE, 0, 1 },
+  { 0xA, 0, 0x1BEF, 0, 1 }, { 0xA, 0, 0x1BF0, 0, 1 }, { 0xA, 0, 0x1BF1, 0, 1 },
+  { 0xA, 0, 0x1BF2, 0, 1 }, { 0xA, 0, 0x1BF3, 0, 1 }, { 0xA, 0, 0x1BF4, 0, 1 },
+  { 0xA, 0, 0x1BF5, 0, 1 }, { 0x2, 0, 0x1BF6, 0, 1 }, { 0xA, 0, 0x1BF7, 0, 1 },
+  { 0x2, 0, 0x1BF8, 0, 1 }, { 0xA, 0, 0x1BF9, 0, 1 }, { 0x2, 0, 0x1BFA, 0, 1 },
+  { 0xA, 0, 0x1BFB, 0, 1 }, { 0xA, 0, 0x1BFC, 0, 1 }, { 0x2, 0, 0x1BFD, 0, 1 },
+  { 0xA, 0, 0x1BFE, 0, 1 }, { 0xA, 0, 0x1BFF, 0, 1 }, { 0x2, 0, 0x1C00, 0, 1 },
+  { 0x2, 0, 0x1C01, 0, 1 }, { 0xA, 0, 0x1C02, 0, 1 }, { 0xA, 0, 0x1C03, 0, 1 },
+  { 0xA, 0, 0x1C04, 0, 1 }, { 0xA, 0, 0x1C05, 0, 1 }, { 0xA, 0, 0x1C06, 0, 1 },
+  { 0xA, 0, 0x1C07, 0, 1 }, { 0xA, 0, 0x1C08, 0, 1 }, { 0xA, 0, 0x1C09, 0, 1 },
+  { 0xA, 0, 0x1C0A, 0, 1 }, { 0xA, 0, 0x1C0B, 0, 1 }, { 0xA, 0, 0x1C0C, 0, 1 },
+  { 0x2, 0, 0x1C0D, 0, 1 }, { 0xA, 0, 0x1C0E, 0, 1 }, { 0x2, 0, 0x1C0F, 0, 1 },
+  { 0x2, 0, 0x1C10, 0, 1 }, { 0xA, 0, 0x1C11, 0, 1 }, { 0x2, 0, 0x1C12, 0, 1 },
+  { 0x2, 0, 0x1C13, 0, 1 }, { 0x2, 0, 0x1C14, 0, 1 }, { 0xA, 0, 0x1C15, 0, 1 },
+  { 0xA, 0, 0x1C16, 0, 1 }, { 0x2, 0, 0x1C17, 0, 1 }, { 0x2, 0, 0x1C18, 0, 1 },
+  { 0x2, 0, 0x1C19, 0, 1 }, { 0x2, 0, 0x1C1A, 0, 1 }, { 0xA, 0, 0x1C1B, 0, 1 },
+  { 0xA, 0, 0x1C1C, 0, 1 }, { 0xA, 0, 0x1C1D, 0, 1 }, { 0xA, 0, 0x1C1E, 0, 1 },
+  { 0xA, 0, 0x1C1F, 0, 1 }, { 0x2, 0, 0x1C20, 0, 1 }, { 0xA, 0, 0x1C21, 0, 1 },
+  { 0xA, 0, 0x1C22, 0, 1 }, { 0x2, 0, 0x1C23, 0, 1 }, { 0x2, 0, 0x1C24, 0, 1 },
+  { 0x2, 0, 0x1C25, 0, 1 }, { 0xA, 0, 0x1C26, 0, 1 }, { 0xA, 0, 0x1C27, 0, 1 },
+  { 0xA, 0, 0x1C28, 0, 1 }, { 0xA, 0, 0x1C29, 0, 1 }, { 0x2, 0, 0x1C2A, 0, 1 },
+  { 0x2, 0, 0x1C2B, 0, 1 }, { 0xA, 0, 0x1C2C, 0, 1 }, { 0xA, 0, 0x1C2D, 0, 1 },
+  { 0x2, 0, 0x1C2E, 0, 1 }, { 0xA, 0, 0x1C2F, 0, 1 }, { 0xA, 0, 0x1C30, 0, 1 },
+  { 0xA, 0, 0x1C31, 0, 1 }, { 0x2, 0, 0x1C32, 0, 1 }, { 0xA, 0, 0x1C33, 0, 1 },
+  { 0xA, 0, 0x1C34, 0, 1 }, { 0xA, 0, 0x1C35, 0, 1 }, { 0xA, 0, 0x1C36, 0, 1 },
+  { 0xA, 0, 0x1C37, 0, 1 }, { 0x2, 0, 0x1C38, 0, 1 }, { 0xA, 0, 0x1C39, 0, 1 },
+  { 0xA, 0, 0x1C3A, 0, 1 }, { 0xA, 0, 0x1C3B, 0, 1 }, { 0xA, 0, 0x1C3C, 0, 1 },
+  { 0xA, 0, 0x1C3D, 0, 1 }, { 0xA, 0, 0x1C3E, 0, 1 }, { 0x2, 0, 0x1C3F, 0, 1 },
+  { 0x2, 0, 0x1C40, 0, 1 }, { 0xA, 0, 0x1C41, 0, 1 }, { 0x2, 0, 0x1C42, 0, 1 },
+  { 0xA, 0, 0x1C43, 0, 1 }, { 0x2, 0, 0x1C44, 0, 1 }, { 0xA, 0, 0x1C45, 0, 1 },
+  { 0xA, 0, 0x1C46, 0, 1 }, { 0x2, 0, 0x1C47, 0, 1 }, { 0x2, 0, 0x1C48, 0, 1 },
+  { 0xA, 0, 0x1C49, 0, 1 }, { 0x2, 0, 0x1C4A, 0, 1 }, { 0xA, 0, 0x1C4B, 0, 1 },
+  { 0x2, 0, 0x1C4C, 0, 1 }, { 0xA, 0, 0x1C4D, 0, 1 }, { 0xA, 0, 0x1C4E, 0, 1 },
+  { 0xA, 0, 0x1C4F, 0, 1 }, { 0xA, 0, 0x1C50, 0, 1 }, { 0xA, 0, 0x1C51, 0, 1 },
+  { 0xA, 0, 0x1C52, 0, 1 }, { 0x2, 0, 0x1C53, 0, 1 }, { 0x2, 0, 0x1C54, 0, 1 },
+  { 0x2, 0, 0x1C55, 0, 1 }, { 0x2, 0, 0x1C56, 0, 1 }, { 0xA, 0, 0x1C57, 0, 1 },
+  { 0xA, 0, 0x1C58, 0, 1 }, { 0xA, 0, 0x1C59, 0, 1 }, { 0xA, 0, 0x1C5A, 0, 1 },
+  { 0xA, 0, 0x1C5B, 0, 1 }, { 0xA, 0, 0x1C5C, 0, 1 }, { 0xA, 0, 0x1C5D, 0, 1 },
+  { 0xA, 0, 0x1C5E, 0, 1 }, { 0xA, 0, 0x1C5F, 0, 1 }, { 0xA, 0, 0x1C60, 0, 1 },
+  { 0xA, 0, 0x1C61, 0, 1 }, { 0x2, 0, 0x1C62, 0, 1 }, { 0xA, 0, 0x1C63, 0, 1 },
+  { 0xA, 0, 0x1C64, 0, 1 }, { 0xA, 0, 0x1C65, 0, 1 }, { 0xA, 0, 0x1C66, 0, 1 },
+  { 0xA, 0, 0x1C67, 0, 1 }, { 0xA, 0, 0x1C68, 0, 1 }, { 0xA, 0, 0x1C69, 0, 1 },
+  { 0xA, 0, 0x1C6A, 0, 1 }, { 0xA, 0, 0x1C6B, 0, 1 }, { 0xA, 0, 0x1C6C, 0, 1 },
+  { 0x2, 0, 0x1C6D, 0, 1 }, { 0x2, 0, 0x1C6E, 0, 1 }, { 0x2, 0, 0x1C6F, 0, 1 },
+  { 0xA, 0, 0x1C70, 0, 1 }, { 0xA, 0, 0x1C71, 0, 1 }, { 0xA, 0, 0x1C72, 0, 1 },
+  { 0xA, 0, 0x1C73, 0, 1 }, { 0x2, 0, 0x1C74, 0, 1 }, { 0xA, 0, 0x1C75, 0, 1 },
+  { 0x2, 0, 0x1C76, 0, 1 }, { 0xA, 0, 0x1C77, 0, 1 }, { 0xA, 0, 0x1C78, 0, 1 },
+  { 0x2, 0, 0x1C79, 0, 1 }, { 0x2, 0, 0x1C7A, 0, 1 }, { 0xA, 0, 0x1C7B, 0, 1 },
+  { 0xA, 0, 0x1C7C, 0, 1 }, { 0xA, 0, 0x1C7D, 0, 1 }, { 0xA, 0, 0x1C7E, 0, 1 },
+  { 0xA, 0, 0x1C7F, 0, 1 }, { 0xA, 0, 0x1C80, 0, 1 }, { 0xA, 0, 0x1C81, 0, 1 },
+  { 0xA, 0, 0x1C82, 0, 1 }, { 0xA, 0, 0x1C83, 0, 1 }, { 0xA, 0, 0x1C84, 0, 1 },
+  { 0xA, 0, 0x1C85, 0, 1 }, { 0xA, 0, 0x1C86, 0, 1 }, { 0xA, 0, 0x1C87, 0, 1 },
+  { 0xA, 0, 0x1C88, 0, 1 }, { 0xA, 0, 0x1C89, 0, 1 }, { 0xA, 0, 0x1C8A, 0, 1 },
+  { 0xA, 0, 0x1C8B, 0, 1 }, { 0x2, 0, 0x1C8C, 0, 1 }, { 0xA, 0, 0x1C8D, 0, 1 },
+  { 0xA, 0, 0x1C8E, 0, 1 }, { 0xA, 0, 0x1C8F, 0, 1 }, { 0xA, 0, 0x1C90, 0, 1 },
+  { 0xA, 0, 0x1C91, 0, 1 }, { 0x2, 0, 0x1C92, 0, 1 }, { 0x2, 0, 0x1C93, 0, 1 },
+  { 0xA, 0, 0x1C94, 0, 1 }, { 0xA, 0, 0x1C95, 0, 1 }, { 0xA, 0, 0x1C96, 0, 1 },
+  { 0xA, 0, 0x1C97, 0, 1 }, { 0x2, 0, 0x1C98, 0, 1 }, { 0xA, 0, 0x1C99, 0, 1 },
+  { 0xA, 0, 0x1C9A, 0, 1 }, { 0xA, 0, 0x1C9B, 0, 1 }, { 0xA, 0, 0x1C9C, 0, 1 },
+  { 0x2, 0, 0x1C9D, 0, 1 }, { 0x2, 0, 0x1C9E, 0, 1 }, { 0xA, 0, 0x1C9F, 0, 1 },
+  { 0xA, 0, 0x1CA0, 0, 1 }, { 0xA, 0, 0x1CA1, 0, 1 }, { 0x2, 0, 0x1CA2, 0, 1 },
+  { 0xA, 0, 0x1CA3, 0, 1 }, { 0x2, 0, 0x1CA4, 0, 1 }, { 0x2, 0, 0x1CA5, 0, 1 },
+  { 0xA, 0, 0x1CA6, 0, 1 }, { 0xA, 0, 0x1CA7, 0, 1 }, { 0xA, 0, 0x1CA8, 0, 1 },
+  { 0x2, 0, 0x1CA9, 0, 1 }, { 0xA, 0, 0x1CAA, 0, 1 }, { 0xA, 0, 0x1CAB, 0, 1 },
+  { 0xA, 0, 0x1CAC, 0, 1 }, { 0xA, 0, 0x1CAD, 0, 1 }, { 0xA, 0, 0x1CAE, 0, 1 },
+  { 0xA, 0, 0x1CAF, 0, 1 }, { 0xA, 0, 0x1CB0, 0, 1 }, { 0x2, 0, 0x1CB1, 0, 1 },
+  { 0xA, 0, 0x1CB2, 0, 1 }, { 0xA, 0, 0x1CB3, 0, 1 }, { 0xA, 0, 0x1CB4, 0, 1 },
+  { 0x2, 0, 0x1CB5, 0, 1 }, { 0xA, 0, 0x1CB6, 0, 1 }, { 0xA, 0, 0x1CB7, 0, 1 },
+  { 0xA, 0, 0x1CB8, 0, 1 }, { 0xA, 0, 0x1CB9, 0, 1 }, { 0x2, 0, 0x1CBA, 0, 1 },
+  { 0x2, 0, 0x1CBB, 0, 1 }, { 0xA, 0, 0x1CBC, 0, 1 }, { 0xA, 0, 0x1CBD, 0, 1 },
+  { 0xA, 0, 0x1CBE, 0, 1 }, { 0x2, 0, 0x1CBF, 0, 1 }, { 0xA, 0, 0x1CC0, 0, 1 },
+  { 0x2, 0, 0x1CC1, 0, 1 }, { 0xA, 0, 0x1CC2, 0, 1 }, { 0x2, 0, 0x1CC3, 0, 1 },
+  { 0xA, 0, 0x1CC4, 0, 1 }, { 0xA, 0, 0x1CC5, 0, 1 }, { 0xA, 0, 0x1CC6, 0, 1 },
+  { 0xA, 0, 0x1CC7, 0, 1 }, { 0xA, 0, 0x1CC8, 0, 1 }, { 0xA, 0, 0x1CC9, 0, 1 },
+  { 0xA, 0, 0x1CCA, 0, 1 }, { 0x2, 0, 0x1CCB, 0, 1 }, { 0xA, 0, 0x1CCC, 0, 1 },
+  { 0xA, 0, 0x1CCD, 0, 1 }, { 0xA, 0, 0x1CCE, 0, 1 }, { 0xA, 0, 0x1CCF, 0, 1 },
+  { 0xA, 0, 0x1CD0, 0, 1 }, { 0x2, 0, 0x1CD1, 0, 1 }, { 0xA, 0, 0x1CD2, 0, 1 },
+  { 0x2, 0, 0x1CD3, 0, 1 }, { 0x2, 0, 0x1CD4, 0, 1 }, { 0x2, 0, 0x1CD5, 0, 1 },
+  { 0xA, 0, 0x1CD6, 0, 1 }, { 0xA, 0, 0x1CD7, 0, 1 }, { 0xA, 0, 0x1CD8, 0, 1 },
+  { 0xA, 0, 0x1CD9, 0, 1 }, { 0xA, 0, 0x1CDA, 0, 1 }, { 0xA, 0, 0x1CDB, 0, 1 },
+  { 0xA, 0, 0x1CDC, 0, 1 }, { 0xA, 0, 0x1CDD, 0, 1 }, { 0x2, 0, 0x1CDE, 0, 1 }
+};
+
+inline constexpr std::uint16_t props_mapping[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 16685, 97, 0, 17783, 50, 51, 17785, 956, 17787, 49, 111,
+  24868, 24871, 24874, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238,
+  239, 240, 241, 242, 243, 244, 245, 246, 248, 249, 250, 251, 252, 253, 254, 17789, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 257, 0, 259, 0, 261, 0,
+  263, 0, 265, 0, 267, 0, 269, 0, 271, 0, 273, 275, 0, 277, 0, 279, 0, 281, 0, 283, 0, 285, 0, 287,
+  0, 289, 0, 291, 0, 293, 0, 295, 297, 0, 299, 0, 301, 0, 303, 0, 17791, 17793, 309, 0, 311, 0, 314,
+  0, 316, 0, 318, 0, 17795, 322, 324, 0, 326, 0, 328, 0, 17797, 331, 333, 0, 335, 0, 337, 0, 339,
+  341, 0, 343, 0, 345, 0, 347, 0, 349, 0, 351, 0, 353, 0, 355, 0, 357, 0, 359, 361, 0, 363, 0, 365,
+  0, 367, 0, 369, 0, 371, 0, 373, 0, 375, 0, 255, 378, 0, 380, 0, 382, 0, 115, 595, 387, 389, 596,
+  392, 598, 599, 396, 477, 601, 603, 402, 608, 611, 617, 616, 409, 623, 626, 629, 417, 0, 419, 421,
+  640, 424, 643, 429, 648, 432, 0, 650, 651, 436, 438, 658, 441, 445, 17799, 17801, 17803, 462, 0,
+  464, 0, 466, 0, 468, 0, 470, 0, 472, 0, 474, 0, 476, 0, 479, 0, 481, 0, 483, 0, 485, 487, 0, 489,
+  0, 491, 0, 493, 0, 495, 0, 0, 17805, 501, 0, 405, 447, 505, 0, 507, 0, 509, 0, 511, 0, 513, 0,
+  515, 0, 517, 0, 519, 0, 521, 0, 523, 0, 525, 0, 527, 0, 529, 0, 531, 0, 533, 0, 535, 0, 537, 0,
+  539, 0, 541, 543, 0, 414, 547, 549, 551, 0, 553, 0, 555, 0, 557, 0, 559, 0, 561, 0, 563, 0, 11365,
+  572, 410, 11366, 578, 384, 649, 652, 583, 585, 587, 589, 591, 0, 104, 614, 106, 114, 633, 635,
+  641, 119, 121, 17807, 17809, 17811, 17813, 17815, 17817, 108, 115, 120, 661, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 768, 769, 787, 16686, 953, 0, 0, 881, 883, 697, 887, 17819, 59, 1011, 24877, 940, 183,
+  941, 942, 943, 972, 973, 974, 0, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 957, 958,
+  959, 960, 961, 963, 964, 965, 966, 967, 968, 969, 970, 971, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 963,
+  0, 0, 0, 0, 0, 0, 0, 983, 965, 973, 971, 985, 987, 989, 991, 993, 995, 997, 999, 1001, 1003, 1005,
+  1007, 961, 949, 1016, 1019, 891, 892, 893, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112,
+  1113, 1114, 1115, 1116, 1117, 1118, 1119, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080,
+  1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096,
+  1097, 1098, 1099, 1100, 1101, 1102, 1103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1121, 1123, 1125, 1127, 1129, 1131, 1133, 1135, 1137, 1139, 1141, 0, 1143, 0, 1145, 1147,
+  1149, 1151, 1153, 0, 1163, 1165, 1167, 1169, 1171, 1173, 1175, 1177, 1179, 1181, 1183, 1185, 1187,
+  1189, 1191, 1193, 1195, 1197, 1199, 1201, 1203, 1205, 1207, 1209, 1211, 1213, 1215, 1231, 1218, 0,
+  1220, 1222, 1224, 1226, 1228, 1230, 1233, 0, 1235, 0, 1237, 1239, 0, 1241, 0, 1243, 0, 1245, 0,
+  1247, 0, 1249, 1251, 0, 1253, 0, 1255, 0, 1257, 0, 1259, 0, 1261, 0, 1263, 0, 1265, 0, 1267, 0,
+  1269, 0, 1271, 1273, 0, 1275, 1277, 1279, 1281, 1283, 1285, 1287, 1289, 1291, 1293, 1295, 1297,
+  1299, 1301, 1303, 1305, 1307, 1309, 1311, 1313, 1315, 1317, 1319, 1321, 1323, 1325, 1327, 1377,
+  1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
+  1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409,
+  1410, 1411, 1412, 1413, 1414, 17821, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17823, 17825, 17827, 17829, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17831, 17833, 17835, 17837, 17839, 17841, 17843, 17845, 0, 0,
+  0, 0, 0, 17847, 17849, 17851, 17853, 17855, 17857, 17859, 17861, 17863, 0, 0, 0, 0, 0, 17865,
+  17867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  17869, 0, 0, 17871, 0, 0, 17873, 17875, 3851, 0, 17877, 17879, 17881, 17883, 17885, 17887, 0, 0,
+  17889, 0, 17891, 17893, 24880, 17895, 24883, 16689, 17897, 17899, 17901, 17903, 17905, 17907, 0,
+  0, 11520, 11521, 11522, 11523, 11524, 11525, 11526, 11527, 11528, 11529, 11530, 11531, 11532,
+  11533, 11534, 11535, 11536, 11537, 11538, 11539, 11540, 11541, 11542, 11543, 11544, 11545, 11546,
+  11547, 11548, 11549, 11550, 11551, 11552, 11553, 11554, 11555, 11556, 11557, 11559, 11565, 4316,
+  0, 5104, 5105, 5106, 5107, 5108, 5109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1086, 42571, 7306, 4304, 4305, 4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313,
+  4314, 4315, 4317, 4318, 4319, 4320, 4321, 4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330,
+  4331, 4332, 4333, 4334, 4335, 4336, 4337, 4338, 4339, 4340, 4341, 4342, 4343, 4344, 4345, 4346,
+  4349, 4350, 4351, 230, 98, 100, 101, 103, 105, 107, 109, 110, 112, 116, 117, 592, 593, 7426, 604,
+  7446, 7447, 7453, 118, 7461, 594, 99, 597, 102, 607, 609, 613, 618, 7547, 669, 621, 7557, 671,
+  625, 624, 627, 628, 632, 642, 427, 7452, 122, 656, 657, 658, 0, 0, 7681, 0, 7683, 0, 7685, 0,
+  7687, 0, 7689, 0, 7691, 0, 7693, 0, 7695, 0, 7697, 0, 7699, 0, 7701, 0, 7703, 0, 7705, 0, 7707, 0,
+  7709, 0, 7711, 0, 7713, 0, 7715, 0, 7717, 0, 7719, 0, 7721, 0, 7723, 0, 7725, 0, 7727, 0, 7729, 0,
+  7731, 0, 7733, 0, 7735, 0, 7737, 0, 7739, 0, 7741, 0, 7743, 0, 7745, 0, 7747, 0, 7749, 0, 7751, 0,
+  7753, 0, 7755, 0, 7757, 0, 7759, 0, 7761, 0, 7763, 0, 7765, 0, 7767, 0, 7769, 0, 7771, 0, 7773, 0,
+  7775, 0, 7777, 0, 7779, 0, 7781, 0, 7783, 0, 7785, 0, 7787, 0, 7789, 0, 7791, 0, 7793, 0, 7795, 0,
+  7797, 0, 7799, 0, 7801, 0, 7803, 0, 7805, 0, 7807, 0, 7809, 0, 7811, 0, 7813, 0, 7815, 0, 7817, 0,
+  7819, 0, 7821, 0, 7823, 0, 7825, 0, 7827, 0, 7829, 0, 0, 0, 0, 0, 17909, 7777, 223, 7841, 0, 7843,
+  0, 7845, 0, 7847, 0, 7849, 0, 7851, 0, 7853, 0, 7855, 0, 7857, 0, 7859, 0, 7861, 0, 7863, 0, 7865,
+  0, 7867, 0, 7869, 0, 7871, 0, 7873, 0, 7875, 0, 7877, 0, 7879, 0, 7881, 0, 7883, 0, 7885, 0, 7887,
+  0, 7889, 0, 7891, 0, 7893, 0, 7895, 0, 7897, 0, 7899, 0, 7901, 0, 7903, 0, 7905, 0, 7907, 0, 7909,
+  0, 7911, 0, 7913, 0, 7915, 0, 7917, 0, 7919, 0, 7921, 0, 7923, 0, 7925, 0, 7927, 0, 7929, 0, 7931,
+  7933, 7935, 0, 0, 0, 0, 0, 0, 0, 0, 7936, 7937, 7938, 7939, 7940, 7941, 7942, 7943, 0, 0, 0, 0, 0,
+  0, 7952, 7953, 7954, 7955, 7956, 7957, 0, 0, 0, 0, 0, 0, 0, 0, 7968, 7969, 7970, 7971, 7972, 7973,
+  7974, 7975, 0, 0, 0, 0, 0, 0, 0, 0, 7984, 7985, 7986, 7987, 7988, 7989, 7990, 7991, 0, 0, 0, 0, 0,
+  0, 8000, 8001, 8002, 8003, 8004, 8005, 0, 0, 0, 0, 0, 0, 0, 0, 8017, 8019, 8021, 8023, 0, 0, 0, 0,
+  0, 0, 0, 0, 8032, 8033, 8034, 8035, 8036, 8037, 8038, 8039, 0, 940, 0, 941, 0, 942, 0, 943, 0,
+  972, 0, 973, 0, 974, 17911, 17913, 17915, 17917, 17919, 17921, 17923, 17925, 17911, 17913, 17915,
+  17917, 17919, 17921, 17923, 17925, 17927, 17929, 17931, 17933, 17935, 17937, 17939, 17941, 17927,
+  17929, 17931, 17933, 17935, 17937, 17939, 17941, 17943, 17945, 17947, 17949, 17951, 17953, 17955,
+  17957, 17943, 17945, 17947, 17949, 17951, 17953, 17955, 17957, 0, 0, 17959, 17961, 17963, 0,
+  17965, 8112, 8113, 8048, 940, 17961, 16697, 953, 16697, 17967, 24886, 17969, 17971, 17973, 0,
+  17975, 8050, 941, 8052, 942, 17971, 24889, 24892, 24895, 0, 0, 0, 912, 0, 0, 8144, 8145, 8054,
+  943, 24898, 24901, 24904, 0, 0, 0, 944, 0, 0, 0, 0, 8160, 8161, 8058, 973, 8165, 24907, 24877, 96,
+  17977, 17979, 17981, 0, 17983, 8056, 972, 8060, 974, 17979, 17785, 16706, 32, 32, 0, 8208, 17985,
+  16492, 24684, 16718, 24910, 17987, 17989, 17991, 17993, 17995, 32876, 48, 52, 53, 54, 55, 56, 57,
+  43, 8722, 61, 40, 41, 17997, 24913, 24916, 17999, 24919, 24922, 18001, 18003, 18005, 24925, 18007,
+  969, 107, 229, 8526, 1488, 1489, 1490, 1491, 24928, 8721, 24931, 24934, 32880, 24937, 24940,
+  24943, 24946, 24949, 24952, 24955, 24958, 24961, 24964, 24967, 24970, 16496, 16501, 24693, 18009,
+  16500, 24692, 32884, 18011, 16781, 24973, 8580, 24976, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 16548, 24740, 16787, 24979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12296, 12297, 16498, 16509, 16513, 16517, 16521,
+  16525, 16529, 16533, 16537, 16541, 16545, 24982, 24985, 24988, 24991, 24994, 24997, 25000, 25003,
+  25006, 32888, 32892, 32896, 32900, 32904, 32908, 32912, 32916, 32920, 32924, 32928, 25009, 25012,
+  25015, 25018, 25021, 25024, 25027, 25030, 25033, 25036, 25039, 25042, 25045, 25048, 25051, 25054,
+  25057, 25060, 25063, 25066, 25069, 25072, 25075, 25078, 25081, 25084, 32932, 25087, 16897, 25090,
+  18013, 11312, 11313, 11314, 11315, 11316, 11317, 11318, 11319, 11320, 11321, 11322, 11323, 11324,
+  11325, 11326, 11327, 11328, 11329, 11330, 11331, 11332, 11333, 11334, 11335, 11336, 11337, 11338,
+  11339, 11340, 11341, 11342, 11343, 11344, 11345, 11346, 11347, 11348, 11349, 11350, 11351, 11352,
+  11353, 11354, 11355, 11356, 11357, 11358, 11359, 11361, 619, 7549, 637, 11368, 11370, 11372,
+  11379, 11382, 575, 576, 11393, 11395, 11397, 11399, 11401, 11403, 11405, 11407, 11409, 11411,
+  11413, 11415, 11417, 11419, 11421, 11423, 11425, 11427, 11429, 11431, 11433, 11435, 11437, 11439,
+  11441, 11443, 11445, 11447, 11449, 11451, 11453, 11455, 11457, 11459, 11461, 11463, 11465, 11467,
+  11469, 11471, 11473, 11475, 11477, 11479, 11481, 11483, 11485, 11487, 11489, 11491, 11500, 11502,
+  11507, 11617, 27597, 40863, 19968, 20008, 20022, 20031, 20057, 20101, 20108, 20128, 20154, 20799,
+  20837, 20843, 20866, 20886, 20907, 20960, 20981, 20992, 21147, 21241, 21269, 21274, 21304, 21313,
+  21340, 21353, 21378, 21430, 21448, 21475, 22231, 22303, 22763, 22786, 22794, 22805, 22823, 22899,
+  23376, 23424, 23544, 23567, 23586, 23608, 23662, 23665, 24027, 24037, 24049, 24062, 24178, 24186,
+  24191, 24308, 24318, 24331, 24339, 24400, 24417, 24435, 24515, 25096, 25142, 25163, 25903, 25908,
+  25991, 26007, 26020, 26041, 26080, 26085, 26352, 26376, 26408, 27424, 27490, 27513, 27571, 27595,
+  27604, 27611, 27663, 27668, 27700, 28779, 29226, 29238, 29243, 29247, 29255, 29273, 29275, 29356,
+  29572, 29577, 29916, 29926, 29976, 29983, 29992, 30000, 30091, 30098, 30326, 30333, 30382, 30399,
+  30446, 30683, 30690, 30707, 31034, 31160, 31166, 31348, 31435, 31481, 31859, 31992, 32566, 32593,
+  32650, 32701, 32769, 32780, 32786, 32819, 32895, 32905, 33251, 33258, 33267, 33276, 33292, 33307,
+  33311, 33390, 33394, 33400, 34381, 34411, 34880, 34892, 34915, 35198, 35211, 35282, 35328, 35895,
+  35910, 35925, 35960, 35997, 36196, 36208, 36275, 36523, 36554, 36763, 36784, 36789, 37009, 37193,
+  37318, 37324, 37329, 38263, 38272, 38428, 38582, 38585, 38632, 38737, 38750, 38754, 38761, 38859,
+  38893, 38899, 38913, 39080, 39131, 39135, 39318, 39321, 39340, 39592, 39640, 39647, 39717, 39727,
+  39730, 39740, 39770, 40165, 40565, 40575, 40613, 40635, 40643, 40653, 40657, 40697, 40701, 40718,
+  40723, 40736, 40763, 40778, 40786, 40845, 40860, 40864, 46, 0, 12306, 21316, 21317, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18015, 18017, 0, 0, 18019, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18021, 4352, 4353, 4522, 4354, 4524, 4525, 4355, 4356, 4357, 4528,
+  4529, 4530, 4531, 4532, 4533, 4378, 4358, 4359, 4360, 4385, 4361, 4362, 4363, 4364, 4365, 4366,
+  4367, 4368, 4369, 4370, 4449, 4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460,
+  4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 4372, 4373, 4551, 4552, 4556, 4558, 4563,
+  4567, 4569, 4380, 4573, 4575, 4381, 4382, 4384, 4386, 4387, 4391, 4393, 4395, 4396, 4397, 4398,
+  4399, 4402, 4406, 4416, 4423, 4428, 4593, 4594, 4439, 4440, 4441, 4484, 4485, 4488, 4497, 4498,
+  4500, 4510, 4513, 19977, 22235, 19978, 20013, 19979, 30002, 19993, 19969, 22825, 22320, 25093,
+  25096, 25099, 25102, 25105, 25108, 25111, 25114, 25117, 25120, 25123, 25126, 25129, 25132, 25135,
+  25138, 25141, 25144, 25147, 25150, 25153, 25156, 25159, 25162, 25165, 25168, 25171, 25174, 25177,
+  32936, 32940, 25180, 25183, 25186, 25189, 25192, 25195, 25198, 25201, 25204, 25207, 25210, 25213,
+  25216, 25219, 25222, 25225, 25228, 25231, 25234, 25237, 25240, 25243, 25246, 25249, 25252, 25255,
+  25258, 25261, 25264, 25267, 25270, 25273, 25276, 25279, 25282, 25285, 21839, 24188, 31631, 25288,
+  17252, 17255, 16681, 17261, 17378, 17381, 17384, 17387, 17390, 17393, 16750, 16747, 18023, 18025,
+  18027, 44032, 45208, 45796, 46972, 47560, 48148, 49324, 50500, 51088, 52264, 52852, 53440, 54028,
+  54616, 18029, 18031, 50864, 20116, 20845, 19971, 20061, 26666, 26377, 31038, 21517, 29305, 36001,
+  31069, 21172, 31192, 30007, 36969, 20778, 21360, 27880, 38917, 20241, 20889, 27491, 24038, 21491,
+  21307, 23447, 23398, 30435, 20225, 36039, 21332, 22812, 18033, 18035, 18037, 18039, 18041, 16678,
+  18043, 18026, 18045, 18047, 18049, 18051, 18053, 18055, 18057, 17103, 17106, 18059, 18061, 18063,
+  18065, 18067, 18069, 18071, 25291, 25294, 25297, 18073, 25300, 18075, 25303, 12450, 12452, 12454,
+  12456, 12458, 12459, 12461, 12463, 12465, 12467, 12469, 12471, 12473, 12475, 12477, 12479, 12481,
+  12484, 12486, 12488, 12490, 12491, 12492, 12493, 12494, 12495, 12498, 12501, 12504, 12507, 12510,
+  12511, 12512, 12513, 12514, 12516, 12518, 12520, 12521, 12522, 12523, 12524, 12525, 12527, 12528,
+  12529, 12530, 18077, 32944, 32948, 32952, 25306, 32956, 25309, 25312, 40998, 32960, 25315, 25318,
+  25321, 32964, 32968, 25324, 25327, 18079, 25330, 32972, 32976, 16410, 41003, 49178, 41008, 24621,
+  41013, 41018, 32980, 25333, 25336, 25339, 32984, 41023, 32988, 25342, 24646, 25345, 18081, 18083,
+  16440, 18085, 25348, 25351, 41028, 25354, 32992, 41033, 25357, 18087, 18089, 41038, 32996, 41043,
+  25360, 41048, 18091, 25363, 25366, 25369, 25372, 25375, 33000, 25378, 18093, 25381, 25384, 25387,
+  33004, 25390, 25393, 25396, 41053, 33008, 16482, 41058, 16628, 33012, 32796, 25399, 25402, 25405,
+  33016, 18095, 25408, 33020, 18097, 41063, 24626, 17220, 17223, 17226, 17229, 17232, 17235, 17238,
+  17241, 17244, 17247, 25411, 25414, 25417, 25420, 25423, 25426, 25429, 25432, 25435, 25438, 25441,
+  25444, 25447, 25450, 25453, 25456, 18099, 18101, 25459, 18103, 18105, 17270, 25462, 25465, 18107,
+  18109, 18111, 18113, 18115, 33024, 17265, 18117, 18119, 17329, 18121, 18123, 18125, 18127, 24837,
+  33028, 18129, 18131, 18133, 18135, 18137, 16654, 17277, 25468, 25471, 25474, 25477, 18139, 18141,
+  18143, 18145, 18147, 18149, 18151, 17288, 17291, 17294, 25480, 25483, 17271, 25486, 25489, 25492,
+  17274, 25495, 24840, 33032, 25498, 25501, 25504, 24608, 40992, 49184, 18153, 18155, 18157, 18159,
+  17754, 18161, 18163, 17326, 18165, 18167, 18169, 18171, 18173, 18175, 18177, 18179, 18181, 18183,
+  18185, 33036, 18187, 18189, 18191, 17264, 18193, 18195, 18197, 16647, 18199, 25507, 18201, 25510,
+  25513, 18203, 25516, 18205, 18207, 18209, 18211, 25519, 25522, 17337, 17340, 17343, 17346, 17349,
+  17352, 17355, 17358, 17361, 25525, 25528, 25531, 25534, 25537, 25540, 25543, 25546, 25549, 25552,
+  25555, 25558, 25561, 25564, 25567, 25570, 25573, 25576, 25579, 25582, 25585, 25588, 25591, 42561,
+  42563, 42565, 42567, 42569, 42573, 42575, 42577, 42579, 42581, 42583, 42585, 42587, 42589, 42591,
+  42593, 42595, 42597, 42599, 42601, 42603, 42605, 42625, 42627, 42629, 42631, 42633, 42635, 42637,
+  42639, 42641, 42643, 42645, 42647, 42649, 42651, 42787, 42789, 42791, 42793, 42795, 42797, 42799,
+  42803, 42805, 42807, 42809, 42811, 42813, 42815, 42817, 42819, 42821, 42823, 42825, 42827, 42829,
+  42831, 42833, 42835, 42837, 42839, 42841, 42843, 42845, 42847, 42849, 42851, 42853, 42855, 42857,
+  42859, 42861, 42863, 42874, 42876, 7545, 42879, 42881, 42883, 42885, 42887, 42892, 42897, 42899,
+  42903, 42905, 42907, 42909, 42911, 42913, 42915, 42917, 42919, 42921, 620, 670, 647, 43859, 42933,
+  42935, 42937, 42939, 42941, 42943, 42945, 42947, 42900, 7566, 42952, 42954, 612, 42957, 42959,
+  42961, 42963, 42965, 42967, 42969, 42971, 411, 42998, 0, 43831, 43858, 653, 5024, 5025, 5026,
+  5027, 5028, 5029, 5030, 5031, 5032, 5033, 5034, 5035, 5036, 5037, 5038, 5039, 5040, 5041, 5042,
+  5043, 5044, 5045, 5046, 5047, 5048, 5049, 5050, 5051, 5052, 5053, 5054, 5055, 5056, 5057, 5058,
+  5059, 5060, 5061, 5062, 5063, 5064, 5065, 5066, 5067, 5068, 5069, 5070, 5071, 5072, 5073, 5074,
+  5075, 5076, 5077, 5078, 5079, 5080, 5081, 5082, 5083, 5084, 5085, 5086, 5087, 5088, 5089, 5090,
+  5091, 5092, 5093, 5094, 5095, 5096, 5097, 5098, 5099, 5100, 5101, 5102, 5103, 35912, 26356, 36554,
+  36040, 28369, 20018, 21477, 40860, 22865, 37329, 21895, 22856, 25078, 30313, 32645, 34367, 34746,
+  35064, 37007, 27138, 27931, 28889, 29662, 33853, 37226, 39409, 20098, 21365, 27396, 29211, 34349,
+  40478, 23888, 28651, 34253, 35172, 25289, 33240, 34847, 24266, 26391, 28010, 29436, 37070, 20358,
+  20919, 21214, 25796, 27347, 29200, 30439, 32769, 34310, 34396, 36335, 38706, 39791, 40442, 30860,
+  31103, 32160, 33737, 37636, 40575, 35542, 22751, 24324, 31840, 32894, 29282, 30922, 36034, 38647,
+  22744, 23650, 27155, 28122, 28431, 32047, 32311, 38475, 21202, 32907, 20956, 20940, 31260, 32190,
+  33777, 38517, 35712, 25295, 35582, 20025, 23527, 24594, 29575, 30064, 21271, 30971, 20415, 24489,
+  19981, 27852, 25976, 32034, 21443, 22622, 30465, 33865, 35498, 27578, 36784, 27784, 25342, 33509,
+  25504, 30053, 20142, 20841, 20937, 26753, 31975, 33391, 35538, 37327, 21237, 21570, 22899, 24300,
+  26053, 28670, 31018, 38317, 39530, 40599, 40654, 21147, 26310, 27511, 36706, 24180, 24976, 25088,
+  25754, 28451, 29001, 29833, 31178, 32244, 32879, 36646, 34030, 36899, 37706, 21015, 21155, 21693,
+  28872, 35010, 24265, 24565, 25467, 27566, 31806, 29557, 20196, 22265, 23994, 24604, 29618, 29801,
+  32666, 32838, 37428, 38646, 38728, 38936, 20363, 31150, 37300, 38584, 24801, 20102, 20698, 23534,
+  23615, 26009, 29134, 30274, 34044, 36988, 40845, 26248, 38446, 21129, 26491, 26611, 27969, 28316,
+  29705, 30041, 30827, 32016, 39006, 20845, 25134, 38520, 20523, 23833, 28138, 36650, 24459, 24900,
+  26647, 38534, 21033, 21519, 23653, 26131, 26446, 26792, 27877, 29702, 30178, 32633, 35023, 35041,
+  37324, 38626, 21311, 28346, 21533, 29136, 29848, 34298, 38563, 40023, 40607, 26519, 28107, 33256,
+  31435, 31520, 31890, 29376, 28825, 35672, 20160, 33590, 21050, 20999, 24230, 25299, 31958, 23429,
+  27934, 26292, 36667, 34892, 38477, 35211, 24275, 20800, 21952, 22618, 26228, 20958, 29482, 30410,
+  31036, 31070, 31077, 31119, 38742, 31934, 32701, 34322, 35576, 36920, 37117, 39151, 39164, 39208,
+  40372, 37086, 38583, 20398, 20711, 20813, 21193, 21220, 21329, 21917, 22022, 22120, 22592, 22696,
+  23652, 23662, 24724, 24936, 24974, 25074, 25935, 26082, 26257, 26757, 28023, 28186, 28450, 29038,
+  29227, 29730, 30865, 31038, 31049, 31048, 31056, 31062, 31069, 31117, 31118, 31296, 31361, 31680,
+  32265, 32321, 32626, 32773, 33261, 33401, 33879, 35088, 35222, 35585, 35641, 36051, 36104, 36790,
+  38627, 38911, 38971, 24693, 10353, 33304, 20006, 20917, 20840, 20352, 20805, 20864, 21191, 21242,
+  21845, 21913, 21986, 22707, 22852, 22868, 23138, 23336, 24274, 24281, 24425, 24493, 24792, 24910,
+  24840, 24928, 25140, 25540, 25628, 25682, 25942, 26395, 26454, 27513, 28379, 28363, 28702, 30631,
+  29237, 29359, 29809, 29958, 30011, 30237, 30239, 30427, 30452, 30538, 30528, 30924, 31409, 31867,
+  32091, 32574, 33618, 33775, 34681, 35137, 35206, 35519, 35531, 35565, 35722, 36664, 36978, 37273,
+  37494, 38524, 38875, 38923, 39698, 10354, 10355, 10356, 15261, 16408, 16441, 10357, 10358, 10359,
+  40771, 40846, 17402, 17403, 17406, 25594, 25597, 18213, 18215, 18217, 18219, 18221, 18223, 18225,
+  0, 18227, 1506, 1492, 1499, 1500, 1501, 1512, 1514, 18229, 18231, 25600, 25603, 18233, 18235,
+  18237, 18239, 18241, 18243, 18245, 18247, 18249, 18251, 18253, 18255, 18257, 18259, 18261, 18263,
+  18265, 18267, 18269, 18271, 18273, 18275, 17408, 18277, 18279, 18281, 18283, 18285, 18287, 1649,
+  1659, 1662, 1664, 1658, 1663, 1657, 1700, 1702, 1668, 1667, 1670, 1671, 1677, 1676, 1678, 1672,
+  1688, 1681, 1705, 1711, 1715, 1713, 1722, 1723, 1728, 1729, 1726, 1746, 1747, 1709, 1735, 1734,
+  1736, 1739, 1733, 1737, 1744, 1609, 18289, 18291, 18293, 18295, 18297, 18299, 18301, 18303, 1740,
+  18305, 18307, 18309, 18311, 18313, 17708, 17612, 18315, 18317, 18319, 17441, 17444, 17450, 17453,
+  18321, 18323, 18325, 18327, 18329, 18331, 17475, 17442, 17445, 16661, 17461, 18333, 17451, 17474,
+  17471, 17642, 17480, 17489, 17492, 18335, 17507, 17510, 18337, 18339, 17513, 18341, 17522, 16666,
+  18343, 17531, 18345, 18347, 17540, 17705, 18349, 18351, 18353, 17543, 18355, 18357, 18359, 18361,
+  18363, 18365, 18367, 17681, 18369, 18371, 17558, 17549, 17561, 16400, 16385, 16394, 16401, 16660,
+  17460, 17487, 17469, 17466, 17597, 17591, 18373, 17603, 18375, 18377, 18379, 17585, 18381, 18383,
+  17635, 17467, 18332, 17572, 18385, 17659, 18387, 18389, 18391, 25606, 25609, 25612, 25615, 25618,
+  25621, 18393, 18395, 18397, 16658, 18399, 18401, 18403, 18405, 18407, 18409, 18411, 18413, 18415,
+  18417, 18419, 18421, 18423, 18425, 17605, 18427, 18429, 18431, 18433, 18435, 16390, 18437, 18439,
+  16395, 18441, 18443, 17501, 18445, 25624, 25627, 25630, 18447, 18449, 18451, 18453, 18455, 18457,
+  18459, 18461, 18463, 18465, 17508, 17553, 17478, 17499, 17625, 17613, 18467, 18469, 18471, 18473,
+  17498, 17495, 18475, 18477, 18479, 18481, 18483, 18485, 25633, 25636, 25639, 25642, 25645, 25648,
+  25651, 25654, 25657, 25660, 25663, 25666, 25669, 25672, 25675, 25678, 25681, 25684, 25687, 25690,
+  25693, 25696, 25699, 25702, 25705, 25708, 25711, 25714, 25717, 25720, 25723, 25726, 25729, 25732,
+  25735, 25738, 25741, 25744, 25747, 25750, 25753, 25756, 25759, 24852, 25762, 25765, 25768, 25652,
+  25771, 25774, 25777, 25780, 25783, 25786, 25789, 25792, 25795, 25798, 25801, 25804, 25807, 25810,
+  25813, 25816, 25819, 25822, 25825, 25828, 25831, 25834, 25837, 25840, 25843, 25846, 25849, 25852,
+  25855, 25858, 25861, 25864, 25867, 25870, 25873, 25876, 25879, 25882, 25885, 25888, 25891, 25894,
+  25897, 25900, 25903, 25906, 25909, 25912, 32772, 33040, 33044, 33048, 33052, 32777, 32782, 24576,
+  60160, 57618, 33056, 44, 12289, 58, 59, 33, 63, 12310, 12311, 8212, 8211, 95, 123, 125, 12308,
+  12309, 12304, 12305, 12298, 12299, 12296, 12297, 12300, 12301, 12302, 12303, 91, 93, 35, 38, 42,
+  45, 60, 62, 92, 36, 37, 64, 18487, 18489, 17414, 17417, 17420, 17432, 17423, 17435, 17426, 17438,
+  17429, 18491, 18493, 18495, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579,
+  1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601,
+  1602, 1603, 1604, 1605, 1606, 1607, 1608, 1610, 18497, 18499, 18501, 16406, 34, 39, 47, 94, 96,
+  124, 126, 10629, 10630, 12539, 12449, 12451, 12453, 12455, 12457, 12515, 12517, 12519, 12483,
+  12540, 12531, 12441, 12442, 162, 163, 172, 166, 165, 8361, 9474, 8592, 8593, 8594, 8595, 9632,
+  9675, 10360, 10361, 10362, 10363, 10364, 10365, 10366, 10367, 10368, 10369, 10370, 10371, 10372,
+  10373, 10374, 10375, 10376, 10377, 10378, 10379, 10380, 10381, 10382, 10383, 10384, 10385, 10386,
+  10387, 10388, 10389, 10390, 10391, 10392, 10393, 10394, 10395, 10396, 10397, 10398, 10399, 10400,
+  10401, 10402, 10403, 10404, 10405, 10406, 10407, 10408, 10409, 10410, 10411, 10412, 10413, 10414,
+  10415, 10416, 10417, 10418, 10419, 10420, 10421, 10422, 10423, 10424, 10425, 10426, 10427, 10428,
+  10429, 10430, 10431, 10432, 10433, 10434, 10435, 10436, 10437, 10438, 10439, 10440, 10441, 10442,
+  10443, 10444, 10445, 10446, 10447, 10448, 10449, 10450, 10451, 10452, 10453, 10454, 10455, 10456,
+  10457, 10458, 10459, 10460, 10461, 10462, 10463, 10464, 10465, 10466, 10467, 10468, 10469, 10470,
+  0, 0, 0, 0, 720, 721, 665, 675, 43878, 677, 676, 7569, 600, 606, 681, 610, 667, 668, 615, 644,
+  682, 683, 10471, 42894, 622, 10472, 654, 10473, 248, 630, 631, 634, 10474, 638, 680, 678, 43879,
+  679, 11377, 655, 673, 674, 664, 448, 449, 450, 10475, 10476, 0, 10477, 10478, 10479, 10480, 10481,
+  10482, 10483, 10484, 10485, 10486, 10487, 10488, 10489, 10490, 10491, 10492, 10493, 10494, 10495,
+  10496, 10497, 10498, 10499, 10500, 10501, 10502, 10503, 10504, 10505, 10506, 10507, 10508, 10509,
+  10510, 10511, 10512, 10513, 10514, 10515, 10516, 10517, 10518, 10519, 10520, 10521, 10522, 10523,
+  10524, 10525, 10526, 10527, 10528, 10529, 10530, 10531, 10532, 10533, 10534, 10535, 10536, 10537,
+  10538, 10539, 10540, 10541, 10542, 10543, 10544, 10545, 10546, 10547, 10548, 10549, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10550, 10551,
+  10552, 10553, 10554, 10555, 10556, 10557, 10558, 10559, 10560, 10561, 10562, 10563, 10564, 10565,
+  10566, 10567, 10568, 10569, 10570, 10571, 10572, 10573, 10574, 10575, 10576, 10577, 10578, 10579,
+  10580, 10581, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10582, 10583, 10584, 10585,
+  10586, 10587, 10588, 10589, 10590, 10591, 10592, 10593, 10594, 10595, 10596, 10597, 10598, 10599,
+  10600, 10601, 10602, 10603, 10604, 10605, 10606, 10607, 10608, 10609, 10610, 10611, 10612, 10613,
+  10614, 10615, 10616, 10617, 10618, 10619, 10620, 10621, 10622, 10623, 10624, 10625, 10626, 10627,
+  10628, 10629, 10630, 10631, 10632, 10633, 10634, 10635, 10636, 10637, 10638, 0, 18503, 17723,
+  25915, 25918, 25921, 25924, 25927, 0, 0, 17738, 17741, 25930, 25933, 25936, 25939, 305, 567, 945,
+  951, 953, 959, 965, 969, 8711, 8706, 1072, 1075, 1077, 1078, 1079, 1080, 1082, 1091, 1095, 1099,
+  1101, 1241, 1110, 1257, 10639, 10640, 10641, 10642, 10643, 10644, 10645, 10646, 10647, 10648,
+  10649, 10650, 10651, 10652, 10653, 10654, 10655, 10656, 10657, 10658, 10659, 10660, 10661, 10662,
+  10663, 10664, 10665, 10666, 10667, 10668, 10669, 10670, 10671, 10672, 0, 1646, 1697, 1647, 18505,
+  18507, 18509, 18511, 18513, 18515, 18517, 18519, 18521, 18523, 25942, 18525, 18527, 18529, 17789,
+  25945, 18531, 18533, 18535, 18537, 18539, 18541, 18543, 23383, 21452, 12487, 22810, 35299, 20132,
+  26144, 28961, 26009, 21069, 24460, 20877, 26032, 21021, 32066, 36009, 22768, 21561, 28436, 25237,
+  25429, 36938, 25351, 25171, 31105, 31354, 21512, 28288, 30003, 21106, 21942, 37197, 25948, 25951,
+  25954, 25957, 25960, 25963, 25966, 25969, 25972, 24471, 21487, 20029, 20024, 20033, 10673, 20320,
+  20411, 20482, 20602, 20633, 20687, 13470, 10674, 20820, 20836, 20855, 10675, 13497, 20839, 20877,
+  10676, 20887, 20900, 20172, 20908, 10677, 20981, 20995, 13535, 21051, 21062, 21106, 21111, 13589,
+  21253, 21254, 21321, 21338, 21363, 21373, 21375, 10678, 28784, 21450, 21471, 10679, 21483, 21489,
+  21510, 21662, 21560, 21576, 21608, 21666, 21750, 21776, 21843, 21859, 21892, 21931, 21939, 21954,
+  22294, 22295, 22097, 22132, 22766, 22478, 22516, 22541, 22411, 22578, 22577, 22700, 10680, 22770,
+  22775, 22790, 22810, 22818, 22882, 10681, 10682, 23020, 23067, 23079, 23000, 23142, 14062, 14076,
+  23304, 23358, 10683, 23491, 23512, 23539, 10684, 23551, 23558, 24403, 23586, 14209, 23648, 23744,
+  23693, 10685, 23875, 10686, 23918, 23915, 23932, 24033, 24034, 14383, 24061, 24104, 24125, 24169,
+  14434, 10687, 14460, 24240, 24243, 24246, 10688, 24318, 10689, 33281, 24354, 14535, 10690, 10691,
+  24418, 24427, 14563, 24474, 24525, 24535, 24569, 24705, 14650, 14620, 10692, 24775, 24904, 24908,
+  24954, 25010, 24996, 25007, 25054, 25104, 25115, 25181, 25265, 25300, 25424, 10693, 25405, 25340,
+  25448, 25475, 25572, 10694, 25634, 25541, 25513, 14894, 25705, 25726, 25757, 25719, 14956, 25964,
+  10695, 26083, 26360, 26185, 15129, 15112, 15076, 20882, 20885, 26368, 26268, 32941, 17369, 26401,
+  26462, 26451, 10696, 15177, 26618, 26501, 26706, 10697, 26766, 26655, 26900, 26946, 27043, 27114,
+  27304, 10698, 27355, 15384, 27425, 10699, 27476, 15438, 27506, 27551, 27579, 10700, 10701, 10702,
+  27726, 10703, 27839, 27853, 27751, 27926, 27966, 28009, 28024, 28037, 10704, 27956, 28207, 28270,
+  15667, 28359, 10705, 28153, 28526, 10706, 10707, 28614, 28729, 28699, 15766, 28746, 28797, 28791,
+  28845, 10708, 28997, 10709, 29084, 10710, 29224, 29264, 10711, 29312, 29333, 10712, 10713, 29562,
+  29579, 16044, 29605, 16056, 29767, 29788, 29829, 29898, 16155, 29988, 10714, 30014, 10715, 10716,
+  30224, 10717, 10718, 10719, 16380, 16392, 10720, 10721, 10722, 10723, 30494, 30495, 30603, 16454,
+  16534, 10724, 30798, 16611, 10725, 10726, 10727, 31211, 16687, 31306, 31311, 10728, 10729, 31470,
+  16898, 10730, 31686, 31689, 16935, 10731, 31954, 17056, 31976, 31971, 32000, 10732, 32099, 17153,
+  32199, 32258, 32325, 17204, 10733, 10734, 17241, 10735, 32634, 10736, 32661, 32762, 10737, 10738,
+  32864, 10739, 32880, 10740, 17365, 32946, 33027, 17419, 33086, 23221, 10741, 10742, 10743, 10744,
+  33284, 36766, 17515, 33425, 33419, 33437, 21171, 33457, 33459, 33469, 33510, 10745, 33565, 33635,
+  33709, 33571, 33725, 33767, 33619, 33738, 33740, 33756, 10746, 10747, 10748, 17707, 34033, 34035,
+  34070, 10749, 34148, 10750, 17757, 17761, 10751, 10752, 17771, 34384, 34407, 34409, 34473, 34440,
+  34574, 34530, 34600, 34667, 34694, 17879, 34785, 34817, 17913, 34912, 34915, 10753, 35031, 35038,
+  17973, 35066, 13499, 10754, 10755, 18110, 18119, 35488, 35925, 10756, 36011, 36033, 36123, 36215,
+  10757, 10758, 36299, 36284, 36336, 10759, 36564, 10760, 10761, 37012, 37105, 37137, 10762, 37147,
+  37432, 37591, 37592, 37500, 37881, 37909, 10763, 38283, 18837, 38327, 10764, 18918, 38595, 23986,
+  38691, 10765, 10766, 19054, 19062, 38880, 10767, 19122, 10768, 38953, 10769, 39138, 19251, 39209,
+  39335, 39362, 39422, 19406, 10770, 40000, 40189, 19662, 19693, 40295, 10771, 19704, 10772, 10773,
+  10774, 40635, 19798, 40697, 40702, 40709, 40719, 40726, 40763, 10775
+};
+
+const std::uint32_t props_hot_end = 0x800;
+inline constexpr std::uint16_t props_hot[] = {
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1, 1, 5, 6, 7, 1, 1, 8,
+  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+  1, 1, 1, 1, 1, 1, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53,
+  54, 55, 56, 57, 58, 59, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 3, 3, 3, 3, 3, 3, 3, 61, 3, 62, 3, 3, 63, 3, 64, 3, 3, 65,
+  66, 67, 68, 3, 3, 69, 70, 71, 3, 72, 73, 74, 3, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+  87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 3, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+  108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 50, 122, 123, 124, 125, 126,
+  127, 3, 128, 129, 130, 131, 132, 133, 50, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+  145, 146, 147, 148, 149, 150, 151, 50, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163,
+  164, 165, 166, 167, 168, 169, 170, 171, 172, 50, 173, 174, 175, 176, 177, 178, 179, 180, 181, 50,
+  182, 182, 183, 184, 185, 186, 50, 187, 188, 189, 190, 191, 192, 193, 193, 194, 50, 195, 196, 197,
+  198, 199, 200, 201, 202, 50, 203, 204, 205, 206, 207, 208, 209, 50, 210, 211, 212, 213, 214, 215,
+  216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 50, 229, 230, 231, 232, 233, 234,
+  235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 50, 253,
+  254, 50, 255, 50, 256, 257, 50, 258, 259, 260, 50, 50, 261, 262, 263, 264, 50, 265, 266, 50, 267,
+  268, 269, 50, 50, 50, 270, 271, 50, 272, 273, 274, 275, 50, 276, 50, 277, 278, 50, 279, 50, 50,
+  280, 50, 281, 282, 283, 284, 285, 286, 50, 287, 50, 288, 289, 50, 50, 50, 290, 50, 50, 50, 50, 50,
+  50, 50, 291, 291, 291, 292, 292, 292, 293, 293, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302,
+  303, 304, 305, 306, 307, 308, 309, 50, 310, 311, 312, 313, 314, 315, 316, 50, 317, 318, 319, 320,
+  321, 322, 323, 324, 325, 326, 327, 328, 328, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+  338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
+  357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 50, 370, 371, 372, 50, 373, 50,
+  374, 50, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 50, 50, 50, 50, 50,
+  50, 389, 390, 50, 391, 392, 50, 50, 393, 50, 394, 395, 396, 397, 50, 398, 50, 399, 50, 400, 50,
+  401, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 402, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 403, 404, 405, 406, 407, 408, 409, 410, 411, 3, 3, 50, 50, 50, 50, 50, 50, 50, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 50, 50, 3, 3, 3, 3, 3, 3, 412, 413, 414, 415, 416, 417, 3, 3, 266,
+  418, 419, 420, 421, 3, 3, 3, 3, 3, 3, 3, 3, 3, 50, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 422, 422, 422, 422, 422, 423, 422, 422, 422, 422, 422, 422, 422, 423, 423, 422, 423, 422, 423,
+  422, 422, 424, 425, 425, 425, 425, 424, 426, 425, 425, 425, 425, 425, 427, 427, 428, 428, 428,
+  428, 429, 429, 425, 425, 425, 425, 428, 428, 425, 428, 428, 425, 425, 430, 430, 430, 430, 431,
+  425, 425, 425, 425, 423, 423, 423, 432, 433, 422, 434, 435, 436, 423, 425, 425, 425, 423, 423,
+  423, 425, 425, 63, 423, 423, 423, 425, 425, 425, 425, 423, 424, 425, 425, 423, 437, 438, 438, 437,
+  438, 438, 437, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 439, 50, 440, 50,
+  441, 3, 442, 50, 0, 0, 443, 50, 50, 50, 444, 445, 0, 0, 0, 0, 67, 446, 447, 448, 449, 450, 451, 0,
+  452, 0, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 68, 467, 468, 469,
+  470, 471, 0, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 50, 50,
+  50, 487, 50, 488, 50, 489, 50, 50, 50, 50, 50, 490, 50, 491, 492, 50, 50, 493, 50, 50, 50, 494,
+  495, 496, 497, 498, 499, 500, 457, 463, 501, 502, 503, 475, 470, 50, 504, 50, 505, 50, 506, 50,
+  507, 50, 508, 50, 509, 50, 510, 50, 511, 50, 512, 50, 513, 50, 514, 50, 515, 50, 465, 516, 472,
+  50, 463, 517, 3, 518, 50, 472, 519, 50, 50, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
+  531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549,
+  550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568,
+  569, 570, 571, 50, 50, 572, 50, 573, 574, 575, 576, 577, 578, 50, 50, 50, 579, 50, 50, 50, 50,
+  580, 50, 50, 50, 581, 50, 50, 50, 582, 50, 583, 50, 50, 584, 585, 50, 586, 50, 50, 587, 588, 50,
+  50, 50, 50, 589, 590, 591, 50, 592, 50, 593, 50, 594, 50, 595, 50, 596, 50, 597, 50, 598, 50, 599,
+  50, 600, 50, 601, 50, 602, 603, 604, 605, 606, 50, 607, 50, 608, 50, 609, 50, 610, 50, 50, 423,
+  423, 423, 423, 423, 611, 611, 612, 50, 613, 50, 614, 50, 615, 50, 616, 50, 617, 50, 618, 50, 619,
+  50, 620, 50, 621, 50, 622, 50, 623, 50, 624, 50, 625, 50, 626, 50, 627, 50, 628, 50, 629, 50, 630,
+  50, 631, 50, 632, 50, 633, 50, 634, 50, 635, 50, 636, 50, 637, 50, 638, 50, 639, 640, 641, 642,
+  50, 643, 50, 644, 50, 645, 50, 646, 50, 647, 50, 50, 648, 649, 650, 651, 652, 50, 653, 654, 655,
+  656, 657, 658, 659, 660, 661, 662, 663, 50, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674,
+  675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 50, 685, 686, 687, 50, 688, 50, 689, 50, 690,
+  50, 691, 50, 692, 50, 693, 50, 694, 50, 695, 50, 696, 50, 697, 50, 698, 50, 699, 50, 700, 50, 701,
+  50, 702, 50, 703, 50, 704, 50, 705, 50, 706, 50, 707, 50, 708, 50, 709, 50, 710, 50, 711, 50, 712,
+  50, 713, 50, 0, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729,
+  730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748,
+  749, 750, 751, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 752, 50, 50, 3, 0, 0, 3, 3, 3, 0, 425, 423, 423, 423, 423, 425, 423, 423, 423, 753,
+  425, 423, 423, 423, 423, 423, 423, 425, 425, 425, 425, 425, 425, 423, 423, 425, 423, 423, 753,
+  754, 423, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 764, 765, 766, 767, 768, 769, 768,
+  770, 771, 768, 423, 425, 768, 763, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0,
+  0, 0, 0, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3,
+  768, 3, 3, 768, 3, 768, 3, 3, 423, 423, 423, 423, 423, 423, 423, 423, 772, 773, 774, 768, 0, 768,
+  768, 768, 775, 768, 776, 777, 778, 779, 780, 781, 775, 782, 775, 775, 775, 775, 775, 782, 782,
+  782, 782, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 768, 775, 775, 775,
+  775, 775, 775, 775, 783, 775, 784, 785, 786, 787, 772, 773, 774, 788, 789, 422, 422, 428, 425,
+  423, 423, 423, 423, 423, 425, 423, 423, 425, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 3,
+  790, 790, 768, 775, 775, 791, 782, 782, 782, 768, 792, 793, 794, 795, 775, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 782, 782, 782, 782, 782, 782, 782, 782, 782,
+  782, 782, 782, 782, 782, 782, 782, 782, 782, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 775, 775, 775, 796, 797, 798, 782, 782, 782, 782, 782, 782, 782,
+  782, 782, 775, 782, 775, 782, 775, 775, 799, 800, 768, 801, 423, 423, 423, 423, 423, 423, 423, 0,
+  3, 423, 423, 423, 423, 425, 423, 768, 768, 423, 423, 3, 425, 423, 423, 425, 782, 782, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 775, 775, 775, 768, 768, 775, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 0, 0, 782, 802, 775, 775, 775, 782, 782, 782, 782, 782, 775, 775, 775, 775,
+  782, 775, 775, 775, 775, 775, 775, 775, 775, 775, 782, 775, 782, 775, 782, 775, 775, 782, 423,
+  425, 423, 423, 425, 423, 423, 425, 425, 425, 423, 425, 425, 423, 425, 423, 423, 423, 425, 423,
+  425, 423, 425, 423, 425, 423, 423, 0, 0, 782, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+  775, 782, 782, 782, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+  782, 782, 775, 775, 775, 775, 782, 775, 782, 782, 775, 775, 775, 782, 782, 775, 775, 775, 775,
+  775, 775, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 775, 775, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 775, 775, 423, 423, 423, 423, 423, 423, 423, 425, 423, 768, 768, 3,
+  3, 3, 3, 768, 0, 0, 425, 768, 768
+};
+
+#ifndef UPA_IDNA_SMALL_TABLES
+const std::size_t props_block_shift = 5;
+const std::uint32_t props_block_mask = 0x1F;
+inline constexpr std::uint16_t props_block[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 423, 423, 423, 423, 768, 423, 423, 423, 423, 423, 423, 423, 423, 423, 768, 423,
+  423, 423, 768, 423, 423, 423, 423, 423, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 0, 782, 775, 775, 775, 775, 775, 782, 782, 775, 782, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 782, 775, 782, 782, 782, 425, 425, 425, 0, 0, 768, 0, 775, 768, 775,
+  775, 775, 775, 768, 782, 775, 782, 782, 0, 0, 0, 0, 0, 782, 782, 782, 782, 782, 782, 782, 782,
+  782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 768, 768, 768, 775, 768, 768, 775, 775,
+  775, 775, 775, 782, 775, 0, 0, 0, 0, 0, 0, 0, 423, 423, 425, 425, 425, 423, 423, 423, 423, 775,
+  775, 775, 775, 775, 775, 775, 775, 775, 775, 782, 782, 782, 768, 782, 775, 775, 782, 782, 775,
+  775, 775, 775, 775, 775, 782, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+  775, 775, 768, 423, 423, 423, 423, 423, 425, 425, 425, 425, 425, 423, 423, 423, 423, 423, 423,
+  423, 423, 423, 423, 423, 423, 423, 423, 0, 425, 423, 423, 425, 423, 423, 425, 423, 423, 423, 425,
+  425, 425, 785, 786, 787, 423, 423, 423, 425, 423, 423, 425, 425, 423, 423, 423, 423, 423, 611,
+  611, 611, 803, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 804, 805, 50, 50, 50, 50, 50, 50, 806,
+  807, 50, 808, 809, 50, 50, 50, 50, 50, 611, 803, 810, 50, 803, 803, 803, 611, 611, 611, 611, 611,
+  611, 611, 611, 803, 803, 803, 803, 811, 803, 803, 50, 423, 425, 423, 423, 611, 611, 611, 812, 813,
+  814, 815, 816, 817, 818, 819, 50, 50, 611, 611, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 803, 803, 0, 50, 50, 50,
+  50, 50, 50, 50, 50, 0, 0, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 0, 0, 0, 50, 50, 50, 50, 0,
+  0, 820, 50, 821, 803, 803, 611, 611, 611, 611, 0, 0, 822, 803, 0, 0, 823, 824, 811, 50, 0, 0, 0,
+  0, 0, 0, 0, 0, 821, 0, 0, 0, 0, 825, 826, 0, 827, 50, 50, 611, 611, 0, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 3, 3, 50, 50, 50, 50, 50, 50, 50, 3, 50, 50, 423, 0, 0, 611, 611, 803, 0,
+  50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 828, 0, 50, 829, 0,
+  50, 50, 0, 0, 820, 0, 803, 803, 803, 611, 611, 0, 0, 0, 0, 611, 611, 0, 0, 611, 611, 811, 0, 0, 0,
+  611, 0, 0, 0, 0, 0, 0, 0, 830, 831, 832, 50, 0, 833, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 611, 611, 50, 50, 50, 611, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 611, 611, 803, 0, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 0, 50, 50, 50,
+  50, 50, 0, 0, 820, 50, 803, 803, 803, 611, 611, 611, 611, 611, 0, 611, 611, 803, 0, 803, 803, 811,
+  0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 611, 611, 0, 0, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 3, 0, 0, 0, 0, 0, 0, 0, 50, 611, 611, 611, 611, 611, 611, 0, 611, 803,
+  803, 0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 0,
+  50, 50, 50, 50, 50, 0, 0, 820, 50, 821, 611, 803, 611, 611, 611, 611, 0, 0, 834, 835, 0, 0, 836,
+  837, 811, 0, 0, 0, 0, 0, 0, 0, 611, 838, 821, 0, 0, 0, 0, 839, 840, 0, 50, 50, 50, 611, 611, 0, 0,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 611, 50, 0, 50, 50, 50, 50, 50, 50, 0, 0, 0, 50, 50, 50, 0, 841, 50, 842, 50, 0, 0, 0, 50, 50,
+  0, 50, 0, 50, 50, 0, 0, 0, 50, 50, 0, 0, 0, 50, 50, 50, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 0, 0, 0, 0, 821, 803, 611, 803, 803, 0, 0, 0, 843, 844, 803, 0, 845, 846, 847,
+  811, 0, 0, 50, 0, 0, 0, 0, 0, 0, 821, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 611, 803, 803, 803,
+  611, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 0, 0, 820, 50, 611, 611, 611, 803, 803, 803, 803, 0, 848, 611, 849, 0, 611, 611,
+  611, 811, 0, 0, 0, 0, 0, 0, 0, 850, 851, 0, 50, 50, 50, 0, 50, 50, 0, 0, 50, 50, 611, 611, 0, 0,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 50, 3, 3, 3, 3, 3, 3, 3, 50, 50, 611,
+  803, 803, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 0, 50, 50, 50, 50, 50, 0, 0, 820, 50, 803, 852, 853, 803, 821, 803, 803, 0, 854, 855, 856, 0,
+  857, 858, 611, 811, 0, 0, 0, 0, 0, 0, 0, 821, 821, 0, 0, 0, 0, 0, 50, 50, 50, 0, 50, 50, 611, 611,
+  0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  611, 611, 803, 803, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 811, 811, 50, 821, 803, 803, 611, 611, 611, 611, 0,
+  859, 860, 803, 0, 861, 862, 863, 811, 50, 50, 0, 0, 0, 0, 50, 50, 50, 821, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 611, 611, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 611, 803, 803, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 0, 0,
+  50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 864, 0, 0, 0, 0, 821, 803, 803, 611, 611, 611, 0, 611, 0,
+  803, 865, 866, 803, 867, 868, 869, 821, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  0, 0, 803, 803, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 50, 870, 611, 611, 611, 611, 871,
+  871, 811, 0, 0, 0, 0, 3, 50, 50, 50, 50, 50, 50, 50, 611, 872, 872, 872, 872, 611, 611, 611, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 50, 50, 0, 50, 0, 50, 50, 50, 50,
+  50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 0, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 50, 873, 611, 611, 611, 611, 874, 874,
+  811, 611, 611, 50, 0, 0, 50, 50, 50, 50, 50, 0, 50, 0, 875, 875, 875, 875, 611, 611, 611, 0, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 876, 877, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 878, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 425, 425, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 425, 50, 425, 50,
+  879, 3, 3, 3, 3, 803, 803, 50, 50, 50, 880, 50, 50, 50, 50, 0, 50, 50, 50, 50, 881, 50, 50, 50,
+  50, 882, 50, 50, 50, 50, 883, 50, 50, 50, 50, 884, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  885, 50, 50, 50, 0, 0, 0, 0, 886, 887, 888, 889, 890, 891, 892, 893, 894, 887, 887, 887, 887, 611,
+  803, 887, 895, 423, 423, 811, 50, 423, 423, 50, 50, 50, 50, 50, 611, 611, 611, 611, 611, 611, 896,
+  611, 611, 611, 611, 0, 611, 611, 611, 611, 897, 611, 611, 611, 611, 898, 611, 611, 611, 611, 899,
+  611, 611, 611, 611, 900, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 901, 611,
+  611, 611, 0, 50, 50, 50, 50, 50, 50, 50, 50, 425, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  902, 903, 50, 50, 50, 50, 803, 803, 611, 838, 611, 611, 803, 611, 611, 611, 611, 611, 820, 803,
+  811, 811, 803, 803, 611, 611, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 803, 803, 611, 611, 50, 50, 50, 50, 611, 611, 611, 50, 803, 803, 803, 50,
+  50, 803, 803, 803, 803, 803, 803, 803, 50, 50, 50, 611, 611, 611, 611, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 611, 803, 803, 611, 611, 803, 803, 803, 803, 803, 803, 425, 50, 803, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 803, 803, 611, 50, 50, 904, 905, 906, 907, 908, 909, 910,
+  911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929,
+  930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 0, 942, 0, 0, 0, 0, 0, 943, 0, 0, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 944, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 63, 63, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945,
+  945, 945, 945, 945, 945, 945, 945, 945, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945,
+  945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 0, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 0, 50, 50, 50, 50, 0, 0,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+  50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 0, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 0, 0, 423, 423, 423, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 946, 947, 948,
+  949, 950, 951, 0, 0, 3, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 0, 0, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 611, 811, 952, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  611, 611, 952, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 611, 611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 0, 611, 611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 63, 63, 803, 611, 611,
+  611, 611, 611, 611, 611, 803, 803, 803, 803, 803, 803, 803, 803, 611, 803, 803, 611, 611, 611,
+  611, 611, 611, 611, 611, 611, 811, 611, 50, 50, 50, 50, 50, 50, 50, 3, 50, 423, 0, 0, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 3,
+  3, 3, 3, 3, 3, 3, 953, 3, 3, 3, 63, 63, 63, 63, 63, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0,
+  0, 0, 0, 0, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+  954, 954, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 611, 611, 954, 954, 954, 954, 954, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 754, 954, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 611, 611, 611,
+  803, 803, 803, 803, 611, 611, 803, 803, 803, 0, 0, 0, 0, 803, 803, 611, 803, 803, 803, 803, 803,
+  803, 753, 423, 425, 0, 0, 0, 0, 3, 0, 0, 0, 3, 3, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 423, 425, 803, 803, 611, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 611, 803, 611, 611, 611, 611, 611, 611, 611, 0, 811,
+  803, 611, 803, 803, 611, 611, 611, 611, 611, 611, 611, 611, 803, 803, 803, 803, 803, 803, 611,
+  611, 423, 423, 423, 423, 423, 423, 423, 423, 0, 0, 425, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+  0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 423, 423, 423, 423, 423, 425, 425, 425, 425, 425, 425, 423,
+  423, 425, 611, 425, 425, 423, 423, 425, 425, 423, 423, 423, 423, 423, 425, 423, 423, 423, 423,
+  423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 425, 0, 0, 423, 423, 423,
+  423, 423, 423, 425, 423, 423, 423, 423, 438, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 611, 611, 611, 611, 803, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 50, 50, 965, 966,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 820, 821, 611, 611, 611, 611, 967, 968, 969, 970, 971, 972,
+  973, 974, 975, 976, 952, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 423, 425, 423,
+  423, 423, 423, 423, 423, 423, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 611, 803, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 803, 611, 611, 611, 611, 803, 803, 611, 611, 952, 811, 611, 611, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 820, 803, 611,
+  611, 803, 803, 803, 611, 803, 611, 611, 611, 952, 952, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50,
+  50, 50, 50, 803, 803, 803, 803, 803, 803, 803, 803, 611, 611, 611, 611, 611, 611, 611, 611, 803,
+  803, 611, 820, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 541, 543, 977, 556, 557,
+  557, 565, 593, 978, 979, 50, 0, 0, 0, 0, 0, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990,
+  991, 944, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007,
+  1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 0, 0, 1022,
+  1023, 1024, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 423, 423, 423, 50, 430, 425,
+  425, 425, 425, 425, 423, 423, 425, 425, 425, 425, 423, 803, 430, 430, 430, 430, 430, 430, 430, 50,
+  50, 50, 50, 425, 50, 50, 50, 50, 50, 50, 423, 50, 50, 803, 423, 423, 50, 0, 0, 0, 0, 0, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 62, 1025, 1026, 50, 1027, 1028, 261, 1029, 403, 1030, 405,
+  1031, 418, 1032, 1033, 50, 71, 373, 1034, 406, 1035, 1036, 410, 62, 1037, 1038, 1039, 1026, 1027,
+  1028, 262, 263, 1040, 1029, 50, 1031, 1032, 202, 71, 256, 1041, 1042, 1034, 1035, 1036, 1043, 270,
+  1044, 1045, 457, 458, 459, 475, 476, 1030, 406, 1036, 1044, 457, 458, 516, 475, 476, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 552, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 1046, 1047,
+  1048, 91, 1040, 1049, 1050, 1051, 1052, 268, 267, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
+  271, 1061, 1062, 272, 1063, 1064, 279, 1065, 395, 284, 1066, 285, 396, 1067, 1068, 1069, 1070,
+  463, 423, 423, 425, 423, 423, 423, 423, 423, 423, 423, 425, 423, 423, 438, 1071, 425, 427, 423,
+  423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423,
+  423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 424, 754,
+  754, 425, 1072, 423, 437, 425, 423, 425, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081,
+  1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097,
+  1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
+  1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129,
+  1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145,
+  1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161,
+  1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177,
+  1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193,
+  1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209,
+  1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225,
+  1226, 1227, 1228, 50, 50, 1229, 50, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239,
+  1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255,
+  1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271,
+  1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287,
+  1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303,
+  1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319,
+  1320, 50, 1321, 50, 1322, 50, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333,
+  1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 0, 0, 1345, 1346, 1347, 1348,
+  1349, 1350, 0, 0, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363,
+  1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379,
+  1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 0, 0, 1389, 1390, 1391, 1392, 1393, 1394, 0,
+  0, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 0, 1403, 0, 1404, 0, 1405, 0, 1406, 1407, 1408,
+  1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+  1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 0, 0, 1437, 1438, 1439,
+  1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455,
+  1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471,
+  1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
+  1488, 1489, 0, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+  1504, 0, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 0, 0,
+  1519, 1520, 1521, 1522, 1523, 1524, 0, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534,
+  1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 0, 0, 1544, 1545, 1546, 0, 1547, 1548, 1549,
+  1550, 1551, 1552, 1553, 1554, 1555, 0, 1556, 1557, 60, 60, 60, 60, 60, 60, 60, 60, 60, 63, 1558,
+  1558, 0, 0, 3, 1559, 3, 3, 3, 3, 3, 1560, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 3, 0, 0, 0,
+  0, 0, 0, 0, 60, 3, 3, 3, 1561, 1562, 3, 1563, 1564, 3, 3, 3, 3, 1565, 3, 1566, 3, 3, 3, 3, 3, 3,
+  3, 3, 1567, 1568, 1569, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1570, 3, 3, 3, 3, 3, 3, 3, 60, 63,
+  63, 63, 63, 63, 0, 0, 0, 0, 0, 63, 63, 63, 63, 63, 63, 1571, 1030, 0, 0, 1572, 1573, 1574, 1575,
+  1576, 1577, 1578, 1579, 1580, 1581, 1582, 1033, 1571, 70, 65, 66, 1572, 1573, 1574, 1575, 1576,
+  1577, 1578, 1579, 1580, 1581, 1582, 0, 62, 1028, 71, 420, 262, 403, 1031, 418, 1032, 1033, 1034,
+  419, 1035, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 1583, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 423, 423, 430, 430, 423, 423,
+  423, 423, 430, 430, 430, 423, 423, 611, 611, 611, 611, 423, 611, 611, 611, 430, 430, 423, 425,
+  423, 430, 430, 425, 425, 425, 425, 423, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1584, 1585,
+  1047, 1586, 3, 1587, 1588, 263, 3, 1589, 1029, 403, 403, 403, 403, 172, 1030, 1030, 418, 418, 3,
+  1033, 1590, 3, 3, 1034, 24, 406, 406, 406, 3, 3, 1591, 1592, 1593, 3, 1067, 3, 1594, 3, 1067, 3,
+  1595, 1596, 1026, 1047, 3, 1028, 1028, 1049, 1597, 1032, 71, 1598, 1599, 1600, 1601, 1030, 3,
+  1602, 470, 458, 458, 470, 1603, 3, 3, 3, 3, 1027, 1027, 1028, 1030, 405, 3, 3, 3, 3, 50, 50, 1604,
+  1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1030,
+  1620, 1621, 1622, 1044, 1623, 1624, 1625, 1626, 420, 1627, 1628, 418, 1047, 1027, 1032, 1030,
+  1620, 1621, 1622, 1044, 1623, 1624, 1625, 1626, 420, 1627, 1628, 418, 1047, 1027, 1032, 50, 50,
+  50, 1629, 50, 50, 50, 50, 50, 1630, 3, 3, 0, 0, 0, 0, 1631, 3, 1632, 3, 1633, 3, 3, 3, 3, 3, 1634,
+  1635, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1636, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1637, 1638, 1639, 1640, 3, 1641, 3, 1642,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1643, 1644, 3, 3, 3, 1645, 1646, 3, 1647, 1648, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1649, 1650, 1651, 1652, 3, 3, 3, 3, 3,
+  1653, 1654, 3, 1655, 1656, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1657, 3, 3, 3, 3, 1658, 3, 1659, 1660,
+  1661, 3, 1662, 1663, 1664, 3, 3, 3, 1665, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  1666, 1667, 1668, 3, 1669, 1670, 3, 3, 3, 3, 3, 3, 3, 1671, 1672, 1673, 1674, 1675, 1676, 1677,
+  1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 3, 3, 1688, 1689, 1690, 1691, 1692,
+  1693, 1694, 1695, 1696, 1697, 3, 3, 3, 3, 3, 3, 3, 1698, 1699, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 1700, 3, 3, 3, 3, 3, 1701, 1702, 3, 1703, 1704, 1705, 1706, 1707, 3, 3, 1708, 1709, 1710,
+  1711, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1712, 1713, 1714, 1715, 3, 3, 3, 3, 3, 3, 1716, 1717, 1718,
+  1719, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1720, 1721,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 50, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70,
+  65, 66, 1572, 1573, 1574, 1575, 1576, 1577, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730,
+  1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746,
+  1747, 1748, 1749, 1750, 1751, 1752, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768,
+  1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 62, 1026, 1047, 1027, 1028, 1049,
+  1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420,
+  411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71,
+  1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 1571, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 50, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1779, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1780,
+  1781, 1782, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 1783, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793,
+  1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809,
+  1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825,
+  1826, 1827, 1828, 1829, 1830, 1831, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 1832, 50, 1833, 1834, 1835, 50, 50, 1836, 50, 1837, 50, 1838, 50, 1038, 1059, 1037, 1046, 50,
+  1839, 50, 50, 1840, 50, 50, 50, 50, 50, 50, 405, 1044, 1841, 1842, 1843, 50, 1844, 50, 1845, 50,
+  1846, 50, 1847, 50, 1848, 50, 1849, 50, 1850, 50, 1851, 50, 1852, 50, 1853, 50, 1854, 50, 1855,
+  50, 1856, 50, 1857, 50, 1858, 50, 1859, 50, 1860, 50, 1861, 50, 1862, 50, 1863, 50, 1864, 50,
+  1865, 50, 1866, 50, 1867, 50, 1868, 50, 1869, 50, 1870, 50, 1871, 50, 1872, 50, 1873, 50, 1874,
+  50, 1875, 50, 1876, 50, 1877, 50, 1878, 50, 1879, 50, 1880, 50, 1881, 50, 1882, 50, 1883, 50,
+  1884, 50, 1885, 50, 1886, 50, 1887, 50, 1888, 50, 1889, 50, 1890, 50, 1891, 50, 1892, 50, 50, 3,
+  3, 3, 3, 3, 3, 1893, 50, 1894, 50, 423, 423, 423, 1895, 50, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3,
+  50, 50, 50, 50, 50, 50, 0, 50, 0, 0, 0, 0, 0, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 1896, 50, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 811, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50,
+  50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 423, 423, 423,
+  423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423,
+  423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 1897, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 1898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906,
+  1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922,
+  1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938,
+  1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954,
+  1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970,
+  1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986,
+  1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002,
+  2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018,
+  2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
+  2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050,
+  2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066,
+  2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082,
+  2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098,
+  2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 60, 3, 2113, 3, 3, 50, 50, 50, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 50, 50, 50, 50, 50, 50, 50, 50, 50, 1072, 754, 424, 753, 2114, 2114, 3,
+  50, 50, 50, 50, 50, 2115, 3, 1922, 2116, 2117, 50, 50, 3, 3, 3, 0, 50, 50, 50, 50, 50, 2118, 50,
+  50, 50, 50, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132,
+  2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 50, 2143, 2144, 2145, 2146, 2147,
+  2148, 50, 50, 50, 50, 50, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160,
+  2161, 2162, 2163, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 2164, 50, 50, 0, 0, 2165, 2165, 2166, 2167, 2168, 2169, 2170, 3, 50, 50, 50, 50, 50, 2171,
+  50, 50, 50, 50, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184,
+  2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 50, 2196, 2197, 2198, 2199,
+  2200, 2201, 50, 50, 50, 50, 50, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212,
+  2213, 2214, 2215, 2216, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 2217,
+  2218, 2219, 2220, 50, 2221, 50, 50, 2222, 2223, 2224, 2225, 3, 50, 2226, 2227, 2228, 0, 0, 0, 0,
+  0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 2229, 2230, 2231,
+  2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247,
+  2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263,
+  2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279,
+  63, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294,
+  2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310,
+  2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 0, 50, 50, 1899, 1905, 2322,
+  2323, 2324, 2325, 2326, 2327, 1903, 2328, 2329, 2330, 2331, 1907, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 2332, 2333, 2334,
+  2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350,
+  2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 0, 2363, 2364, 2365, 2366,
+  2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382,
+  2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398,
+  2399, 2400, 1965, 2401, 50, 50, 50, 50, 50, 50, 50, 50, 2402, 2403, 2404, 2405, 2406, 2407, 2408,
+  2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2229, 2232, 2235, 2237, 2245, 2246, 2249,
+  2251, 2252, 2254, 2255, 2256, 2257, 2258, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426,
+  2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 50, 1899, 1905, 2322, 2323, 2435, 2436, 2437,
+  1910, 2438, 1922, 1972, 1984, 1983, 1973, 2065, 1930, 1970, 2439, 2440, 2441, 2442, 2443, 2444,
+  2445, 2446, 2447, 2448, 1936, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2324, 2325, 2326,
+  2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472,
+  2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488,
+  2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504,
+  2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520,
+  2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536,
+  2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552,
+  2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568,
+  2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584,
+  2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600,
+  2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616,
+  2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632,
+  2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648,
+  2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664,
+  2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680,
+  2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696,
+  2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712,
+  2713, 2714, 2674, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727,
+  2728, 2729, 2728, 2730, 2731, 2732, 2733, 2734, 2733, 2735, 2736, 0, 2737, 2738, 2739, 2740, 0,
+  2741, 2742, 2743, 2744, 2745, 2746, 2704, 2747, 2748, 2749, 2750, 2751, 2680, 2752, 2753, 2754, 0,
+  2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770,
+  2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786,
+  2787, 2788, 2789, 2790, 2791, 2792, 2793, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+  0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 3, 3, 3, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2794, 50, 2795, 50, 2796, 50, 2797, 50, 2798, 50, 978, 50, 2799, 50, 2800, 50, 2801, 50,
+  2802, 50, 2803, 50, 2804, 50, 2805, 50, 2806, 50, 2807, 50, 2808, 50, 2809, 50, 2810, 50, 2811,
+  50, 2812, 50, 2813, 50, 2814, 50, 2815, 50, 50, 423, 611, 611, 611, 3, 423, 423, 423, 423, 423,
+  423, 423, 423, 423, 423, 3, 3, 2816, 50, 2817, 50, 2818, 50, 2819, 50, 2820, 50, 2821, 50, 2822,
+  50, 2823, 50, 2824, 50, 2825, 50, 2826, 50, 2827, 50, 2828, 50, 2829, 50, 565, 567, 423, 423, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 423, 423, 50, 50, 50, 50, 50, 50, 0,
+  0, 0, 0, 0, 0, 0, 0, 3, 3, 2830, 50, 2831, 50, 2832, 50, 2833, 50, 2834, 50, 2835, 50, 2836, 50,
+  50, 50, 2837, 50, 2838, 50, 2839, 50, 2840, 50, 2841, 50, 2842, 50, 2843, 50, 2844, 50, 2845, 50,
+  2846, 50, 2847, 50, 2848, 50, 2849, 50, 2850, 50, 2851, 50, 2852, 50, 2853, 50, 2854, 50, 2855,
+  50, 2856, 50, 2857, 50, 2858, 50, 2859, 50, 2860, 50, 2861, 50, 2862, 50, 2863, 50, 2864, 50,
+  2865, 50, 2866, 50, 2867, 50, 2867, 50, 50, 50, 50, 50, 50, 50, 50, 2868, 50, 2869, 50, 2870,
+  2871, 50, 2872, 50, 2873, 50, 2874, 50, 2875, 50, 3, 50, 50, 2876, 50, 1052, 50, 50, 2877, 50,
+  2878, 50, 50, 50, 2879, 50, 2880, 50, 2881, 50, 2882, 50, 2883, 50, 2884, 50, 2885, 50, 2886, 50,
+  2887, 50, 2888, 50, 404, 1040, 1051, 2889, 1053, 50, 2890, 2891, 1055, 2892, 2893, 50, 2894, 50,
+  2895, 50, 2896, 50, 2897, 50, 2898, 50, 2899, 50, 2900, 50, 2901, 1064, 2902, 2903, 50, 2904, 50,
+  2905, 2906, 50, 2907, 50, 2908, 50, 2909, 50, 2910, 50, 2911, 50, 2912, 50, 2913, 50, 2914, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 1047, 1049, 24, 2915, 50, 50, 172, 209,
+  50, 50, 50, 50, 50, 50, 50, 50, 611, 50, 50, 50, 811, 50, 50, 50, 50, 611, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 803, 611, 611, 803, 3, 3,
+  3, 3, 811, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 0, 0, 0, 0, 0, 0, 954, 954, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 2916, 50, 3, 3, 3, 3, 0, 0,
+  0, 0, 0, 0, 0, 0, 803, 803, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803,
+  803, 803, 803, 803, 811, 611, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 0, 0, 0, 0, 0, 0, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423,
+  423, 423, 423, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 50, 50, 50, 50, 50, 50,
+  611, 611, 611, 611, 611, 425, 425, 425, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+  803, 952, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 820, 803, 803, 611, 611, 611, 611, 803, 803, 611, 611, 803, 803, 952, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+  0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 611, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 611, 611,
+  611, 611, 611, 803, 803, 611, 611, 803, 803, 611, 611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 611,
+  50, 50, 50, 50, 50, 50, 50, 50, 611, 803, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 803, 611, 803, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 423, 50, 423, 423, 425, 50, 50, 423, 423, 50, 50, 50, 50, 50, 423, 423, 50, 423, 50,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 611, 611, 803, 803, 50, 50, 50, 50, 50, 803, 811, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 50,
+  50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50,
+  0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 2832, 2917, 1833,
+  2918, 50, 50, 50, 50, 50, 50, 50, 50, 50, 2919, 3, 3, 0, 0, 0, 0, 2920, 2921, 2922, 2923, 2924,
+  2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940,
+  2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956,
+  2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972,
+  2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988,
+  2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 50, 50, 50, 803, 803, 611, 803,
+  803, 611, 803, 803, 50, 803, 811, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0,
+  50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 3000, 3001, 3002,
+  3003, 3004, 3005, 3006, 3007, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017,
+  3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033,
+  3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049,
+  3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065,
+  3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081,
+  3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3019, 3091, 3092, 3093, 3094, 3095, 3096,
+  3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112,
+  3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128,
+  3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144,
+  3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157, 3158, 3109, 3159,
+  3160, 3161, 3162, 3163, 3164, 3165, 3166, 3093, 3167, 3168, 3169, 3170, 3171, 3172, 3173, 3174,
+  3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3019, 3187, 3188, 3189,
+  3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205,
+  3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3095, 3214, 3215, 3216, 3217, 3218, 3219, 3220,
+  3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236,
+  3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252,
+  3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 50, 50, 3264, 50, 3265, 50, 50,
+  3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 50, 3276, 50, 3277, 50, 50, 3278,
+  3279, 50, 50, 50, 3280, 3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292,
+  3293, 3294, 3295, 3296, 3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308,
+  3309, 3310, 3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324,
+  3148, 3325, 3326, 3327, 3328, 3329, 3330, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338,
+  3278, 3339, 3340, 3341, 3342, 3343, 3344, 0, 0, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352,
+  3292, 3353, 3354, 3355, 3264, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365, 3366,
+  3367, 3301, 3368, 3302, 3369, 3370, 3371, 3372, 3373, 3265, 3040, 3374, 3375, 3376, 3110, 3197,
+  3377, 3378, 3309, 3379, 3310, 3380, 3381, 3382, 3267, 3383, 3384, 3385, 3386, 3387, 3268, 3388,
+  3389, 3390, 3391, 3392, 3393, 3324, 3394, 3395, 3148, 3396, 3328, 3397, 3398, 3399, 3400, 3401,
+  3333, 3402, 3277, 3403, 3334, 3091, 3404, 3335, 3405, 3337, 3406, 3407, 3408, 3409, 3410, 3339,
+  3273, 3411, 3340, 3412, 3341, 3413, 3007, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422,
+  3423, 3424, 0, 0, 0, 0, 0, 0, 3425, 3426, 3427, 3428, 3429, 3430, 3430, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3431, 3432, 3433, 3434, 3435, 0, 0, 0, 0, 0, 3436, 3437, 3438, 3439, 1598, 1601, 3440,
+  3441, 3442, 3443, 3444, 3445, 1578, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455,
+  3456, 3457, 3458, 0, 3459, 3460, 3461, 3462, 3463, 0, 3464, 0, 3465, 3466, 0, 3467, 3468, 0, 3469,
+  3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479, 3479, 3480, 3480, 3480, 3480, 3481,
+  3481, 3481, 3481, 3482, 3482, 3482, 3482, 3483, 3483, 3483, 3483, 3484, 3484, 3484, 3484, 3485,
+  3485, 3485, 3485, 3486, 3486, 3486, 3486, 3487, 3487, 3487, 3487, 3488, 3488, 3488, 3488, 3489,
+  3489, 3489, 3489, 3490, 3490, 3490, 3490, 3491, 3491, 3491, 3491, 3492, 3492, 3493, 3493, 3494,
+  3494, 3495, 3495, 3496, 3496, 3497, 3497, 3498, 3498, 3498, 3498, 3499, 3499, 3499, 3499, 3500,
+  3500, 3500, 3500, 3501, 3501, 3501, 3501, 3502, 3502, 3503, 3503, 3503, 3503, 3504, 3504, 3505,
+  3505, 3505, 3505, 3506, 3506, 3506, 3506, 3507, 3507, 3508, 3508, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3509, 3509, 3509, 3509, 3510, 3510, 3511, 3511, 3512, 3512, 794, 3513, 3513, 3514, 3514,
+  3515, 3515, 3516, 3516, 3516, 3516, 3517, 3517, 3518, 3518, 3519, 3519, 3520, 3520, 3521, 3521,
+  3522, 3522, 3523, 3523, 3524, 3524, 3524, 3525, 3525, 3525, 3526, 3526, 3526, 3526, 3527, 3528,
+  3529, 3525, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543,
+  3544, 3545, 3546, 3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559,
+  3560, 3561, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575,
+  3576, 3577, 3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591,
+  3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607,
+  3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621, 3622, 3623,
+  3624, 3625, 3626, 3627, 3529, 3628, 3525, 3530, 3629, 3630, 3534, 3631, 3535, 3536, 3632, 3633,
+  3540, 3634, 3541, 3542, 3635, 3636, 3544, 3637, 3545, 3546, 3575, 3576, 3579, 3580, 3581, 3585,
+  3586, 3587, 3588, 3592, 3593, 3594, 3638, 3598, 3639, 3640, 3604, 3641, 3605, 3606, 3619, 3642,
+  3643, 3614, 3644, 3615, 3616, 3527, 3528, 3645, 3529, 3646, 3531, 3532, 3533, 3534, 3647, 3537,
+  3538, 3539, 3540, 3648, 3544, 3547, 3548, 3549, 3550, 3551, 3553, 3554, 3555, 3556, 3557, 3558,
+  3649, 3559, 3560, 3561, 3562, 3563, 3564, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574,
+  3577, 3578, 3582, 3583, 3584, 3585, 3586, 3589, 3590, 3591, 3592, 3650, 3595, 3596, 3597, 3598,
+  3601, 3602, 3603, 3604, 3651, 3607, 3608, 3652, 3611, 3612, 3613, 3614, 3653, 3529, 3646, 3534,
+  3647, 3540, 3648, 3544, 3654, 3557, 3655, 3656, 3657, 3585, 3586, 3592, 3604, 3651, 3614, 3653,
+  3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673,
+  3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3656, 3684, 3685, 3686, 3687, 3661,
+  3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677,
+  3678, 3679, 3680, 3681, 3682, 3683, 3656, 3684, 3685, 3686, 3687, 3681, 3682, 3683, 3656, 3655,
+  3657, 3565, 3554, 3555, 3556, 3681, 3682, 3683, 3565, 3566, 3688, 3688, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3689, 3690, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3696, 3697, 3698,
+  3699, 3700, 3701, 3702, 3702, 3703, 3704, 3704, 3705, 3705, 3706, 3707, 3707, 3708, 3709, 3709,
+  3710, 3710, 3711, 3712, 3712, 3713, 3713, 3714, 3715, 3716, 3717, 3717, 3718, 3719, 3720, 3721,
+  3722, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3728, 3729, 3729, 3730, 3730, 3731, 3732, 3733,
+  3734, 3735, 3736, 3737, 3, 3, 3738, 3739, 3740, 3741, 3742, 3743, 3743, 3744, 3745, 3746, 3747,
+  3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755, 3756, 3757, 3758, 3759, 3760, 3761, 3762,
+  3763, 3764, 3765, 3766, 3767, 3768, 3769, 3723, 3725, 3770, 3771, 3772, 3773, 3774, 3775, 3774,
+  3772, 3776, 3777, 3778, 3779, 3780, 3775, 3716, 3706, 3781, 3782, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3783, 3784,
+  3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3, 3, 3, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 3796, 3797, 0, 3798, 3799, 3800, 3801, 3802, 3803, 0, 0,
+  0, 0, 0, 0, 0, 423, 423, 423, 423, 423, 423, 423, 425, 425, 425, 425, 425, 425, 425, 423, 423, 0,
+  3804, 3805, 3806, 3806, 1581, 1582, 3807, 3808, 3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816,
+  3817, 3818, 3819, 3820, 3, 3, 3821, 3822, 1566, 1566, 1566, 1566, 3806, 3806, 3806, 3796, 3797, 0,
+  0, 3799, 3798, 3801, 3800, 3804, 1581, 1582, 3807, 3808, 3809, 3810, 3823, 3824, 3825, 1578, 3826,
+  3827, 3828, 1580, 0, 3829, 3830, 3831, 3832, 0, 0, 0, 0, 3833, 3834, 3835, 768, 3836, 0, 3837,
+  3838, 3839, 3840, 3841, 3842, 3843, 3844, 3845, 3846, 3847, 3848, 3848, 3849, 3849, 3850, 3850,
+  3851, 3851, 3852, 3852, 3852, 3852, 3853, 3853, 3854, 3854, 3854, 3854, 3855, 3855, 3856, 3856,
+  3856, 3856, 3857, 3857, 3857, 3857, 3858, 3858, 3858, 3858, 3859, 3859, 3859, 3859, 3860, 3860,
+  3860, 3860, 3861, 3861, 3862, 3862, 3863, 3863, 3864, 3864, 3865, 3865, 3865, 3865, 3866, 3866,
+  3866, 3866, 3867, 3867, 3867, 3867, 3868, 3868, 3868, 3868, 3869, 3869, 3869, 3869, 3870, 3870,
+  3870, 3870, 3871, 3871, 3871, 3871, 3872, 3872, 3872, 3872, 3873, 3873, 3873, 3873, 3874, 3874,
+  3874, 3874, 3875, 3875, 3875, 3875, 3876, 3876, 3876, 3876, 3877, 3877, 3877, 3877, 3878, 3878,
+  3878, 3878, 3879, 3879, 3879, 3879, 3880, 3880, 3517, 3517, 3881, 3881, 3881, 3881, 3882, 3882,
+  3883, 3883, 3884, 3884, 3885, 3885, 0, 0, 63, 0, 3800, 3886, 3823, 3830, 3831, 3824, 3887, 1581,
+  1582, 3825, 1578, 3796, 3826, 2113, 3888, 1571, 70, 65, 66, 1572, 1573, 1574, 1575, 1576, 1577,
+  3798, 3799, 3827, 1580, 3828, 3801, 3832, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405,
+  1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 3821, 3829,
+  3822, 3889, 3806, 3890, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032,
+  1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 3807, 3891, 3808, 3892, 3893,
+  3894, 2113, 3817, 3818, 3797, 3895, 2544, 3896, 3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904,
+  3905, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512,
+  2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528,
+  2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 3906, 3907, 3908,
+  63, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243,
+  2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 0, 0, 0,
+  2259, 2260, 2261, 2262, 2263, 2264, 0, 0, 2265, 2266, 2267, 2268, 2269, 2270, 0, 0, 2271, 2272,
+  2273, 2274, 2275, 2276, 0, 0, 2277, 2278, 2279, 0, 0, 0, 3909, 3910, 3911, 64, 3912, 3913, 3914,
+  0, 3915, 3916, 3917, 3918, 3919, 3920, 3921, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0,
+  0, 0, 0, 50, 3, 50, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 50, 50, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  425, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 425, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 0, 0, 0, 0, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0,
+  0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 423, 423, 423, 423, 423, 0, 0, 0,
+  0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929,
+  3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937, 3938, 3939, 3940, 3941, 3942, 3943, 3944, 3945,
+  3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955, 3956, 3957, 3958, 3959, 3960, 3961,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 3962,
+  3963, 3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978,
+  3979, 3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994,
+  3995, 3996, 3997, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+  0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 3998, 3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006,
+  4007, 4008, 0, 4009, 4010, 4011, 4012, 4013, 4014, 4015, 4016, 4017, 4018, 4019, 4020, 4021, 4022,
+  4023, 0, 4024, 4025, 4026, 4027, 4028, 4029, 4030, 0, 4031, 4032, 0, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50,
+  50, 50, 50, 0, 50, 50, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 4033, 50, 50, 50, 50, 50, 50,
+  50, 50, 4034, 50, 50, 50, 50, 50, 50, 50, 4035, 50, 50, 50, 50, 50, 50, 50, 50, 50, 4036, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50,
+  50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  50, 4037, 4038, 1025, 4039, 253, 0, 4040, 4041, 4042, 4043, 258, 259, 4044, 4045, 4046, 4047,
+  2905, 4048, 265, 4049, 172, 4050, 4051, 4052, 4053, 4054, 2889, 4055, 4056, 4057, 4058, 4059,
+  4060, 4061, 4062, 4063, 24, 4064, 4065, 1835, 4066, 277, 4067, 4068, 4069, 4070, 281, 4071, 0,
+  4072, 4073, 4074, 4075, 4076, 4077, 4078, 4079, 4080, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768,
+  0, 0, 768, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 0, 768, 768, 0, 0, 0, 768, 0, 0, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 768, 768,
+  0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 3,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0,
+  0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 611, 611, 611, 0, 611, 611, 0, 0, 0, 0, 0, 611, 425, 611, 423, 768,
+  768, 768, 768, 0, 768, 768, 768, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 423,
+  430, 425, 0, 0, 0, 0, 811, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 775, 775, 775, 775, 775, 782, 768,
+  782, 768, 782, 782, 768, 768, 4081, 782, 782, 782, 782, 782, 775, 775, 775, 775, 4081, 775, 775,
+  775, 775, 775, 782, 775, 775, 775, 782, 768, 768, 782, 423, 425, 0, 0, 0, 0, 775, 775, 775, 775,
+  782, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 3, 3, 3,
+  3, 3, 3, 3, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 768, 768,
+  768, 768, 768, 768, 768, 768, 775, 782, 775, 782, 782, 782, 775, 775, 775, 782, 775, 775, 782,
+  775, 782, 782, 775, 782, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 782, 782, 782, 782, 775, 775, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095, 4096,
+  4097, 4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111, 4112,
+  4113, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4127, 4128,
+  4129, 4130, 4131, 4132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768,
+  768, 768, 768, 4081, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 782,
+  775, 423, 423, 423, 423, 0, 0, 0, 0, 0, 0, 0, 0, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790,
+  0, 0, 0, 0, 0, 0, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 768, 768, 768, 768, 768, 768,
+  4133, 4134, 4135, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 4145, 4146, 4147, 4148,
+  4149, 4150, 4151, 4152, 4153, 4154, 0, 0, 0, 423, 423, 423, 423, 423, 3, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0,
+  0, 0, 0, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 790, 790, 790, 790, 790,
+  790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790,
+  790, 790, 790, 790, 790, 790, 790, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 423,
+  423, 768, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 782, 775, 775, 768, 775,
+  775, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 425, 425, 611, 425, 425, 425, 768, 768,
+  768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 775, 775, 775, 782, 775, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 768, 425, 425, 423, 423, 423, 425,
+  423, 425, 425, 425, 425, 775, 775, 775, 782, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 775, 775, 775, 775, 782, 782, 775, 775, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 423, 425, 423, 425, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 775, 768,
+  775, 775, 782, 782, 782, 768, 775, 782, 782, 775, 775, 782, 775, 775, 768, 775, 782, 782, 775,
+  768, 768, 768, 768, 782, 775, 4081, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 803, 611, 803, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 611, 611,
+  611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 811, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0,
+  0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 811, 50, 50, 611, 611, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 811, 611, 611, 803, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 4155, 4156, 4157, 4158, 50,
+  50, 50, 50, 50, 50, 50, 50, 4159, 50, 50, 50, 50, 50, 4160, 50, 50, 50, 50, 803, 803, 803, 611,
+  611, 611, 611, 803, 803, 811, 810, 50, 50, 0, 50, 50, 50, 50, 611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 423,
+  423, 423, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 838, 611, 611, 611, 611, 803, 611, 4161,
+  4162, 611, 4163, 4164, 811, 811, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  803, 803, 50, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 820, 50, 50, 50,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 803, 803, 803, 611, 611, 611, 611, 611, 611, 611, 611, 611, 803, 952, 50, 50, 50, 50, 50, 50,
+  50, 50, 611, 820, 611, 611, 50, 803, 611, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 803, 803, 803, 611, 611, 611, 803, 803, 611, 952, 820, 611, 50, 50, 50, 50, 50, 50, 611, 50,
+  50, 611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  50, 50, 50, 50, 50, 50, 50, 0, 50, 0, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 803, 803,
+  803, 611, 611, 611, 611, 611, 611, 820, 811, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 0, 0, 0, 0, 0, 0, 611, 611, 803, 803, 0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 0, 0,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50,
+  50, 50, 50, 50, 50, 0, 50, 50, 0, 50, 50, 50, 50, 50, 0, 820, 820, 50, 821, 803, 611, 803, 803,
+  803, 803, 0, 0, 4165, 803, 0, 0, 4166, 4167, 952, 0, 0, 50, 0, 0, 0, 0, 0, 0, 821, 0, 0, 0, 0, 0,
+  50, 50, 50, 50, 50, 803, 803, 0, 0, 423, 423, 423, 423, 423, 423, 423, 0, 0, 0, 423, 423, 423,
+  423, 423, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 4168, 4169, 4170, 4171, 50, 50, 50, 50, 0,
+  4172, 0, 0, 4173, 0, 4174, 4175, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 821, 803,
+  803, 838, 611, 611, 611, 611, 611, 0, 4176, 0, 0, 4177, 0, 4178, 4179, 821, 803, 0, 803, 803, 811,
+  952, 811, 50, 611, 50, 50, 50, 0, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 611, 611, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 803, 803, 611, 611, 611, 611, 611, 611,
+  611, 611, 803, 803, 811, 611, 611, 803, 820, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 423, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 821, 803, 803, 611, 611, 611, 611, 611, 611, 4180, 838, 4181, 4182, 821, 4183,
+  611, 611, 803, 811, 820, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 821, 803,
+  803, 611, 611, 611, 611, 0, 0, 4184, 4185, 4186, 4187, 611, 611, 803, 811, 820, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611,
+  611, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 803, 803, 611,
+  611, 611, 611, 611, 611, 611, 611, 803, 803, 611, 803, 811, 611, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 611, 803, 611, 803, 803, 611, 611, 611, 611, 611, 611, 952, 820, 50, 50, 0, 0,
+  0, 0, 0, 0, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 0, 0, 611, 803, 611, 803, 803, 611, 611, 611, 611, 803, 611, 611, 611,
+  611, 811, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 803, 803, 611, 611, 611, 611, 611, 611, 611, 611,
+  611, 803, 811, 820, 50, 0, 0, 0, 0, 4188, 4189, 4190, 4191, 4192, 4193, 4194, 4195, 4196, 4197,
+  4198, 4199, 4200, 4201, 4202, 4203, 4204, 4205, 4206, 4207, 4208, 4209, 4210, 4211, 4212, 4213,
+  4214, 4215, 4216, 4217, 4218, 4219, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 0,
+  0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 821, 803, 803, 803, 803, 4220, 0, 803, 4221, 0, 0,
+  611, 611, 952, 811, 50, 803, 50, 803, 820, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 803, 803, 611, 611, 611, 611, 0, 0, 611, 611,
+  803, 803, 803, 803, 811, 50, 50, 50, 803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 50, 611, 611, 611, 611, 611, 611, 4222, 4222, 611, 611, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 811, 611, 611, 611, 611, 803, 50, 611, 611,
+  611, 611, 50, 50, 50, 50, 50, 50, 50, 50, 811, 0, 0, 0, 0, 0, 0, 0, 0, 50, 611, 611, 611, 611,
+  611, 611, 803, 803, 611, 611, 611, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611,
+  611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 803, 611, 811, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 611, 803, 611, 611, 611, 803, 611, 803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 611, 611, 611, 611, 611, 611, 611, 0, 611, 611,
+  611, 611, 611, 611, 803, 4223, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+  611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 0, 803, 611, 611, 611, 611, 611,
+  611, 611, 803, 611, 611, 803, 611, 611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0,
+  50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 611, 611, 611, 611, 611, 0,
+  0, 0, 611, 0, 611, 611, 0, 611, 611, 611, 820, 611, 811, 811, 50, 611, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 0, 50, 50, 0, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 803, 803, 803, 803, 803, 0, 611, 611, 0, 803, 803, 611, 803, 811, 50,
+  0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  611, 611, 803, 803, 50, 50, 0, 0, 0, 0, 0, 0, 0, 611, 611, 50, 803, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 803, 611, 611, 611, 611, 611,
+  0, 0, 0, 803, 803, 611, 952, 811, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 611, 50, 50, 50, 50, 50, 50, 611, 611, 611, 611, 611,
+  611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 4224, 838, 838, 4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233, 803, 803, 803, 611,
+  611, 811, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 430, 430, 430, 430, 430, 50, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 423, 423,
+  423, 423, 423, 423, 423, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 50,
+  50, 50, 50, 50, 50, 4234, 50, 50, 50, 4235, 4236, 4237, 4238, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 4239, 4240, 4241, 4242, 4243, 4244, 4245, 4246, 4247,
+  4248, 4249, 4250, 4251, 4252, 4253, 4254, 4255, 4256, 4257, 4258, 4259, 4260, 4261, 4262, 4263,
+  4264, 4265, 4266, 4267, 4268, 4269, 4270, 4271, 4272, 4273, 4274, 4275, 4276, 4277, 4278, 4279,
+  4280, 4281, 4282, 4283, 4284, 4285, 4286, 4287, 4288, 4289, 4290, 4291, 4292, 4293, 4294, 4295, 0,
+  0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0,
+  611, 50, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803,
+  803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803,
+  803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 0, 0, 0,
+  0, 0, 0, 0, 611, 611, 611, 611, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 3, 50,
+  611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4296, 4296, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0,
+  50, 50, 0, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 0, 0, 50, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0,
+  0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 611, 430, 50, 63, 63, 63, 63, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030,
+  405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 1571,
+  70, 65, 66, 1572, 1573, 1574, 1575, 1576, 1577, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 611, 611, 611, 611, 611, 611, 611,
+  611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+  611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+  611, 0, 0, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+  611, 611, 611, 611, 611, 611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 4297, 4298, 4299,
+  4300, 4301, 4302, 4303, 4304, 4304, 430, 430, 430, 50, 50, 50, 4305, 4304, 4304, 4304, 4304, 4304,
+  63, 63, 63, 63, 63, 63, 63, 63, 425, 425, 425, 425, 425, 425, 425, 425, 50, 50, 423, 423, 423,
+  423, 423, 425, 425, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 423, 423, 423, 423, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 4306, 4307, 4308, 4309, 4310, 4311, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3,
+  423, 423, 423, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62,
+  1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419,
+  1035, 1036, 1044, 410, 420, 411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405,
+  1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 62, 1026,
+  1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035,
+  1036, 1044, 410, 420, 411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029, 0, 1030, 405, 1031, 418,
+  1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 62, 1026, 1047, 1027,
+  1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044,
+  410, 420, 411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032,
+  1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 62, 0, 1047, 1027, 0, 0,
+  1029, 0, 0, 405, 1031, 0, 0, 1033, 71, 1034, 24, 0, 419, 1035, 1036, 1044, 410, 420, 411, 1067,
+  62, 1026, 1047, 1027, 0, 1049, 0, 403, 1030, 405, 1031, 418, 1032, 1033, 0, 1034, 24, 406, 419,
+  1035, 1036, 1044, 410, 420, 411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405,
+  1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 62, 1026,
+  1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035,
+  1036, 1044, 410, 420, 411, 1067, 62, 1026, 0, 1027, 1028, 1049, 1029, 0, 0, 405, 1031, 418, 1032,
+  1033, 71, 1034, 24, 0, 419, 1035, 1036, 1044, 410, 420, 411, 0, 62, 1026, 1047, 1027, 1028, 1049,
+  1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420,
+  411, 1067, 62, 1026, 0, 1027, 1028, 1049, 1029, 0, 1030, 405, 1031, 418, 1032, 0, 71, 0, 0, 0,
+  419, 1035, 1036, 1044, 410, 420, 411, 0, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405,
+  1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 62, 1026,
+  1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035,
+  1036, 1044, 410, 420, 411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031,
+  418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 1032, 1033, 71,
+  1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029,
+  403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 411, 1067, 62, 1026, 1047, 1027, 1028,
+  1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410,
+  420, 411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71,
+  1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029,
+  403, 1030, 405, 410, 420, 411, 1067, 4312, 4313, 0, 0, 4314, 457, 458, 459, 517, 461, 4315, 463,
+  4316, 465, 466, 68, 467, 468, 4317, 470, 516, 463, 472, 473, 4318, 475, 476, 477, 4319, 4320,
+  4314, 457, 458, 459, 517, 461, 4315, 463, 4316, 465, 466, 68, 467, 468, 4317, 470, 516, 472, 472,
+  473, 4318, 475, 476, 477, 4319, 4321, 517, 463, 465, 475, 516, 470, 4314, 457, 458, 459, 517, 461,
+  4315, 463, 4316, 465, 466, 68, 467, 468, 4317, 470, 516, 463, 472, 473, 4318, 475, 476, 477, 4319,
+  4320, 4314, 457, 458, 459, 517, 461, 4315, 463, 4316, 465, 466, 68, 467, 468, 4317, 470, 516, 472,
+  472, 473, 4318, 475, 476, 477, 4319, 4321, 517, 463, 465, 475, 516, 470, 4314, 457, 458, 459, 517,
+  461, 4315, 463, 4316, 465, 466, 68, 467, 468, 4317, 470, 516, 463, 472, 473, 4318, 475, 476, 477,
+  4319, 4320, 4314, 457, 458, 459, 517, 461, 4315, 463, 4316, 465, 466, 68, 467, 468, 4317, 470,
+  516, 472, 472, 473, 4318, 475, 476, 477, 4319, 4321, 517, 463, 465, 475, 516, 470, 4314, 457, 458,
+  459, 517, 461, 4315, 463, 4316, 465, 466, 68, 467, 468, 4317, 470, 516, 463, 472, 473, 4318, 475,
+  476, 477, 4319, 4320, 4314, 457, 458, 459, 517, 461, 4315, 463, 4316, 465, 466, 68, 467, 468,
+  4317, 470, 516, 472, 472, 473, 4318, 475, 476, 477, 4319, 4321, 517, 463, 465, 475, 516, 470,
+  4314, 457, 458, 459, 517, 461, 4315, 463, 4316, 465, 466, 68, 467, 468, 4317, 470, 516, 463, 472,
+  473, 4318, 475, 476, 477, 4319, 4320, 4314, 457, 458, 459, 517, 461, 4315, 463, 4316, 465, 466,
+  68, 467, 468, 4317, 470, 516, 472, 472, 473, 4318, 475, 476, 477, 4319, 4321, 517, 463, 465, 475,
+  516, 470, 506, 506, 0, 0, 1571, 70, 65, 66, 1572, 1573, 1574, 1575, 1576, 1577, 1571, 70, 65, 66,
+  1572, 1573, 1574, 1575, 1576, 1577, 1571, 70, 65, 66, 1572, 1573, 1574, 1575, 1576, 1577, 1571,
+  70, 65, 66, 1572, 1573, 1574, 1575, 1576, 1577, 1571, 70, 65, 66, 1572, 1573, 1574, 1575, 1576,
+  1577, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+  611, 611, 611, 611, 611, 50, 50, 50, 50, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+  611, 611, 611, 611, 611, 611, 611, 50, 50, 50, 50, 50, 50, 50, 50, 611, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 611, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 611, 611, 611, 611, 611, 0, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+  611, 611, 611, 611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50,
+  50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 423, 423, 423, 423, 423,
+  423, 423, 0, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423,
+  0, 0, 423, 423, 423, 423, 423, 423, 423, 0, 423, 423, 0, 423, 423, 423, 423, 423, 0, 0, 0, 0, 0,
+  4322, 540, 541, 4323, 543, 4324, 4325, 4326, 4327, 4328, 550, 551, 977, 554, 555, 556, 557, 4329,
+  559, 560, 561, 4330, 563, 4331, 4332, 569, 2820, 4333, 4334, 531, 4335, 630, 639, 4322, 540, 541,
+  4323, 543, 4324, 4325, 4326, 4327, 4328, 550, 977, 554, 556, 4329, 559, 560, 561, 4330, 563, 565,
+  4331, 615, 4334, 528, 538, 628, 2801, 631, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 423, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 423, 423, 423, 423, 423, 423, 423,
+  50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 50, 50, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 423, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 423, 423, 423, 423, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 3, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 424, 424, 425, 423, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 423, 425, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 50, 50, 50, 50, 423, 50, 50, 423, 50, 50, 50, 50,
+  50, 50, 50, 423, 423, 50, 50, 50, 50, 50, 423, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 0, 50, 50, 50, 50, 0, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 0, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 425, 425, 425,
+  425, 425, 425, 425, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4336, 4337, 4338, 4339, 4340, 4341, 4342, 4343,
+  4344, 4345, 4346, 4347, 4348, 4349, 4350, 4351, 4352, 4353, 4354, 4355, 4356, 4357, 4358, 4359,
+  4360, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 775, 775, 775, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 775, 775, 423, 423, 423, 423, 423, 423, 820, 4370, 0, 0, 0, 0, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 3853, 3854, 3858, 3861, 0,
+  3880, 3864, 3859, 3869, 3881, 3875, 3876, 3877, 3878, 3865, 3871, 3873, 3867, 3874, 3863, 3866,
+  3856, 3857, 3860, 3862, 3868, 3870, 3872, 4371, 3502, 4372, 4373, 0, 3854, 3858, 0, 3879, 0, 0,
+  3859, 0, 3881, 3875, 3876, 3877, 3878, 3865, 3871, 3873, 3867, 3874, 0, 3866, 3856, 3857, 3860, 0,
+  3868, 0, 3872, 0, 0, 0, 0, 0, 0, 3858, 0, 0, 0, 0, 3859, 0, 3881, 0, 3876, 0, 3878, 3865, 3871, 0,
+  3867, 3874, 0, 3866, 0, 0, 3860, 0, 3868, 0, 3872, 0, 3502, 0, 4373, 0, 3854, 3858, 0, 3879, 0, 0,
+  3859, 3869, 3881, 3875, 0, 3877, 3878, 3865, 3871, 3873, 3867, 3874, 0, 3866, 3856, 3857, 3860, 0,
+  3868, 3870, 3872, 4371, 0, 4372, 0, 3853, 3854, 3858, 3861, 3879, 3880, 3864, 3859, 3869, 3881, 0,
+  3876, 3877, 3878, 3865, 3871, 3873, 3867, 3874, 3863, 3866, 3856, 3857, 3860, 3862, 3868, 3870,
+  3872, 0, 0, 0, 0, 0, 3854, 3858, 3861, 0, 3880, 3864, 3859, 3869, 3881, 0, 3876, 3877, 3878, 3865,
+  3871, 3873, 3867, 3874, 3863, 3866, 3856, 3857, 3860, 3862, 3868, 3870, 3872, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4374, 4375, 4376, 4377,
+  4378, 4379, 4380, 4381, 4382, 4383, 3, 3, 3, 3, 3, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760,
+  1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776,
+  1777, 1778, 4384, 1047, 406, 2739, 4385, 3, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030,
+  405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 4386,
+  2728, 4387, 4388, 4389, 4390, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 4391, 4392, 4393, 3, 3, 3, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 4394,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  4395, 4396, 2508, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1962, 4397, 4398, 4399, 1905, 4400, 4401,
+  2330, 4402, 4403, 4404, 4405, 4406, 4407, 4408, 4409, 4410, 4411, 1998, 4412, 4413, 4414, 4415,
+  4416, 4417, 1899, 2322, 4418, 2457, 2325, 2458, 4419, 2054, 4420, 4421, 4422, 4423, 4424, 2440,
+  1972, 4425, 4426, 4427, 4428, 0, 0, 0, 0, 4429, 4430, 4431, 4432, 4433, 4434, 4435, 4436, 4437, 0,
+  0, 0, 0, 0, 0, 0, 4438, 4439, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+  0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+  0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+  0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1571, 70, 65, 66, 1572,
+  1573, 1574, 1575, 1576, 1577, 3, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  4440, 4441, 4442, 4443, 4444, 3286, 4445, 4446, 4447, 4448, 3287, 4449, 4450, 4451, 3288, 4452,
+  4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 3346, 4464, 4465, 4466, 4467,
+  4468, 4469, 4470, 4471, 4472, 3351, 3289, 3290, 3352, 4473, 4474, 3097, 4475, 3291, 4476, 4477,
+  4478, 4479, 4479, 4479, 4480, 4481, 4482, 4483, 4484, 4485, 4486, 4487, 4488, 4489, 4490, 4491,
+  4492, 4493, 4494, 4495, 4496, 4497, 4497, 3354, 4498, 4499, 4500, 4501, 3293, 4502, 4503, 4504,
+  3250, 4505, 4506, 4507, 4508, 4509, 4510, 4511, 4512, 4513, 4514, 4515, 4516, 4517, 4518, 4519,
+  4520, 4521, 4522, 4523, 4524, 4525, 4526, 4527, 4528, 4529, 4530, 4530, 4531, 4532, 4533, 3093,
+  4534, 4535, 4536, 4537, 4538, 4539, 4540, 4541, 3298, 4542, 4543, 4544, 4545, 4546, 4547, 4548,
+  4549, 4550, 4551, 4552, 4553, 4554, 4555, 4556, 4557, 4558, 4559, 4560, 4561, 4562, 3039, 4563,
+  4564, 4565, 4565, 4566, 4567, 4567, 4568, 4569, 4570, 4571, 4572, 4573, 4574, 4575, 4576, 4577,
+  4578, 4579, 4580, 3299, 4581, 4582, 4583, 4584, 3366, 4584, 4585, 3301, 4586, 4587, 4588, 4589,
+  3302, 3012, 4590, 4591, 4592, 4593, 4594, 4595, 4596, 4597, 4598, 4599, 4600, 4601, 4602, 4603,
+  4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611, 3303, 4612, 4613, 4614, 4615, 4616, 4617, 3305,
+  4618, 4619, 4620, 4621, 4622, 4623, 4624, 4625, 3040, 3374, 4626, 4627, 4628, 4629, 4630, 4631,
+  4632, 4633, 3306, 4634, 4635, 4636, 4637, 3417, 4638, 4639, 4640, 4641, 4642, 4643, 4644, 4645,
+  4646, 4647, 4648, 4649, 4650, 3110, 4651, 4652, 4653, 4654, 4655, 4656, 4657, 4658, 4659, 4660,
+  4661, 3307, 3197, 4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669, 3378, 4670, 4671, 4672, 4673,
+  4674, 4675, 4676, 4677, 3379, 4678, 4679, 4680, 4681, 4682, 4683, 4684, 4685, 4686, 4687, 4688,
+  4689, 3381, 4690, 4691, 4692, 4693, 4694, 4695, 4696, 4697, 4698, 4699, 4700, 4700, 4701, 4702,
+  3383, 4703, 4704, 4705, 4706, 4707, 4708, 4709, 3096, 4710, 4711, 4712, 4713, 4714, 4715, 4716,
+  3389, 4717, 4718, 4719, 4720, 4721, 4722, 4722, 3390, 3419, 4723, 4724, 4725, 4726, 4727, 3058,
+  3392, 4728, 4729, 3318, 4730, 4731, 3272, 4732, 4733, 3322, 4734, 4735, 4736, 4737, 4737, 4738,
+  4739, 4740, 4741, 4742, 4743, 4744, 4745, 4746, 4747, 4748, 4749, 4750, 4751, 4752, 4753, 4754,
+  4755, 4756, 4757, 4758, 4759, 4760, 4761, 4762, 4763, 4764, 3328, 4765, 4766, 4767, 4768, 4769,
+  4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777, 4778, 4779, 4780, 4566, 4781, 4782, 4783, 4784,
+  4785, 4786, 4787, 4788, 4789, 4790, 4791, 4792, 3114, 4793, 4794, 4795, 4796, 4797, 4798, 3331,
+  4799, 4800, 4801, 4802, 4803, 4804, 4805, 4806, 4807, 4808, 4809, 4810, 4811, 4812, 4813, 4814,
+  4815, 4816, 4817, 4818, 3053, 4819, 4820, 4821, 4822, 4823, 4824, 3399, 4825, 4826, 4827, 4828,
+  4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838, 4839, 4840, 4841, 4842, 4843, 4844,
+  3404, 3405, 4845, 4846, 4847, 4848, 4849, 4850, 4851, 4852, 4853, 4854, 4855, 4856, 4857, 3406,
+  4858, 4859, 4860, 4861, 4862, 4863, 4864, 4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873,
+  4874, 4875, 4876, 4877, 4878, 4879, 4880, 4881, 4882, 4883, 4884, 4885, 4886, 4887, 3412, 3412,
+  4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895, 4896, 4897, 3413, 4898, 4899, 4900, 4901, 4902,
+  4903, 4904, 4905, 4906, 4907, 4908, 4909, 4910, 4911, 4912, 4913, 4914, 4915, 4916, 0, 0
+};
+inline constexpr std::uint16_t props_block_index[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+  29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0, 52,
+  53, 54, 0, 55, 56, 57, 58, 59, 60, 61, 0, 62, 63, 64, 65, 66, 67, 68, 69, 62, 62, 70, 71, 62, 72,
+  73, 62, 62, 62, 74, 62, 75, 76, 77, 62, 78, 62, 79, 80, 81, 62, 62, 82, 83, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 84, 62, 62, 85, 86, 87, 88, 89, 62, 90,
+  91, 92, 93, 94, 94, 95, 96, 97, 62, 98, 99, 100, 101, 102, 62, 103, 104, 105, 106, 62, 107, 108,
+  109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 62, 119, 62, 120, 121, 62, 122, 123, 124, 125,
+  62, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+  145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163,
+  105, 164, 165, 166, 167, 168, 169, 105, 170, 105, 171, 62, 172, 173, 105, 105, 105, 105, 174, 175,
+  176, 177, 178, 179, 180, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 181,
+  105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 62, 62, 62, 62, 62, 62, 62, 62, 105, 105, 105,
+  105, 105, 105, 105, 105, 182, 105, 105, 183, 105, 105, 184, 105, 105, 105, 105, 185, 105, 105,
+  105, 105, 186, 187, 62, 188, 189, 190, 191, 192, 62, 193, 62, 194, 195, 196, 196, 197, 105, 105,
+  198, 0, 199, 105, 105, 200, 201, 202, 203, 204, 205, 206, 207, 0, 208, 209, 210, 211, 212, 213,
+  214, 215, 216, 217, 218, 219, 220, 62, 105, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231,
+  232, 233, 234, 235, 236, 237, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 105, 105, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 238, 105, 239, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 240, 241, 242, 243, 244, 62, 62, 245, 105, 246, 247, 248, 249, 250,
+  251, 252, 253, 254, 94, 255, 256, 257, 258, 259, 62, 260, 261, 80, 9, 262, 263, 264, 62, 265, 266,
+  267, 62, 268, 269, 270, 271, 272, 273, 274, 275, 276, 62, 277, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 278, 279, 280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293,
+  294, 295, 0, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312,
+  313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331,
+  332, 333, 334, 335, 336, 337, 338, 0, 62, 62, 62, 339, 340, 341, 105, 105, 342, 343, 344, 345, 0,
+  0, 0, 0, 80, 62, 346, 347, 62, 348, 349, 350, 351, 62, 352, 0, 353, 354, 62, 62, 355, 356, 357,
+  280, 62, 358, 62, 359, 360, 361, 362, 363, 62, 62, 62, 62, 62, 62, 62, 62, 62, 195, 98, 364, 365,
+  366, 0, 0, 367, 368, 369, 370, 371, 372, 0, 373, 374, 375, 376, 0, 370, 377, 378, 370, 379, 380,
+  381, 370, 370, 0, 382, 383, 370, 384, 385, 386, 387, 388, 0, 0, 370, 370, 389, 0, 390, 391, 370,
+  392, 393, 394, 395, 396, 397, 0, 0, 0, 0, 0, 0, 398, 370, 399, 400, 401, 370, 402, 403, 404, 405,
+  406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 117, 421, 422, 423,
+  424, 425, 426, 0, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 62, 439, 440, 441,
+  62, 442, 443, 0, 0, 0, 0, 0, 62, 444, 445, 0, 62, 446, 447, 448, 62, 449, 428, 450, 451, 452, 453,
+  0, 0, 0, 0, 0, 62, 454, 0, 0, 0, 455, 62, 456, 457, 458, 459, 0, 0, 460, 461, 462, 463, 464, 465,
+  62, 466, 467, 62, 85, 468, 0, 0, 469, 0, 0, 62, 470, 471, 472, 473, 474, 475, 476, 0, 0, 477, 478,
+  479, 480, 481, 428, 280, 468, 0, 0, 0, 0, 0, 0, 0, 482, 483, 484, 485, 0, 0, 486, 487, 488, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 489, 0, 0, 0, 62, 62, 62, 490, 62, 62, 62, 62, 62, 62, 450, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 344, 62, 62, 491, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 492, 493, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  339, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 453, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 494, 495, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 85, 99, 496, 62, 99,
+  428, 497, 62, 498, 499, 500, 492, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 501, 0, 0, 0, 0, 0,
+  0, 502, 62, 339, 503, 504, 0, 62, 62, 505, 506, 507, 0, 0, 508, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 98, 509, 99, 0, 0, 0, 62, 62, 62, 491, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 510, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 511, 512, 513, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 280, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 62, 62, 62, 514, 515, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 105, 105, 105, 105, 105, 105, 517, 518, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+  105, 105, 105, 519, 520, 520, 521, 522, 523, 62, 62, 62, 450, 0, 62, 62, 62, 62, 62, 62, 62, 98,
+  62, 524, 525, 526, 527, 528, 529, 530, 105, 105, 531, 0, 0, 0, 504, 504, 105, 105, 532, 85, 0, 0,
+  0, 0, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 533, 534, 546, 536, 547,
+  548, 179, 540, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 521, 560, 521, 561, 562, 563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 564, 0, 0, 0, 0, 0, 0,
+  565, 566, 567, 568, 569, 0, 0, 0, 62, 570, 571, 0, 0, 0, 0, 0, 0, 0, 0, 0, 344, 572, 62, 573, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 344, 574, 0, 0, 0, 0, 0, 0, 344, 575, 0, 0, 0, 0, 0, 0, 99,
+  576, 0, 0, 0, 0, 0, 0, 0, 577, 370, 370, 370, 370, 370, 370, 578, 0, 579, 580, 581, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 370, 583, 0, 0, 584, 585, 0, 0, 0,
+  0, 0, 0, 586, 587, 588, 589, 590, 591, 0, 592, 0, 0, 0, 0, 0, 0, 0, 0, 105, 593, 105, 105, 594,
+  595, 596, 597, 598, 599, 600, 601, 602, 603, 0, 604, 605, 606, 607, 608, 0, 0, 0, 0, 105, 105,
+  105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+  105, 105, 105, 105, 105, 105, 105, 105, 105, 609, 610, 105, 105, 105, 105, 105, 105, 611, 612,
+  593, 105, 613, 105, 614, 615, 616, 0, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 617, 618,
+  619, 105, 620, 621, 105, 105, 105, 105, 622, 105, 105, 623, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 0, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 355, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 624, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 625, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 355,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638,
+  639, 640, 641, 642, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 349, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 489
+};
+#else
+const std::size_t props_bmp_shift = 4;
+const std::uint32_t props_bmp_mask = 0xF;
+const std::size_t props_supp_index1_shift = 7;
+const std::uint32_t props_supp_index2_mask = 0xF;
+const std::size_t props_supp_block_shift = 3;
+const std::uint32_t props_supp_block_mask = 0x7;
+inline constexpr std::uint16_t props_block[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 423, 423, 423, 423, 768, 423, 423,
+  423, 423, 423, 423, 423, 423, 423, 768, 423, 423, 423, 768, 423, 423, 423, 423, 423, 0, 0, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 782, 775, 775, 775, 775,
+  775, 782, 782, 775, 782, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 782, 775, 782, 782,
+  782, 425, 425, 425, 0, 0, 768, 0, 775, 768, 775, 775, 775, 775, 768, 782, 775, 782, 782, 0, 0, 0,
+  0, 0, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782, 782,
+  782, 768, 768, 768, 775, 768, 768, 775, 775, 775, 775, 775, 782, 775, 0, 0, 0, 0, 0, 0, 0, 423,
+  423, 425, 425, 425, 423, 423, 423, 423, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 782,
+  782, 782, 768, 782, 775, 775, 782, 782, 775, 775, 775, 775, 775, 775, 782, 775, 775, 775, 775,
+  775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 768, 423, 423, 423, 423, 423, 425, 425,
+  425, 425, 425, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 0, 425, 423,
+  423, 425, 423, 423, 425, 423, 423, 423, 425, 425, 425, 785, 786, 787, 423, 423, 423, 425, 423,
+  423, 425, 425, 423, 423, 423, 423, 423, 611, 611, 611, 803, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 804, 805, 50, 50, 50, 50, 50, 50, 806, 807, 50, 808, 809, 50, 50, 50, 50, 50, 611,
+  803, 810, 50, 803, 803, 803, 611, 611, 611, 611, 611, 611, 611, 611, 803, 803, 803, 803, 811, 803,
+  803, 50, 423, 425, 423, 423, 611, 611, 611, 812, 813, 814, 815, 816, 817, 818, 819, 50, 50, 611,
+  611, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 803, 803, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 0, 0, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 0, 0, 0, 50, 50, 50, 50, 0, 0, 820, 50,
+  821, 803, 803, 611, 611, 611, 611, 0, 0, 822, 803, 0, 0, 823, 824, 811, 50, 0, 0, 0, 0, 0, 0, 0,
+  0, 821, 0, 0, 0, 0, 825, 826, 0, 827, 50, 50, 611, 611, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 3, 3, 50, 50, 50, 50, 50, 50, 50, 3, 50, 50, 423, 0, 0, 611, 611, 803, 0, 50, 50, 50,
+  50, 50, 50, 0, 0, 0, 0, 50, 50, 0, 50, 828, 0, 50, 829, 0, 50, 50, 0, 0, 820, 0, 803, 803, 803,
+  611, 611, 0, 0, 0, 0, 611, 611, 0, 0, 611, 611, 811, 0, 0, 0, 611, 0, 0, 0, 0, 0, 0, 0, 830, 831,
+  832, 50, 0, 833, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 611, 50, 50,
+  50, 611, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 611, 611, 803, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  0, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 0, 50, 50,
+  50, 50, 50, 0, 0, 820, 50, 803, 803, 803, 611, 611, 611, 611, 611, 0, 611, 611, 803, 0, 803, 803,
+  811, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 3, 0, 0, 0, 0, 0, 0, 0, 50, 611,
+  611, 611, 611, 611, 611, 0, 611, 803, 803, 0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 0, 50,
+  50, 0, 50, 50, 50, 50, 50, 0, 0, 820, 50, 821, 611, 803, 611, 611, 611, 611, 0, 0, 834, 835, 0, 0,
+  836, 837, 811, 0, 0, 0, 0, 0, 0, 0, 611, 838, 821, 0, 0, 0, 0, 839, 840, 0, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 611, 50, 0, 50, 50, 50, 50, 50, 50, 0, 0, 0, 50, 50,
+  50, 0, 841, 50, 842, 50, 0, 0, 0, 50, 50, 0, 50, 0, 50, 50, 0, 0, 0, 50, 50, 0, 0, 0, 50, 50, 50,
+  0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 821, 803, 611, 803, 803, 0,
+  0, 0, 843, 844, 803, 0, 845, 846, 847, 811, 0, 0, 50, 0, 0, 0, 0, 0, 0, 821, 0, 0, 0, 0, 0, 0, 0,
+  0, 50, 50, 50, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 611, 803, 803, 803, 611, 50, 50, 50, 50, 50,
+  50, 50, 50, 0, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 0, 0, 820, 50, 611, 611, 611, 803, 803, 803, 803, 0, 848, 611, 849, 0,
+  611, 611, 611, 811, 0, 0, 0, 0, 0, 0, 0, 850, 851, 0, 50, 50, 50, 0, 50, 50, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 50, 3, 3, 3, 3, 3, 3, 3, 50, 50, 611, 803, 803, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50,
+  50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 0, 0, 820, 50, 803, 852, 853, 803, 821, 803, 803, 0,
+  854, 855, 856, 0, 857, 858, 611, 811, 0, 0, 0, 0, 0, 0, 0, 821, 821, 0, 0, 0, 0, 0, 50, 50, 50, 0,
+  0, 50, 50, 803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 611, 611, 803, 803, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 811, 811, 50, 821, 803, 803,
+  611, 611, 611, 611, 0, 859, 860, 803, 0, 861, 862, 863, 811, 50, 50, 0, 0, 0, 0, 50, 50, 50, 821,
+  50, 50, 50, 50, 50, 50, 50, 50, 0, 611, 803, 803, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 0, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 864, 0, 0, 0, 0, 821, 803, 803, 611,
+  611, 611, 0, 611, 0, 803, 865, 866, 803, 867, 868, 869, 821, 0, 0, 803, 803, 50, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 50, 870,
+  611, 611, 611, 611, 871, 871, 811, 0, 0, 0, 0, 3, 50, 50, 50, 50, 50, 50, 50, 611, 872, 872, 872,
+  872, 611, 611, 611, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 50, 50, 0,
+  50, 0, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 611, 50, 873, 611, 611, 611, 611, 874, 874, 811, 611, 611, 50, 0, 0, 50, 50, 50,
+  50, 50, 0, 50, 0, 875, 875, 875, 875, 611, 611, 611, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0,
+  0, 876, 877, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 878, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 425, 425, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 425, 50, 425, 50, 879,
+  3, 3, 3, 3, 803, 803, 50, 50, 50, 880, 50, 50, 50, 50, 0, 50, 50, 50, 50, 881, 50, 50, 50, 50,
+  882, 50, 50, 50, 50, 883, 50, 50, 50, 50, 884, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  885, 50, 50, 50, 0, 0, 0, 0, 886, 887, 888, 889, 890, 891, 892, 893, 894, 887, 887, 887, 887, 611,
+  803, 887, 895, 423, 423, 811, 50, 423, 423, 50, 50, 50, 50, 50, 611, 611, 611, 611, 611, 611, 896,
+  611, 611, 611, 611, 0, 611, 611, 611, 611, 897, 611, 611, 611, 611, 898, 611, 611, 611, 611, 899,
+  611, 611, 611, 611, 900, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 901, 611,
+  611, 611, 0, 50, 50, 50, 50, 50, 50, 50, 50, 425, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 902, 903, 50, 50, 50, 50, 803,
+  803, 611, 838, 611, 611, 803, 611, 611, 611, 611, 611, 820, 803, 811, 811, 803, 803, 611, 611, 50,
+  50, 50, 50, 50, 50, 50, 803, 803, 611, 611, 50, 50, 50, 50, 611, 611, 611, 50, 803, 803, 803, 50,
+  50, 803, 803, 803, 803, 803, 803, 803, 50, 50, 50, 611, 611, 611, 611, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 611, 803, 803, 611, 611, 803, 803, 803, 803, 803, 803, 425, 50, 803, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 803, 803, 611, 50, 50, 904, 905, 906, 907, 908, 909, 910,
+  911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929,
+  930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 0, 942, 0, 0, 0, 0, 0, 943, 0, 0, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 944, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 63, 63, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945,
+  945, 945, 945, 945, 945, 945, 945, 945, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945,
+  945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 945, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50,
+  0, 50, 0, 50, 50, 50, 50, 0, 0, 50, 0, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 0,
+  50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 423, 423, 423, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+  50, 50, 50, 50, 50, 50, 0, 0, 946, 947, 948, 949, 950, 951, 0, 0, 3, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 0, 0, 0, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 50, 50, 611, 611, 811, 952, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 50, 50, 50, 611, 611, 952, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 611, 611, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 0, 611,
+  611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 63, 63, 803, 611, 611, 611, 611, 611,
+  611, 611, 803, 803, 803, 803, 803, 803, 803, 803, 611, 803, 803, 611, 611, 611, 611, 611, 611,
+  611, 611, 611, 811, 611, 50, 50, 50, 50, 50, 50, 50, 3, 50, 423, 0, 0, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 953, 3, 3, 3, 63, 63, 63, 63, 63, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+  954, 954, 954, 954, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 611, 611, 954, 954, 954, 954, 954,
+  954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 754, 954, 0, 0, 0, 0, 0, 50, 50,
+  50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 0, 611, 611, 611, 803, 803, 803, 803, 611, 611, 803, 803, 803, 0, 0, 0, 0, 803, 803, 611,
+  803, 803, 803, 803, 803, 803, 753, 423, 425, 0, 0, 0, 0, 3, 0, 0, 0, 3, 3, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 50, 50, 50, 50, 50, 50, 50, 423, 425, 803, 803, 611, 0,
+  0, 50, 50, 50, 50, 50, 50, 50, 803, 611, 803, 611, 611, 611, 611, 611, 611, 611, 0, 811, 803, 611,
+  803, 803, 611, 611, 611, 611, 611, 611, 611, 611, 803, 803, 803, 803, 803, 803, 611, 611, 423,
+  423, 423, 423, 423, 423, 423, 423, 0, 0, 425, 423, 423, 423, 423, 423, 425, 425, 425, 425, 425,
+  425, 423, 423, 425, 611, 425, 425, 423, 423, 425, 425, 423, 423, 423, 423, 423, 425, 423, 423,
+  423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 425, 0, 0, 423,
+  423, 423, 423, 423, 423, 425, 423, 423, 423, 423, 438, 0, 0, 0, 0, 611, 611, 611, 611, 803, 955,
+  956, 957, 958, 959, 960, 961, 962, 963, 964, 50, 50, 965, 966, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 820, 821, 611, 611, 611, 611, 967, 968, 969, 970, 971, 972, 973,
+  974, 975, 976, 952, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 423, 425, 423, 423, 423, 423, 423, 423, 423, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 611, 611, 803, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 611, 611, 611,
+  611, 803, 803, 611, 611, 952, 811, 611, 611, 50, 50, 50, 50, 50, 50, 50, 50, 820, 803, 611, 611,
+  803, 803, 803, 611, 803, 611, 611, 611, 952, 952, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 803, 803, 803, 803, 803, 803, 803, 803, 611, 611, 611, 611, 611, 611, 611, 611, 803, 803,
+  611, 820, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 50, 50,
+  50, 541, 543, 977, 556, 557, 557, 565, 593, 978, 979, 50, 0, 0, 0, 0, 0, 980, 981, 982, 983, 984,
+  985, 986, 987, 988, 989, 990, 991, 944, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002,
+  1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018,
+  1019, 1020, 1021, 0, 0, 1022, 1023, 1024, 423, 423, 423, 50, 430, 425, 425, 425, 425, 425, 423,
+  423, 425, 425, 425, 425, 423, 803, 430, 430, 430, 430, 430, 430, 430, 50, 50, 50, 50, 425, 50, 50,
+  50, 50, 50, 50, 423, 50, 50, 803, 423, 423, 50, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 62, 1025, 1026, 50, 1027, 1028, 261, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 50,
+  71, 373, 1034, 406, 1035, 1036, 410, 62, 1037, 1038, 1039, 1026, 1027, 1028, 262, 263, 1040, 1029,
+  50, 1031, 1032, 202, 71, 256, 1041, 1042, 1034, 1035, 1036, 1043, 270, 1044, 1045, 457, 458, 459,
+  475, 476, 1030, 406, 1036, 1044, 457, 458, 516, 475, 476, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 552, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 1046,
+  1047, 1048, 91, 1040, 1049, 1050, 1051, 1052, 268, 267, 1053, 1054, 1055, 1056, 1057, 1058, 1059,
+  1060, 271, 1061, 1062, 272, 1063, 1064, 279, 1065, 395, 284, 1066, 285, 396, 1067, 1068, 1069,
+  1070, 463, 423, 423, 425, 423, 423, 423, 423, 423, 423, 423, 425, 423, 423, 438, 1071, 425, 427,
+  423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423,
+  423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 424,
+  754, 754, 425, 1072, 423, 437, 425, 423, 425, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080,
+  1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096,
+  1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112,
+  1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128,
+  1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
+  1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160,
+  1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176,
+  1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192,
+  1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208,
+  1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
+  1225, 1226, 1227, 1228, 50, 50, 1229, 50, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238,
+  1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254,
+  1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270,
+  1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286,
+  1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302,
+  1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318,
+  1319, 1320, 50, 1321, 50, 1322, 50, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332,
+  1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 0, 0, 1345, 1346, 1347,
+  1348, 1349, 1350, 0, 0, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
+  1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378,
+  1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 0, 0, 1389, 1390, 1391, 1392, 1393,
+  1394, 0, 0, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 0, 1403, 0, 1404, 0, 1405, 0, 1406,
+  1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422,
+  1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 0, 0, 1437,
+  1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453,
+  1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469,
+  1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485,
+  1486, 1487, 1488, 1489, 0, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501,
+  1502, 1503, 1504, 0, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
+  1518, 0, 0, 1519, 1520, 1521, 1522, 1523, 1524, 0, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532,
+  1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 0, 0, 1544, 1545, 1546, 0, 1547,
+  1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 0, 1556, 1557, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  63, 1558, 1558, 0, 0, 3, 1559, 3, 3, 3, 3, 3, 1560, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+  3, 0, 0, 0, 0, 0, 0, 0, 60, 3, 3, 3, 1561, 1562, 3, 1563, 1564, 3, 3, 3, 3, 1565, 3, 1566, 3, 3,
+  3, 3, 3, 3, 3, 3, 1567, 1568, 1569, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1570, 3, 3, 3, 3, 3, 3,
+  3, 60, 63, 63, 63, 63, 63, 0, 0, 0, 0, 0, 63, 63, 63, 63, 63, 63, 1571, 1030, 0, 0, 1572, 1573,
+  1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1033, 1571, 70, 65, 66, 1572, 1573, 1574,
+  1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 0, 62, 1028, 71, 420, 262, 403, 1031, 418, 1032,
+  1033, 1034, 419, 1035, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 1583, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 423, 423, 430, 430, 423, 423, 423, 423, 430, 430, 430, 423, 423,
+  611, 611, 611, 611, 423, 611, 611, 611, 430, 430, 423, 425, 423, 430, 430, 425, 425, 425, 425,
+  423, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1584, 1585, 1047, 1586, 3, 1587, 1588, 263, 3,
+  1589, 1029, 403, 403, 403, 403, 172, 1030, 1030, 418, 418, 3, 1033, 1590, 3, 3, 1034, 24, 406,
+  406, 406, 3, 3, 1591, 1592, 1593, 3, 1067, 3, 1594, 3, 1067, 3, 1595, 1596, 1026, 1047, 3, 1028,
+  1028, 1049, 1597, 1032, 71, 1598, 1599, 1600, 1601, 1030, 3, 1602, 470, 458, 458, 470, 1603, 3, 3,
+  3, 3, 1027, 1027, 1028, 1030, 405, 3, 3, 3, 3, 50, 50, 1604, 1605, 1606, 1607, 1608, 1609, 1610,
+  1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1030, 1620, 1621, 1622, 1044, 1623, 1624,
+  1625, 1626, 420, 1627, 1628, 418, 1047, 1027, 1032, 50, 50, 50, 1629, 50, 50, 50, 50, 50, 1630, 3,
+  3, 0, 0, 0, 0, 1631, 3, 1632, 3, 1633, 3, 3, 3, 3, 3, 1634, 1635, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 1636, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1637, 1638, 1639, 1640, 3,
+  1641, 3, 1642, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1643, 1644, 3, 3, 3, 1645, 1646, 3, 1647,
+  1648, 3, 3, 3, 3, 3, 3, 1649, 1650, 1651, 1652, 3, 3, 3, 3, 3, 1653, 1654, 3, 1655, 1656, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 1657, 3, 3, 3, 3, 1658, 3, 1659, 1660, 1661, 3, 1662, 1663, 1664, 3, 3, 3,
+  1665, 3, 3, 1666, 1667, 1668, 3, 1669, 1670, 3, 3, 3, 3, 3, 3, 3, 1671, 1672, 1673, 1674, 1675,
+  1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 3, 3, 1688, 1689, 1690,
+  1691, 1692, 1693, 1694, 1695, 1696, 1697, 3, 3, 3, 3, 3, 3, 3, 1698, 1699, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 1700, 3, 3, 3, 3, 3, 1701, 1702, 3, 1703, 1704, 1705, 1706, 1707, 3, 3, 1708,
+  1709, 1710, 1711, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1712, 1713, 1714, 1715, 3, 3, 3, 3, 3, 3, 1716,
+  1717, 1718, 1719, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1720, 1721, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 50, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+  70, 65, 66, 1572, 1573, 1574, 1575, 1576, 1577, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729,
+  1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745,
+  1746, 1747, 1748, 1749, 1750, 1751, 1752, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768,
+  1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 62, 1026, 1047, 1027, 1028, 1049,
+  1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420,
+  411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71,
+  1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 1571, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 50, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1779, 3, 3, 3, 3, 3, 3, 3,
+  1780, 1781, 1782, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1783, 3, 3, 3, 3,
+  3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792,
+  1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808,
+  1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824,
+  1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 50, 1833, 1834, 1835, 50, 50, 1836, 50, 1837, 50,
+  1838, 50, 1038, 1059, 1037, 1046, 50, 1839, 50, 50, 1840, 50, 50, 50, 50, 50, 50, 405, 1044, 1841,
+  1842, 1843, 50, 1844, 50, 1845, 50, 1846, 50, 1847, 50, 1848, 50, 1849, 50, 1850, 50, 1851, 50,
+  1852, 50, 1853, 50, 1854, 50, 1855, 50, 1856, 50, 1857, 50, 1858, 50, 1859, 50, 1860, 50, 1861,
+  50, 1862, 50, 1863, 50, 1864, 50, 1865, 50, 1866, 50, 1867, 50, 1868, 50, 1869, 50, 1870, 50,
+  1871, 50, 1872, 50, 1873, 50, 1874, 50, 1875, 50, 1876, 50, 1877, 50, 1878, 50, 1879, 50, 1880,
+  50, 1881, 50, 1882, 50, 1883, 50, 1884, 50, 1885, 50, 1886, 50, 1887, 50, 1888, 50, 1889, 50,
+  1890, 50, 1891, 50, 1892, 50, 50, 3, 3, 3, 3, 3, 3, 1893, 50, 1894, 50, 423, 423, 423, 1895, 50,
+  0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 50, 50, 50, 50, 50, 50, 0, 50, 0, 0, 0, 0, 0, 50, 0, 0, 50,
+  50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 1896, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 811, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50,
+  50, 50, 50, 50, 50, 50, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 0, 3, 3, 3, 3, 1897, 3, 3, 3, 1898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1899, 1900, 1901,
+  1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917,
+  1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933,
+  1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949,
+  1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965,
+  1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981,
+  1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997,
+  1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013,
+  2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029,
+  2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045,
+  2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061,
+  2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077,
+  2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093,
+  2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109,
+  2110, 2111, 2112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 3, 2113, 3, 3, 50, 50, 50, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 50, 50, 50, 50, 50, 50, 50, 50, 50, 1072, 754, 424, 753, 2114, 2114, 3, 50, 50, 50, 50,
+  50, 2115, 3, 1922, 2116, 2117, 50, 50, 3, 3, 3, 0, 50, 50, 50, 50, 50, 2118, 50, 50, 50, 50, 2119,
+  2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135,
+  2136, 2137, 2138, 2139, 2140, 2141, 2142, 50, 2143, 2144, 2145, 2146, 2147, 2148, 50, 50, 50, 50,
+  50, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 50,
+  50, 50, 50, 50, 50, 2164, 50, 50, 0, 0, 2165, 2165, 2166, 2167, 2168, 2169, 2170, 3, 50, 50, 50,
+  50, 50, 2171, 50, 50, 50, 50, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182,
+  2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 50, 2196, 2197,
+  2198, 2199, 2200, 2201, 50, 50, 50, 50, 50, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210,
+  2211, 2212, 2213, 2214, 2215, 2216, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 2217, 2218, 2219, 2220, 50, 2221, 50, 50, 2222, 2223, 2224, 2225, 3, 50, 2226, 2227, 2228,
+  0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 2229, 2230, 2231, 2232, 2233, 2234,
+  2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250,
+  2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266,
+  2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 63, 2280, 2281,
+  2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297,
+  2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313,
+  2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 0, 50, 50, 1899, 1905, 2322, 2323, 2324, 2325,
+  2326, 2327, 1903, 2328, 2329, 2330, 2331, 1907, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347,
+  2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 0, 2363,
+  2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379,
+  2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395,
+  2396, 2397, 2398, 2399, 2400, 1965, 2401, 50, 50, 50, 50, 50, 50, 50, 50, 2402, 2403, 2404, 2405,
+  2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2229, 2232, 2235, 2237,
+  2245, 2246, 2249, 2251, 2252, 2254, 2255, 2256, 2257, 2258, 2418, 2419, 2420, 2421, 2422, 2423,
+  2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 50, 1899, 1905, 2322, 2323,
+  2435, 2436, 2437, 1910, 2438, 1922, 1972, 1984, 1983, 1973, 2065, 1930, 1970, 2439, 2440, 2441,
+  2442, 2443, 2444, 2445, 2446, 2447, 2448, 1936, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456,
+  2324, 2325, 2326, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469,
+  2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485,
+  2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501,
+  2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517,
+  2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533,
+  2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549,
+  2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565,
+  2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581,
+  2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597,
+  2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613,
+  2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629,
+  2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645,
+  2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661,
+  2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677,
+  2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693,
+  2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709,
+  2710, 2711, 2712, 2713, 2714, 2674, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724,
+  2725, 2726, 2727, 2728, 2729, 2728, 2730, 2731, 2732, 2733, 2734, 2733, 2735, 2736, 0, 2737, 2738,
+  2739, 2740, 0, 2741, 2742, 2743, 2744, 2745, 2746, 2704, 2747, 2748, 2749, 2750, 2751, 2680, 2752,
+  2753, 2754, 0, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768,
+  2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784,
+  2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 3, 2794, 50, 2795, 50, 2796, 50,
+  2797, 50, 2798, 50, 978, 50, 2799, 50, 2800, 50, 2801, 50, 2802, 50, 2803, 50, 2804, 50, 2805, 50,
+  2806, 50, 2807, 50, 2808, 50, 2809, 50, 2810, 50, 2811, 50, 2812, 50, 2813, 50, 2814, 50, 2815,
+  50, 50, 423, 611, 611, 611, 3, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 3, 3, 2816, 50,
+  2817, 50, 2818, 50, 2819, 50, 2820, 50, 2821, 50, 2822, 50, 2823, 50, 2824, 50, 2825, 50, 2826,
+  50, 2827, 50, 2828, 50, 2829, 50, 565, 567, 423, 423, 423, 423, 50, 50, 50, 50, 50, 50, 0, 0, 0,
+  0, 0, 0, 0, 0, 3, 3, 2830, 50, 2831, 50, 2832, 50, 2833, 50, 2834, 50, 2835, 50, 2836, 50, 50, 50,
+  2837, 50, 2838, 50, 2839, 50, 2840, 50, 2841, 50, 2842, 50, 2843, 50, 2844, 50, 2845, 50, 2846,
+  50, 2847, 50, 2848, 50, 2849, 50, 2850, 50, 2851, 50, 2852, 50, 2853, 50, 2854, 50, 2855, 50,
+  2856, 50, 2857, 50, 2858, 50, 2859, 50, 2860, 50, 2861, 50, 2862, 50, 2863, 50, 2864, 50, 2865,
+  50, 2866, 50, 2867, 50, 2867, 50, 50, 50, 50, 50, 50, 50, 50, 2868, 50, 2869, 50, 2870, 2871, 50,
+  2872, 50, 2873, 50, 2874, 50, 2875, 50, 3, 50, 50, 2876, 50, 1052, 50, 50, 2877, 50, 2878, 50, 50,
+  50, 2879, 50, 2880, 50, 2881, 50, 2882, 50, 2883, 50, 2884, 50, 2885, 50, 2886, 50, 2887, 50,
+  2888, 50, 404, 1040, 1051, 2889, 1053, 50, 2890, 2891, 1055, 2892, 2893, 50, 2894, 50, 2895, 50,
+  2896, 50, 2897, 50, 2898, 50, 2899, 50, 2900, 50, 2901, 1064, 2902, 2903, 50, 2904, 50, 2905,
+  2906, 50, 2907, 50, 2908, 50, 2909, 50, 2910, 50, 2911, 50, 2912, 50, 2913, 50, 2914, 0, 0, 0, 0,
+  419, 1047, 1049, 24, 2915, 50, 50, 172, 209, 50, 50, 50, 50, 50, 50, 50, 50, 611, 50, 50, 50, 811,
+  50, 50, 50, 50, 611, 50, 50, 50, 50, 50, 50, 50, 803, 803, 611, 611, 803, 3, 3, 3, 3, 811, 0, 0,
+  0, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 0, 0, 0, 0, 0, 0, 954, 954, 2916, 50, 3, 3, 3, 3, 0, 0,
+  0, 0, 0, 0, 0, 0, 803, 803, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 811, 611, 0,
+  0, 0, 0, 0, 0, 0, 0, 50, 50, 423, 423, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 611,
+  50, 50, 50, 50, 50, 50, 611, 611, 611, 611, 611, 425, 425, 425, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 803, 952, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 50, 50, 50, 50, 820, 803, 803, 611, 611, 611, 611, 803, 803, 611, 611, 803, 803, 952, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0,
+  0, 0, 50, 50, 50, 50, 50, 50, 50, 611, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 611, 611, 611, 611, 611, 611, 803, 803, 611, 611, 803, 803, 611, 611, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 50, 50, 50, 611, 50, 50, 50, 50, 50, 50, 50, 50, 611, 803, 0, 0, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803,
+  611, 803, 50, 50, 423, 50, 423, 423, 425, 50, 50, 423, 423, 50, 50, 50, 50, 50, 423, 423, 50, 423,
+  50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 803, 611, 611, 803, 803, 50, 50, 50, 50, 50, 803, 811,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50,
+  50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 2832,
+  2917, 1833, 2918, 50, 50, 50, 50, 50, 50, 50, 50, 50, 2919, 3, 3, 0, 0, 0, 0, 2920, 2921, 2922,
+  2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938,
+  2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954,
+  2955, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970,
+  2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986,
+  2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 50, 50, 50, 803,
+  803, 611, 803, 803, 611, 803, 803, 50, 803, 811, 0, 0, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 50, 50, 50, 50, 50, 3000, 3001, 3002, 3003, 3004,
+  3005, 3006, 3007, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019,
+  3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035,
+  3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051,
+  3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067,
+  3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083,
+  3084, 3085, 3086, 3087, 3088, 3089, 3090, 3019, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098,
+  3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114,
+  3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130,
+  3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146,
+  3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157, 3158, 3109, 3159, 3160, 3161,
+  3162, 3163, 3164, 3165, 3166, 3093, 3167, 3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176,
+  3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3019, 3187, 3188, 3189, 3190, 3191,
+  3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206, 3207,
+  3208, 3209, 3210, 3211, 3212, 3213, 3095, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221, 3222,
+  3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236, 3237, 3238,
+  3239, 3240, 3241, 3242, 3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252, 3253, 3254,
+  3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 50, 50, 3264, 50, 3265, 50, 50, 3266, 3267,
+  3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 50, 3276, 50, 3277, 50, 50, 3278, 3279, 50, 50,
+  50, 3280, 3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294,
+  3295, 3296, 3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310,
+  3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3148, 3325,
+  3326, 3327, 3328, 3329, 3330, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3278, 3339,
+  3340, 3341, 3342, 3343, 3344, 0, 0, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3292, 3353,
+  3354, 3355, 3264, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365, 3366, 3367, 3301,
+  3368, 3302, 3369, 3370, 3371, 3372, 3373, 3265, 3040, 3374, 3375, 3376, 3110, 3197, 3377, 3378,
+  3309, 3379, 3310, 3380, 3381, 3382, 3267, 3383, 3384, 3385, 3386, 3387, 3268, 3388, 3389, 3390,
+  3391, 3392, 3393, 3324, 3394, 3395, 3148, 3396, 3328, 3397, 3398, 3399, 3400, 3401, 3333, 3402,
+  3277, 3403, 3334, 3091, 3404, 3335, 3405, 3337, 3406, 3407, 3408, 3409, 3410, 3339, 3273, 3411,
+  3340, 3412, 3341, 3413, 3007, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 0,
+  0, 0, 0, 0, 0, 3425, 3426, 3427, 3428, 3429, 3430, 3430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3431,
+  3432, 3433, 3434, 3435, 0, 0, 0, 0, 0, 3436, 3437, 3438, 3439, 1598, 1601, 3440, 3441, 3442, 3443,
+  3444, 3445, 1578, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455, 3456, 3457, 3458, 0,
+  3459, 3460, 3461, 3462, 3463, 0, 3464, 0, 3465, 3466, 0, 3467, 3468, 0, 3469, 3470, 3471, 3472,
+  3473, 3474, 3475, 3476, 3477, 3478, 3479, 3479, 3480, 3480, 3480, 3480, 3481, 3481, 3481, 3481,
+  3482, 3482, 3482, 3482, 3483, 3483, 3483, 3483, 3484, 3484, 3484, 3484, 3485, 3485, 3485, 3485,
+  3486, 3486, 3486, 3486, 3487, 3487, 3487, 3487, 3488, 3488, 3488, 3488, 3489, 3489, 3489, 3489,
+  3490, 3490, 3490, 3490, 3491, 3491, 3491, 3491, 3492, 3492, 3493, 3493, 3494, 3494, 3495, 3495,
+  3496, 3496, 3497, 3497, 3498, 3498, 3498, 3498, 3499, 3499, 3499, 3499, 3500, 3500, 3500, 3500,
+  3501, 3501, 3501, 3501, 3502, 3502, 3503, 3503, 3503, 3503, 3504, 3504, 3505, 3505, 3505, 3505,
+  3506, 3506, 3506, 3506, 3507, 3507, 3508, 3508, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3509, 3509,
+  3509, 3509, 3510, 3510, 3511, 3511, 3512, 3512, 794, 3513, 3513, 3514, 3514, 3515, 3515, 3516,
+  3516, 3516, 3516, 3517, 3517, 3518, 3518, 3519, 3519, 3520, 3520, 3521, 3521, 3522, 3522, 3523,
+  3523, 3524, 3524, 3524, 3525, 3525, 3525, 3526, 3526, 3526, 3526, 3527, 3528, 3529, 3525, 3530,
+  3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546,
+  3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562,
+  3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578,
+  3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594,
+  3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610,
+  3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626,
+  3627, 3529, 3628, 3525, 3530, 3629, 3630, 3534, 3631, 3535, 3536, 3632, 3633, 3540, 3634, 3541,
+  3542, 3635, 3636, 3544, 3637, 3545, 3546, 3575, 3576, 3579, 3580, 3581, 3585, 3586, 3587, 3588,
+  3592, 3593, 3594, 3638, 3598, 3639, 3640, 3604, 3641, 3605, 3606, 3619, 3642, 3643, 3614, 3644,
+  3615, 3616, 3527, 3528, 3645, 3529, 3646, 3531, 3532, 3533, 3534, 3647, 3537, 3538, 3539, 3540,
+  3648, 3544, 3547, 3548, 3549, 3550, 3551, 3553, 3554, 3555, 3556, 3557, 3558, 3649, 3559, 3560,
+  3561, 3562, 3563, 3564, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3577, 3578, 3582,
+  3583, 3584, 3585, 3586, 3589, 3590, 3591, 3592, 3650, 3595, 3596, 3597, 3598, 3601, 3602, 3603,
+  3604, 3651, 3607, 3608, 3652, 3611, 3612, 3613, 3614, 3653, 3529, 3646, 3534, 3647, 3540, 3648,
+  3544, 3654, 3557, 3655, 3656, 3657, 3585, 3586, 3592, 3604, 3651, 3614, 3653, 3658, 3659, 3660,
+  3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676,
+  3677, 3678, 3679, 3680, 3681, 3682, 3683, 3656, 3684, 3685, 3686, 3687, 3661, 3662, 3663, 3664,
+  3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679, 3680,
+  3681, 3682, 3683, 3656, 3684, 3685, 3686, 3687, 3681, 3682, 3683, 3656, 3655, 3657, 3565, 3554,
+  3555, 3556, 3681, 3682, 3683, 3565, 3566, 3688, 3688, 3, 3, 3689, 3690, 3690, 3691, 3692, 3693,
+  3694, 3695, 3696, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3702, 3703, 3704, 3704, 3705, 3705,
+  3706, 3707, 3707, 3708, 3709, 3709, 3710, 3710, 3711, 3712, 3712, 3713, 3713, 3714, 3715, 3716,
+  3717, 3717, 3718, 3719, 3720, 3721, 3722, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3728, 3729,
+  3729, 3730, 3730, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 3, 3, 3738, 3739, 3740, 3741, 3742,
+  3743, 3743, 3744, 3745, 3746, 3747, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755, 3756,
+  3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769, 3723, 3725, 3770,
+  3771, 3772, 3773, 3774, 3775, 3774, 3772, 3776, 3777, 3778, 3779, 3780, 3775, 3716, 3706, 3781,
+  3782, 3, 3, 3, 3, 3, 3, 3, 3, 3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793,
+  3794, 3795, 3, 3, 3, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 3796, 3797,
+  0, 3798, 3799, 3800, 3801, 3802, 3803, 0, 0, 0, 0, 0, 0, 0, 423, 423, 423, 423, 423, 423, 423,
+  425, 425, 425, 425, 425, 425, 425, 423, 423, 0, 3804, 3805, 3806, 3806, 1581, 1582, 3807, 3808,
+  3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3, 3, 3821, 3822, 1566,
+  1566, 1566, 1566, 3806, 3806, 3806, 3796, 3797, 0, 0, 3799, 3798, 3801, 3800, 3804, 1581, 1582,
+  3807, 3808, 3809, 3810, 3823, 3824, 3825, 1578, 3826, 3827, 3828, 1580, 0, 3829, 3830, 3831, 3832,
+  0, 0, 0, 0, 3833, 3834, 3835, 768, 3836, 0, 3837, 3838, 3839, 3840, 3841, 3842, 3843, 3844, 3845,
+  3846, 3847, 3848, 3848, 3849, 3849, 3850, 3850, 3851, 3851, 3852, 3852, 3852, 3852, 3853, 3853,
+  3854, 3854, 3854, 3854, 3855, 3855, 3856, 3856, 3856, 3856, 3857, 3857, 3857, 3857, 3858, 3858,
+  3858, 3858, 3859, 3859, 3859, 3859, 3860, 3860, 3860, 3860, 3861, 3861, 3862, 3862, 3863, 3863,
+  3864, 3864, 3865, 3865, 3865, 3865, 3866, 3866, 3866, 3866, 3867, 3867, 3867, 3867, 3868, 3868,
+  3868, 3868, 3869, 3869, 3869, 3869, 3870, 3870, 3870, 3870, 3871, 3871, 3871, 3871, 3872, 3872,
+  3872, 3872, 3873, 3873, 3873, 3873, 3874, 3874, 3874, 3874, 3875, 3875, 3875, 3875, 3876, 3876,
+  3876, 3876, 3877, 3877, 3877, 3877, 3878, 3878, 3878, 3878, 3879, 3879, 3879, 3879, 3880, 3880,
+  3517, 3517, 3881, 3881, 3881, 3881, 3882, 3882, 3883, 3883, 3884, 3884, 3885, 3885, 0, 0, 63, 0,
+  3800, 3886, 3823, 3830, 3831, 3824, 3887, 1581, 1582, 3825, 1578, 3796, 3826, 2113, 3888, 1571,
+  70, 65, 66, 1572, 1573, 1574, 1575, 1576, 1577, 3798, 3799, 3827, 1580, 3828, 3801, 3832, 62,
+  1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419,
+  1035, 1036, 1044, 410, 420, 411, 1067, 3821, 3829, 3822, 3889, 3806, 3890, 62, 1026, 1047, 1027,
+  1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044,
+  410, 420, 411, 1067, 3807, 3891, 3808, 3892, 3893, 3894, 2113, 3817, 3818, 3797, 3895, 2544, 3896,
+  3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904, 3905, 2498, 2499, 2500, 2501, 2502, 2503, 2504,
+  2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520,
+  2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536,
+  2537, 2538, 2539, 2540, 2541, 3906, 3907, 3908, 63, 2229, 2230, 2231, 2232, 2233, 2234, 2235,
+  2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251,
+  2252, 2253, 2254, 2255, 2256, 2257, 2258, 0, 0, 0, 2259, 2260, 2261, 2262, 2263, 2264, 0, 0, 2265,
+  2266, 2267, 2268, 2269, 2270, 0, 0, 2271, 2272, 2273, 2274, 2275, 2276, 0, 0, 2277, 2278, 2279, 0,
+  0, 0, 3909, 3910, 3911, 64, 3912, 3913, 3914, 0, 3915, 3916, 3917, 3918, 3919, 3920, 3921, 0, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50,
+  50, 0, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 0, 0, 0,
+  0, 0, 50, 3, 50, 0, 0, 0, 0, 50, 50, 50, 50, 50, 0, 0, 0, 50, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 50, 50, 0, 3, 3, 3, 3, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 425, 0, 0, 50,
+  50, 50, 50, 50, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 425, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 0, 0, 0, 0, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 423, 423, 423, 423, 423, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 0, 50, 3922, 3923, 3924,
+  3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937, 3938, 3939, 3940,
+  3941, 3942, 3943, 3944, 3945, 3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955, 3956,
+  3957, 3958, 3959, 3960, 3961, 50, 50, 0, 0, 0, 0, 0, 0, 3962, 3963, 3964, 3965, 3966, 3967, 3968,
+  3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982, 3983, 3984,
+  3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3997, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 50, 3998, 3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 4008, 0, 4009, 4010,
+  4011, 4012, 4013, 4014, 4015, 4016, 4017, 4018, 4019, 4020, 4021, 4022, 4023, 0, 4024, 4025, 4026,
+  4027, 4028, 4029, 4030, 0, 4031, 4032, 0, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50, 0,
+  0, 0, 50, 4033, 50, 50, 50, 50, 50, 50, 50, 50, 4034, 50, 50, 50, 50, 50, 50, 50, 4035, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 4036, 50, 50, 50, 50, 4037, 4038, 1025, 4039, 253, 0, 4040, 4041,
+  4042, 4043, 258, 259, 4044, 4045, 4046, 4047, 2905, 4048, 265, 4049, 172, 4050, 4051, 4052, 4053,
+  4054, 2889, 4055, 4056, 4057, 4058, 4059, 4060, 4061, 4062, 4063, 24, 4064, 4065, 1835, 4066, 277,
+  4067, 4068, 4069, 4070, 281, 4071, 0, 4072, 4073, 4074, 4075, 4076, 4077, 4078, 4079, 4080, 0, 0,
+  0, 0, 0, 768, 768, 768, 768, 768, 768, 0, 0, 768, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 768, 768, 0, 0, 0, 768, 0, 0, 768, 768,
+  768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 0, 768, 768, 0, 0, 0, 0,
+  0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 3, 768, 768, 0, 0, 0, 0, 0, 768, 768,
+  768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768,
+  611, 611, 611, 0, 611, 611, 0, 0, 0, 0, 0, 611, 425, 611, 423, 768, 768, 768, 768, 0, 768, 768,
+  768, 0, 768, 768, 768, 768, 768, 768, 768, 423, 430, 425, 0, 0, 0, 0, 811, 768, 0, 0, 0, 0, 0, 0,
+  0, 775, 775, 775, 775, 775, 782, 768, 782, 768, 782, 782, 768, 768, 4081, 782, 782, 782, 782, 782,
+  775, 775, 775, 775, 4081, 775, 775, 775, 775, 775, 782, 775, 775, 775, 782, 768, 768, 782, 423,
+  425, 0, 0, 0, 0, 775, 775, 775, 775, 782, 0, 3, 3, 3, 3, 3, 3, 3, 768, 768, 768, 0, 0, 0, 0, 0,
+  775, 782, 775, 782, 782, 782, 775, 775, 775, 782, 775, 775, 782, 775, 782, 782, 775, 782, 0, 0, 0,
+  0, 0, 0, 0, 768, 768, 768, 768, 0, 0, 0, 0, 782, 782, 782, 782, 775, 775, 768, 4082, 4083, 4084,
+  4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095, 4096, 4097, 4098, 4099, 4100,
+  4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111, 4112, 4113, 4114, 4115, 4116,
+  4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4127, 4128, 4129, 4130, 4131, 4132, 0,
+  0, 0, 0, 0, 4081, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+  775, 782, 775, 423, 423, 423, 423, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 0, 0, 0, 0,
+  0, 0, 790, 790, 768, 768, 768, 768, 768, 768, 4133, 4134, 4135, 4136, 4137, 4138, 4139, 4140,
+  4141, 4142, 4143, 4144, 4145, 4146, 4147, 4148, 4149, 4150, 4151, 4152, 4153, 4154, 0, 0, 0, 423,
+  423, 423, 423, 423, 3, 768, 0, 0, 0, 0, 0, 0, 768, 768, 790, 790, 790, 790, 790, 790, 790, 0, 768,
+  768, 0, 423, 423, 768, 0, 0, 0, 0, 782, 775, 775, 768, 775, 775, 0, 0, 425, 425, 611, 425, 425,
+  425, 775, 775, 775, 782, 775, 775, 775, 775, 775, 775, 775, 775, 775, 768, 425, 425, 423, 423,
+  423, 425, 423, 425, 425, 425, 425, 775, 775, 775, 782, 768, 768, 768, 775, 775, 775, 775, 782,
+  782, 775, 775, 775, 775, 423, 425, 423, 425, 768, 768, 775, 768, 775, 775, 782, 782, 782, 768,
+  775, 782, 782, 775, 775, 782, 775, 775, 768, 775, 782, 782, 775, 768, 768, 768, 768, 782, 775,
+  4081, 0, 0, 0, 0, 803, 611, 803, 50, 50, 50, 50, 50, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+  611, 611, 611, 611, 611, 811, 50, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 50, 50, 811, 50, 50,
+  611, 611, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 811, 611, 611, 803, 50, 50, 50, 50, 50, 50, 4155, 4156,
+  4157, 4158, 50, 50, 50, 50, 50, 50, 50, 50, 4159, 50, 50, 50, 50, 50, 4160, 50, 50, 50, 50, 803,
+  803, 803, 611, 611, 611, 611, 803, 803, 811, 810, 50, 50, 0, 50, 50, 50, 50, 611, 0, 0, 0, 0, 0,
+  423, 423, 423, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 838, 611, 611, 611, 611, 803, 611,
+  4161, 4162, 611, 4163, 4164, 811, 811, 0, 50, 50, 50, 50, 50, 50, 50, 803, 803, 50, 50, 50, 50,
+  820, 50, 50, 50, 0, 50, 50, 50, 803, 803, 803, 611, 611, 611, 611, 611, 611, 611, 611, 611, 803,
+  952, 50, 50, 50, 50, 50, 50, 50, 50, 611, 820, 611, 611, 50, 803, 611, 0, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 803, 803, 803, 611, 611, 611, 803, 803, 611, 952, 820, 611, 50, 50, 50, 50,
+  50, 50, 611, 50, 50, 611, 0, 0, 0, 0, 0, 0, 50, 0, 50, 50, 50, 50, 0, 50, 50, 50, 50, 50, 50, 50,
+  50, 611, 803, 803, 803, 611, 611, 611, 611, 611, 611, 820, 811, 0, 0, 0, 0, 0, 611, 611, 803, 803,
+  0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 50, 50, 0, 0, 50, 50, 50, 50, 50, 50, 0, 50, 50, 50, 50,
+  50, 50, 50, 0, 50, 50, 0, 50, 50, 50, 50, 50, 0, 820, 820, 50, 821, 803, 611, 803, 803, 803, 803,
+  0, 0, 4165, 803, 0, 0, 4166, 4167, 952, 0, 0, 50, 0, 0, 0, 0, 0, 0, 821, 50, 50, 803, 803, 0, 0,
+  423, 423, 423, 423, 423, 423, 423, 0, 0, 0, 50, 50, 4168, 4169, 4170, 4171, 50, 50, 50, 50, 0,
+  4172, 0, 0, 4173, 0, 4174, 4175, 50, 50, 50, 50, 50, 50, 821, 803, 803, 838, 611, 611, 611, 611,
+  611, 0, 4176, 0, 0, 4177, 0, 4178, 4179, 821, 803, 0, 803, 803, 811, 952, 811, 50, 611, 50, 50,
+  50, 0, 50, 0, 611, 611, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 803, 803, 803, 803, 803, 811, 611, 611,
+  803, 820, 50, 50, 50, 50, 50, 0, 50, 423, 50, 821, 803, 803, 611, 611, 611, 611, 611, 611, 4180,
+  838, 4181, 4182, 821, 4183, 611, 611, 803, 811, 820, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  821, 803, 803, 611, 611, 611, 611, 0, 0, 4184, 4185, 4186, 4187, 611, 611, 803, 811, 820, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 611, 611, 0, 0, 611, 611, 611, 803, 803, 611, 803, 811, 611,
+  50, 50, 50, 50, 0, 0, 0, 50, 50, 50, 611, 803, 611, 803, 803, 611, 611, 611, 611, 611, 611, 952,
+  820, 50, 50, 50, 0, 0, 611, 803, 611, 803, 803, 611, 611, 611, 611, 803, 611, 611, 611, 611, 811,
+  0, 0, 0, 0, 803, 811, 820, 50, 0, 0, 0, 0, 4188, 4189, 4190, 4191, 4192, 4193, 4194, 4195, 4196,
+  4197, 4198, 4199, 4200, 4201, 4202, 4203, 4204, 4205, 4206, 4207, 4208, 4209, 4210, 4211, 4212,
+  4213, 4214, 4215, 4216, 4217, 4218, 4219, 0, 50, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 50,
+  0, 821, 803, 803, 803, 803, 4220, 0, 803, 4221, 0, 0, 611, 611, 952, 811, 50, 803, 50, 803, 820,
+  50, 50, 50, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 803, 803, 803, 611, 611, 611, 611, 0, 0, 611,
+  611, 803, 803, 803, 803, 811, 50, 50, 50, 803, 0, 0, 0, 50, 611, 611, 611, 611, 611, 611, 4222,
+  4222, 611, 611, 50, 50, 50, 50, 50, 50, 50, 50, 611, 811, 611, 611, 611, 611, 803, 50, 611, 611,
+  611, 611, 50, 50, 50, 50, 50, 50, 50, 50, 811, 50, 611, 611, 611, 611, 611, 611, 803, 803, 611,
+  611, 611, 50, 50, 50, 50, 50, 50, 611, 611, 611, 611, 611, 611, 611, 811, 50, 50, 50, 50, 50, 50,
+  611, 803, 611, 611, 611, 803, 611, 803, 50, 50, 50, 50, 50, 50, 50, 803, 611, 611, 611, 611, 611,
+  611, 611, 0, 611, 611, 611, 611, 611, 611, 803, 4223, 0, 0, 611, 611, 611, 611, 611, 611, 0, 803,
+  611, 611, 611, 611, 611, 611, 611, 803, 611, 611, 803, 611, 611, 0, 50, 611, 611, 611, 611, 611,
+  611, 0, 0, 0, 611, 0, 611, 611, 0, 611, 611, 611, 820, 611, 811, 811, 50, 611, 50, 50, 803, 803,
+  803, 803, 803, 0, 611, 611, 0, 803, 803, 611, 803, 811, 50, 50, 50, 611, 611, 803, 803, 50, 611,
+  611, 50, 803, 50, 50, 50, 50, 50, 50, 50, 50, 803, 803, 611, 611, 611, 611, 611, 0, 0, 0, 803,
+  803, 611, 952, 811, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 611,
+  50, 50, 50, 50, 50, 50, 611, 611, 611, 611, 611, 611, 611, 0, 0, 50, 50, 50, 50, 50, 50, 4224,
+  838, 838, 4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233, 803, 803, 803, 611, 611, 811, 50,
+  50, 0, 0, 0, 0, 50, 50, 430, 430, 430, 430, 430, 50, 0, 0, 423, 423, 423, 423, 423, 423, 423, 50,
+  50, 50, 50, 4234, 50, 50, 50, 4235, 4236, 4237, 4238, 50, 50, 50, 50, 50, 4239, 4240, 4241, 4242,
+  4243, 4244, 4245, 4246, 4247, 4248, 4249, 4250, 4251, 4252, 4253, 4254, 4255, 4256, 4257, 4258,
+  4259, 4260, 4261, 4262, 4263, 4264, 4265, 4266, 4267, 4268, 4269, 4270, 4271, 4272, 4273, 4274,
+  4275, 4276, 4277, 4278, 4279, 4280, 4281, 4282, 4283, 4284, 4285, 4286, 4287, 4288, 4289, 4290,
+  4291, 4292, 4293, 4294, 4295, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 611, 50, 803, 803,
+  803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 0, 0, 0, 0, 0, 0, 0, 611, 611,
+  611, 611, 50, 50, 50, 50, 50, 50, 50, 3, 50, 611, 0, 0, 0, 4296, 4296, 50, 50, 50, 50, 50, 0, 0,
+  0, 50, 0, 0, 0, 0, 0, 50, 50, 50, 0, 0, 50, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 0, 0, 50,
+  611, 430, 50, 63, 63, 63, 63, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 62, 1026, 1047, 1027, 1028, 1049,
+  1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420,
+  411, 1067, 1571, 70, 65, 66, 1572, 1573, 1574, 1575, 1576, 1577, 3, 3, 3, 0, 0, 0, 3, 3, 3, 3, 0,
+  0, 0, 0, 50, 50, 50, 50, 50, 50, 4297, 4298, 4299, 4300, 4301, 4302, 4303, 4304, 4304, 430, 430,
+  430, 50, 50, 50, 4305, 4304, 4304, 4304, 4304, 4304, 63, 63, 63, 63, 63, 63, 63, 63, 425, 425,
+  425, 425, 425, 425, 425, 425, 50, 50, 423, 423, 423, 423, 423, 425, 425, 50, 50, 50, 50, 50, 50,
+  423, 423, 423, 423, 50, 50, 50, 50, 50, 4306, 4307, 4308, 4309, 4310, 4311, 50, 50, 50, 50, 50,
+  50, 50, 50, 3, 3, 0, 0, 0, 0, 0, 3, 3, 423, 423, 423, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 62, 1026,
+  1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035,
+  1036, 1044, 410, 420, 411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029, 403, 1030, 405, 1031,
+  418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036, 1044, 410, 420, 411, 1067, 62, 1026, 1047,
+  1027, 1028, 1049, 1029, 403, 1030, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 406, 419, 1035, 1036,
+  1044, 410, 420, 411, 1067, 62, 1026, 1047, 1027, 1028, 1049, 1029, 0, 1030, 405, 410, 420, 411,
+  1067, 62, 0, 1047, 1027, 0, 0, 1029, 0, 0, 405, 1031, 0, 0, 1033, 71, 1034, 24, 0, 419, 1035,
+  1047, 1027, 0, 1049, 0, 403, 1030, 405, 1031, 418, 1032, 1033, 0, 1034, 24, 406, 410, 420, 411,
+  1067, 62, 1026, 0, 1027, 1028, 1049, 1029, 0, 0, 405, 1031, 418, 1032, 1033, 71, 1034, 24, 0, 419,
+  1035, 1036, 1044, 410, 420, 411, 0, 62, 1026, 62, 1026, 0, 1027, 1028, 1049, 1029, 0, 1030, 405,
+  1031, 418, 1032, 0, 71, 0, 0, 0, 419, 1035, 1036, 1044, 410, 420, 411, 0, 62, 1026, 1047, 1027,
+  1028, 1049, 410, 420, 411, 1067, 4312, 4313, 0, 0, 4314, 457, 458, 459, 517, 461, 4315, 463, 4316,
+  465, 466, 68, 467, 468, 4317, 470, 516, 463, 472, 473, 4318, 475, 476, 477, 4319, 4320, 4314, 457,
+  458, 459, 517, 461, 4315, 463, 4316, 465, 466, 68, 467, 468, 4317, 470, 516, 472, 472, 473, 4318,
+  475, 476, 477, 4319, 4321, 517, 463, 465, 475, 516, 470, 4314, 457, 458, 459, 517, 461, 4317, 470,
+  516, 463, 472, 473, 4318, 475, 476, 477, 4319, 4320, 4314, 457, 458, 459, 517, 461, 4315, 463,
+  4316, 465, 466, 68, 467, 468, 4317, 470, 516, 472, 472, 473, 4318, 475, 476, 477, 4319, 4321, 517,
+  463, 465, 475, 516, 470, 4314, 457, 458, 459, 467, 468, 4317, 470, 516, 463, 472, 473, 4318, 475,
+  476, 477, 4319, 4320, 4314, 457, 458, 459, 517, 461, 4315, 463, 4316, 465, 466, 68, 467, 468,
+  4317, 470, 516, 472, 472, 473, 4318, 475, 476, 477, 4319, 4321, 517, 463, 465, 475, 516, 470,
+  4314, 457, 466, 68, 467, 468, 4317, 470, 516, 463, 472, 473, 4318, 475, 476, 477, 4319, 4320, 516,
+  472, 472, 473, 4318, 475, 476, 477, 4319, 4321, 517, 463, 465, 475, 516, 470, 516, 470, 506, 506,
+  0, 0, 1571, 70, 65, 66, 1572, 1573, 1574, 1575, 1576, 1577, 1576, 1577, 1571, 70, 65, 66, 1572,
+  1573, 1574, 1575, 1576, 1577, 1571, 70, 65, 66, 1572, 1573, 1574, 1575, 1576, 1577, 1571, 70, 611,
+  611, 611, 611, 611, 611, 611, 50, 50, 50, 50, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+  50, 50, 50, 50, 50, 50, 50, 50, 611, 50, 50, 50, 50, 50, 50, 611, 50, 50, 50, 0, 0, 0, 611, 611,
+  611, 611, 611, 0, 611, 611, 611, 611, 611, 611, 611, 423, 423, 423, 423, 423, 423, 423, 0, 423,
+  423, 423, 423, 423, 423, 423, 423, 423, 0, 0, 423, 423, 423, 423, 423, 423, 423, 0, 423, 423, 0,
+  423, 423, 4322, 540, 541, 4323, 543, 4324, 4325, 4326, 4327, 4328, 550, 551, 977, 554, 555, 556,
+  557, 4329, 559, 560, 561, 4330, 563, 4331, 4332, 569, 2820, 4333, 4334, 531, 4335, 630, 639, 4322,
+  540, 541, 4323, 543, 4324, 4325, 4326, 4327, 4328, 550, 977, 554, 556, 4329, 559, 560, 561, 4330,
+  563, 565, 4331, 615, 4334, 528, 538, 628, 2801, 631, 0, 0, 0, 0, 0, 0, 0, 0, 0, 423, 50, 50, 50,
+  50, 50, 50, 423, 0, 50, 50, 50, 50, 423, 423, 423, 423, 50, 50, 0, 0, 0, 0, 0, 3, 50, 50, 50, 50,
+  424, 424, 425, 423, 50, 50, 50, 50, 50, 50, 423, 425, 50, 50, 50, 0, 0, 0, 0, 50, 50, 50, 50, 423,
+  50, 50, 423, 50, 50, 50, 50, 50, 50, 423, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 768, 768, 768, 768, 768,
+  0, 0, 768, 425, 425, 425, 425, 425, 425, 425, 0, 4336, 4337, 4338, 4339, 4340, 4341, 4342, 4343,
+  4344, 4345, 4346, 4347, 4348, 4349, 4350, 4351, 4352, 4353, 4354, 4355, 4356, 4357, 4358, 4359,
+  4360, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 775, 775, 775, 775, 775, 775, 775,
+  775, 775, 775, 423, 423, 423, 423, 423, 423, 820, 4370, 0, 0, 0, 0, 768, 768, 0, 0, 0, 0, 768,
+  768, 768, 768, 768, 768, 768, 0, 0, 0, 3853, 3854, 3858, 3861, 0, 3880, 3864, 3859, 3869, 3881,
+  3875, 3876, 3877, 3878, 3865, 3871, 3873, 3867, 3874, 3863, 3866, 3856, 3857, 3860, 3862, 3868,
+  3870, 3872, 4371, 3502, 4372, 4373, 0, 3854, 3858, 0, 3879, 0, 0, 3859, 0, 3881, 3875, 3876, 3877,
+  3878, 3865, 3871, 3873, 3867, 3874, 0, 3866, 3856, 3857, 3860, 0, 3868, 0, 3872, 0, 0, 0, 0, 0, 0,
+  3858, 0, 0, 0, 0, 3859, 0, 3881, 0, 3876, 0, 3878, 3865, 3871, 0, 3867, 3874, 0, 3866, 0, 0, 3860,
+  0, 3868, 0, 3872, 0, 3502, 0, 4373, 3869, 3881, 3875, 0, 3877, 3878, 3865, 3871, 0, 3868, 3870,
+  3872, 4371, 0, 4372, 0, 3853, 3854, 3858, 3861, 3879, 3880, 3864, 3859, 3869, 3881, 0, 3876, 3877,
+  3878, 3865, 3871, 3862, 3868, 3870, 3872, 0, 0, 0, 0, 0, 3854, 3858, 3861, 0, 3880, 3864, 3859, 3,
+  3, 3, 3, 3, 3, 0, 0, 0, 4374, 4375, 4376, 4377, 4378, 4379, 4380, 4381, 4382, 4383, 3, 3, 3, 3, 3,
+  1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768,
+  1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 4384, 1047, 406, 2739, 4385, 3, 411,
+  1067, 4386, 2728, 4387, 4388, 4389, 4390, 50, 50, 4391, 4392, 4393, 3, 3, 3, 4394, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 3, 0, 0, 4395, 4396, 2508, 0, 0, 0, 0, 0, 1962, 4397, 4398, 4399,
+  1905, 4400, 4401, 2330, 4402, 4403, 4404, 4405, 4406, 4407, 4408, 4409, 4410, 4411, 1998, 4412,
+  4413, 4414, 4415, 4416, 4417, 1899, 2322, 4418, 2457, 2325, 2458, 4419, 2054, 4420, 4421, 4422,
+  4423, 4424, 2440, 1972, 4425, 4426, 4427, 4428, 0, 0, 0, 0, 4429, 4430, 4431, 4432, 4433, 4434,
+  4435, 4436, 4437, 0, 0, 0, 0, 0, 0, 0, 4438, 4439, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 3, 3, 3, 3, 3, 3,
+  3, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 3, 3, 3, 3,
+  0, 3, 3, 3, 3, 1576, 1577, 3, 0, 0, 0, 0, 0, 4440, 4441, 4442, 4443, 4444, 3286, 4445, 4446, 4447,
+  4448, 3287, 4449, 4450, 4451, 3288, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461,
+  4462, 4463, 3346, 4464, 4465, 4466, 4467, 4468, 4469, 4470, 4471, 4472, 3351, 3289, 3290, 3352,
+  4473, 4474, 3097, 4475, 3291, 4476, 4477, 4478, 4479, 4479, 4479, 4480, 4481, 4482, 4483, 4484,
+  4485, 4486, 4487, 4488, 4489, 4490, 4491, 4492, 4493, 4494, 4495, 4496, 4497, 4497, 3354, 4498,
+  4499, 4500, 4501, 3293, 4502, 4503, 4504, 3250, 4505, 4506, 4507, 4508, 4509, 4510, 4511, 4512,
+  4513, 4514, 4515, 4516, 4517, 4518, 4519, 4520, 4521, 4522, 4523, 4524, 4525, 4526, 4527, 4528,
+  4529, 4530, 4530, 4531, 4532, 4533, 3093, 4534, 4535, 4536, 4537, 4538, 4539, 4540, 4541, 3298,
+  4542, 4543, 4544, 4545, 4546, 4547, 4548, 4549, 4550, 4551, 4552, 4553, 4554, 4555, 4556, 4557,
+  4558, 4559, 4560, 4561, 4562, 3039, 4563, 4564, 4565, 4565, 4566, 4567, 4567, 4568, 4569, 4570,
+  4571, 4572, 4573, 4574, 4575, 4576, 4577, 4578, 4579, 4580, 3299, 4581, 4582, 4583, 4584, 3366,
+  4584, 4585, 3301, 4586, 4587, 4588, 4589, 3302, 3012, 4590, 4591, 4592, 4593, 4594, 4595, 4596,
+  4597, 4598, 4599, 4600, 4601, 4602, 4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611, 3303,
+  4612, 4613, 4614, 4615, 4616, 4617, 3305, 4618, 4619, 4620, 4621, 4622, 4623, 4624, 4625, 3040,
+  3374, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 3306, 4634, 4635, 4636, 4637, 3417, 4638,
+  4639, 4640, 4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649, 4650, 3110, 4651, 4652, 4653,
+  4654, 4655, 4656, 4657, 4658, 4659, 4660, 4661, 3307, 3197, 4662, 4663, 4664, 4665, 4666, 4667,
+  4668, 4669, 3378, 4670, 4671, 4672, 4673, 4674, 4675, 4676, 4677, 3379, 4678, 4679, 4680, 4681,
+  4682, 4683, 4684, 4685, 4686, 4687, 4688, 4689, 3381, 4690, 4691, 4692, 4693, 4694, 4695, 4696,
+  4697, 4698, 4699, 4700, 4700, 4701, 4702, 3383, 4703, 4704, 4705, 4706, 4707, 4708, 4709, 3096,
+  4710, 4711, 4712, 4713, 4714, 4715, 4716, 3389, 4717, 4718, 4719, 4720, 4721, 4722, 4722, 3390,
+  3419, 4723, 4724, 4725, 4726, 4727, 3058, 3392, 4728, 4729, 3318, 4730, 4731, 3272, 4732, 4733,
+  3322, 4734, 4735, 4736, 4737, 4737, 4738, 4739, 4740, 4741, 4742, 4743, 4744, 4745, 4746, 4747,
+  4748, 4749, 4750, 4751, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760, 4761, 4762, 4763,
+  4764, 3328, 4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777, 4778,
+  4779, 4780, 4566, 4781, 4782, 4783, 4784, 4785, 4786, 4787, 4788, 4789, 4790, 4791, 4792, 3114,
+  4793, 4794, 4795, 4796, 4797, 4798, 3331, 4799, 4800, 4801, 4802, 4803, 4804, 4805, 4806, 4807,
+  4808, 4809, 4810, 4811, 4812, 4813, 4814, 4815, 4816, 4817, 4818, 3053, 4819, 4820, 4821, 4822,
+  4823, 4824, 3399, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837,
+  4838, 4839, 4840, 4841, 4842, 4843, 4844, 3404, 3405, 4845, 4846, 4847, 4848, 4849, 4850, 4851,
+  4852, 4853, 4854, 4855, 4856, 4857, 3406, 4858, 4859, 4860, 4861, 4862, 4863, 4864, 4865, 4866,
+  4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4879, 4880, 4881, 4882,
+  4883, 4884, 4885, 4886, 4887, 3412, 3412, 4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895, 4896,
+  4897, 3413, 4898, 4899, 4900, 4901, 4902, 4903, 4904, 4905, 4906, 4907, 4908, 4909, 4910, 4911,
+  4912, 4913, 4914, 4915, 4916, 0, 0
+};
+inline constexpr std::uint16_t props_bmp_index[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 32, 48,
+  64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 256, 272, 288, 304, 320, 336, 352, 368,
+  288, 384, 400, 416, 432, 448, 464, 480, 496, 512, 400, 416, 528, 544, 560, 576, 592, 608, 624,
+  416, 640, 656, 672, 480, 688, 704, 400, 416, 720, 736, 752, 480, 768, 784, 800, 816, 832, 848,
+  864, 576, 880, 896, 912, 416, 928, 944, 960, 480, 976, 992, 912, 416, 1008, 1024, 1040, 480, 1056,
+  1072, 912, 288, 1088, 1104, 1120, 480, 288, 1136, 1152, 288, 1168, 1184, 1200, 576, 1216, 1232,
+  288, 288, 1248, 1264, 1280, 0, 0, 1296, 288, 1312, 1328, 1344, 1360, 0, 0, 1376, 1392, 288, 1408,
+  1424, 1440, 1456, 1472, 1488, 1504, 1520, 1536, 1552, 1568, 0, 0, 288, 288, 1584, 1600, 288, 1616,
+  1632, 1648, 1664, 1680, 1696, 1712, 1728, 288, 288, 1744, 288, 288, 288, 288, 288, 1760, 1776,
+  1792, 288, 288, 1808, 1824, 1840, 288, 288, 288, 288, 288, 288, 288, 1856, 1872, 288, 288, 1856,
+  288, 288, 1888, 1904, 1920, 288, 288, 288, 1904, 288, 288, 288, 1936, 288, 1952, 288, 1968, 288,
+  288, 288, 288, 288, 1984, 2000, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 1232, 2016, 288, 288, 288, 288, 288, 2032, 288, 2048, 288,
+  2064, 288, 2080, 2096, 2112, 288, 288, 288, 2128, 2144, 2160, 2176, 1968, 2192, 2176, 2208, 2208,
+  2208, 2208, 2208, 2224, 2240, 2208, 2256, 288, 288, 288, 288, 2272, 288, 2288, 2304, 2320, 2336,
+  288, 2352, 2368, 288, 288, 1280, 288, 2176, 2384, 2400, 2400, 288, 2416, 288, 288, 288, 2432,
+  2448, 2464, 2176, 2176, 2352, 2480, 2496, 2512, 2528, 0, 2544, 2560, 288, 2576, 2592, 288, 2608,
+  2624, 2640, 288, 2656, 288, 288, 288, 2672, 2688, 288, 288, 2704, 2720, 2736, 288, 288, 288, 2752,
+  2768, 2784, 2800, 768, 2816, 2832, 2848, 288, 288, 2864, 2880, 2896, 2912, 2928, 2944, 288, 2960,
+  2976, 2992, 3008, 3024, 3040, 3056, 3072, 3088, 3104, 3120, 3136, 3152, 3168, 3184, 3200, 3216,
+  3232, 3248, 3264, 3280, 3296, 3312, 3328, 3344, 3360, 3376, 3392, 3408, 3424, 3440, 3456, 3472,
+  3488, 3504, 3520, 3536, 3552, 3568, 3584, 3600, 3616, 3632, 3648, 3664, 3680, 3696, 3712, 3728,
+  3744, 2400, 3760, 3776, 3792, 3808, 3824, 3840, 3856, 3872, 3888, 3904, 3920, 3920, 3936, 3952,
+  3968, 2400, 3984, 4000, 2400, 2400, 4016, 2400, 4032, 4048, 4064, 2400, 4080, 4096, 4112, 4128,
+  4144, 4160, 2400, 2400, 4176, 2400, 2400, 2400, 4192, 4208, 288, 288, 288, 4224, 2400, 4240, 2400,
+  2400, 2400, 2400, 2400, 2400, 2400, 2400, 1968, 0, 4256, 0, 4272, 4288, 4304, 4320, 4336, 4352,
+  4368, 4384, 4400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
+  2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 4416, 2400,
+  2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
+  2400, 2400, 2400, 2400, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
+  2400, 4432, 2400, 2400, 2400, 2400, 2400, 2400, 4448, 2400, 2400, 2400, 2400, 2400, 4464, 2400,
+  2400, 2400, 2400, 2400, 2400, 2400, 2400, 2400, 4480, 2400, 2400, 2400, 2400, 2400, 2400, 2400,
+  2400, 4496, 4512, 4528, 288, 288, 288, 4544, 4560, 4576, 4592, 4608, 4624, 4640, 4656, 4672, 4688,
+  288, 288, 4704, 288, 288, 288, 4720, 4736, 288, 4752, 4768, 4768, 4768, 4768, 3040, 3040, 2400,
+  2400, 2400, 2400, 2400, 4784, 0, 0, 2400, 4800, 2400, 2400, 2400, 2400, 2400, 4816, 4832, 4848,
+  4864, 4880, 4896, 4912, 4928, 4944, 4960, 4976, 4992, 5008, 5024, 5040, 0, 0, 5056, 2400, 5072,
+  5088, 5104, 5120, 5136, 5152, 288, 5168, 5184, 5200, 5216, 5232, 5248, 5264, 5280, 288, 288, 5296,
+  5312, 5328, 5344, 5360, 5376, 5392, 288, 288, 2400, 2400, 5408, 288, 5424, 5440, 5456, 5472, 5488,
+  5504, 5520, 5536, 5552, 5568, 5584, 5600, 5616, 5632, 5648, 5664, 5680, 5696, 5712, 5728, 5744,
+  5760, 5776, 5792, 5808, 5824, 5840, 5856, 5872, 5888, 5904, 5920, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 2400, 2400, 2400, 2400, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 1952, 2400, 2400, 2400, 5936, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 5952, 288, 1280, 0, 5968,
+  5984, 6000, 6016, 6032, 6048, 288, 288, 288, 288, 288, 6064, 2400, 2400, 6080, 6096, 6112, 6128,
+  6144, 6160, 6176, 6192, 6208, 6224, 6240, 6256, 0, 6272, 6288, 288, 6304, 6320, 2208, 2208, 2208,
+  6336, 6352, 288, 288, 6368, 6384, 2176, 3040, 6400, 288, 288, 6416, 288, 6432, 6448, 288, 1952,
+  272, 288, 288, 6464, 6480, 6496, 6512, 2288, 288, 288, 6528, 6544, 6560, 6576, 288, 6592, 288,
+  288, 288, 6608, 6624, 6640, 6656, 6672, 6688, 6704, 4768, 288, 288, 6720, 6736, 6752, 6768, 6784,
+  6800, 6816, 288, 288, 6832, 2176, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+  288, 6848, 288, 6864, 288, 288, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6880, 6896, 6912, 6928, 6944, 6960, 6976, 6992, 7008, 7024,
+  7040, 7056, 7072, 7088, 7104, 7120, 7136, 7152, 7168, 7184, 7200, 7216, 7232, 7248, 7264, 7280,
+  7296, 7312, 7328, 7344, 0, 0, 7360, 7376, 7392, 7408, 7424, 7440, 7456, 7472, 7488, 7504, 7520,
+  7536, 7552, 7568, 7584, 7600, 7616, 7632, 7648, 7664, 7680, 7696, 7712, 7728, 7744, 7760, 7776,
+  7792, 7808, 7824, 7840, 7856, 7872, 7888, 7904, 7920, 2400, 7936, 7952, 7968, 7984, 8000, 8016,
+  8032, 8048, 0, 0, 8064, 8080, 8096, 8112, 8128, 8144, 8160, 8176, 8192, 8208, 8224, 8240, 8256,
+  8272, 8288, 8304, 8320, 8336, 8352, 8368, 8384, 8400, 8416, 8432, 8448, 8464, 8480, 8496, 8512,
+  8528, 8544, 8560, 0
+};
+inline constexpr std::uint16_t props_supp_index1[] = {
+  0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 192, 208, 224, 240, 256, 272, 288, 304,
+  320, 336, 352, 368, 384, 400, 416, 432, 448, 464, 480, 496, 512, 528, 544, 560, 576, 592, 608,
+  624, 640, 64, 656, 672, 688, 704, 64, 720, 736, 752, 768, 784, 800, 816, 832, 848, 864, 880, 896,
+  64, 912, 928, 944, 192, 192, 192, 192, 192, 192, 192, 960, 976, 192, 992, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 1008, 192, 192, 192, 192, 192, 192, 192,
+  192, 1024, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 16, 192, 192, 192, 192, 1040, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 1056, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 192, 192, 192, 192,
+  1072, 1088, 1104, 1120, 64, 64, 1136, 64, 1152, 1168, 1184, 1200, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 1216, 1232, 1248, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 1264, 192, 192, 1280, 192, 192, 1296,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 1312, 1328, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 1344, 1360, 1344, 1344, 1344, 1376, 1392, 992, 192, 1408, 1424, 1440, 1456, 1472,
+  1488, 64, 1504, 1520, 1536, 1552, 1568, 1584, 1600, 1616, 192, 192, 192, 192, 1632, 1648, 64, 64,
+  64, 64, 64, 64, 64, 64, 1664, 64, 1680, 1696, 1712, 64, 64, 1728, 64, 64, 64, 1744, 64, 1760, 64,
+  1776, 64, 1792, 1808, 1824, 1840, 64, 64, 64, 64, 64, 1856, 1872, 1888, 64, 1904, 1920, 64, 64,
+  1936, 1952, 1968, 1984, 2000, 64, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 2016, 1344, 2032,
+  2048, 2064, 1344, 1344, 2080, 2096, 1344, 2112, 64, 64, 64, 64, 64, 64, 64, 64, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 2128, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 2144, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 2160, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 2176, 192, 192, 192, 192, 2192, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 2208, 2224, 2240, 2256,
+  2272, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 2288, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  2304
+};
+inline constexpr std::uint16_t props_supp_index2[] = {
+  8576, 8584, 8576, 8576, 8592, 8576, 8576, 8600, 8576, 8608, 8576, 8608, 8616, 8616, 8616, 8616,
+  8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8624,
+  8632, 8576, 8576, 8576, 8576, 8576, 8640, 8576, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648,
+  8648, 8656, 8648, 8664, 8672, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576, 8576, 8576, 8680,
+  8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8576, 8576, 8576, 8688, 8576, 8576, 8576, 8576, 8576, 8576, 8696, 8616, 8704, 8712, 8712, 8720,
+  8576, 8576, 8576, 8576, 8728, 8736, 8576, 8576, 8576, 8624, 8576, 8576, 8576, 8576, 8744, 8752,
+  8576, 8576, 8576, 8760, 8576, 8576, 8576, 8576, 8728, 8576, 8608, 8616, 8616, 8616, 8616, 8616,
+  8768, 8776, 8784, 8792, 8800, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8608, 8576, 8808, 8816, 8824, 8832, 8840, 8848, 8576, 8576, 8576, 8576, 8728,
+  8576, 8576, 8576, 8576, 8576, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 8728, 8856, 8864, 8872,
+  8880, 8888, 8896, 8576, 8904, 8576, 8904, 8912, 8576, 8920, 8928, 8936, 8944, 8576, 8728, 8616,
+  8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8576, 8576, 8592, 8616, 8576, 8576, 8608, 8616, 8576, 8616, 8616, 8616,
+  8952, 8960, 8968, 8976, 8984, 8992, 9000, 9008, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  9016, 9024, 9032, 9032, 9032, 9032, 9040, 9048, 9032, 9032, 9040, 9032, 9032, 9032, 9032, 9032,
+  9032, 9032, 9032, 9056, 9064, 9032, 8616, 8616, 8616, 8616, 8616, 8616, 9032, 9032, 9072, 9080,
+  9032, 9032, 9032, 9088, 9032, 9032, 9032, 9096, 9032, 9032, 9032, 9104, 8616, 8616, 8616, 8616,
+  9032, 9032, 9032, 9032, 9032, 9032, 9032, 9112, 9032, 9032, 9120, 9032, 9032, 9032, 9032, 9032,
+  9128, 9136, 9144, 9152, 9032, 9032, 9016, 9160, 9032, 9168, 9032, 9168, 9032, 9032, 9032, 9032,
+  9032, 9032, 9032, 9032, 8616, 8616, 8616, 8616, 9176, 9184, 9192, 9200, 9208, 9216, 9056, 8616,
+  9032, 9032, 9032, 9032, 9032, 9032, 9016, 9224, 9032, 9032, 9016, 9032, 9032, 9032, 9232, 9032,
+  9240, 9248, 9256, 9264, 8616, 9272, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 9168, 8616, 8616, 8616, 8616, 8616, 8616,
+  9280, 9288, 9296, 9304, 9312, 9320, 9328, 8616, 9032, 9032, 9032, 9032, 9032, 9032, 9232, 9120,
+  9336, 9344, 9344, 9344, 9352, 8616, 9360, 9368, 9360, 9376, 9384, 9392, 9400, 9408, 9032, 9032,
+  9016, 9416, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 9360, 9360, 9360, 9424,
+  9032, 9032, 9032, 9032, 9032, 9432, 9104, 8616, 9440, 8616, 8648, 8672, 8616, 8616, 8616, 9448,
+  9032, 9032, 9032, 9032, 9032, 8616, 9456, 9344, 9464, 9472, 9480, 9104, 8616, 8616, 9488, 9344,
+  9496, 9104, 8616, 8616, 8616, 8616, 9504, 9512, 9520, 9528, 8616, 8616, 9032, 9032, 9056, 8616,
+  9536, 8576, 8576, 8576, 8576, 8576, 8576, 9544, 9552, 8608, 9560, 8648, 9568, 8576, 9576, 9584,
+  9592, 8576, 8576, 9600, 9608, 9616, 9624, 9632, 9640, 8616, 8576, 8576, 8576, 8696, 8576, 8808,
+  9648, 8576, 8576, 8576, 9656, 9664, 9672, 8576, 9680, 8616, 8576, 8576, 8576, 8576, 9688, 8616,
+  9592, 8576, 8576, 8576, 8576, 8576, 9696, 9704, 9712, 9720, 8576, 8576, 9728, 8576, 8688, 8616,
+  8576, 8576, 8904, 8576, 8576, 9736, 9744, 9752, 9760, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8592, 9768, 8576, 8760, 8576, 8808, 8576, 8576, 8576, 8576, 8576, 9776, 9784, 9792, 8576, 8808,
+  9800, 9808, 9816, 8576, 8576, 9824, 9832, 9840, 9848, 9856, 9864, 8736, 9872, 9880, 9880, 8616,
+  9888, 9896, 9904, 8576, 8576, 8576, 8760, 9912, 9920, 9928, 9936, 8696, 9944, 8616, 8616, 8616,
+  8576, 8576, 8576, 8576, 8576, 8576, 9952, 9544, 9960, 8576, 8576, 9968, 8808, 8616, 8616, 8616,
+  8576, 8576, 8576, 8576, 8576, 8576, 9976, 9984, 9992, 8616, 8576, 8808, 8616, 8616, 8616, 8616,
+  8576, 8576, 8576, 8576, 8576, 10000, 10008, 10016, 10024, 8576, 8576, 10032, 8616, 8616, 8616,
+  8616, 8576, 8576, 8576, 8576, 8576, 8576, 9784, 10040, 10048, 8616, 8576, 8808, 8648, 8664, 8616,
+  8616, 8576, 8576, 8576, 8576, 8576, 10056, 10064, 8808, 8576, 8808, 8576, 8576, 8728, 8616, 8616,
+  8616, 8576, 8576, 8576, 10072, 10080, 10088, 8576, 8576, 8592, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8576, 8576, 8576, 8576, 8576, 9736, 9544, 10096, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 10104, 10112, 10120, 10128, 8576, 8576, 8576, 8576, 8576, 8576,
+  8624, 8856, 8592, 10136, 10144, 8576, 8576, 8576, 10152, 10160, 10168, 8616, 8576, 8808, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 8616, 8576, 10176, 8576, 8576, 8576, 8576, 10184, 10192,
+  10200, 8616, 8616, 8616, 10208, 10216, 8576, 8576, 8576, 8576, 10224, 10232, 10240, 8616, 10248,
+  10256, 8576, 8576, 8576, 8576, 8576, 10264, 9704, 10272, 8624, 8616, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8696, 8576, 8808, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 10280, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576,
+  8576, 8808, 8616, 8576, 8808, 8576, 9824, 8576, 8576, 8576, 10288, 10296, 10304, 8608, 8616, 8576,
+  8576, 8576, 8688, 8576, 8576, 8576, 8576, 10312, 9544, 9544, 10320, 10328, 8616, 8616, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 8592, 8904, 8576, 8576, 8576, 8576, 10336, 10344, 10352, 8616, 8576,
+  8808, 8760, 9824, 8576, 8576, 8576, 10360, 10368, 8696, 8576, 8808, 8576, 8576, 8576, 8576, 8576,
+  8728, 8576, 8808, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8576, 8576, 10376, 8696, 10384, 8576, 9824, 8576, 8576, 8576, 10392, 10400, 10408, 8576,
+  8576, 9640, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8696, 8616, 8576, 8576,
+  10416, 8648, 8648, 8648, 10424, 8856, 8576, 8576, 8576, 8808, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8592, 8688, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8728, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8624, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 8616, 8616, 10432, 9544,
+  10440, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8592, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576, 10448, 10456, 10464, 8576, 8808, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8696, 8576, 8576,
+  8576, 8592, 8576, 10472, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8592, 8576, 8808,
+  8576, 8576, 8576, 8608, 10480, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 10488, 8576, 8608, 8616,
+  8576, 8904, 8904, 8576, 8576, 8736, 8576, 8576, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8576, 8576,
+  8576, 8576, 10496, 10504, 8576, 8808, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 10512,
+  10520, 10528, 10536, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8624, 10544, 10552, 10560, 10568,
+  8576, 8576, 8728, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 10576, 10584, 10592, 10592, 10592, 10592, 10592, 10592, 10600, 10608, 8576, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 10616, 8616, 10624, 8616, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8608, 8616, 8616, 8616, 8616, 8856, 8576, 8576, 8576, 8592, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8624, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8584, 10144, 8576, 8576, 8576, 8576, 8624, 8616,
+  10632, 8616, 8616, 8616, 10640, 8616, 10648, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8728, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8576, 8576, 8576, 8624, 8576, 8688, 8576, 8696, 8576, 10656, 10664, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8648, 8648, 8648, 8648, 8648, 8648,
+  8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648,
+  8648, 8648, 8648, 8648, 10672, 10680, 10688, 10696, 10704, 10712, 8648, 8648, 8648, 8648, 8648,
+  8648, 10720, 9560, 8648, 8648, 8672, 8616, 8648, 8648, 8672, 8616, 9544, 9544, 9544, 9544, 9544,
+  10440, 9544, 9544, 10296, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8608, 8616, 8576, 8576, 8576, 8576, 8592,
+  9728, 8576, 8576, 8576, 8576, 8576, 10728, 10736, 10744, 10752, 10760, 10768, 10776, 8576, 8576,
+  8576, 10784, 8576, 10792, 10800, 8576, 8576, 8576, 8576, 10808, 8616, 8616, 8648, 8648, 8648,
+  8648, 8648, 8648, 8648, 8648, 10816, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 8576, 8576, 8728, 8616, 8576, 8576, 8728, 8616, 8648, 8648, 8648,
+  8648, 8648, 8648, 8648, 8648, 8648, 8648, 10824, 8616, 8576, 8576, 8576, 8696, 10832, 10840,
+  10848, 10856, 10864, 10872, 10880, 10888, 10896, 10904, 10912, 10688, 10696, 10832, 10840, 10848,
+  10856, 10864, 10872, 10920, 10928, 10936, 10904, 10944, 10952, 10696, 10832, 10840, 10848, 10856,
+  10864, 10872, 10960, 10968, 10976, 10984, 10680, 10688, 10696, 10992, 11000, 11008, 11016, 10864,
+  10872, 10880, 10888, 10896, 10904, 10680, 10688, 10696, 10832, 10840, 10848, 10856, 10864, 10872,
+  10880, 10888, 10896, 10904, 10680, 10688, 10696, 10832, 10840, 10848, 10856, 10864, 10872, 10880,
+  10888, 10896, 10904, 10680, 10688, 10696, 10832, 10840, 10848, 10856, 10864, 10872, 11024, 11032,
+  11040, 11048, 11056, 11064, 11072, 11080, 11088, 11064, 11096, 11104, 11112, 11120, 11128, 11136,
+  11112, 11144, 11152, 11160, 11168, 11176, 11184, 11160, 11192, 11200, 11032, 11040, 11208, 11216,
+  11032, 11040, 11048, 11056, 11064, 11072, 11080, 11224, 11232, 10704, 11240, 11248, 11256, 11232,
+  9544, 9544, 9544, 9544, 9544, 9544, 11264, 11272, 9544, 9544, 9544, 9544, 9544, 11280, 11288,
+  8576, 11296, 8728, 8616, 11304, 11312, 9544, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8576, 8576, 8576, 8592, 8736, 8624, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 11320, 11328, 11328, 11336, 11344, 8752, 11352, 11360, 11368, 11376, 11384, 11392, 11400,
+  11408, 8616, 8616, 8616, 11416, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8616, 8616, 8576, 8576, 8576, 8576, 8576, 8688, 10488, 8608, 8576, 10472, 8616, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576, 11424, 8616, 8616, 8576, 8576, 8576, 8576, 8576,
+  11432, 8576, 11440, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576,
+  11448, 8576, 8808, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576,
+  11456, 8576, 11464, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576, 8592, 11472,
+  8744, 11480, 11488, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8592,
+  10144, 8576, 8592, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032,
+  9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 11496, 9032, 11504, 8616, 8616,
+  8616, 8616, 8616, 11512, 11520, 11528, 11536, 11544, 9344, 9344, 9344, 11552, 11560, 9032, 11568,
+  8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8616, 9152, 9032, 9032, 9032, 9032, 9032, 9032, 9032, 11576, 8616, 8616, 8616, 8616, 8616,
+  8616, 8616, 8616, 8616, 9152, 9032, 9032, 9032, 9032, 9032, 9032, 9016, 8616, 8616, 8616, 8616,
+  8616, 8616, 8616, 8616, 11584, 11592, 11600, 11608, 11616, 11624, 11632, 11640, 11648, 11656,
+  11664, 11672, 11616, 11680, 11632, 11688, 11696, 11704, 11600, 11712, 11720, 11704, 11600, 11712,
+  8616, 8616, 8616, 8616, 8616, 8616, 10424, 8616, 8648, 8648, 8648, 8648, 8648, 10720, 8648, 8648,
+  8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 10720, 8616, 8648, 10824, 9224, 8648,
+  9224, 8648, 9224, 8648, 8648, 8648, 11728, 8616, 11736, 11744, 11752, 11760, 11768, 11776, 10832,
+  10840, 10848, 11784, 8576, 8576, 8576, 11792, 8576, 8576, 8576, 8576, 11800, 8576, 8576, 11808,
+  8616, 8616, 8616, 8616, 8616, 8616, 11488, 8576, 8576, 8576, 11816, 8616, 11824, 11832, 11840,
+  11848, 11856, 11864, 11872, 11880, 11888, 8616, 11728, 8616, 8616, 8616, 8648, 8648, 8648, 8648,
+  8648, 8648, 8648, 8648, 8648, 8648, 8648, 11896, 8648, 8664, 8648, 8664, 8648, 8648, 8648, 8648,
+  8648, 8648, 8648, 8648, 8648, 8648, 8648, 10424, 8648, 10720, 8672, 8616, 8648, 10720, 8648, 8648,
+  8648, 8648, 8648, 8648, 8648, 8616, 8648, 10424, 8648, 8648, 8648, 8648, 8648, 8616, 8648, 8648,
+  8648, 11728, 8648, 10720, 10424, 8616, 8648, 8672, 8616, 8616, 8616, 8616, 8648, 8648, 8648, 8648,
+  8648, 8648, 8648, 8648, 8648, 8648, 8648, 8616, 8648, 11728, 8648, 8664, 8648, 11904, 8648, 8648,
+  8648, 8648, 8648, 8648, 10824, 11912, 8648, 11920, 8648, 11928, 8648, 8672, 8648, 8648, 11936,
+  8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 8648, 10704, 11944, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8616, 8616, 8616, 8616, 8576, 8576, 8576,
+  8608, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8608, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8696, 8616, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8608, 8616, 8616, 8616, 8616, 11952, 11960, 11968,
+  11976, 11984, 11992, 12000, 12008, 12016, 12024, 12032, 12040, 12048, 12056, 12064, 12072, 12080,
+  12088, 12096, 12104, 12112, 12120, 12128, 12136, 12144, 12152, 12160, 12168, 12176, 12184, 12192,
+  12200, 12208, 12216, 12224, 12232, 12240, 12248, 12256, 12264, 12272, 12280, 12288, 12296, 12304,
+  12312, 12320, 12328, 12336, 12344, 12352, 12360, 12368, 12376, 12384, 12392, 12400, 12408, 12416,
+  12424, 12432, 12440, 12448, 12456, 12464, 12472, 12480, 12488, 8616, 8616, 8616, 8616, 8616, 8616,
+  8616, 8616, 8616, 8616, 8616, 8616, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8624,
+  8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576, 8576,
+  8576, 8576, 8576, 8576, 8576, 8808
+};
+#endif // UPA_IDNA_SMALL_TABLES
+// END-GENERATED
+
+
+// Returns the index of the code point properties in props_data and props_mapping
+constexpr std::uint16_t get_props_index(std::uint32_t cp) {
+    // Direct table of the most frequent non-ASCII code points
+    if (cp < props_hot_end)
+        return props_hot[cp];
+    if (cp >= props_default_start) {
+        if (cp >= props_spec_range1 && cp <= props_spec_range2)
+            return props_spec_index;
+        return props_default_index;
+    }
+#ifndef UPA_IDNA_SMALL_TABLES
+    return props_block[
+        (props_block_index[cp >> props_block_shift] << props_block_shift) |
+        (cp & props_block_mask)
+    ];
+#else
+    // The three-level table: the BMP code points have one index level, and
+    // the supplementary ones two
+    if (cp < 0x10000) {
+        return props_block[
+            props_bmp_index[cp >> props_bmp_shift] + (cp & props_bmp_mask)
+        ];
+    }
+    const std::uint32_t scp = cp - 0x10000;
+    const std::uint32_t ind2 = props_supp_index1[scp >> props_supp_index1_shift] +
+        ((scp >> props_supp_block_shift) & props_supp_index2_mask);
+    return props_block[
+        props_supp_index2[ind2] + (scp & props_supp_block_mask)
+    ];
+#endif
+}
+
+constexpr const char_props& get_char_props(std::uint32_t cp) {
+    return props_data[get_props_index(cp)];
+}
+
+} // namespace upa::idna::props
+
+#endif // #ifndef UPA_IDNA_PROPS_TABLE_H
@@ -0,0 +1,503 @@
+// Copyright 2017-2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_PUNYCODE_IMPL_H
+#define UPA_IDNA_PUNYCODE_IMPL_H
+
+#include "../punycode.h"
+
+#ifndef UPA_MODULE
+# include <algorithm>
+# include <cstddef>
+# include <cstdint>
+# include <string>
+# include <type_traits>
+# include <vector>
+#endif // UPA_MODULE
+
+#include "stats.h"
+
+// The Punycode encoder and decoder; they are defined in the header, so they
+// can be evaluated at compile time in C++20 (see upa/idna/static.h)
+
+namespace upa::idna::punycode::detail {
+
+// punycode_uint needs to be unsigned and needs to be
+// at least 26 bits wide.
+
+using punycode_uint = std::uint32_t;
+
+// Bootstring parameters for Punycode
+
+constexpr punycode_uint base = 36;
+constexpr punycode_uint tmin = 1;
+constexpr punycode_uint tmax = 26;
+constexpr punycode_uint skew = 38;
+constexpr punycode_uint damp = 700;
+constexpr punycode_uint initial_bias = 72;
+constexpr punycode_uint initial_n = 0x80;
+constexpr char delimiter = 0x2D;
+
+// basic(cp) tests whether cp is a basic code point:
+template <class T>
+constexpr bool basic(T cp) noexcept {
+    return static_cast<std::make_unsigned_t<T>>(cp) < 0x80;
+}
+
+// decode_digit(cp) returns the numeric value of a basic code
+// point (for use in representing integers) in the range 0 to
+// base-1, or base if cp does not represent a value.
+
+constexpr punycode_uint decode_digit(punycode_uint cp) noexcept {
+    return cp - 48 < 10 ? cp - 22 : cp - 65 < 26 ? cp - 65 :
+        cp - 97 < 26 ? cp - 97 : base;
+}
+
+// encode_digit(d) returns the basic code point whose value
+// (when used for representing integers) is d, which needs to be in
+// the range 0 to base-1. The lowercase form is used.
+
+constexpr char encode_digit(punycode_uint d) noexcept {
+    return static_cast<char>(d + 22 + 75 * (d < 26));
+    /*  0..25 map to ASCII a..z */
+    /* 26..35 map to ASCII 0..9 */
+}
+
+// Platform-specific constants
+
+// maxint is the maximum value of a punycode_uint variable:
+constexpr punycode_uint maxint = -1;
+constexpr std::size_t kMaxCodePoints = maxint;
+
+// for encoder and decoder
+
+// Labels up to this length are processed without memory allocation
+constexpr std::size_t kStackCodePoints = 128;
+
+// The decoder inserts code points one by one into output up to this length
+// (bounds the cost of insertion to kInsertCodePoints moves per code point)
+constexpr punycode_uint kInsertCodePoints = 1024;
+
+// Counts the marked positions before any position
+struct fenwick_tree {
+    punycode_uint* tree; // size + 1 elements
+    punycode_uint size;
+
+    // marks all positions
+    constexpr void fill() const noexcept {
+        for (punycode_uint pos = 1; pos <= size; ++pos)
+            tree[pos] = pos & (0 - pos);
+    }
+    constexpr void add(punycode_uint pos) const noexcept {
+        for (++pos; pos <= size; pos += pos & (0 - pos))
+            ++tree[pos];
+    }
+    constexpr punycode_uint count(punycode_uint pos) const noexcept {
+        punycode_uint sum = 0;
+        for (; pos > 0; pos -= pos & (0 - pos))
+            sum += tree[pos];
+        return sum;
+    }
+    // returns the position of the marked position with index `ind` (0-based);
+    // there must be more than `ind` marked positions and `size` must be
+    // a power of two
+    constexpr punycode_uint find(punycode_uint ind) const noexcept {
+        punycode_uint pos = 0;
+        for (punycode_uint step = size; step != 0; step >>= 1) {
+            const punycode_uint value = tree[pos + step];
+            if (value <= ind) {
+                pos += step;
+                ind -= value;
+            }
+        }
+        return pos;
+    }
+    // same as find, but also unmarks the found position
+    constexpr punycode_uint extract(punycode_uint ind) const noexcept {
+        punycode_uint pos = 0;
+        for (punycode_uint step = size; step != 0; step >>= 1) {
+            // the nodes not stepped over contain the found position;
+            // branchless, as the steps are unpredictable: take is all ones or zero
+            punycode_uint& value = tree[pos + step];
+            const punycode_uint take = 0 - static_cast<punycode_uint>(value <= ind);
+            ind -= value & take;
+            value -= 1 + take;
+            pos += step & take;
+        }
+        return pos;
+    }
+};
+
+// Bias adaptation function
+
+constexpr punycode_uint adapt(punycode_uint delta, punycode_uint numpoints, bool firsttime)
+{
+    delta = firsttime ? delta / damp : delta >> 1; // delta >> 1 is a faster way of doing delta / 2
+    delta += delta / numpoints;
+
+    punycode_uint k = 0;
+    while (delta > ((base - tmin) * tmax) / 2) {
+        delta /= base - tmin;
+        k += base;
+    }
+
+    return k + (base - tmin + 1) * delta / (delta + skew);
+}
+
+// for decoder
+
+template <typename CharT>
+constexpr const CharT* find_delim(const CharT* first, const CharT* last) {
+    for (auto it = last; it != first;) {
+        if (*--it == delimiter) return it;
+    }
+    return nullptr;
+}
+
+// Encoder output
+
+// Appends to std::string
+class string_output {
+public:
+    constexpr explicit string_output(std::string& str) noexcept : str_(str) {}
+
+    UPA_IDNA_CONSTEXPR_20 bool reserve(std::size_t count) {
+        str_.reserve(str_.length() + count);
+        return true;
+    }
+    UPA_IDNA_CONSTEXPR_20 bool push_back(char c) {
+        str_.push_back(c);
+        return true;
+    }
+private:
+    std::string& str_;
+};
+
+// Writes to fixed capacity buffer; push_back returns false if it is full
+class span_output {
+public:
+    constexpr span_output(char* first, std::size_t capacity) noexcept
+        : first_(first), it_(first), end_(first + capacity) {}
+
+    constexpr bool reserve(std::size_t count) const noexcept {
+        return count <= static_cast<std::size_t>(end_ - it_);
+    }
+    constexpr bool push_back(char c) noexcept {
+        if (it_ == end_) return false;
+        *it_++ = c;
+        return true;
+    }
+    constexpr std::size_t length() const noexcept { return it_ - first_; }
+private:
+    char* first_;
+    char* it_;
+    char* end_;
+};
+
+// Main encode function
+
+template <class Output>
+UPA_IDNA_CONSTEXPR_20 status encode_to(Output& output, const char32_t* first, const char32_t* last) {
+    UPA_IDNA_STATS_SCOPE(punycode_encode, (last - first) * sizeof(char32_t));
+
+    // The Punycode spec assumes that the input length is the same type
+    // of integer as a code point, so we need to convert the size_t to
+    // a punycode_uint, which could overflow.
+
+    if (last - first > kMaxCodePoints)
+        return status::overflow;
+
+    const auto input_length = static_cast<punycode_uint>(last - first);
+
+    // Each code point is encoded to at least one character
+    if (!output.reserve(input_length))
+        return status::big_output;
+
+    // Handle the basic code points:
+
+    punycode_uint b = 0; // the number of basic code points
+    for (auto it = first; it != last; ++it) {
+        const auto ch = *it;
+        if (basic(ch)) {
+            if (!output.push_back(static_cast<char>(ch)))
+                return status::big_output;
+            ++b;
+        } else if (ch > 0x10FFFF) {
+            // invalid codepoint
+            return status::bad_input;
+        }
+    }
+    if (b > 0 && !output.push_back(delimiter))
+        return status::big_output;
+
+    if (b == input_length)
+        return status::success;
+
+    // Sort the non-basic code points by (code point, position) once; then the
+    // code points are handled in this order. The number of already handled
+    // code points before any position is kept in the Fenwick tree.
+
+    std::uint64_t stack_keys[kStackCodePoints];
+    punycode_uint stack_tree[kStackCodePoints + 1];
+    std::vector<std::uint64_t> heap_keys;
+    std::vector<punycode_uint> heap_tree;
+    std::uint64_t* keys = stack_keys;
+    punycode_uint* tree = stack_tree;
+    if (input_length > kStackCodePoints) {
+        heap_keys.resize(input_length);
+        heap_tree.resize(input_length + 1);
+        keys = heap_keys.data();
+        tree = heap_tree.data();
+    }
+    const fenwick_tree handled{ tree, input_length };
+    std::fill_n(tree, input_length + 1, 0);
+
+    punycode_uint keys_count = 0;
+    for (punycode_uint pos = 0; pos < input_length; ++pos) {
+        const auto ch = first[pos];
+        if (basic(ch))
+            handled.add(pos);
+        else
+            keys[keys_count++] = (static_cast<std::uint64_t>(ch) << 32) | pos;
+    }
+    std::sort(keys, keys + keys_count);
+
+    // Initialize the state:
+
+    punycode_uint n = initial_n;
+    punycode_uint delta = 0;
+    punycode_uint bias = initial_bias;
+
+    // Main encoding loop:
+
+    // h is the number of code points that have been handled
+    punycode_uint h = b;
+    for (punycode_uint ind = 0; ind < keys_count;) {
+        // All non-basic code points < n have been
+        // handled already. The next larger one is:
+        const auto m = static_cast<punycode_uint>(keys[ind] >> 32);
+
+        // Increase delta enough to advance the decoder's
+        // <n,i> state to <m,0>, but guard against overflow:
+        if (m - n > (maxint - delta) / (h + 1))
+            return status::overflow;
+        delta += (m - n) * (h + 1);
+        n = m;
+
+        // Code points < n are counted in the delta; the handled ones before
+        // the first occurrence of n and between the occurrences:
+        const punycode_uint handled_count = h;
+        const punycode_uint group_begin = ind;
+        punycode_uint prev_count = 0;
+        for (; ind < keys_count && static_cast<punycode_uint>(keys[ind] >> 32) == n; ++ind) {
+            const auto count = handled.count(static_cast<punycode_uint>(keys[ind]));
+            if (count - prev_count > maxint - delta)
+                return status::overflow;
+            delta += count - prev_count;
+            prev_count = count;
+
+            // Represent delta as a generalized variable-length integer:
+            punycode_uint q = delta;
+            for (punycode_uint k = base; ; k += base) {
+                const punycode_uint t = k <= bias ? tmin :
+                    k >= bias + tmax ? tmax : k - bias;
+                if (q < t) break;
+                if (!output.push_back(encode_digit(t + (q - t) % (base - t))))
+                    return status::big_output;
+                q = (q - t) / (base - t);
+            }
+
+            if (!output.push_back(encode_digit(q)))
+                return status::big_output;
+            bias = adapt(delta, h + 1, h == b);
+            delta = 0;
+            ++h;
+        }
+        // handled code points after the last occurrence of n
+        if (handled_count - prev_count > maxint - delta)
+            return status::overflow;
+        delta += handled_count - prev_count;
+        for (punycode_uint i = group_begin; i < ind; ++i)
+            handled.add(static_cast<punycode_uint>(keys[i]));
+
+        if (++delta == 0)
+            return status::overflow;
+        ++n;
+    }
+    return status::success;
+}
+
+// Main decode function
+
+UPA_IDNA_CONSTEXPR_20 status decode_to(char32_t* output, std::size_t capacity, std::size_t& length,
+    const char32_t* first, const char32_t* last) {
+    UPA_IDNA_STATS_SCOPE(punycode_decode, (last - first) * sizeof(char32_t));
+    length = 0;
+
+    // Handle the basic code points:  Let b be the number of input code
+    // points before the last delimiter, or 0 if there is none, then
+    // copy the first b code points to the output.
+
+    auto bp = find_delim(first, last);
+    if (bp) {
+        // has delimiter, but hasn't basic code points
+        if (bp == first) return status::bad_input;
+        if (bp - first > kMaxCodePoints)
+            return status::big_output;
+    }
+    if (bp) {
+        // copy basic code points to output
+        for (auto it = first; it != bp; ++it) {
+            const auto ch = *it;
+            if (!basic(ch)) return status::bad_input;
+            if (length == capacity) return status::big_output;
+            output[length++] = ch;
+        }
+        // skip delimiter
+        first = bp + 1;
+    }
+
+    // Each decoded code point takes at least one input code point, so there
+    // are at most (last - first) of them. The (insert position, code point)
+    // pairs are collected first and placed into the output after decoding.
+
+    const std::size_t max_decoded = std::min<std::size_t>(last - first, capacity - length);
+    punycode_uint stack_inserts[kStackCodePoints * 2];
+    std::vector<punycode_uint> heap_inserts;
+    punycode_uint* inserts = stack_inserts; // pairs of insert position and code point
+    if (max_decoded > kStackCodePoints) {
+        heap_inserts.resize(max_decoded * 2);
+        inserts = heap_inserts.data();
+    }
+
+    // Initialize the state:
+
+    punycode_uint n = initial_n;
+    const auto b = static_cast<punycode_uint>(length); // basic code points count
+    auto out = b;
+    punycode_uint i = 0;
+    punycode_uint bias = initial_bias;
+
+    // Main decoding loop:
+
+    for (auto inp = first; inp != last; ++out) {
+        // in is the index of the next ASCII code point to be consumed,
+        // and out is the number of code points in the output array.
+
+        // Decode a generalized variable-length integer into delta,
+        // which gets added to i.  The overflow checking is easier
+        // if we increase i as we go, then subtract off its starting
+        // value at the end to obtain delta.
+
+        const punycode_uint oldi = i;
+        punycode_uint w = 1;
+        for (punycode_uint k = base; ; k += base) {
+            if (inp == last) return status::bad_input;
+            const punycode_uint digit = decode_digit(*inp++);
+            if (digit >= base) return status::bad_input;
+            if (digit > (maxint - i) / w) return status::overflow;
+            i += digit * w;
+            const punycode_uint t = k <= bias ? tmin :
+                k >= bias + tmax ? tmax : k - bias;
+            if (digit < t) break;
+            if (w > maxint / (base - t)) return status::overflow;
+            w *= (base - t);
+        }
+
+        bias = adapt(i - oldi, out + 1, oldi == 0);
+
+        // i was supposed to wrap around from out+1 to 0,
+        // incrementing n each time, so we'll fix that now:
+
+        if (i / (out + 1) > maxint - n) return status::overflow;
+        n += i / (out + 1);
+        i %= (out + 1);
+
+        // Record the insertion of n at position i of the output:
+
+        if (out >= kMaxCodePoints || out >= capacity)
+            return status::big_output;
+
+        inserts[(out - b) * 2] = i;
+        inserts[(out - b) * 2 + 1] = n;
+        ++i;
+    }
+
+    // Place the code points
+
+    const punycode_uint decoded_count = out - b;
+    if (decoded_count == 0)
+        return status::success;
+
+    length = out;
+    char32_t* const result = output;
+
+    if (out <= kInsertCodePoints) {
+        // Insert the code points one by one; for short output it is faster
+        // than the order statistics below
+        for (punycode_uint ind = 0; ind < decoded_count; ++ind) {
+            char32_t* const pos = result + inserts[ind * 2];
+            char32_t* const end = result + b + ind;
+            std::copy_backward(pos, end, end + 1);
+            *pos = inserts[ind * 2 + 1];
+        }
+        return status::success;
+    }
+
+    // The last inserted code point stays at its insert position; each earlier
+    // one takes the free position whose index is its insert position. The basic
+    // code points take the remaining free positions. Positions after the output
+    // end are never found, as they follow all the output positions.
+
+    if (out > maxint / 2)
+        return status::big_output;
+    punycode_uint tree_size = 1;
+    while (tree_size < out) tree_size <<= 1;
+    std::vector<punycode_uint> tree(static_cast<std::size_t>(tree_size) + 1);
+    const fenwick_tree free_pos{ tree.data(), tree_size };
+    free_pos.fill();
+    for (punycode_uint ind = decoded_count; ind-- > 0;)
+        inserts[ind * 2] = free_pos.extract(inserts[ind * 2]);
+
+    // The j-th basic code point moves to the position >= j, so moving
+    // them from the last one does not overwrite unmoved ones
+    for (punycode_uint j = b; j-- > 0;)
+        result[free_pos.find(j)] = result[j];
+    for (punycode_uint ind = 0; ind < decoded_count; ++ind)
+        result[inserts[ind * 2]] = inserts[ind * 2 + 1];
+    return status::success;
+}
+
+// Implementation of the functions declared in upa/idna/punycode.h
+
+UPA_IDNA_CONSTEXPR_20 status encode(std::string& output, const char32_t* first, const char32_t* last) {
+    string_output out(output);
+    return encode_to(out, first, last);
+}
+
+UPA_IDNA_CONSTEXPR_20 status encode(char* output, std::size_t& output_length, const char32_t* first, const char32_t* last) {
+    span_output out(output, output_length);
+    const status res = encode_to(out, first, last);
+    output_length = out.length();
+    return res;
+}
+
+UPA_IDNA_CONSTEXPR_20 status decode(std::u32string& output, const char32_t* first, const char32_t* last) {
+    // The decoded label is not longer than the input
+    const std::size_t len0 = output.length();
+    output.resize(len0 + (last - first));
+    std::size_t length = 0;
+    const status res = decode_to(output.data() + len0, last - first, length, first, last);
+    output.resize(len0 + length);
+    return res;
+}
+
+UPA_IDNA_CONSTEXPR_20 status decode(char32_t* output, std::size_t& output_length, const char32_t* first, const char32_t* last) {
+    const std::size_t capacity = output_length;
+    return decode_to(output, capacity, output_length, first, last);
+}
+
+} // namespace upa::idna::punycode::detail
+
+#endif // UPA_IDNA_PUNYCODE_IMPL_H
@@ -0,0 +1,92 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_DETAIL_STATS_H
+#define UPA_IDNA_DETAIL_STATS_H
+
+#include "../stats.h"
+
+#if defined(UPA_IDNA_STATS) && defined(UPA_IDNA_CPP_20) && !defined(UPA_MODULE)
+# include <type_traits> // std::is_constant_evaluated
+#endif
+
+// Instrumentation macros; they expand to nothing if UPA_IDNA_STATS is not defined
+//
+// UPA_IDNA_STATS_SCOPE(stage, bytes) - counts the call of the `stage` (a
+//   stats_stage enumerator name) and, if timing is enabled, measures the time
+//   until the end of the enclosing block, excluding nested scopes. Nothing is
+//   counted if the block is evaluated at compile time
+// UPA_IDNA_STATS_PAUSE() - the time until the end of the enclosing block is
+//   not attributed to any stage
+// UPA_IDNA_STATS_QUICK_CHECK(qc) - counts the NFC quick check result
+
+#ifdef UPA_IDNA_STATS
+
+namespace upa::idna::detail {
+
+// Value of the scope which is not attributed to any stage
+constexpr auto stats_no_stage = stats_stage::count;
+
+// Returns true if the instrumented code is evaluated at compile time
+constexpr bool stats_compile_time() noexcept {
+#ifdef UPA_IDNA_CPP_20
+    return std::is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+class stats_scope {
+public:
+    UPA_IDNA_CONSTEXPR_20 stats_scope(stats_stage stage, std::size_t bytes) noexcept
+        : stage_(stage)
+    {
+        if (!stats_compile_time())
+            start(bytes);
+    }
+    UPA_IDNA_CONSTEXPR_20 ~stats_scope() {
+        if (!stats_compile_time())
+            stop();
+    }
+
+    stats_scope(const stats_scope&) = delete;
+    stats_scope& operator=(const stats_scope&) = delete;
+private:
+    UPA_IDNA_API void start(std::size_t bytes) noexcept;
+    UPA_IDNA_API void stop() noexcept;
+
+    stats_scope* parent_ = nullptr;
+    std::uint64_t start_ = 0;
+    std::uint64_t elapsed_ = 0;
+    stats_stage stage_;
+    bool timed_ = false;
+};
+
+UPA_IDNA_API void stats_add_quick_check(stats_quick_check qc) noexcept;
+
+UPA_IDNA_CONSTEXPR_20 void stats_count_quick_check(stats_quick_check qc) noexcept {
+    if (!stats_compile_time())
+        stats_add_quick_check(qc);
+}
+
+} // namespace upa::idna::detail
+
+# define UPA_IDNA_STATS_SCOPE(stage, bytes) \
+    const upa::idna::detail::stats_scope upa_idna_stats_scope_( \
+        upa::idna::stats_stage::stage, (bytes))
+# define UPA_IDNA_STATS_PAUSE() \
+    const upa::idna::detail::stats_scope upa_idna_stats_scope_( \
+        upa::idna::detail::stats_no_stage, 0)
+# define UPA_IDNA_STATS_QUICK_CHECK(qc) \
+    upa::idna::detail::stats_count_quick_check(upa::idna::stats_quick_check::qc)
+
+#else
+
+# define UPA_IDNA_STATS_SCOPE(stage, bytes) static_cast<void>(0)
+# define UPA_IDNA_STATS_PAUSE() static_cast<void>(0)
+# define UPA_IDNA_STATS_QUICK_CHECK(qc) static_cast<void>(0)
+
+#endif // UPA_IDNA_STATS
+
+#endif // UPA_IDNA_DETAIL_STATS_H
@@ -10,7 +10,9 @@
 #include "idna_version.h" // IWYU pragma: export
 
 #ifndef UPA_MODULE
+# include <cstddef>
 # include <string>
+# include <vector>
 #endif // UPA_MODULE
 
 namespace upa::idna {
@@ -47,6 +49,58 @@ constexpr Option domain_options(bool be_strict, bool is_input_ascii) noexcept {
     return options;
 }
 
+/// @brief The rule that the domain fails
+///
+/// The enumerator comments name the corresponding steps of UTS #46.
+enum class error_code {
+    ok = 0,
+    disallowed,        ///< V7 (and U1 if UseSTD3ASCIIRules): the label contains a disallowed code point
+    not_nfc,           ///< V1: the decoded A-label is not in the Normalization Form C
+    hyphen_3_4,        ///< V2: the label contains "--" in the third and fourth positions
+    hyphen_start_end,  ///< V3: the label begins or ends with a hyphen
+    xn_prefix,         ///< V4: the decoded A-label begins with "xn--"
+    leading_mark,      ///< V6: the label begins with a combining mark
+    joiner,            ///< C1, C2: the CONTEXTJ rules of the ZWNJ or ZWJ are not satisfied
+    bidi,              ///< B1 - B6: the Bidi Rule is not satisfied
+    punycode_invalid,  ///< P4: the A-label is not valid Punycode, or decodes to the empty or ASCII label
+    punycode_overflow, ///< P4, A3: the label is too long to be decoded or encoded
+    label_length,      ///< A4_2: the label is empty or longer than 63 octets
+    domain_length,     ///< A4_1: the domain is empty or longer than 253 octets
+    limit_exceeded,    ///< the input exceeds the processing limits of the context
+};
+
+/// @brief Failure details of `to_ascii`
+struct error_info {
+    /// the failed rule; error_code::ok if the conversion succeeded
+    error_code code = error_code::ok;
+    /// the index of the failed label in the mapped domain
+    std::size_t label_index = 0;
+    /// the offset of the offending code point in the mapped and normalized (or,
+    /// for A-labels, decoded) label; 0 if the rule applies to the whole label
+    std::size_t offset = 0;
+};
+
+/// @brief Limits of the processing work and memory for untrusted input
+///
+/// The limits are enforced by the `to_ascii` functions taking the `context`:
+/// the conversion fails as soon as any limit is exceeded, so the work and
+/// memory per domain are bounded by the limits instead of the input. The
+/// mapped code points are counted before the NFC normalization, which is bounded
+/// by them. The default value of every limit is `unlimited`.
+struct limits {
+    static constexpr std::size_t unlimited = static_cast<std::size_t>(-1);
+
+    /// the size of the input in bytes
+    std::size_t max_input_size = unlimited;
+    /// the number of code points of the mapped domain
+    std::size_t max_mapped_length = unlimited;
+    /// the number of code points of a mapped label
+    std::size_t max_label_length = unlimited;
+    /// the number of consecutive combining marks (General_Category=M) in a
+    /// mapped label; they are reordered by the NFC normalization
+    std::size_t max_combining_length = unlimited;
+};
+
 UPA_EXPORT_END
 
 namespace detail {
@@ -56,6 +110,44 @@ constexpr bool has(Option option, const Option value) noexcept {
     return (option & value) == value;
 }
 
+// DNS length limits checked if Option::VerifyDnsLength (A4)
+constexpr std::size_t max_label_length = 63;
+constexpr std::size_t max_domain_length = 253;
+
+// Recently converted labels of to_ascii_stream; the slot of the label is
+// selected by its hash, so the colliding label replaces the older one
+
+struct label_memo {
+    static constexpr std::size_t slot_count = 64; // must be a power of two
+
+    struct entry {
+        std::u32string label; // mapped label; empty if the slot is unused
+        std::string alabel;   // the label converted to ASCII
+        int bidi = 0;         // bidi classification bits of the label alone
+    };
+    std::vector<entry> entries; // empty if the memo is disabled
+    Option options = Option::Default; // options the entries were converted with
+};
+
+// Intermediate buffers of the IDNA processing
+
+struct buffers {
+    std::u32string mapped;    // mapped and normalized to NFC domain
+    std::u32string nfc;       // normalization working buffer
+    std::u32string label;     // Punycode decoded label, if too long for the stack buffer
+    std::string alabel;       // Punycode encoded label, if too long for the stack buffer
+    std::u32string nfc_label; // normalized label of to_ascii_stream
+    label_memo memo;          // converted labels of to_ascii_stream
+    limits lim;               // processing limits of the context
+    bool limit_exceeded = false; // the last conversion was stopped by `lim`
+};
+
+// Records that the conversion was stopped by the processing limits; returns false
+constexpr bool set_limit_exceeded(buffers& buff) noexcept {
+    buff.limit_exceeded = true;
+    return false;
+}
+
 // IDNA map and normalize to NFC
 
 template <typename CharT>
@@ -65,16 +157,153 @@ extern template UPA_IDNA_API bool map(std::u32string&, const char*, const char*,
 extern template UPA_IDNA_API bool map(std::u32string&, const char16_t*, const char16_t*, Option);
 extern template UPA_IDNA_API bool map(std::u32string&, const char32_t*, const char32_t*, Option);
 
+// The `nfc_buff` is used as a working buffer of the NFC normalization
+template <typename CharT>
+bool map(std::u32string& mapped, const CharT* input, const CharT* input_end, Option options,
+    std::u32string& nfc_buff);
+
+extern template UPA_IDNA_API bool map(std::u32string&, const char*, const char*, Option, std::u32string&);
+extern template UPA_IDNA_API bool map(std::u32string&, const char16_t*, const char16_t*, Option, std::u32string&);
+extern template UPA_IDNA_API bool map(std::u32string&, const char32_t*, const char32_t*, Option, std::u32string&);
+
+// ToASCII fast path for ASCII input
+
+enum class fast_result {
+    success,
+    failure,
+    fallback, // the input must be processed by the full algorithm
+    limit_exceeded // the input exceeds the processing limits
+};
+
+// Performs ToASCII on the input if it consists of ASCII characters only and has no "xn--"
+// labels; otherwise returns fast_result::fallback. The result is appended to `domain`.
+// Expects Option::FailFast: on failure the content of `domain` is unspecified.
+// The label and domain lengths are also limited by `lim`; exceeding them returns
+// fast_result::limit_exceeded.
+template <typename CharT>
+fast_result to_ascii_fast(std::string& domain, const CharT* input, const CharT* input_end, Option options,
+    const limits& lim);
+
+extern template UPA_IDNA_API fast_result to_ascii_fast(std::string&, const char*, const char*, Option, const limits&);
+extern template UPA_IDNA_API fast_result to_ascii_fast(std::string&, const char16_t*, const char16_t*, Option, const limits&);
+extern template UPA_IDNA_API fast_result to_ascii_fast(std::string&, const char32_t*, const char32_t*, Option, const limits&);
+
+// Performs ToASCII in one pass over the input: each label is mapped, normalized,
+// validated and appended to `domain` as soon as its end is reached. Expects
+// Option::FailFast and no Option::InputASCII; on failure the content of `domain`
+// is unspecified. The mapped domain and labels are checked against `buff.lim`
+// as they grow, before the normalization; `buff.limit_exceeded` is set if they
+// stop the conversion.
+template <typename CharT>
+bool to_ascii_stream(std::string& domain, const CharT* input, const CharT* input_end, Option options,
+    buffers& buff);
+
+extern template UPA_IDNA_API bool to_ascii_stream(std::string&, const char*, const char*, Option, buffers&);
+extern template UPA_IDNA_API bool to_ascii_stream(std::string&, const char16_t*, const char16_t*, Option, buffers&);
+extern template UPA_IDNA_API bool to_ascii_stream(std::string&, const char32_t*, const char32_t*, Option, buffers&);
+
 // Performs ToASCII on IDNA-mapped and normalized to NFC input
 UPA_IDNA_API bool to_ascii_mapped(std::string& domain, const std::u32string& mapped, Option options);
 
-// Performs ToUnicode on IDNA-mapped and normalized to NFC input
+// Performs ToASCII on IDNA-mapped and normalized to NFC input, using `buff` for
+// intermediate strings (`mapped` must not refer to `buff.label`); the input is
+// checked against `buff.lim` and `buff.limit_exceeded` is set if it stops the
+// conversion
+UPA_IDNA_API bool to_ascii_mapped(std::string& domain, const std::u32string& mapped, Option options,
+    buffers& buff);
+
+// Performs ToUnicode on IDNA-mapped and normalized to NFC input; the result
+// is appended to `domain` encoded in UTF-8, UTF-16 or UTF-32
+UPA_IDNA_API bool to_unicode_mapped(std::string& domain, const std::u32string& mapped, Option options);
+UPA_IDNA_API bool to_unicode_mapped(std::u16string& domain, const std::u32string& mapped, Option options);
 UPA_IDNA_API bool to_unicode_mapped(std::u32string& domain, const std::u32string& mapped, Option options);
 
+// Finds the first rule the domain fails, by processing it again label by label,
+// or reports error_code::limit_exceeded if `buff.limit_exceeded` is set; intended
+// to be called after the ToASCII has failed with the same `buff`
+template <typename CharT>
+void diagnose_to_ascii(error_info& err, const CharT* input, const CharT* input_end, Option options,
+    buffers& buff);
+
+extern template UPA_IDNA_API void diagnose_to_ascii(error_info&, const char*, const char*, Option, buffers&);
+extern template UPA_IDNA_API void diagnose_to_ascii(error_info&, const char16_t*, const char16_t*, Option, buffers&);
+extern template UPA_IDNA_API void diagnose_to_ascii(error_info&, const char32_t*, const char32_t*, Option, buffers&);
+
+// Implements ToASCII; the result is appended to `domain`
+template <typename CharT>
+inline bool to_ascii_append(std::string& domain, const CharT* input, const CharT* input_end, Option options,
+    buffers& buff) {
+    const auto opt = options | Option::FailFast;
+    const auto input_length = static_cast<std::size_t>(input_end - input);
+    buff.limit_exceeded = false;
+    if (input_length > buff.lim.max_input_size / sizeof(CharT))
+        return set_limit_exceeded(buff);
+    // A4_1 - the ASCII input is converted to the domain of the same length
+    if (has(opt, Option::VerifyDnsLength | Option::InputASCII) && input_length > max_domain_length)
+        return false;
+    switch (to_ascii_fast(domain, input, input_end, opt, buff.lim)) {
+    case fast_result::success: return true;
+    case fast_result::failure: return false;
+    case fast_result::limit_exceeded: return set_limit_exceeded(buff);
+    default: break;
+    }
+    if (!has(opt, Option::InputASCII))
+        return to_ascii_stream(domain, input, input_end, opt, buff);
+    // P1 - Map and further processing
+    buff.mapped.clear();
+    return
+        map(buff.mapped, input, input_end, opt, buff.nfc) &&
+        to_ascii_mapped(domain, buff.mapped, opt, buff);
+}
+
+// Implements ToUnicode for any output string type accepted by to_unicode_mapped
+template <class StrT, typename CharT>
+inline bool to_unicode(StrT& domain, const CharT* input, const CharT* input_end, Option options) {
+    // P1 - Map and further processing
+    std::u32string mapped;
+    if (!map(mapped, input, input_end, options) &&
+        has(options, Option::FailFast))
+        return false;
+    return to_unicode_mapped(domain, mapped, options);
+}
+
 } // namespace detail
 
 UPA_EXPORT_BEGIN
 
+/// @brief Reusable working memory of the IDNA functions
+///
+/// The functions taking a context keep all intermediate strings in it. Once its
+/// buffers have grown to fit the processed domains, subsequent calls do not
+/// allocate memory. A context also remembers the recently converted labels, so
+/// the labels shared by many domains (such as top-level domains) are converted
+/// once. A context must not be used by several threads at the same time.
+class context {
+public:
+    context() {
+        buff_.memo.entries.resize(detail::label_memo::slot_count);
+    }
+
+    /// @brief Constructs the context which enforces the processing limits
+    /// @param[in] lim the limits of the conversions using this context
+    explicit context(const limits& lim)
+        : context()
+    {
+        buff_.lim = lim;
+    }
+
+    /// @return the processing limits of this context
+    [[nodiscard]] const limits& get_limits() const noexcept { return buff_.lim; }
+
+    /// @brief Sets the processing limits of this context
+    void set_limits(const limits& lim) noexcept { buff_.lim = lim; }
+
+    // for internal use
+    detail::buffers& buff() noexcept { return buff_; }
+private:
+    detail::buffers buff_;
+};
+
 /// @brief Implements the Unicode IDNA ToASCII
 ///
 /// See: https://www.unicode.org/reports/tr46/#ToASCII
@@ -87,13 +316,80 @@ UPA_EXPORT_BEGIN
 /// @return `true` on success, or `false` on failure
 template <typename CharT>
 inline bool to_ascii(std::string& domain, const CharT* input, const CharT* input_end, Option options) {
-    // P1 - Map and further processing
-    std::u32string mapped;
+    detail::buffers buff;
     domain.clear();
-    const auto opt = options | Option::FailFast;
-    return
-        detail::map(mapped, input, input_end, opt) &&
-        detail::to_ascii_mapped(domain, mapped, opt);
+    return detail::to_ascii_append(domain, input, input_end, options, buff);
+}
+
+/// @brief Implements the Unicode IDNA ToASCII using reusable buffers
+///
+/// Same as `to_ascii(domain, input, input_end, options)`, but all intermediate
+/// strings are kept in the @a ctx, so the steady-state conversion does not allocate
+/// memory (provided that @a domain has enough capacity).
+///
+/// @param[in,out] ctx context whose buffers are used for the processing
+/// @param[out] domain buffer to store result string. Stored
+///   result is valid if the function returns `true`.
+/// @param[in]  input source domain string
+/// @param[in]  input_end the end of source domain string
+/// @param[in]  options
+/// @return `true` on success, or `false` on failure
+template <typename CharT>
+inline bool to_ascii(context& ctx, std::string& domain, const CharT* input, const CharT* input_end, Option options) {
+    domain.clear();
+    return detail::to_ascii_append(domain, input, input_end, options, ctx.buff());
+}
+
+/// @brief Implements the Unicode IDNA ToASCII and reports the cause of failure
+///
+/// Same as `to_ascii(domain, input, input_end, options)`, but on failure @a err
+/// receives the failed rule and its location. The input is processed again to
+/// find them only if the conversion fails, so a successful conversion costs the
+/// same as without @a err.
+///
+/// @param[out] domain buffer to store result string. Stored
+///   result is valid if the function returns `true`.
+/// @param[in]  input source domain string
+/// @param[in]  input_end the end of source domain string
+/// @param[in]  options
+/// @param[out] err the failure details; `err.code` is error_code::ok on success
+/// @return `true` on success, or `false` on failure
+template <typename CharT>
+inline bool to_ascii(std::string& domain, const CharT* input, const CharT* input_end, Option options,
+    error_info& err) {
+    detail::buffers buff;
+    domain.clear();
+    err = error_info{};
+    if (detail::to_ascii_append(domain, input, input_end, options, buff))
+        return true;
+    detail::diagnose_to_ascii(err, input, input_end, options, buff);
+    return false;
+}
+
+/// @brief Implements the Unicode IDNA ToASCII using reusable buffers and reports
+///   the cause of failure
+///
+/// Same as `to_ascii(ctx, domain, input, input_end, options)`, but on failure
+/// @a err receives the failed rule and its location; see
+/// `to_ascii(domain, input, input_end, options, err)`.
+///
+/// @param[in,out] ctx context whose buffers are used for the processing
+/// @param[out] domain buffer to store result string. Stored
+///   result is valid if the function returns `true`.
+/// @param[in]  input source domain string
+/// @param[in]  input_end the end of source domain string
+/// @param[in]  options
+/// @param[out] err the failure details; `err.code` is error_code::ok on success
+/// @return `true` on success, or `false` on failure
+template <typename CharT>
+inline bool to_ascii(context& ctx, std::string& domain, const CharT* input, const CharT* input_end,
+    Option options, error_info& err) {
+    domain.clear();
+    err = error_info{};
+    if (detail::to_ascii_append(domain, input, input_end, options, ctx.buff()))
+        return true;
+    detail::diagnose_to_ascii(err, input, input_end, options, ctx.buff());
+    return false;
 }
 
 /// @brief Implements the Unicode IDNA ToUnicode
@@ -109,12 +405,39 @@ inline bool to_ascii(std::string& domain, const CharT* input, const CharT* input
 /// @return `true` on success, or `false` on errors
 template <typename CharT>
 inline bool to_unicode(std::u32string& domain, const CharT* input, const CharT* input_end, Option options) {
-    // P1 - Map and further processing
-    std::u32string mapped;
-    if (!detail::map(mapped, input, input_end, options) &&
-        detail::has(options, Option::FailFast))
-        return false;
-    return detail::to_unicode_mapped(domain, mapped, options);
+    return detail::to_unicode(domain, input, input_end, options);
+}
+
+/// @brief Implements the Unicode IDNA ToUnicode with the UTF-8 output
+///
+/// Same as `to_unicode(std::u32string&, input, input_end, options)`, but the result is
+/// appended to @a domain encoded in UTF-8, without the intermediate UTF-32 string.
+/// Code points which are not Unicode scalar values (surrogates) are encoded as U+FFFD.
+///
+/// @param[out] domain buffer to store result string. Result is appended to the buffer.
+/// @param[in]  input source domain string
+/// @param[in]  input_end the end of source domain string
+/// @param[in]  options
+/// @return `true` on success, or `false` on errors
+template <typename CharT>
+inline bool to_unicode(std::string& domain, const CharT* input, const CharT* input_end, Option options) {
+    return detail::to_unicode(domain, input, input_end, options);
+}
+
+/// @brief Implements the Unicode IDNA ToUnicode with the UTF-16 output
+///
+/// Same as `to_unicode(std::u32string&, input, input_end, options)`, but the result is
+/// appended to @a domain encoded in UTF-16, without the intermediate UTF-32 string.
+/// Code points which are not Unicode scalar values (surrogates) are encoded as U+FFFD.
+///
+/// @param[out] domain buffer to store result string. Result is appended to the buffer.
+/// @param[in]  input source domain string
+/// @param[in]  input_end the end of source domain string
+/// @param[in]  options
+/// @return `true` on success, or `false` on errors
+template <typename CharT>
+inline bool to_unicode(std::u16string& domain, const CharT* input, const CharT* input_end, Option options) {
+    return detail::to_unicode(domain, input, input_end, options);
 }
 
 /// @brief Implements the domain to ASCII algorithm
@@ -20,6 +20,19 @@ UPA_IDNA_API void canonical_decompose(std::u32string& str);
 UPA_IDNA_API void normalize_nfc(std::u32string& str);
 [[nodiscard]] UPA_IDNA_API bool is_normalized_nfc(const char32_t* first, const char32_t* last);
 
+// The overloads below use `buff` as a working buffer instead of allocating
+// a temporary string. The content of `buff` is unspecified after the call.
+
+UPA_IDNA_API void canonical_decompose(std::u32string& str, std::u32string& buff);
+UPA_IDNA_API void normalize_nfc(std::u32string& str, std::u32string& buff);
+[[nodiscard]] UPA_IDNA_API bool is_normalized_nfc(const char32_t* first, const char32_t* last,
+    std::u32string& buff);
+
+// Normalizes [first, last) to NFC: returns `false` if it is already normalized,
+// otherwise stores the normalized string in `out` and returns `true`
+[[nodiscard]] UPA_IDNA_API bool normalize_nfc_to(const char32_t* first, const char32_t* last,
+    std::u32string& out);
+
 
 } // namespace upa::idna
 
@@ -8,6 +8,7 @@
 #include "config.h" // IWYU pragma: export
 
 #ifndef UPA_MODULE
+# include <cstddef>
 # include <string>
 #endif
 
@@ -23,6 +24,13 @@ enum class status {
 UPA_IDNA_API status encode(std::string& output, const char32_t* first, const char32_t* last);
 UPA_IDNA_API status decode(std::u32string& output, const char32_t* first, const char32_t* last);
 
+// Fixed capacity output: on input `output_length` is the capacity of `output`,
+// on return it is the number of stored code units. Returns status::big_output
+// if the result does not fit. These functions do not allocate memory for labels
+// up to 128 code points.
+UPA_IDNA_API status encode(char* output, std::size_t& output_length, const char32_t* first, const char32_t* last);
+UPA_IDNA_API status decode(char32_t* output, std::size_t& output_length, const char32_t* first, const char32_t* last);
+
 } // namespace upa::idna::punycode
 
 #endif // UPA_IDNA_PUNYCODE_H
@@ -0,0 +1,116 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_STATIC_H
+#define UPA_IDNA_STATIC_H
+
+// Compile-time ToASCII of string literals; requires C++20. This header is
+// self-contained: it does not need the compiled library.
+
+#include "config.h" // IWYU pragma: export
+
+#ifdef UPA_IDNA_CPP_20
+
+#include "idna.h" // IWYU pragma: export
+
+#ifndef UPA_MODULE
+# include <cstddef>
+# include <string>
+# include <string_view>
+# include <type_traits>
+#endif // UPA_MODULE
+
+#include "detail/idna_impl.h"
+
+namespace upa::idna {
+
+namespace detail {
+
+// These functions are not constexpr and are not defined: called from the
+// `static_to_ascii`, they turn the conversion failure into a compile error
+void static_to_ascii_invalid_domain();
+void static_to_ascii_capacity_exceeded();
+
+} // namespace detail
+
+UPA_EXPORT_BEGIN
+
+/// @brief The ASCII domain of fixed capacity, computed by `static_to_ascii`
+///
+/// @tparam Capacity the maximum length of the domain
+template <std::size_t Capacity>
+class static_ascii_domain {
+public:
+    // for internal use
+    constexpr explicit static_ascii_domain(std::string_view str) noexcept
+        : length_(str.length())
+    {
+        for (std::size_t i = 0; i < length_; ++i)
+            data_[i] = str[i];
+    }
+
+    /// @return the domain
+    [[nodiscard]] constexpr std::string_view view() const noexcept { return { data_, length_ }; }
+    [[nodiscard]] constexpr operator std::string_view() const noexcept { return view(); }
+
+    /// @return pointer to the null-terminated domain
+    [[nodiscard]] constexpr const char* data() const noexcept { return data_; }
+    [[nodiscard]] constexpr const char* c_str() const noexcept { return data_; }
+
+    /// @return the length of the domain
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return length_; }
+    [[nodiscard]] constexpr std::size_t length() const noexcept { return length_; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return length_ == 0; }
+
+private:
+    char data_[Capacity + 1] = {};
+    std::size_t length_ = 0;
+};
+
+/// @brief Implements the Unicode IDNA ToASCII at compile time
+///
+/// The result is the same as of `to_ascii` with the same options, but it is
+/// computed by the compiler, for example:
+/// @code
+/// constexpr auto host = upa::idna::static_to_ascii(u8"bücher.example");
+/// static_assert(host.view() == "xn--bcher-kva.example");
+/// @endcode
+/// The domain that fails the conversion, or does not fit @a Capacity, is a
+/// compile error.
+///
+/// @tparam Capacity the maximum length of the result; the default is enough
+///   if @a options has Option::VerifyDnsLength
+/// @param[in] input the string literal encoded in UTF-8, UTF-16 or UTF-32
+/// @param[in] options the Option::InputASCII is ignored
+/// @return the domain
+template <std::size_t Capacity = detail::max_domain_length, typename CharT, std::size_t N>
+[[nodiscard]] consteval static_ascii_domain<Capacity> static_to_ascii(const CharT (&input)[N],
+    Option options = domain_options(true, false)) {
+    // the terminating null is not a part of the domain
+    const std::size_t input_length = N != 0 && input[N - 1] == 0 ? N - 1 : N;
+    options = (options & ~Option::InputASCII) | Option::FailFast;
+
+    std::string domain;
+    detail::buffers buff;
+    bool ok = false;
+    if constexpr (std::is_same_v<CharT, char8_t>) {
+        const std::string str(input, input + input_length);
+        ok = detail::map_code_points(buff.mapped, str.data(), str.data() + str.length(), options, buff.nfc);
+    } else {
+        ok = detail::map_code_points(buff.mapped, input, input + input_length, options, buff.nfc);
+    }
+    if (!ok || !detail::mapped_to_ascii(domain, buff.mapped, options, buff))
+        detail::static_to_ascii_invalid_domain();
+    if (domain.length() > Capacity)
+        detail::static_to_ascii_capacity_exceeded();
+    return static_ascii_domain<Capacity>(domain);
+}
+
+UPA_EXPORT_END
+
+} // namespace upa::idna
+
+#endif // UPA_IDNA_CPP_20
+
+#endif // UPA_IDNA_STATIC_H
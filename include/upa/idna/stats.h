@@ -0,0 +1,89 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_IDNA_STATS_H
+#define UPA_IDNA_STATS_H
+
+#include "config.h" // IWYU pragma: export
+
+#ifndef UPA_MODULE
+# include <cstddef>
+# include <cstdint>
+#endif // UPA_MODULE
+
+// Processing stage counters are compiled in only if the library is built
+// with the UPA_IDNA_STATS macro defined (CMake option UPA_IDNA_STATS)
+
+#ifdef UPA_IDNA_STATS
+
+namespace upa::idna {
+
+UPA_EXPORT_BEGIN
+
+/// @brief Instrumented processing stages
+enum class stats_stage : unsigned {
+    map,
+    normalize_nfc,
+    canonical_decompose,
+    compose,
+    punycode_encode,
+    punycode_decode,
+    validate_label,
+    validate_bidi,
+    count
+};
+
+/// @brief NFC quick check results of the `normalize_nfc` stage
+enum class stats_quick_check : unsigned {
+    yes,
+    maybe,
+    no,
+    count
+};
+
+/// @brief Counters of one stage
+struct stats_counters {
+    std::uint64_t calls;  ///< the number of calls
+    std::uint64_t bytes;  ///< the size of the stage input in bytes
+    std::uint64_t cycles; ///< time spent in the stage (excluding nested stages) if timing is enabled
+};
+
+/// @brief Counters summed over all threads
+struct stats_snapshot {
+    stats_counters stages[static_cast<std::size_t>(stats_stage::count)];
+    std::uint64_t quick_check[static_cast<std::size_t>(stats_quick_check::count)];
+
+    [[nodiscard]] const stats_counters& operator[](stats_stage stage) const noexcept {
+        return stages[static_cast<std::size_t>(stage)];
+    }
+    [[nodiscard]] std::uint64_t operator[](stats_quick_check qc) const noexcept {
+        return quick_check[static_cast<std::size_t>(qc)];
+    }
+};
+
+/// @brief Sums the counters of all threads, including the finished ones
+///
+/// The counters are thread-local and are updated without synchronization, so
+/// the counts of concurrently running conversions may be partially included.
+[[nodiscard]] UPA_IDNA_API stats_snapshot get_stats();
+
+/// @brief Sets all counters to zero
+UPA_IDNA_API void reset_stats();
+
+/// @brief Enables or disables the measuring of cycles (disabled by default)
+///
+/// The time stamp counter is used on x86, and `std::chrono::steady_clock`
+/// nanoseconds otherwise.
+UPA_IDNA_API void set_stats_timing(bool enable) noexcept;
+
+/// @return the name of the @a stage
+[[nodiscard]] UPA_IDNA_API const char* stats_stage_name(stats_stage stage) noexcept;
+
+UPA_EXPORT_END
+
+} // namespace upa::idna
+
+#endif // UPA_IDNA_STATS
+
+#endif // UPA_IDNA_STATS_H
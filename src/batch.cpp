@@ -0,0 +1,236 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_MODULE
+# include "upa/idna/batch.h"
+# include <algorithm>
+# include <atomic>
+# include <cstddef>
+# include <cstdint>
+# include <exception>
+# include <memory>
+# include <string>
+# include <string_view>
+# include <thread>
+# include <vector>
+#endif // UPA_MODULE
+
+namespace upa::idna {
+namespace {
+
+// Parallel batch conversion
+//
+// The inputs are split into chunks of kChunkSize items. Each worker initially
+// owns an equal contiguous range of chunks: it takes chunks from the front of
+// its range, and when the range is empty, steals chunks from the back of the
+// other workers' ranges. Chunk results are stored in the worker's own arena
+// and copied to the batch_result arena in the input order at the end. The
+// worker arenas and contexts are kept in the batch_result for the next batch.
+
+constexpr std::size_t kChunkSize = 256;
+
+// Range of chunk indices [front, back) packed in one atomic word, so the owner
+// and thieves can update it with compare-and-swap
+class alignas(64) work_range {
+public:
+    void assign(std::uint32_t front, std::uint32_t back) noexcept {
+        range_.store(pack(front, back), std::memory_order_relaxed);
+    }
+    bool pop_front(std::uint32_t& chunk) noexcept {
+        auto value = range_.load(std::memory_order_relaxed);
+        while (front(value) < back(value)) {
+            if (range_.compare_exchange_weak(value, pack(front(value) + 1, back(value)),
+                std::memory_order_relaxed)) {
+                chunk = front(value);
+                return true;
+            }
+        }
+        return false;
+    }
+    bool steal_back(std::uint32_t& chunk) noexcept {
+        auto value = range_.load(std::memory_order_relaxed);
+        while (front(value) < back(value)) {
+            if (range_.compare_exchange_weak(value, pack(front(value), back(value) - 1),
+                std::memory_order_relaxed)) {
+                chunk = back(value) - 1;
+                return true;
+            }
+        }
+        return false;
+    }
+private:
+    static constexpr std::uint64_t pack(std::uint32_t front, std::uint32_t back) noexcept {
+        return (static_cast<std::uint64_t>(back) << 32) | front;
+    }
+    static constexpr std::uint32_t front(std::uint64_t value) noexcept {
+        return static_cast<std::uint32_t>(value);
+    }
+    static constexpr std::uint32_t back(std::uint64_t value) noexcept {
+        return static_cast<std::uint32_t>(value >> 32);
+    }
+
+    std::atomic<std::uint64_t> range_{ 0 };
+};
+
+// Where the chunk results are stored
+struct chunk_output {
+    std::size_t worker;
+    std::size_t offset; // in the worker's arena
+    std::size_t length;
+    std::size_t ok_count;
+};
+
+struct worker_state {
+    work_range range;
+    std::exception_ptr error;
+};
+
+} // namespace
+
+template <typename CharT>
+std::size_t to_ascii_batch(batch_result& result, const std::basic_string_view<CharT>* inputs,
+    std::size_t count, Option options) {
+    auto& output = result.output();
+    auto& items = result.items();
+    auto& buff = result.ctx().buff();
+
+    // Most hostnames are ASCII, which are converted to the same length
+    std::size_t total_length = 0;
+    for (std::size_t ind = 0; ind < count; ++ind)
+        total_length += inputs[ind].length();
+    output.clear();
+    output.reserve(total_length);
+    items.resize(count);
+
+    const auto opt = options | Option::FailFast;
+    std::size_t ok_count = 0;
+    for (std::size_t ind = 0; ind < count; ++ind) {
+        const auto input = inputs[ind];
+        const std::size_t offset = output.length();
+        const bool ok = detail::to_ascii_append(output, input.data(), input.data() + input.length(), opt, buff);
+        if (!ok) output.resize(offset);
+        items[ind] = { offset, output.length() - offset, ok };
+        ok_count += ok;
+    }
+    return ok_count;
+}
+
+template <typename CharT>
+std::size_t to_ascii_batch_parallel(batch_result& result, const std::basic_string_view<CharT>* inputs,
+    std::size_t count, Option options, unsigned thread_count) {
+    if (thread_count == 0)
+        thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+
+    // Chunk indices must fit in 32 bits
+    const std::size_t chunk_size = std::max(kChunkSize, count / 0x80000000u + 1);
+    const std::size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+    const std::size_t worker_count = std::min<std::size_t>(thread_count, chunk_count);
+    if (worker_count <= 1)
+        return to_ascii_batch(result, inputs, count, options);
+
+    auto& items = result.items();
+    items.resize(count);
+
+    const auto opt = options | Option::FailFast;
+    std::vector<chunk_output> chunks(chunk_count);
+    const std::unique_ptr<worker_state[]> workers(new worker_state[worker_count]);
+    auto& worker_buffs = result.workers();
+    if (worker_buffs.size() < worker_count)
+        worker_buffs.resize(worker_count);
+    for (std::size_t ind = 0; ind < worker_count; ++ind) {
+        worker_buffs[ind].output.clear();
+        workers[ind].range.assign(
+            static_cast<std::uint32_t>(chunk_count * ind / worker_count),
+            static_cast<std::uint32_t>(chunk_count * (ind + 1) / worker_count));
+    }
+
+    const auto convert_chunk = [&](std::size_t worker, std::uint32_t chunk) {
+        auto& output = worker_buffs[worker].output;
+        auto& buff = worker_buffs[worker].ctx.buff();
+        const std::size_t chunk_offset = output.length();
+        const std::size_t first = chunk * chunk_size;
+        const std::size_t last = std::min(first + chunk_size, count);
+        std::size_t ok_count = 0;
+        for (std::size_t ind = first; ind < last; ++ind) {
+            const auto input = inputs[ind];
+            const std::size_t offset = output.length();
+            const bool ok = detail::to_ascii_append(output, input.data(), input.data() + input.length(), opt, buff);
+            if (!ok) output.resize(offset);
+            // offset relative to the chunk output
+            items[ind] = { offset - chunk_offset, output.length() - offset, ok };
+            ok_count += ok;
+        }
+        chunks[chunk] = { worker, chunk_offset, output.length() - chunk_offset, ok_count };
+    };
+
+    const auto run_worker = [&](std::size_t worker) {
+        try {
+            std::uint32_t chunk = 0;
+            while (workers[worker].range.pop_front(chunk))
+                convert_chunk(worker, chunk);
+            // steal from the others
+            for (std::size_t step = 1; step < worker_count; ++step) {
+                auto& victim = workers[(worker + step) % worker_count].range;
+                while (victim.steal_back(chunk))
+                    convert_chunk(worker, chunk);
+            }
+        }
+        catch (...) {
+            workers[worker].error = std::current_exception();
+        }
+    };
+
+    // The calling thread is the worker 0
+    std::vector<std::thread> threads;
+    threads.reserve(worker_count - 1);
+    try {
+        for (std::size_t worker = 1; worker < worker_count; ++worker)
+            threads.emplace_back(run_worker, worker);
+    }
+    catch (...) {
+        // the already started threads do all the work
+        run_worker(0);
+        for (auto& thread : threads)
+            thread.join();
+        throw;
+    }
+    run_worker(0);
+    for (auto& thread : threads)
+        thread.join();
+    for (std::size_t worker = 0; worker < worker_count; ++worker) {
+        if (workers[worker].error)
+            std::rethrow_exception(workers[worker].error);
+    }
+
+    // Merge the chunk outputs in the input order
+    auto& output = result.output();
+    std::size_t total_length = 0;
+    for (const auto& chunk : chunks)
+        total_length += chunk.length;
+    output.clear();
+    output.reserve(total_length);
+    std::size_t ok_count = 0;
+    for (std::size_t chunk = 0; chunk < chunk_count; ++chunk) {
+        const auto& chunk_out = chunks[chunk];
+        const std::size_t offset = output.length();
+        output.append(worker_buffs[chunk_out.worker].output, chunk_out.offset, chunk_out.length);
+        const std::size_t last = std::min((chunk + 1) * chunk_size, count);
+        for (std::size_t ind = chunk * chunk_size; ind < last; ++ind)
+            items[ind].offset += offset;
+        ok_count += chunk_out.ok_count;
+    }
+    return ok_count;
+}
+
+// The `to_ascii_batch` function template instantiations
+template std::size_t to_ascii_batch(batch_result&, const std::string_view*, std::size_t, Option);
+template std::size_t to_ascii_batch(batch_result&, const std::u16string_view*, std::size_t, Option);
+template std::size_t to_ascii_batch(batch_result&, const std::u32string_view*, std::size_t, Option);
+
+// The `to_ascii_batch_parallel` function template instantiations
+template std::size_t to_ascii_batch_parallel(batch_result&, const std::string_view*, std::size_t, Option, unsigned);
+template std::size_t to_ascii_batch_parallel(batch_result&, const std::u16string_view*, std::size_t, Option, unsigned);
+template std::size_t to_ascii_batch_parallel(batch_result&, const std::u32string_view*, std::size_t, Option, unsigned);
+
+} // namespace upa::idna
@@ -0,0 +1,187 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_MODULE
+# include "upa/idna/cache.h"
+# include <algorithm>
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <functional>
+# include <list>
+# include <mutex>
+# include <string>
+# include <string_view>
+# include <unordered_map>
+#endif // UPA_MODULE
+
+namespace upa::idna {
+namespace {
+
+// Result kinds, stored in the key
+enum : unsigned {
+    kToAscii = 0,
+    kToUnicode32,
+    kToUnicode8,
+    kToUnicode16,
+};
+
+// Key header: kind, input code unit size and options
+constexpr std::size_t kKeyHeaderSize = 6;
+
+struct cache_entry {
+    std::string key;
+    std::string value; // the result code units as bytes
+    bool ok;
+};
+
+} // namespace
+
+// Each shard keeps its entries in the most recently used first list; the map
+// keys refer to the keys stored in the list nodes
+struct alignas(64) result_cache::shard {
+    std::mutex mutex;
+    std::list<cache_entry> entries;
+    std::unordered_map<std::string_view, std::list<cache_entry>::iterator> index;
+    std::size_t capacity = 0;
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+};
+
+result_cache::result_cache(std::size_t capacity, std::size_t shard_count)
+    : shards_(new shard[std::max<std::size_t>(shard_count, 1)])
+    , shard_count_(std::max<std::size_t>(shard_count, 1))
+{
+    // Distribute the capacity among the shards
+    for (std::size_t ind = 0; ind < shard_count_; ++ind)
+        shards_[ind].capacity = capacity * (ind + 1) / shard_count_ - capacity * ind / shard_count_;
+}
+
+result_cache::~result_cache() = default;
+
+result_cache::statistics result_cache::stats() const {
+    statistics res{ 0, 0, 0 };
+    for (std::size_t ind = 0; ind < shard_count_; ++ind) {
+        auto& sh = shards_[ind];
+        const std::lock_guard<std::mutex> lock(sh.mutex);
+        res.hits += sh.hits;
+        res.misses += sh.misses;
+        res.size += sh.entries.size();
+    }
+    return res;
+}
+
+void result_cache::clear() {
+    for (std::size_t ind = 0; ind < shard_count_; ++ind) {
+        auto& sh = shards_[ind];
+        const std::lock_guard<std::mutex> lock(sh.mutex);
+        sh.index.clear();
+        sh.entries.clear();
+        sh.hits = 0;
+        sh.misses = 0;
+    }
+}
+
+template <unsigned kind, class StrT, typename CharT>
+bool result_cache::convert(StrT& domain, const CharT* input, const CharT* input_end, Option options) {
+    const auto uncached = [&]() {
+        if constexpr (kind == kToAscii)
+            return upa::idna::to_ascii(domain, input, input_end, options);
+        else
+            return upa::idna::to_unicode(domain, input, input_end, options);
+    };
+
+    const auto input_size = static_cast<std::size_t>(input_end - input) * sizeof(CharT);
+    if (input_size > max_input_size)
+        return uncached();
+
+    // Build the key on the stack
+    char key_buff[kKeyHeaderSize + max_input_size];
+    const auto opt = static_cast<std::uint32_t>(options);
+    key_buff[0] = static_cast<char>(kind);
+    key_buff[1] = static_cast<char>(sizeof(CharT));
+    std::memcpy(key_buff + 2, &opt, sizeof(opt));
+    if (input_size != 0)
+        std::memcpy(key_buff + kKeyHeaderSize, input, input_size);
+    const std::string_view key{ key_buff, kKeyHeaderSize + input_size };
+
+    const std::size_t hash = std::hash<std::string_view>{}(key);
+    auto& sh = shards_[(hash >> 8) % shard_count_];
+
+    // to_ascii replaces the domain, to_unicode appends to it
+    const std::size_t domain_start = kind == kToAscii ? 0 : domain.length();
+    {
+        const std::lock_guard<std::mutex> lock(sh.mutex);
+        const auto it = sh.index.find(key);
+        if (it != sh.index.end()) {
+            ++sh.hits;
+            const auto& entry = *it->second;
+            sh.entries.splice(sh.entries.begin(), sh.entries, it->second);
+            domain.resize(domain_start + entry.value.length() / sizeof(typename StrT::value_type));
+            if (!entry.value.empty())
+                std::memcpy(&domain[domain_start], entry.value.data(), entry.value.length());
+            return entry.ok;
+        }
+        ++sh.misses;
+    }
+
+    // Convert without holding the lock
+    const bool ok = uncached();
+    if (sh.capacity == 0)
+        return ok;
+
+    cache_entry entry{ std::string(key), std::string(), ok };
+    if (kind != kToAscii || ok) {
+        entry.value.assign(reinterpret_cast<const char*>(domain.data() + domain_start),
+            (domain.length() - domain_start) * sizeof(typename StrT::value_type));
+    }
+
+    const std::lock_guard<std::mutex> lock(sh.mutex);
+    // Other thread may have added the same key in the meantime
+    if (sh.index.find(key) != sh.index.end())
+        return ok;
+    if (sh.entries.size() >= sh.capacity) {
+        sh.index.erase(sh.entries.back().key);
+        sh.entries.pop_back();
+    }
+    sh.entries.push_front(std::move(entry));
+    sh.index.emplace(sh.entries.front().key, sh.entries.begin());
+    return ok;
+}
+
+template <typename CharT>
+bool result_cache::to_ascii(std::string& domain, const CharT* input, const CharT* input_end, Option options) {
+    return convert<kToAscii>(domain, input, input_end, options);
+}
+
+template <typename CharT>
+bool result_cache::to_unicode(std::u32string& domain, const CharT* input, const CharT* input_end, Option options) {
+    return convert<kToUnicode32>(domain, input, input_end, options);
+}
+
+template <typename CharT>
+bool result_cache::to_unicode(std::string& domain, const CharT* input, const CharT* input_end, Option options) {
+    return convert<kToUnicode8>(domain, input, input_end, options);
+}
+
+template <typename CharT>
+bool result_cache::to_unicode(std::u16string& domain, const CharT* input, const CharT* input_end, Option options) {
+    return convert<kToUnicode16>(domain, input, input_end, options);
+}
+
+// The `result_cache` member function template instantiations
+template bool result_cache::to_ascii(std::string&, const char*, const char*, Option);
+template bool result_cache::to_ascii(std::string&, const char16_t*, const char16_t*, Option);
+template bool result_cache::to_ascii(std::string&, const char32_t*, const char32_t*, Option);
+template bool result_cache::to_unicode(std::u32string&, const char*, const char*, Option);
+template bool result_cache::to_unicode(std::u32string&, const char16_t*, const char16_t*, Option);
+template bool result_cache::to_unicode(std::u32string&, const char32_t*, const char32_t*, Option);
+template bool result_cache::to_unicode(std::string&, const char*, const char*, Option);
+template bool result_cache::to_unicode(std::string&, const char16_t*, const char16_t*, Option);
+template bool result_cache::to_unicode(std::string&, const char32_t*, const char32_t*, Option);
+template bool result_cache::to_unicode(std::u16string&, const char*, const char*, Option);
+template bool result_cache::to_unicode(std::u16string&, const char16_t*, const char16_t*, Option);
+template bool result_cache::to_unicode(std::u16string&, const char32_t*, const char32_t*, Option);
+
+} // namespace upa::idna
@@ -4,305 +4,48 @@
 //
 #ifndef UPA_MODULE
 # include "upa/idna/idna.h"
-# include "upa/idna/nfc.h"
 # include "upa/idna/punycode.h"
 # include <algorithm>
 # include <iterator>
 # include <stdexcept>
 # include <string>
+# include <string_view>
 # include <type_traits> // std::make_unsigned
 #endif // UPA_MODULE
 
-#include "idna_table.h"
-#include "iterate_utf.h"
+#include "upa/idna/detail/ascii_simd.h"
+#include "upa/idna/detail/idna_impl.h"
 
 namespace upa::idna {
 namespace {
 
-// Split
-
-template<class InputIt, class T, class FunT>
-inline void split(InputIt first, InputIt last, const T& delim, FunT output) {
-    auto start = first;
-    while (true) {
-        auto it = std::find(start, last, delim);
-        output(start, it);
-        if (it == last) break;
-        start = ++it; // skip delimiter
+// Label memoization of to_ascii_stream
+
+// Labels longer than the DNS label limit are not memoized
+constexpr std::size_t kMemoMaxLabelLength = detail::max_label_length;
+
+// Options that affect the conversion of a label
+constexpr Option kMemoLabelOptions = Option::UseSTD3ASCIIRules | Option::Transitional |
+    Option::CheckHyphens | Option::CheckBidi | Option::CheckJoiners;
+
+// Returns the memo slot of the mapped label, or nullptr if the label is not
+// memoized. Entries converted with other options are dropped.
+detail::label_memo::entry* memo_slot(detail::label_memo& memo, const char32_t* label,
+    const char32_t* label_end, Option options) {
+    const auto label_length = static_cast<std::size_t>(label_end - label);
+    if (memo.entries.empty() || label_length == 0 || label_length > kMemoMaxLabelLength)
+        return nullptr;
+    options &= kMemoLabelOptions;
+    if (memo.options != options) {
+        for (auto& entry : memo.entries)
+            entry.label.clear();
+        memo.options = options;
     }
-}
-
-// Processing
-
-constexpr int IsBidiDomain = 0x01;
-constexpr int IsBidiError = 0x02;
-
-bool validate_label(const char32_t* label, const char32_t* label_end, Option options, bool full_check, int& bidiRes);
-bool validate_bidi(const char32_t* label, const char32_t* label_end, int& bidiRes);
-
-bool processing_mapped(std::u32string* pdecoded, const std::u32string& mapped, Option options) {
-    bool error = false;
-
-    // P3 - Break
-    int bidiRes = 0;
-    bool first_label = true;
-    split(mapped.data(), mapped.data() + mapped.length(), 0x002E, [&](const char32_t* label, const char32_t* label_end) {
-        if (first_label) {
-            first_label = false;
-        } else {
-            if (pdecoded) pdecoded->push_back('.');
-        }
-        // P4 - Convert/Validate
-        if (label_end - label >= 4 && label[0] == 'x' && label[1] == 'n' && label[2] == '-' && label[3] == '-') {
-            if (*(label_end - 1) == '-' && label_end - label != 5) {
-                // > 4. Processing - 4. - 3. If (after Punycode decode) the label is empty, or if the label
-                // > contains only ASCII code points, record that there was an error.
-                // 1) "xn--" is decoded to empty label
-                // 2) "xn--ascii-" is decoded to "ascii"
-                // Note: "xn---" is ignored here, because it will fail punycode::decode
-                error = true;
-                // Decode "xn--ascii-" to "ascii" for to_unicode:
-                if (pdecoded && label_end - label > 5) {
-                    if (std::all_of(label + 4, label_end - 1, [](char32_t ch) { return ch < 0x80; }))
-                        pdecoded->append(label + 4, label_end - 1);
-                    else
-                        pdecoded->append(label, label_end); // contains non-ASCII - leave original label
-                }
-            } else {
-                std::u32string ulabel;
-                if (punycode::decode(ulabel, label + 4, label_end) == punycode::status::success) {
-                    error = error || !validate_label(ulabel.data(), ulabel.data() + ulabel.length(), options & ~Option::Transitional, true, bidiRes);
-                    if (pdecoded) pdecoded->append(ulabel);
-                } else {
-                    error = true; // punycode decode error
-                    if (pdecoded) pdecoded->append(label, label_end);
-                }
-            }
-        } else {
-            error = error || !validate_label(label, label_end, options, false, bidiRes);
-            if (pdecoded) pdecoded->append(label, label_end);
-        }
-    });
-
-    return !error;
-}
-
-bool validate_label(const char32_t* label, const char32_t* label_end, Option options, bool full_check, int& bidiRes) {
-    if (label != label_end) {
-        // V1 - The label must be in Unicode Normalization Form NFC
-        if (full_check && !is_normalized_nfc(label, label_end))
-            return false;
-
-        if (detail::has(options, Option::CheckHyphens)) {
-            // V2
-            const std::size_t label_length = label_end - label;
-            if (label_length >= 4 && label[2] == '-' && label[3] == '-')
-                return false;
-            // V3
-            if (label[0] == '-' || *(label_end - 1) == '-')
-                return false;
-        } else if (full_check) {
-            // V4: If not CheckHyphens, the label must not begin with “xn--”
-            // https://github.com/whatwg/url/issues/603#issuecomment-842625331
-            const std::size_t label_length = label_end - label;
-            if (label_length >= 4 && label[0] == 'x' && label[1] == 'n' && label[2] == '-' && label[3] == '-')
-                return false;
-        }
-
-        // V5 - can be ignored (todo)
-
-        // V6
-        const std::uint32_t cpflags = util::getCharInfo(label[0]); // label != label_end
-        if (cpflags & util::CAT_MARK)
-            return false;
-
-        // V7
-        // TODO: if (full_check)
-        const std::uint32_t valid_mask = util::getValidMask(
-            detail::has(options, Option::UseSTD3ASCIIRules),
-            detail::has(options, Option::Transitional));
-        for (auto it = label; it != label_end;) {
-            const std::uint32_t cpflags = util::getCharInfo(*it++); // it != label_end
-            if ((cpflags & valid_mask) != util::CP_VALID) {
-                return false;
-            }
-        }
-
-        // V8
-        if (detail::has(options, Option::CheckJoiners)) {
-            // https://tools.ietf.org/html/rfc5892#appendix-A
-            for (auto it = label; it != label_end;) {
-                auto start = it;
-                const std::uint32_t cp = *it++; // it != label_end
-                if (cp == 0x200C) {
-                    // ZERO WIDTH NON-JOINER
-                    if (start == label)
-                        return false;
-                    std::uint32_t cpflags = util::getCharInfo(*(--start)); // label != start
-                    if (!(cpflags & util::CAT_Virama)) {
-                        // {R,D} is required on the right
-                        if (it == label_end)
-                            return false;
-                        // (Joining_Type:{L,D})(Joining_Type:T)* \u200C
-                        while (!(cpflags & (util::CAT_Joiner_L | util::CAT_Joiner_D))) {
-                            if (!(cpflags & util::CAT_Joiner_T) || start == label)
-                                return false;
-                            cpflags = util::getCharInfo(*(--start)); // label != start
-                        }
-                        // \u200C (Joining_Type:T)*(Joining_Type:{R,D})
-                        cpflags = util::getCharInfo(*it++); // it != label_end
-                        while (!(cpflags & (util::CAT_Joiner_R | util::CAT_Joiner_D))) {
-                            if (!(cpflags & util::CAT_Joiner_T) || it == label_end)
-                                return false;
-                            cpflags = util::getCharInfo(*it++); // it != label_end
-                        }
-                        // HACK: because 0x200C is Non_Joining (U); 0x200D is Join_Causing (C), i.e.
-                        // not L, D, R, T; then the cycle can be continued with `it` increased here
-                    }
-                } else if (cp == 0x200D) {
-                    //  ZERO WIDTH JOINER
-                    if (start == label ||
-                        !(util::getCharInfo(*(--start)) & util::CAT_Virama)  // label != start
-                        ) {
-                        return false;
-                    }
-                }
-            }
-        }
-
-        // V9
-        if (detail::has(options, Option::CheckBidi)) {
-            if (!validate_bidi(label, label_end, bidiRes))
-                return false;
-        }
-    }
-    return true;
-}
-
-inline bool is_bidi(const char32_t* first, const char32_t* last) {
-    // https://tools.ietf.org/html/rfc5893#section-2
-    for (auto it = first; it != last;) {
-        const std::uint32_t cpflags = util::getCharInfo(*it++); // it != last
-        // A "Bidi domain name" is a domain name that contains at least one RTL
-        // label. An RTL label is a label that contains at least one character
-        // of type R, AL, or AN.
-        if (cpflags & (util::CAT_Bidi_R_AL | util::CAT_Bidi_AN))
-            return true;
-    }
-    return false;
-}
-
-bool validate_bidi(const char32_t* label, const char32_t* label_end, int& bidiRes) {
-    // To check rules the label must have at least one character
-    if (label == label_end)
-        return true;
-
-    // if there is a bidi error, then only check domain is bidi
-    if (bidiRes & IsBidiError) {
-        // error if bidi domain
-        return !is_bidi(label, label_end);
-    }
-
-    // 1. The first character must be a character with Bidi property L, R, or AL
-    std::uint32_t cpflags = util::getCharInfo(*label++); // label != label_end
-    if (cpflags & util::CAT_Bidi_R_AL) {
-        // RTL
-        std::uint32_t end_cpflags = cpflags;
-        std::uint32_t all_cpflags = 0;
-        for (auto it = label; it != label_end;) {
-            cpflags = util::getCharInfo(*it++); // it != label_end
-            // 2. R, AL, AN, EN, ES, CS, ET, ON, BN, NSM
-            if (!(cpflags & (util::CAT_Bidi_R_AL | util::CAT_Bidi_AN | util::CAT_Bidi_EN |
-                util::CAT_Bidi_ES_CS_ET_ON_BN | util::CAT_Bidi_NSM)))
-                return false;
-            // 3. NSM
-            if (!(cpflags & util::CAT_Bidi_NSM))
-                end_cpflags = cpflags;
-            // 4. EN, AN
-            all_cpflags |= cpflags;
-        }
-        // 3. R, AL, AN, EN
-        if (!(end_cpflags & (util::CAT_Bidi_R_AL | util::CAT_Bidi_AN | util::CAT_Bidi_EN)))
-            return false;
-        // 4. EN, AN
-        if ((all_cpflags & (util::CAT_Bidi_AN | util::CAT_Bidi_EN)) == (util::CAT_Bidi_AN | util::CAT_Bidi_EN))
-            return false;
-        // is bidi domain
-        bidiRes |= IsBidiDomain;
-    } else if (cpflags & util::CAT_Bidi_L) {
-        // LTR
-        std::uint32_t end_cpflags = cpflags;
-        for (auto it = label; it != label_end;) {
-            cpflags = util::getCharInfo(*it++); // it != label_end
-#if 0
-            // 5. L, EN, ES, CS, ET, ON, BN, NSM
-            if (!(cpflags & (CAT_Bidi_L | CAT_Bidi_EN | CAT_Bidi_ES_CS_ET_ON_BN | CAT_Bidi_NSM))) {
-                // error if bidi domain
-                if ((bidiRes & IsBidiDomain) || (cpflags & (CAT_Bidi_R_AL | CAT_Bidi_AN)) || is_bidi(it, label_end)) {
-                    return false;
-                } else {
-                    bidiRes |= IsBidiError;
-                }
-            }
-            // 6. NSM
-            if (!(cpflags & CAT_Bidi_NSM))
-                end_cpflags = cpflags;
-#else
-            // 5. L, EN, ES, CS, ET, ON, BN, NSM; 6. NSM
-            if (cpflags & (util::CAT_Bidi_L | util::CAT_Bidi_EN | util::CAT_Bidi_ES_CS_ET_ON_BN)) {
-                end_cpflags = cpflags;
-            } else if (!(cpflags & util::CAT_Bidi_NSM)) {
-                // error if bidi domain
-                if ((bidiRes & IsBidiDomain) || (cpflags & (util::CAT_Bidi_R_AL | util::CAT_Bidi_AN))
-                    || is_bidi(it, label_end)) {
-                    return false;
-                }
-                bidiRes |= IsBidiError;
-            }
-#endif
-        }
-        // 6. L, EN
-        if (!(end_cpflags & (util::CAT_Bidi_L | util::CAT_Bidi_EN))) {
-            // error if bidi domain
-            if (bidiRes & IsBidiDomain) {
-                return false;
-            }
-            bidiRes |= IsBidiError;
-        }
-    } else {
-        // error if bidi domain
-        if ((bidiRes & IsBidiDomain) || (cpflags & (util::CAT_Bidi_R_AL | util::CAT_Bidi_AN))
-            || is_bidi(label, label_end)) {
-            return false;
-        }
-        bidiRes |= IsBidiError;
-    }
-    return true;
-}
-
-// This function does not reduce the capacity of the string if it is greater
-// than new_cap, to avoid unnecessary memory reallocations in some cases.
-template <class CharT>
-UPA_IDNA_CONSTEXPR_20 void reserve(std::basic_string<CharT>& str, std::size_t new_cap) {
-#ifndef UPA_IDNA_CPP_20
-    if (str.capacity() < new_cap)
-#endif
-        str.reserve(new_cap);
-}
-
-template <class InputIt>
-inline void str_append(std::string& dest, InputIt first, InputIt last) {
-#ifdef _MSC_VER
-    const std::size_t input_size = std::distance(first, last);
-    if (dest.max_size() - dest.size() < input_size)
-        throw std::length_error("too big size");
-    // now it is safe to add sizes
-    reserve(dest, dest.size() + input_size);
-    for (auto it = first; it != last; ++it)
-        dest.push_back(static_cast<char>(*it));
-#else
-    dest.append(first, last);
-#endif
+    // FNV-1a
+    std::uint32_t hash = 0x811C9DC5;
+    for (auto it = label; it != label_end; ++it)
+        hash = (hash ^ static_cast<std::uint32_t>(*it)) * 0x01000193;
+    return &memo.entries[hash & (detail::label_memo::slot_count - 1)];
 }
 
 } // namespace
@@ -318,14 +61,42 @@ constexpr char ascii_to_lower_char(CharT c) noexcept {
 
 template <typename CharT>
 bool map(std::u32string& mapped, const CharT* input, const CharT* input_end, Option options) {
+    std::u32string nfc_buff;
+    return map(mapped, input, input_end, options, nfc_buff);
+}
+
+template <typename CharT>
+bool map(std::u32string& mapped, const CharT* input, const CharT* input_end, Option options,
+    std::u32string& nfc_buff) {
     using UCharT = std::make_unsigned_t<CharT>;
+    UPA_IDNA_STATS_SCOPE(map, (input_end - input) * sizeof(CharT));
 
     // P1 - Map
     if (has(options, Option::InputASCII)) {
         // The input is in ASCII and can contain `xn--` labels
-        mapped.reserve(input_end - input);
+        const auto* it = input;
+        if constexpr (sizeof(CharT) == 1) {
+            // Lowercase and widen ascii_block_size characters at once
+            const bool fail_on_disallowed =
+                has(options, Option::UseSTD3ASCIIRules) && has(options, Option::FailFast);
+            std::size_t out = mapped.length();
+            mapped.resize(out + (input_end - input));
+            char block[util::ascii_block_size];
+            for (; input_end - it >= static_cast<std::ptrdiff_t>(util::ascii_block_size);
+                it += util::ascii_block_size) {
+                const auto info = util::ascii_lower_block(reinterpret_cast<const char*>(it), block);
+                if (info.non_ascii)
+                    break; // leave it for the code below
+                if (fail_on_disallowed && info.disallowed)
+                    return false;
+                util::ascii_widen_block(block, mapped.data() + out);
+                out += util::ascii_block_size;
+            }
+            mapped.resize(out);
+        }
+        mapped.reserve(mapped.length() + (input_end - it));
         if (has(options, Option::UseSTD3ASCIIRules)) {
-            for (const auto* it = input; it != input_end; ++it) {
+            for (; it != input_end; ++it) {
                 const auto cp = static_cast<UCharT>(*it);
                 switch (util::ascii_data[cp]) {
                 case util::AC_VALID:
@@ -342,54 +113,28 @@ bool map(std::u32string& mapped, const CharT* input, const CharT* input_end, Opt
                 }
             }
         } else {
-            for (const auto* it = input; it != input_end; ++it)
+            for (; it != input_end; ++it)
                 mapped.push_back(ascii_to_lower_char(*it));
         }
     } else {
         const std::uint32_t status_mask = util::getStatusMask(has(options, Option::UseSTD3ASCIIRules));
+        // The input is decoded to UTF-32 by blocks
+        char32_t block[64];
+        nfc_quick_check nfc_check;
         for (auto it = input; it != input_end; ) {
-            const std::uint32_t cp = util::getCodePoint(it, input_end);
-            const std::uint32_t value = util::getCharInfo(cp);
-
-            switch (value & status_mask) {
-            case util::CP_VALID:
-                mapped.push_back(cp);
-                break;
-            case util::CP_MAPPED:
-                if (has(options, Option::Transitional) && cp == 0x1E9E) {
-                    // replace U+1E9E capital sharp s by “ss”
-                    mapped.append(U"ss", 2);
-                } else {
-                    util::apply_mapping(value, mapped);
-                }
-                break;
-            case util::CP_DEVIATION:
-                if (has(options, Option::Transitional)) {
-                    util::apply_mapping(value, mapped);
-                } else {
-                    mapped.push_back(cp);
-                }
-                break;
-            default:
-                // CP_DISALLOWED or
-                // CP_NO_STD3_VALID if Option::UseSTD3ASCIIRules
-                // Starting with Unicode 15.1.0, disallowed characters are checked after NFC
-                // normalization. However, normalization is expensive. Most disallowed characters
-                // are not normalized, so they remain after normalization. Analysis in
-                // unitool-idna.cpp shows that only three STD3 disallowed characters can be
-                // normalized: 0x3C, 0x3D, and 0x3E (see upa::idna::util::comp_disallowed_std3).
-                // So, for other disallowed characters, failure can be returned here, avoiding the
-                // normalization step.
-                if (has(options, Option::FailFast) &&
-                    ((value & util::CP_DISALLOWED_STD3) == 0 || cp > 0x3E || cp < 0x3C))
+            const std::size_t block_len = util::decodeBlock(it, input_end, block, std::size(block));
+            for (std::size_t ind = 0; ind < block_len; ++ind) {
+                if (!map_code_point(block[ind], options, status_mask, mapped, nfc_check))
                     return false;
-                mapped.push_back(cp);
-                break;
             }
         }
 
         // P2 - Normalize
-        normalize_nfc(mapped);
+        if (nfc_check.yes) {
+            UPA_IDNA_STATS_QUICK_CHECK(yes);
+        } else {
+            normalize::normalize_nfc(mapped, nfc_buff);
+        }
     }
 
     return true;
@@ -399,75 +144,364 @@ bool map(std::u32string& mapped, const CharT* input, const CharT* input_end, Opt
 template bool map(std::u32string&, const char*, const char*, Option);
 template bool map(std::u32string&, const char16_t*, const char16_t*, Option);
 template bool map(std::u32string&, const char32_t*, const char32_t*, Option);
+template bool map(std::u32string&, const char*, const char*, Option, std::u32string&);
+template bool map(std::u32string&, const char16_t*, const char16_t*, Option, std::u32string&);
+template bool map(std::u32string&, const char32_t*, const char32_t*, Option, std::u32string&);
 
-// Performs ToASCII on IDNA-mapped and normalized to NFC input
+// ToASCII fast path for ASCII input
 
-bool to_ascii_mapped(std::string& domain, const std::u32string& mapped, Option options) {
-    // A1
-    bool ok = processing_mapped(nullptr, mapped, options);
-    if (!ok) return ok;
+template <typename CharT>
+fast_result to_ascii_fast(std::string& domain, const CharT* input, const CharT* input_end, Option options,
+    const limits& lim) {
+    using UCharT = std::make_unsigned_t<CharT>;
 
-    // A2 - Break the result into labels at U+002E FULL STOP
-    if (mapped.empty()) {
-        if (detail::has(options, Option::VerifyDnsLength))
-            ok = false;
-    } else {
-        const char32_t* first = mapped.data();
-        const char32_t* last = mapped.data() + mapped.length();
-        std::size_t domain_len = domain.length() + static_cast<std::size_t>(-1);
-        bool first_label = true;
-        split(first, last, 0x002E, [&](const char32_t* label, const char32_t* label_end) {
-            // join
-            if (first_label) {
-                first_label = false;
-            } else {
-                domain.push_back('.');
-            }
+    const bool use_std3 = has(options, Option::UseSTD3ASCIIRules);
+    const bool check_hyphens = has(options, Option::CheckHyphens);
+    const bool verify_dns_length = has(options, Option::VerifyDnsLength);
+
+    // The label and domain length limits: the DNS ones (A4) and the processing
+    // limits, as ASCII domain has as many code points as characters
+    const std::size_t label_limit = verify_dns_length
+        ? std::min(max_label_length, lim.max_label_length) : lim.max_label_length;
+    const std::size_t domain_limit = verify_dns_length
+        ? std::min(max_domain_length, lim.max_mapped_length) : lim.max_mapped_length;
+
+    // ASCII characters are mapped one to one and nothing can remove them, so the
+    // domain starting with more ASCII characters than allowed fails
+    if (static_cast<std::size_t>(input_end - input) > domain_limit) {
+        const bool ascii_prefix = std::all_of(input, input + domain_limit + 1,
+            [](CharT c) { return static_cast<UCharT>(c) < 0x80; });
+        if (!ascii_prefix)
+            return fast_result::fallback;
+        return domain_limit == lim.max_mapped_length ? fast_result::limit_exceeded : fast_result::failure;
+    }
 
-            // A3 - to Punycode
-            const std::size_t label_start_ind = domain.length();
-            if (std::any_of(label, label_end, [](char32_t ch) { return ch >= 0x80; })) {
-                // has non-ASCII
-                std::string alabel;
-                if (punycode::encode(alabel, label, label_end) == punycode::status::success) {
-                    domain.push_back('x');
-                    domain.push_back('n');
-                    domain.push_back('-');
-                    domain.push_back('-');
-                    domain.append(alabel);
-                } else {
-                    // ignore label if it cannot be punycode encoded and record an error
-                    ok = false; // punycode error
+    // ASCII characters are mapped one to one, so the output has the same length
+    const std::size_t domain_start = domain.length();
+    domain.resize(domain_start + (input_end - input));
+    char* const first = domain.data() + domain_start;
+    char* out = first;
+    const char* label = first;
+    bool label_disallowed = false;
+
+    // Checks the label [label, label_end), which is complete and contains only ASCII
+    // characters, so the checks are final regardless of the rest of the input
+    const auto check_label = [&](const char* label_end) {
+        const auto label_length = label_end - label;
+        // The label length limit is checked before the rules, as in to_ascii_stream;
+        // the domain length limit is checked before the conversion
+        if (static_cast<std::size_t>(label_length) > lim.max_label_length)
+            return fast_result::limit_exceeded;
+        if (label_length >= 4 && label[2] == '-' && label[3] == '-') {
+            // "xn--" labels must be decoded and validated
+            if (label[0] == 'x' && label[1] == 'n')
+                return fast_result::fallback;
+            // V2
+            if (check_hyphens)
+                return fast_result::failure;
+        }
+        // V3
+        if (check_hyphens && label_length > 0 && (label[0] == '-' || label_end[-1] == '-'))
+            return fast_result::failure;
+        // V7 - disallowed STD3 characters. They are checked at the end of the
+        // label because 0x3C, 0x3D and 0x3E can be composed with U+0338.
+        if (label_disallowed)
+            return fast_result::failure;
+        // A4_2 and the label length limit
+        if ((verify_dns_length && label_length < 1) ||
+            static_cast<std::size_t>(label_length) > label_limit)
+            return fast_result::failure;
+        // A4_1 and the domain length limit
+        if (static_cast<std::size_t>(label_end - first) > domain_limit)
+            return fast_result::failure;
+        return fast_result::success;
+    };
+
+    auto it = input;
+
+    if constexpr (sizeof(CharT) == 1) {
+        // P1 - Map: lowercase and classify ascii_block_size characters at once
+        for (; input_end - it >= static_cast<std::ptrdiff_t>(util::ascii_block_size);
+            it += util::ascii_block_size) {
+            const auto info = util::ascii_lower_block(reinterpret_cast<const char*>(it), out);
+            if (info.non_ascii) {
+                domain.resize(domain_start);
+                return fast_result::fallback;
+            }
+            unsigned disallowed = use_std3 ? info.disallowed : 0;
+            for (unsigned dots = info.dots; dots != 0; dots &= dots - 1) {
+                const unsigned pos = util::count_trailing_zeros(dots);
+                const unsigned label_mask = (1u << pos) - 1;
+                label_disallowed = label_disallowed || (disallowed & label_mask) != 0;
+                disallowed &= ~(label_mask | (1u << pos));
+                const auto res = check_label(out + pos);
+                if (res != fast_result::success) {
+                    if (res == fast_result::fallback)
+                        domain.resize(domain_start);
+                    return res;
                 }
-            } else {
-                str_append(domain, label, label_end);
+                label = out + pos + 1;
+                label_disallowed = false;
             }
+            label_disallowed = label_disallowed || disallowed != 0;
+            out += util::ascii_block_size;
+        }
+    }
+
+    for (; ; ++it) {
+        if (it == input_end || *it == '.') {
+            const auto res = check_label(out);
+            if (res != fast_result::success) {
+                if (res == fast_result::fallback)
+                    domain.resize(domain_start);
+                return res;
+            }
+            if (it == input_end)
+                break;
+            *out++ = '.';
+            label = out;
+            label_disallowed = false;
+            continue;
+        }
 
-            // A4 - DNS length restrictions
-            if (detail::has(options, Option::VerifyDnsLength)) {
-                const std::size_t label_length = domain.length() - label_start_ind;
-                // A4_2
-                if (label_length < 1 || label_length > 63)
-                    ok = false;
-                // A4_1
-                domain_len += (1 + label_length); // dot & label
-                if (domain_len > 253) // early detect
-                    ok = false;
+        // P1 - Map
+        const auto cp = static_cast<UCharT>(*it);
+        if (cp >= 0x80) {
+            domain.resize(domain_start);
+            return fast_result::fallback;
+        }
+        switch (util::ascii_data[cp]) {
+        case util::AC_VALID:
+            *out++ = static_cast<char>(cp);
+            break;
+        case util::AC_MAPPED:
+            *out++ = static_cast<char>(cp | 0x20);
+            break;
+        default:
+            // util::AC_DISALLOWED_STD3
+            label_disallowed = label_disallowed || use_std3;
+            *out++ = static_cast<char>(cp);
+            break;
+        }
+    }
+
+    return fast_result::success;
+}
+
+// The `to_ascii_fast` function template instantiations
+template fast_result to_ascii_fast(std::string&, const char*, const char*, Option, const limits&);
+template fast_result to_ascii_fast(std::string&, const char16_t*, const char16_t*, Option, const limits&);
+template fast_result to_ascii_fast(std::string&, const char32_t*, const char32_t*, Option, const limits&);
+
+// ToASCII in one pass: map, normalize, validate and convert by labels
+
+template <typename CharT>
+bool to_ascii_stream(std::string& domain, const CharT* input, const CharT* input_end, Option options,
+    buffers& buff) {
+    const std::uint32_t status_mask = util::getStatusMask(has(options, Option::UseSTD3ASCIIRules));
+    auto& mapped = buff.mapped; // the mapped code points of the incomplete labels
+    mapped.clear();
+
+    int bidiRes = 0;
+    std::size_t domain_len = static_cast<std::size_t>(-1);
+    bool first_label = true;
+
+    const auto output_label = [&](const char32_t* label, const char32_t* label_end, bool nfc_yes) {
+        UPA_IDNA_STATS_PAUSE(); // the nested stages are counted
+        if (!within_label_limits(label, label_end, buff.lim))
+            return set_limit_exceeded(buff);
+        // join
+        if (first_label) {
+            first_label = false;
+        } else {
+            domain.push_back('.');
+        }
+        // The mapped label converted before
+        auto* slot = memo_slot(buff.memo, label, label_end, options);
+        if (slot != nullptr &&
+            std::u32string_view(slot->label) == std::u32string_view(label, label_end - label)) {
+            if (!merge_bidi(bidiRes, slot->bidi))
+                return false;
+            domain.append(slot->alabel);
+            return check_dns_length(options, slot->alabel.length(), domain_len);
+        }
+        const char32_t* mapped_label = label;
+        const char32_t* mapped_label_end = label_end;
+
+        // P2 - Normalize; U+002E FULL STOP neither decomposes nor composes, so the
+        // labels can be normalized separately
+        if (nfc_yes) {
+            UPA_IDNA_STATS_QUICK_CHECK(yes);
+        } else if (normalize::normalize_nfc_to(label, label_end, buff.nfc_label)) {
+            label = buff.nfc_label.data();
+            label_end = label + buff.nfc_label.length();
+        }
+        // A4 - the too long label fails without the validation and encoding
+        if (!may_fit_dns_length(options, label_end - label, domain_len))
+            return false;
+        // P4 - Convert/Validate (A1); the label is validated alone, so its bidi
+        // classification can be memoized
+        bool error = false;
+        int label_bidi = 0;
+        process_label<std::u32string>(nullptr, label, label_end, options, label_bidi, error, buff);
+        if (error || !merge_bidi(bidiRes, label_bidi))
+            return false;
+        // A3, A4
+        const std::size_t label_start = domain.length();
+        if (!append_label(domain, label, label_end, options, domain_len, buff))
+            return false;
+        if (slot != nullptr) {
+            slot->label.assign(mapped_label, mapped_label_end);
+            slot->alabel.assign(domain, label_start, std::string::npos);
+            slot->bidi = label_bidi;
+        }
+        return true;
+    };
+
+    // The input is decoded to UTF-32 by blocks
+    char32_t block[64];
+    std::size_t mapped_length = 0; // the mapped length of the processed blocks
+    nfc_quick_check nfc_check; // of the incomplete label
+    for (auto it = input; it != input_end; ) {
+        [[maybe_unused]] const auto* block_input = it;
+        const std::size_t block_len = util::decodeBlock(it, input_end, block, std::size(block));
+        // the input bytes, as `map` counts
+        UPA_IDNA_STATS_SCOPE(map, (it - block_input) * sizeof(CharT));
+        const std::size_t block_start = mapped.length();
+        std::size_t label_start = 0;
+        for (std::size_t ind = 0; ind < block_len; ++ind) {
+            // P1 - Map
+            const std::size_t mapped_len = mapped.length();
+            if (!map_code_point(block[ind], options, status_mask, mapped, nfc_check))
+                return false;
+            // P3 - Break; the mapping of one code point can contain several full stops
+            for (std::size_t i = mapped_len; i < mapped.length(); ++i) {
+                if (mapped[i] == 0x002E) {
+                    if (!output_label(mapped.data() + label_start, mapped.data() + i, nfc_check.yes))
+                        return false;
+                    label_start = i + 1;
+                    // the code points following the full stop in the same mapping
+                    // were checked together with the output label
+                    nfc_check = nfc_quick_check{};
+                    nfc_check.yes = i + 1 == mapped.length();
+                }
             }
-        });
+        }
+        // The processing limits of the mapped domain and the incomplete label
+        mapped_length += mapped.length() - block_start;
+        if (mapped_length > buff.lim.max_mapped_length)
+            return set_limit_exceeded(buff);
+        // remove the processed labels
+        mapped.erase(0, label_start);
+        if (mapped.length() > buff.lim.max_label_length)
+            return set_limit_exceeded(buff);
+    }
+
+    // The last label
+    if (first_label && mapped.empty()) {
+        // the empty domain
+        return !has(options, Option::VerifyDnsLength);
+    }
+    if (!output_label(mapped.data(), mapped.data() + mapped.length(), nfc_check.yes))
+        return false;
+
+    // A4_1
+    return !(has(options, Option::VerifyDnsLength) && domain_len == 0);
+}
+
+// The `to_ascii_stream` function template instantiations
+template bool to_ascii_stream(std::string&, const char*, const char*, Option, buffers&);
+template bool to_ascii_stream(std::string&, const char16_t*, const char16_t*, Option, buffers&);
+template bool to_ascii_stream(std::string&, const char32_t*, const char32_t*, Option, buffers&);
+
+// Finds the first rule the domain fails
 
-        // A4_1
-        if (detail::has(options, Option::VerifyDnsLength) && domain_len == 0)
-            ok = false;
+template <typename CharT>
+void diagnose_to_ascii(error_info& err, const CharT* input, const CharT* input_end, Option options,
+    buffers& buff) {
+    // The conversion recorded that it was stopped by the processing limits, which
+    // it checks before the rules; the input is not processed again then
+    if (buff.limit_exceeded) {
+        err = { error_code::limit_exceeded, 0, 0 };
+        return;
+    }
+
+    // Without Option::FailFast the disallowed code points are kept and reported by V7
+    const Option opt = options & ~Option::FailFast;
+
+    // P1 - Map, P2 - Normalize
+    buff.mapped.clear();
+    map(buff.mapped, input, input_end, opt, buff.nfc);
+    const std::u32string& mapped = buff.mapped;
+    if (mapped.empty()) {
+        // A4_1: the empty domain
+        if (has(opt, Option::VerifyDnsLength))
+            err = { error_code::domain_length, 0, 0 };
+        return;
     }
 
-    return ok;
+    // P3 - Break; the labels are processed as the conversion does, until the
+    // first failure
+    int bidiRes = 0;
+    std::size_t domain_len = static_cast<std::size_t>(-1);
+    std::string domain;
+    std::size_t label_index = 0;
+    const char32_t* label = mapped.data();
+    const char32_t* const last = mapped.data() + mapped.length();
+    for (; ; ++label_index) {
+        const char32_t* label_end = std::find(label, last, 0x002E);
+        err.label_index = label_index;
+
+        // P4 - Convert/Validate
+        bool error = false;
+        process_label<std::u32string>(nullptr, label, label_end, opt, bidiRes, error, buff, &err);
+        if (error)
+            return;
+
+        // A3, A4
+        if (!append_label(domain, label, label_end, opt, domain_len, buff, &err))
+            return;
+
+        if (label_end == last)
+            break;
+        label = label_end + 1; // skip the full stop
+    }
+    // No rule has failed
+    err = error_info{};
+}
+
+// The `diagnose_to_ascii` function template instantiations
+template void diagnose_to_ascii(error_info&, const char*, const char*, Option, buffers&);
+template void diagnose_to_ascii(error_info&, const char16_t*, const char16_t*, Option, buffers&);
+template void diagnose_to_ascii(error_info&, const char32_t*, const char32_t*, Option, buffers&);
+
+// Performs ToASCII on IDNA-mapped and normalized to NFC input
+
+bool to_ascii_mapped(std::string& domain, const std::u32string& mapped, Option options) {
+    buffers buff;
+    return to_ascii_mapped(domain, mapped, options, buff);
+}
+
+bool to_ascii_mapped(std::string& domain, const std::u32string& mapped, Option options,
+    buffers& buff) {
+    return mapped_to_ascii(domain, mapped, options, buff);
 }
 
 // Performs ToUnicode on IDNA-mapped and normalized to NFC input
 
+bool to_unicode_mapped(std::string& domain, const std::u32string& mapped, Option options) {
+    buffers buff;
+    return processing_mapped(&domain, mapped, options, buff);
+}
+
+bool to_unicode_mapped(std::u16string& domain, const std::u32string& mapped, Option options) {
+    buffers buff;
+    return processing_mapped(&domain, mapped, options, buff);
+}
+
 bool to_unicode_mapped(std::u32string& domain, const std::u32string& mapped, Option options) {
-    return processing_mapped(&domain, mapped, options);
+    buffers buff;
+    return processing_mapped(&domain, mapped, options, buff);
 }
 
 
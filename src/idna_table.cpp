@@ -1,2203 +0,0 @@
-// Copyright 2017-2025 Rimas Misevičius
-// Distributed under the BSD-style license that can be
-// found in the LICENSE file.
-//
-#include "idna_table.h"
-
-namespace upa::idna::util {
-
-// BEGIN-GENERATED
-const std::uint32_t uni_data[] = {
-  0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000,
-  0x40050000, 0x50000, 0x50000, 0x50000, 0x50000, 0x50000, 0x40050000, 0x40050000, 0x40050000,
-  0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000,
-  0x40050000, 0x40050000, 0x40050000, 0x50000, 0x50000, 0x50000, 0x50000, 0x50000, 0x40050000,
-  0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000,
-  0x40050000, 0x40050000, 0x40050000, 0x40010000, 0x40010000, 0x40050000, 0x20010000, 0x20010000,
-  0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000,
-  0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0xA0061,
-  0xA0062, 0xA0063, 0xA0064, 0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069, 0xA006A, 0xA006B, 0xA006C,
-  0xA006D, 0xA006E, 0xA006F, 0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074, 0xA0075, 0xA0076, 0xA0077,
-  0xA0078, 0xA0079, 0xA007A, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x40050000, 0x40050000, 0x40050000, 0x40050000, 0x40050000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0xA0020, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x24130, 0x40010000, 0xA0061, 0x40010000, 0x40010000, 0x20000, 0x40010000, 0x24653,
-  0x40010000, 0x40010000, 0xA0032, 0xA0033, 0x24655, 0xA03BC, 0x40010000, 0x40010000, 0x24659,
-  0xA0031, 0xA006F, 0x40010000, 0x26136, 0x26139, 0x2613C, 0x40010000, 0xA00E0, 0xA00E1, 0xA00E2,
-  0xA00E3, 0xA00E4, 0xA00E5, 0xA00E6, 0xA00E7, 0xA00E8, 0xA00E9, 0xA00EA, 0xA00EB, 0xA00EC, 0xA00ED,
-  0xA00EE, 0xA00EF, 0xA00F0, 0xA00F1, 0xA00F2, 0xA00F3, 0xA00F4, 0xA00F5, 0xA00F6, 0x40010000,
-  0xA00F8, 0xA00F9, 0xA00FA, 0xA00FB, 0xA00FC, 0xA00FD, 0xA00FE, 0x4034665, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x40010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0xA0101, 0x4010000, 0xA0103, 0x4010000, 0xA0105,
-  0x4010000, 0xA0107, 0x4010000, 0xA0109, 0x4010000, 0xA010B, 0x4010000, 0xA010D, 0x4010000,
-  0xA010F, 0x4010000, 0xA0111, 0x4010000, 0xA0113, 0x4010000, 0xA0115, 0x4010000, 0xA0117,
-  0x4010000, 0xA0119, 0x4010000, 0xA011B, 0x4010000, 0xA011D, 0x4010000, 0xA011F, 0x4010000,
-  0xA0121, 0x4010000, 0xA0123, 0x4010000, 0xA0125, 0x4010000, 0xA0127, 0x4010000, 0xA0129,
-  0x4010000, 0xA012B, 0x4010000, 0xA012D, 0x4010000, 0xA012F, 0x4010000, 0x24667, 0x4010000,
-  0x24669, 0x24669, 0xA0135, 0x4010000, 0xA0137, 0x4010000, 0x4010000, 0xA013A, 0x4010000, 0xA013C,
-  0x4010000, 0xA013E, 0x4010000, 0x2466B, 0x2466B, 0xA0142, 0x4010000, 0xA0144, 0x4010000, 0xA0146,
-  0x4010000, 0xA0148, 0x4010000, 0x2466D, 0xA014B, 0x4010000, 0xA014D, 0x4010000, 0xA014F,
-  0x4010000, 0xA0151, 0x4010000, 0xA0153, 0x4010000, 0xA0155, 0x4010000, 0xA0157, 0x4010000,
-  0xA0159, 0x4010000, 0xA015B, 0x4010000, 0xA015D, 0x4010000, 0xA015F, 0x4010000, 0xA0161,
-  0x4010000, 0xA0163, 0x4010000, 0xA0165, 0x4010000, 0xA0167, 0x4010000, 0xA0169, 0x4010000,
-  0xA016B, 0x4010000, 0xA016D, 0x4010000, 0xA016F, 0x4010000, 0xA0171, 0x4010000, 0xA0173,
-  0x4010000, 0xA0175, 0x4010000, 0xA0177, 0x4010000, 0xA00FF, 0xA017A, 0x4010000, 0xA017C,
-  0x4010000, 0xA017E, 0x4010000, 0xA0073, 0x4010000, 0xA0253, 0xA0183, 0x4010000, 0xA0185,
-  0x4010000, 0xA0254, 0xA0188, 0x4010000, 0xA0256, 0xA0257, 0xA018C, 0x4010000, 0x4010000, 0xA01DD,
-  0xA0259, 0xA025B, 0xA0192, 0x4010000, 0xA0260, 0xA0263, 0x4010000, 0xA0269, 0xA0268, 0xA0199,
-  0x4010000, 0x4010000, 0x4010000, 0xA026F, 0xA0272, 0x4010000, 0xA0275, 0xA01A1, 0x4010000,
-  0xA01A3, 0x4010000, 0xA01A5, 0x4010000, 0xA0280, 0xA01A8, 0x4010000, 0xA0283, 0x4010000,
-  0x4010000, 0xA01AD, 0x4010000, 0xA0288, 0xA01B0, 0x4010000, 0xA028A, 0xA028B, 0xA01B4, 0x4010000,
-  0xA01B6, 0x4010000, 0xA0292, 0xA01B9, 0x4010000, 0x4010000, 0x4010000, 0xA01BD, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x24767, 0x24767, 0x24767,
-  0x24769, 0x24769, 0x24769, 0x2476B, 0x2476B, 0x2476B, 0xA01CE, 0x4010000, 0xA01D0, 0x4010000,
-  0xA01D2, 0x4010000, 0xA01D4, 0x4010000, 0xA01D6, 0x4010000, 0xA01D8, 0x4010000, 0xA01DA,
-  0x4010000, 0xA01DC, 0x4010000, 0x4010000, 0xA01DF, 0x4010000, 0xA01E1, 0x4010000, 0xA01E3,
-  0x4010000, 0xA01E5, 0x4010000, 0xA01E7, 0x4010000, 0xA01E9, 0x4010000, 0xA01EB, 0x4010000,
-  0xA01ED, 0x4010000, 0xA01EF, 0x4010000, 0x4010000, 0x24781, 0x24781, 0x24781, 0xA01F5, 0x4010000,
-  0xA0195, 0xA01BF, 0xA01F9, 0x4010000, 0xA01FB, 0x4010000, 0xA01FD, 0x4010000, 0xA01FF, 0x4010000,
-  0xA0201, 0x4010000, 0xA0203, 0x4010000, 0xA0205, 0x4010000, 0xA0207, 0x4010000, 0xA0209,
-  0x4010000, 0xA020B, 0x4010000, 0xA020D, 0x4010000, 0xA020F, 0x4010000, 0xA0211, 0x4010000,
-  0xA0213, 0x4010000, 0xA0215, 0x4010000, 0xA0217, 0x4010000, 0xA0219, 0x4010000, 0xA021B,
-  0x4010000, 0xA021D, 0x4010000, 0xA021F, 0x4010000, 0xA019E, 0x4010000, 0xA0223, 0x4010000,
-  0xA0225, 0x4010000, 0xA0227, 0x4010000, 0xA0229, 0x4010000, 0xA022B, 0x4010000, 0xA022D,
-  0x4010000, 0xA022F, 0x4010000, 0xA0231, 0x4010000, 0xA0233, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0xA2C65, 0xA023C, 0x4010000, 0xA019A, 0xA2C66,
-  0x4010000, 0x4010000, 0xA0242, 0x4010000, 0xA0180, 0xA0289, 0xA028C, 0xA0247, 0x4010000, 0xA0249,
-  0x4010000, 0xA024B, 0x4010000, 0xA024D, 0x4010000, 0xA024F, 0x4010000, 0xA0068, 0xA0266, 0xA006A,
-  0xA0072, 0xA0279, 0xA027B, 0xA0281, 0xA0077, 0xA0079, 0x40010000, 0x40010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x4010000, 0x4010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x247A5, 0x247A7, 0x247A9, 0x247AB, 0x247AD,
-  0x247AF, 0x40010000, 0x40010000, 0xA0263, 0xA006C, 0xA0073, 0xA0078, 0xA0295, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x4010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0xA0300, 0xA0301, 0x82110000, 0xA0313, 0x24131, 0xA03B9, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x20000, 0xA0371, 0x4010000, 0xA0373, 0x4010000, 0xA02B9, 0x40010000, 0xA0377, 0x4010000, 0, 0,
-  0x247C7, 0x4010000, 0x4010000, 0x4010000, 0xA003B, 0xA03F3, 0, 0, 0, 0, 0x24655, 0x26130, 0xA03AC,
-  0xA00B7, 0xA03AD, 0xA03AE, 0xA03AF, 0, 0xA03CC, 0, 0xA03CD, 0xA03CE, 0x4010000, 0xA03B1, 0xA03B2,
-  0xA03B3, 0xA03B4, 0xA03B5, 0xA03B6, 0xA03B7, 0xA03B8, 0xA03B9, 0xA03BA, 0xA03BB, 0xA03BC, 0xA03BD,
-  0xA03BE, 0xA03BF, 0xA03C0, 0xA03C1, 0, 0xA03C3, 0xA03C4, 0xA03C5, 0xA03C6, 0xA03C7, 0xA03C8,
-  0xA03C9, 0xA03CA, 0xA03CB, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x40B03C3, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0xA03D7, 0xA03B2, 0xA03B8, 0xA03C5, 0xA03CD, 0xA03CB,
-  0xA03C6, 0xA03C0, 0x4010000, 0xA03D9, 0x4010000, 0xA03DB, 0x4010000, 0xA03DD, 0x4010000, 0xA03DF,
-  0x4010000, 0xA03E1, 0x4010000, 0xA03E3, 0x4010000, 0xA03E5, 0x4010000, 0xA03E7, 0x4010000,
-  0xA03E9, 0x4010000, 0xA03EB, 0x4010000, 0xA03ED, 0x4010000, 0xA03EF, 0x4010000, 0xA03BA, 0xA03C1,
-  0xA03C3, 0x4010000, 0xA03B8, 0xA03B5, 0x40010000, 0xA03F8, 0x4010000, 0xA03C3, 0xA03FB, 0x4010000,
-  0x4010000, 0xA037B, 0xA037C, 0xA037D, 0xA0450, 0xA0451, 0xA0452, 0xA0453, 0xA0454, 0xA0455,
-  0xA0456, 0xA0457, 0xA0458, 0xA0459, 0xA045A, 0xA045B, 0xA045C, 0xA045D, 0xA045E, 0xA045F, 0xA0430,
-  0xA0431, 0xA0432, 0xA0433, 0xA0434, 0xA0435, 0xA0436, 0xA0437, 0xA0438, 0xA0439, 0xA043A, 0xA043B,
-  0xA043C, 0xA043D, 0xA043E, 0xA043F, 0xA0440, 0xA0441, 0xA0442, 0xA0443, 0xA0444, 0xA0445, 0xA0446,
-  0xA0447, 0xA0448, 0xA0449, 0xA044A, 0xA044B, 0xA044C, 0xA044D, 0xA044E, 0xA044F, 0xA0461,
-  0x4010000, 0xA0463, 0x4010000, 0xA0465, 0x4010000, 0xA0467, 0x4010000, 0xA0469, 0x4010000,
-  0xA046B, 0x4010000, 0xA046D, 0x4010000, 0xA046F, 0x4010000, 0xA0471, 0x4010000, 0xA0473,
-  0x4010000, 0xA0475, 0x4010000, 0xA0477, 0x4010000, 0xA0479, 0x4010000, 0xA047B, 0x4010000,
-  0xA047D, 0x4010000, 0xA047F, 0x4010000, 0xA0481, 0x4010000, 0x4010000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0xA048B, 0x4010000, 0xA048D,
-  0x4010000, 0xA048F, 0x4010000, 0xA0491, 0x4010000, 0xA0493, 0x4010000, 0xA0495, 0x4010000,
-  0xA0497, 0x4010000, 0xA0499, 0x4010000, 0xA049B, 0x4010000, 0xA049D, 0x4010000, 0xA049F,
-  0x4010000, 0xA04A1, 0x4010000, 0xA04A3, 0x4010000, 0xA04A5, 0x4010000, 0xA04A7, 0x4010000,
-  0xA04A9, 0x4010000, 0xA04AB, 0x4010000, 0xA04AD, 0x4010000, 0xA04AF, 0x4010000, 0xA04B1,
-  0x4010000, 0xA04B3, 0x4010000, 0xA04B5, 0x4010000, 0xA04B7, 0x4010000, 0xA04B9, 0x4010000,
-  0xA04BB, 0x4010000, 0xA04BD, 0x4010000, 0xA04BF, 0x4010000, 0xA04CF, 0xA04C2, 0x4010000, 0xA04C4,
-  0x4010000, 0xA04C6, 0x4010000, 0xA04C8, 0x4010000, 0xA04CA, 0x4010000, 0xA04CC, 0x4010000,
-  0xA04CE, 0x4010000, 0x4010000, 0xA04D1, 0x4010000, 0xA04D3, 0x4010000, 0xA04D5, 0x4010000,
-  0xA04D7, 0x4010000, 0xA04D9, 0x4010000, 0xA04DB, 0x4010000, 0xA04DD, 0x4010000, 0xA04DF,
-  0x4010000, 0xA04E1, 0x4010000, 0xA04E3, 0x4010000, 0xA04E5, 0x4010000, 0xA04E7, 0x4010000,
-  0xA04E9, 0x4010000, 0xA04EB, 0x4010000, 0xA04ED, 0x4010000, 0xA04EF, 0x4010000, 0xA04F1,
-  0x4010000, 0xA04F3, 0x4010000, 0xA04F5, 0x4010000, 0xA04F7, 0x4010000, 0xA04F9, 0x4010000,
-  0xA04FB, 0x4010000, 0xA04FD, 0x4010000, 0xA04FF, 0x4010000, 0xA0501, 0x4010000, 0xA0503,
-  0x4010000, 0xA0505, 0x4010000, 0xA0507, 0x4010000, 0xA0509, 0x4010000, 0xA050B, 0x4010000,
-  0xA050D, 0x4010000, 0xA050F, 0x4010000, 0xA0511, 0x4010000, 0xA0513, 0x4010000, 0xA0515,
-  0x4010000, 0xA0517, 0x4010000, 0xA0519, 0x4010000, 0xA051B, 0x4010000, 0xA051D, 0x4010000,
-  0xA051F, 0x4010000, 0xA0521, 0x4010000, 0xA0523, 0x4010000, 0xA0525, 0x4010000, 0xA0527,
-  0x4010000, 0xA0529, 0x4010000, 0xA052B, 0x4010000, 0xA052D, 0x4010000, 0xA052F, 0x4010000, 0,
-  0xA0561, 0xA0562, 0xA0563, 0xA0564, 0xA0565, 0xA0566, 0xA0567, 0xA0568, 0xA0569, 0xA056A, 0xA056B,
-  0xA056C, 0xA056D, 0xA056E, 0xA056F, 0xA0570, 0xA0571, 0xA0572, 0xA0573, 0xA0574, 0xA0575, 0xA0576,
-  0xA0577, 0xA0578, 0xA0579, 0xA057A, 0xA057B, 0xA057C, 0xA057D, 0xA057E, 0xA057F, 0xA0580, 0xA0581,
-  0xA0582, 0xA0583, 0xA0584, 0xA0585, 0xA0586, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x245D3, 0x4010000, 0x4010000, 0x40010000, 0, 0, 0x40010000, 0x40010000, 0x40010000, 0,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x8010000, 0x82110000, 0x8010000,
-  0x82110000, 0x82110000, 0x8010000, 0x82110000, 0x82110000, 0x8010000, 0x82110000, 0, 0, 0, 0, 0,
-  0, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0, 0, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x40010000, 0x40010000, 0x8010000, 0x40010000,
-  0x40010000, 0x8010000, 0x40010000, 0x8010000, 0x40010000, 0x40010000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x8010000, 0, 0x8010000, 0x8010000, 0x8010000, 0x8410000, 0x8010000, 0x9010000,
-  0x9010000, 0x9010000, 0x9010000, 0x8410000, 0x9010000, 0x8410000, 0x9010000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8010000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x9010000, 0x8410000, 0x8410000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000,
-  0x10010000, 0x10010000, 0x10010000, 0x40010000, 0x10010000, 0x10010000, 0x8010000, 0x8410000,
-  0x8410000, 0x82110000, 0x9010000, 0x9010000, 0x9010000, 0x8010000, 0x245D5, 0x245D7, 0x245D9,
-  0x245DB, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x9010000, 0x9010000,
-  0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000,
-  0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x9010000, 0x8410000, 0x8410000, 0x9010000, 0x9010000, 0x9010000, 0x9010000,
-  0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x8410000, 0x9010000, 0x8410000, 0x9010000,
-  0x8410000, 0x8410000, 0x9010000, 0x9010000, 0x8010000, 0x9010000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0x40010000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x8010000, 0x8010000, 0x82110000, 0x82110000,
-  0x40010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x9010000, 0x9010000, 0x20010000,
-  0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000,
-  0x20010000, 0x8410000, 0x8410000, 0x8410000, 0x8010000, 0x8010000, 0x8410000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0x9010000, 0x82110000, 0x8410000, 0x8410000,
-  0x8410000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x9010000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x9010000, 0x8410000, 0x9010000, 0x8410000, 0x9010000, 0x8410000, 0x8410000,
-  0x9010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0, 0x9010000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x9010000,
-  0x9010000, 0x9010000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x9010000,
-  0x9010000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x9010000, 0x8410000, 0x9010000, 0x9010000,
-  0x8410000, 0x8410000, 0x8410000, 0x9010000, 0x9010000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x8010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x8010000, 0x8010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x8010000, 0, 0,
-  0x82110000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x8010000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x8010000,
-  0x82110000, 0x82110000, 0x82110000, 0x8010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0,
-  0x9010000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x9010000, 0x9010000, 0x8410000,
-  0x9010000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x9010000, 0x8410000, 0x9010000, 0x9010000, 0x9010000, 0x82110000,
-  0x82110000, 0x82110000, 0, 0, 0x8010000, 0, 0x8410000, 0x8010000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8010000, 0x9010000, 0x8410000, 0x9010000, 0x9010000, 0, 0, 0, 0, 0, 0x9010000,
-  0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000,
-  0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x9010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8410000, 0x8010000, 0x8010000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x9010000, 0x8410000, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x9010000, 0x9010000, 0x9010000, 0x8010000, 0x9010000, 0x8410000, 0x8410000, 0x9010000, 0x9010000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x9010000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8010000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x82110000, 0x4110000, 0x82110000, 0x4010000, 0x4110000, 0x4110000,
-  0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x82310000, 0x4110000, 0x4110000,
-  0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x245DD, 0x245DF, 0x245E1, 0x245E3, 0x245E5, 0x245E7, 0x245E9, 0x245EB, 0x4010000, 0x4010000,
-  0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000,
-  0x4110000, 0x4110000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0, 0, 0x4010000, 0x4010000, 0, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0x4010000, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x82110000, 0x4010000,
-  0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0, 0x4110000,
-  0x4110000, 0, 0, 0x4110000, 0x4110000, 0x82310000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0x4110000,
-  0, 0, 0, 0, 0x245ED, 0x245EF, 0, 0x245F1, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x40010000, 0x40010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x40010000, 0x4010000, 0x4010000, 0x82110000, 0, 0,
-  0x82110000, 0x82110000, 0x4110000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0, 0, 0, 0, 0x4010000, 0x4010000, 0, 0x4010000, 0x245F3, 0, 0x4010000, 0x245F5, 0,
-  0x4010000, 0x4010000, 0, 0, 0x82110000, 0, 0x4110000, 0x4110000, 0x4110000, 0x82110000,
-  0x82110000, 0, 0, 0, 0, 0x82110000, 0x82110000, 0, 0, 0x82110000, 0x82110000, 0x82310000, 0, 0, 0,
-  0x82110000, 0, 0, 0, 0, 0, 0, 0, 0x245F7, 0x245F9, 0x245FB, 0x4010000, 0, 0x245FD, 0, 0, 0, 0, 0,
-  0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x82110000,
-  0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x4110000, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0,
-  0x82110000, 0x4010000, 0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0, 0x82110000, 0x82110000, 0x4110000, 0, 0x4110000, 0x4110000, 0x82310000,
-  0, 0, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x40010000, 0, 0, 0, 0,
-  0, 0, 0, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0,
-  0x82110000, 0x4110000, 0x4110000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0, 0, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x82110000, 0x4010000, 0x4110000,
-  0x82110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0, 0x4110000, 0x4110000,
-  0, 0, 0x4110000, 0x4110000, 0x82310000, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x4110000, 0,
-  0, 0, 0, 0x245FF, 0x24601, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x4010000, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0x4010000, 0x4010000,
-  0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0x4010000, 0x4010000, 0,
-  0x4010000, 0, 0x4010000, 0x4010000, 0, 0, 0, 0x4010000, 0x4010000, 0, 0, 0, 0x4010000, 0x4010000,
-  0x4010000, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0x4110000, 0x4110000,
-  0x82110000, 0x4110000, 0x4110000, 0, 0, 0, 0x4110000, 0x4110000, 0x4110000, 0, 0x4110000,
-  0x4110000, 0x4110000, 0x82310000, 0, 0, 0x4010000, 0, 0, 0, 0, 0, 0, 0x4110000, 0, 0, 0, 0, 0, 0,
-  0, 0, 0x4010000, 0x4010000, 0x4010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0, 0, 0x82110000, 0x4110000, 0x4110000, 0x4110000,
-  0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0, 0, 0x82110000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x4110000,
-  0x4110000, 0x4110000, 0x4110000, 0, 0x82110000, 0x82110000, 0x82110000, 0, 0x82110000, 0x82110000,
-  0x82110000, 0x82310000, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0, 0x4010000, 0x4010000,
-  0x4010000, 0, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x4010000, 0x4010000, 0x82110000,
-  0x4110000, 0x4110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x82110000, 0x4010000, 0x4110000,
-  0x6110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0, 0x6110000, 0x4110000,
-  0x4110000, 0, 0x4110000, 0x4110000, 0x82110000, 0x82310000, 0, 0, 0, 0, 0, 0, 0, 0x4110000,
-  0x4110000, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x4010000, 0x4010000, 0x4110000,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x4110000, 0x4110000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82310000, 0x82310000, 0x4010000, 0x4110000,
-  0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0x4110000, 0x4110000,
-  0x4110000, 0, 0x4110000, 0x4110000, 0x4110000, 0x82310000, 0x4010000, 0x4010000, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0, 0x82110000, 0x4110000, 0x4110000, 0, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0x4010000, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0, 0, 0x82310000, 0, 0, 0, 0, 0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000,
-  0, 0x82110000, 0, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000,
-  0x4110000, 0, 0, 0x4110000, 0x4110000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4010000, 0x24603,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82310000, 0, 0, 0, 0,
-  0x40010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0, 0x4010000, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x82110000, 0x4010000, 0x24605, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82310000, 0x82110000, 0x82110000, 0x4010000, 0, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0, 0x4010000, 0, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x24607, 0x24609, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0xA0F0B, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x82110000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x82110000, 0x4010000, 0x82110000, 0x4010000, 0x82110000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x4110000, 0x4110000, 0x4010000, 0x4010000, 0x4010000,
-  0x2460D, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x2460F, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x24611, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x24613, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x24615, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x24617, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0x82110000,
-  0x82110000, 0x24619, 0x82110000, 0x2461B, 0x2461D, 0x262D1, 0x2461F, 0x26334, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x82110000, 0x242D2, 0x82110000,
-  0x82110000, 0x82310000, 0x4010000, 0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x24621, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x24623, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x24625, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x24627, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x24629, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x2462B, 0x82110000, 0x82110000,
-  0x82110000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4110000,
-  0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x82310000, 0x82310000, 0x4110000,
-  0x4110000, 0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x4010000, 0x4110000, 0x4110000,
-  0x4110000, 0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000,
-  0x4110000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4110000, 0x4110000, 0x82110000,
-  0x82110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x82110000,
-  0x4010000, 0x4110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x4010000,
-  0x4010000, 0xA2D00, 0xA2D01, 0xA2D02, 0xA2D03, 0xA2D04, 0xA2D05, 0xA2D06, 0xA2D07, 0xA2D08,
-  0xA2D09, 0xA2D0A, 0xA2D0B, 0xA2D0C, 0xA2D0D, 0xA2D0E, 0xA2D0F, 0xA2D10, 0xA2D11, 0xA2D12, 0xA2D13,
-  0xA2D14, 0xA2D15, 0xA2D16, 0xA2D17, 0xA2D18, 0xA2D19, 0xA2D1A, 0xA2D1B, 0xA2D1C, 0xA2D1D, 0xA2D1E,
-  0xA2D1F, 0xA2D20, 0xA2D21, 0xA2D22, 0xA2D23, 0xA2D24, 0xA2D25, 0, 0xA2D27, 0, 0, 0, 0, 0, 0xA2D2D,
-  0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0xA10DC, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x20000, 0x20000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0, 0,
-  0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0xA13F0, 0xA13F1,
-  0xA13F2, 0xA13F3, 0xA13F4, 0xA13F5, 0, 0, 0x40010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x40010000, 0x40010000, 0, 0, 0, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82310000, 0x4310000, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x4310000, 0x4010000, 0x4010000, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0,
-  0x82110000, 0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x20000, 0x20000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000,
-  0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82310000,
-  0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x40010000, 0x4010000, 0x82110000, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40410000, 0x40010000, 0x40010000,
-  0x40010000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0x4410000, 0x4410000, 0x4410000,
-  0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000,
-  0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000,
-  0x4410000, 0x4410000, 0x4410000, 0x4410000, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x4410000, 0x4410000, 0x4410000, 0x4410000,
-  0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000,
-  0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x4410000, 0x82110000, 0x4410000, 0, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x82110000, 0x82110000,
-  0x82110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x4110000,
-  0x4110000, 0x4110000, 0, 0, 0, 0, 0x4110000, 0x4110000, 0x82110000, 0x4110000, 0x4110000,
-  0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0, 0, 0, 0,
-  0x40010000, 0, 0, 0, 0x40010000, 0x40010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0x40010000, 0x40010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x4110000,
-  0x4110000, 0x82110000, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4110000, 0x82110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0, 0x82310000, 0x4110000, 0x82110000, 0x4110000, 0x4110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0,
-  0, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x4110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x82110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000,
-  0x82110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x4110000,
-  0x4310000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x82110000, 0x82110000, 0x4110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4110000,
-  0x82110000, 0x82110000, 0x4310000, 0x82310000, 0x82110000, 0x82110000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4110000,
-  0x82110000, 0x82110000, 0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x4110000, 0x82110000,
-  0x82110000, 0x82110000, 0x4310000, 0x4310000, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x4110000,
-  0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4110000, 0x82110000,
-  0x82110000, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0xA0432, 0xA0434, 0xA043E, 0xA0441, 0xA0442, 0xA0442, 0xA044A,
-  0xA0463, 0xAA64B, 0xA1C8A, 0x4010000, 0, 0, 0, 0, 0, 0xA10D0, 0xA10D1, 0xA10D2, 0xA10D3, 0xA10D4,
-  0xA10D5, 0xA10D6, 0xA10D7, 0xA10D8, 0xA10D9, 0xA10DA, 0xA10DB, 0xA10DC, 0xA10DD, 0xA10DE, 0xA10DF,
-  0xA10E0, 0xA10E1, 0xA10E2, 0xA10E3, 0xA10E4, 0xA10E5, 0xA10E6, 0xA10E7, 0xA10E8, 0xA10E9, 0xA10EA,
-  0xA10EB, 0xA10EC, 0xA10ED, 0xA10EE, 0xA10EF, 0xA10F0, 0xA10F1, 0xA10F2, 0xA10F3, 0xA10F4, 0xA10F5,
-  0xA10F6, 0xA10F7, 0xA10F8, 0xA10F9, 0xA10FA, 0, 0, 0xA10FD, 0xA10FE, 0xA10FF, 0x82110000,
-  0x82110000, 0x82110000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4010000, 0x4010000, 0x4110000, 0x82110000,
-  0x82110000, 0x4010000, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0xA0061, 0xA00E6,
-  0xA0062, 0x4010000, 0xA0064, 0xA0065, 0xA01DD, 0xA0067, 0xA0068, 0xA0069, 0xA006A, 0xA006B,
-  0xA006C, 0xA006D, 0xA006E, 0x4010000, 0xA006F, 0xA0223, 0xA0070, 0xA0072, 0xA0074, 0xA0075,
-  0xA0077, 0xA0061, 0xA0250, 0xA0251, 0xA1D02, 0xA0062, 0xA0064, 0xA0065, 0xA0259, 0xA025B, 0xA025C,
-  0xA0067, 0x4010000, 0xA006B, 0xA006D, 0xA014B, 0xA006F, 0xA0254, 0xA1D16, 0xA1D17, 0xA0070,
-  0xA0074, 0xA0075, 0xA1D1D, 0xA026F, 0xA0076, 0xA1D25, 0xA03B2, 0xA03B3, 0xA03B4, 0xA03C6, 0xA03C7,
-  0xA0069, 0xA0072, 0xA0075, 0xA0076, 0xA03B2, 0xA03B3, 0xA03C1, 0xA03C6, 0xA03C7, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0xA043D, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0xA0252, 0xA0063, 0xA0255, 0xA00F0, 0xA025C, 0xA0066,
-  0xA025F, 0xA0261, 0xA0265, 0xA0268, 0xA0269, 0xA026A, 0xA1D7B, 0xA029D, 0xA026D, 0xA1D85, 0xA029F,
-  0xA0271, 0xA0270, 0xA0272, 0xA0273, 0xA0274, 0xA0275, 0xA0278, 0xA0282, 0xA0283, 0xA01AB, 0xA0289,
-  0xA028A, 0xA1D1C, 0xA028B, 0xA028C, 0xA007A, 0xA0290, 0xA0291, 0xA0292, 0xA03B8, 0xA1E01,
-  0x4010000, 0xA1E03, 0x4010000, 0xA1E05, 0x4010000, 0xA1E07, 0x4010000, 0xA1E09, 0x4010000,
-  0xA1E0B, 0x4010000, 0xA1E0D, 0x4010000, 0xA1E0F, 0x4010000, 0xA1E11, 0x4010000, 0xA1E13,
-  0x4010000, 0xA1E15, 0x4010000, 0xA1E17, 0x4010000, 0xA1E19, 0x4010000, 0xA1E1B, 0x4010000,
-  0xA1E1D, 0x4010000, 0xA1E1F, 0x4010000, 0xA1E21, 0x4010000, 0xA1E23, 0x4010000, 0xA1E25,
-  0x4010000, 0xA1E27, 0x4010000, 0xA1E29, 0x4010000, 0xA1E2B, 0x4010000, 0xA1E2D, 0x4010000,
-  0xA1E2F, 0x4010000, 0xA1E31, 0x4010000, 0xA1E33, 0x4010000, 0xA1E35, 0x4010000, 0xA1E37,
-  0x4010000, 0xA1E39, 0x4010000, 0xA1E3B, 0x4010000, 0xA1E3D, 0x4010000, 0xA1E3F, 0x4010000,
-  0xA1E41, 0x4010000, 0xA1E43, 0x4010000, 0xA1E45, 0x4010000, 0xA1E47, 0x4010000, 0xA1E49,
-  0x4010000, 0xA1E4B, 0x4010000, 0xA1E4D, 0x4010000, 0xA1E4F, 0x4010000, 0xA1E51, 0x4010000,
-  0xA1E53, 0x4010000, 0xA1E55, 0x4010000, 0xA1E57, 0x4010000, 0xA1E59, 0x4010000, 0xA1E5B,
-  0x4010000, 0xA1E5D, 0x4010000, 0xA1E5F, 0x4010000, 0xA1E61, 0x4010000, 0xA1E63, 0x4010000,
-  0xA1E65, 0x4010000, 0xA1E67, 0x4010000, 0xA1E69, 0x4010000, 0xA1E6B, 0x4010000, 0xA1E6D,
-  0x4010000, 0xA1E6F, 0x4010000, 0xA1E71, 0x4010000, 0xA1E73, 0x4010000, 0xA1E75, 0x4010000,
-  0xA1E77, 0x4010000, 0xA1E79, 0x4010000, 0xA1E7B, 0x4010000, 0xA1E7D, 0x4010000, 0xA1E7F,
-  0x4010000, 0xA1E81, 0x4010000, 0xA1E83, 0x4010000, 0xA1E85, 0x4010000, 0xA1E87, 0x4010000,
-  0xA1E89, 0x4010000, 0xA1E8B, 0x4010000, 0xA1E8D, 0x4010000, 0xA1E8F, 0x4010000, 0xA1E91,
-  0x4010000, 0xA1E93, 0x4010000, 0xA1E95, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x246F5, 0xA1E61, 0x4010000, 0x4010000, 0xA00DF, 0x4010000, 0xA1EA1, 0x4010000, 0xA1EA3,
-  0x4010000, 0xA1EA5, 0x4010000, 0xA1EA7, 0x4010000, 0xA1EA9, 0x4010000, 0xA1EAB, 0x4010000,
-  0xA1EAD, 0x4010000, 0xA1EAF, 0x4010000, 0xA1EB1, 0x4010000, 0xA1EB3, 0x4010000, 0xA1EB5,
-  0x4010000, 0xA1EB7, 0x4010000, 0xA1EB9, 0x4010000, 0xA1EBB, 0x4010000, 0xA1EBD, 0x4010000,
-  0xA1EBF, 0x4010000, 0xA1EC1, 0x4010000, 0xA1EC3, 0x4010000, 0xA1EC5, 0x4010000, 0xA1EC7,
-  0x4010000, 0xA1EC9, 0x4010000, 0xA1ECB, 0x4010000, 0xA1ECD, 0x4010000, 0xA1ECF, 0x4010000,
-  0xA1ED1, 0x4010000, 0xA1ED3, 0x4010000, 0xA1ED5, 0x4010000, 0xA1ED7, 0x4010000, 0xA1ED9,
-  0x4010000, 0xA1EDB, 0x4010000, 0xA1EDD, 0x4010000, 0xA1EDF, 0x4010000, 0xA1EE1, 0x4010000,
-  0xA1EE3, 0x4010000, 0xA1EE5, 0x4010000, 0xA1EE7, 0x4010000, 0xA1EE9, 0x4010000, 0xA1EEB,
-  0x4010000, 0xA1EED, 0x4010000, 0xA1EEF, 0x4010000, 0xA1EF1, 0x4010000, 0xA1EF3, 0x4010000,
-  0xA1EF5, 0x4010000, 0xA1EF7, 0x4010000, 0xA1EF9, 0x4010000, 0xA1EFB, 0x4010000, 0xA1EFD,
-  0x4010000, 0xA1EFF, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0xA1F00, 0xA1F01, 0xA1F02, 0xA1F03, 0xA1F04, 0xA1F05, 0xA1F06, 0xA1F07,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0xA1F10, 0xA1F11, 0xA1F12,
-  0xA1F13, 0xA1F14, 0xA1F15, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0xA1F20, 0xA1F21, 0xA1F22, 0xA1F23, 0xA1F24, 0xA1F25, 0xA1F26, 0xA1F27,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0xA1F30,
-  0xA1F31, 0xA1F32, 0xA1F33, 0xA1F34, 0xA1F35, 0xA1F36, 0xA1F37, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0, 0, 0xA1F40, 0xA1F41, 0xA1F42, 0xA1F43, 0xA1F44, 0xA1F45, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0xA1F51, 0, 0xA1F53, 0, 0xA1F55, 0, 0xA1F57, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0xA1F60, 0xA1F61, 0xA1F62, 0xA1F63, 0xA1F64, 0xA1F65,
-  0xA1F66, 0xA1F67, 0x4010000, 0xA03AC, 0x4010000, 0xA03AD, 0x4010000, 0xA03AE, 0x4010000, 0xA03AF,
-  0x4010000, 0xA03CC, 0x4010000, 0xA03CD, 0x4010000, 0xA03CE, 0, 0, 0x247D1, 0x247D3, 0x247D5,
-  0x247D7, 0x247D9, 0x247DB, 0x247DD, 0x247DF, 0x247D1, 0x247D3, 0x247D5, 0x247D7, 0x247D9, 0x247DB,
-  0x247DD, 0x247DF, 0x247E1, 0x247E3, 0x247E5, 0x247E7, 0x247E9, 0x247EB, 0x247ED, 0x247EF, 0x247E1,
-  0x247E3, 0x247E5, 0x247E7, 0x247E9, 0x247EB, 0x247ED, 0x247EF, 0x247F1, 0x247F3, 0x247F5, 0x247F7,
-  0x247F9, 0x247FB, 0x247FD, 0x247FF, 0x247F1, 0x247F3, 0x247F5, 0x247F7, 0x247F9, 0x247FB, 0x247FD,
-  0x247FF, 0x4010000, 0x4010000, 0x24813, 0x24815, 0x24817, 0, 0x4010000, 0x24819, 0xA1FB0, 0xA1FB1,
-  0xA1F70, 0xA03AC, 0x24815, 0x242A4, 0xA03B9, 0x242A4, 0x24831, 0x26289, 0x24833, 0x24835, 0x24837,
-  0, 0x4010000, 0x24839, 0xA1F72, 0xA03AD, 0xA1F74, 0xA03AE, 0x24835, 0x262A4, 0x262AA, 0x262B0,
-  0x4010000, 0x4010000, 0x4010000, 0xA0390, 0, 0, 0x4010000, 0x4010000, 0xA1FD0, 0xA1FD1, 0xA1F76,
-  0xA03AF, 0, 0x262C8, 0x262CB, 0x262CE, 0x4010000, 0x4010000, 0x4010000, 0xA03B0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0xA1FE0, 0xA1FE1, 0xA1F7A, 0xA03CD, 0xA1FE5, 0x2631C, 0x26130,
-  0xA0060, 0, 0, 0x24853, 0x24855, 0x24857, 0, 0x4010000, 0x2485F, 0xA1F78, 0xA03CC, 0xA1F7C,
-  0xA03CE, 0x24855, 0x24655, 0x242C8, 0, 0xA0020, 0xA0020, 0xA0020, 0xA0020, 0xA0020, 0xA0020,
-  0xA0020, 0xA0020, 0xA0020, 0xA0020, 0xA0020, 0x20000, 0x40030000, 0x40030000, 0, 0, 0x40010000,
-  0xA2010, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x24589, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0x40010000, 0, 0, 0, 0, 0, 0, 0, 0xA0020, 0x40010000,
-  0x40010000, 0x40010000, 0x240C4, 0x260C4, 0x40010000, 0x24538, 0x26538, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x2458D, 0x40010000, 0x2458F, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x24591, 0x24593, 0x24595, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x280C4, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0xA0020, 0x20000, 0x20000, 0x20000, 0x20000,
-  0x20000, 0, 0, 0, 0, 0, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0xA0030, 0xA0069, 0,
-  0, 0xA0034, 0xA0035, 0xA0036, 0xA0037, 0xA0038, 0xA0039, 0xA002B, 0xA2212, 0xA003D, 0xA0028,
-  0xA0029, 0xA006E, 0xA0030, 0xA0031, 0xA0032, 0xA0033, 0xA0034, 0xA0035, 0xA0036, 0xA0037, 0xA0038,
-  0xA0039, 0xA002B, 0xA2212, 0xA003D, 0xA0028, 0xA0029, 0, 0xA0061, 0xA0065, 0xA006F, 0xA0078,
-  0xA0259, 0xA0068, 0xA006B, 0xA006C, 0xA006D, 0xA006E, 0xA0070, 0xA0073, 0xA0074, 0, 0, 0,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x245B1, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0x2626E, 0x26271, 0xA0063, 0x245B3, 0x40010000, 0x26277, 0x2627A, 0xA025B,
-  0x40010000, 0x245B5, 0xA0067, 0xA0068, 0xA0068, 0xA0068, 0xA0068, 0xA0127, 0xA0069, 0xA0069,
-  0xA006C, 0xA006C, 0x40010000, 0xA006E, 0x245BD, 0x40010000, 0x40010000, 0xA0070, 0xA0071, 0xA0072,
-  0xA0072, 0xA0072, 0x40010000, 0x40010000, 0x245C1, 0x262C2, 0x245C3, 0x40010000, 0xA007A,
-  0x40010000, 0xA03C9, 0x40010000, 0xA007A, 0x40010000, 0xA006B, 0xA00E5, 0xA0062, 0xA0063,
-  0x40010000, 0xA0065, 0xA0065, 0xA0066, 0xA214E, 0xA006D, 0xA006F, 0xA05D0, 0xA05D1, 0xA05D2,
-  0xA05D3, 0xA0069, 0x40010000, 0x26358, 0xA03C0, 0xA03B3, 0xA03B3, 0xA03C0, 0xA2211, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0xA0064, 0xA0064, 0xA0065, 0xA0069, 0xA006A, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x4010000, 0x4010000, 0x2652F, 0x26532, 0x28090, 0x2653B,
-  0x26127, 0x2612A, 0x2612D, 0x26133, 0x26151, 0x2615D, 0x26163, 0x2616F, 0x26187, 0x261CC, 0x261CF,
-  0x24090, 0xA0069, 0x24089, 0x26089, 0x2460B, 0xA0076, 0x24088, 0x26088, 0x28088, 0x2462D, 0xA0078,
-  0x24274, 0x26274, 0xA006C, 0xA0063, 0xA0064, 0xA006D, 0x4010000, 0x4010000, 0x4010000, 0xA2184,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x261E1, 0x40010000, 0x40010000, 0, 0, 0,
-  0, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x2408C, 0x2608C, 0x40010000, 0x241E4, 0x261E4,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0xA3008, 0xA3009, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x4010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0,
-  0, 0, 0, 0, 0xA0031, 0xA0032, 0xA0033, 0xA0034, 0xA0035, 0xA0036, 0xA0037, 0xA0038, 0xA0039,
-  0x24092, 0x240E1, 0x240E5, 0x240E9, 0x240ED, 0x240F1, 0x240F5, 0x240F9, 0x240FD, 0x24101, 0x24105,
-  0x26337, 0x2633A, 0x2633D, 0x26340, 0x26343, 0x26346, 0x26349, 0x2634C, 0x2634F, 0x280DC, 0x280E0,
-  0x280E4, 0x280E8, 0x280EC, 0x280F0, 0x280F4, 0x280F8, 0x280FC, 0x28100, 0x28104, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x2636A, 0x2636D, 0x26370, 0x26373, 0x26376, 0x26379,
-  0x2637C, 0x2637F, 0x26382, 0x26385, 0x26388, 0x2638B, 0x2638E, 0x26391, 0x26394, 0x26397, 0x2639A,
-  0x2639D, 0x263A0, 0x263A3, 0x263A6, 0x263A9, 0x263AC, 0x263AF, 0x263B2, 0x263B5, 0xA0061, 0xA0062,
-  0xA0063, 0xA0064, 0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069, 0xA006A, 0xA006B, 0xA006C, 0xA006D,
-  0xA006E, 0xA006F, 0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074, 0xA0075, 0xA0076, 0xA0077, 0xA0078,
-  0xA0079, 0xA007A, 0xA0061, 0xA0062, 0xA0063, 0xA0064, 0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069,
-  0xA006A, 0xA006B, 0xA006C, 0xA006D, 0xA006E, 0xA006F, 0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074,
-  0xA0075, 0xA0076, 0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA0030, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x4010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x2808C, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x26535, 0x24124, 0x26124,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x24657, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0xA2C30, 0xA2C31, 0xA2C32, 0xA2C33, 0xA2C34, 0xA2C35, 0xA2C36, 0xA2C37, 0xA2C38, 0xA2C39, 0xA2C3A,
-  0xA2C3B, 0xA2C3C, 0xA2C3D, 0xA2C3E, 0xA2C3F, 0xA2C40, 0xA2C41, 0xA2C42, 0xA2C43, 0xA2C44, 0xA2C45,
-  0xA2C46, 0xA2C47, 0xA2C48, 0xA2C49, 0xA2C4A, 0xA2C4B, 0xA2C4C, 0xA2C4D, 0xA2C4E, 0xA2C4F, 0xA2C50,
-  0xA2C51, 0xA2C52, 0xA2C53, 0xA2C54, 0xA2C55, 0xA2C56, 0xA2C57, 0xA2C58, 0xA2C59, 0xA2C5A, 0xA2C5B,
-  0xA2C5C, 0xA2C5D, 0xA2C5E, 0xA2C5F, 0xA2C61, 0x4010000, 0xA026B, 0xA1D7D, 0xA027D, 0x4010000,
-  0x4010000, 0xA2C68, 0x4010000, 0xA2C6A, 0x4010000, 0xA2C6C, 0x4010000, 0xA0251, 0xA0271, 0xA0250,
-  0xA0252, 0x4010000, 0xA2C73, 0x4010000, 0x4010000, 0xA2C76, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0xA006A, 0xA0076, 0xA023F, 0xA0240, 0xA2C81, 0x4010000, 0xA2C83,
-  0x4010000, 0xA2C85, 0x4010000, 0xA2C87, 0x4010000, 0xA2C89, 0x4010000, 0xA2C8B, 0x4010000,
-  0xA2C8D, 0x4010000, 0xA2C8F, 0x4010000, 0xA2C91, 0x4010000, 0xA2C93, 0x4010000, 0xA2C95,
-  0x4010000, 0xA2C97, 0x4010000, 0xA2C99, 0x4010000, 0xA2C9B, 0x4010000, 0xA2C9D, 0x4010000,
-  0xA2C9F, 0x4010000, 0xA2CA1, 0x4010000, 0xA2CA3, 0x4010000, 0xA2CA5, 0x4010000, 0xA2CA7,
-  0x4010000, 0xA2CA9, 0x4010000, 0xA2CAB, 0x4010000, 0xA2CAD, 0x4010000, 0xA2CAF, 0x4010000,
-  0xA2CB1, 0x4010000, 0xA2CB3, 0x4010000, 0xA2CB5, 0x4010000, 0xA2CB7, 0x4010000, 0xA2CB9,
-  0x4010000, 0xA2CBB, 0x4010000, 0xA2CBD, 0x4010000, 0xA2CBF, 0x4010000, 0xA2CC1, 0x4010000,
-  0xA2CC3, 0x4010000, 0xA2CC5, 0x4010000, 0xA2CC7, 0x4010000, 0xA2CC9, 0x4010000, 0xA2CCB,
-  0x4010000, 0xA2CCD, 0x4010000, 0xA2CCF, 0x4010000, 0xA2CD1, 0x4010000, 0xA2CD3, 0x4010000,
-  0xA2CD5, 0x4010000, 0xA2CD7, 0x4010000, 0xA2CD9, 0x4010000, 0xA2CDB, 0x4010000, 0xA2CDD,
-  0x4010000, 0xA2CDF, 0x4010000, 0xA2CE1, 0x4010000, 0xA2CE3, 0x4010000, 0x4010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0xA2CEC, 0x4010000, 0xA2CEE,
-  0x4010000, 0x82110000, 0x82110000, 0x82110000, 0xA2CF3, 0x4010000, 0, 0, 0, 0, 0, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0, 0, 0, 0, 0, 0x4010000, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0,
-  0, 0, 0, 0, 0xA2D61, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82310000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0xA6BCD, 0x40010000, 0x40010000, 0x40010000, 0xA9F9F, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xA4E00, 0xA4E28, 0xA4E36, 0xA4E3F, 0xA4E59, 0xA4E85, 0xA4E8C, 0xA4EA0,
-  0xA4EBA, 0xA513F, 0xA5165, 0xA516B, 0xA5182, 0xA5196, 0xA51AB, 0xA51E0, 0xA51F5, 0xA5200, 0xA529B,
-  0xA52F9, 0xA5315, 0xA531A, 0xA5338, 0xA5341, 0xA535C, 0xA5369, 0xA5382, 0xA53B6, 0xA53C8, 0xA53E3,
-  0xA56D7, 0xA571F, 0xA58EB, 0xA5902, 0xA590A, 0xA5915, 0xA5927, 0xA5973, 0xA5B50, 0xA5B80, 0xA5BF8,
-  0xA5C0F, 0xA5C22, 0xA5C38, 0xA5C6E, 0xA5C71, 0xA5DDB, 0xA5DE5, 0xA5DF1, 0xA5DFE, 0xA5E72, 0xA5E7A,
-  0xA5E7F, 0xA5EF4, 0xA5EFE, 0xA5F0B, 0xA5F13, 0xA5F50, 0xA5F61, 0xA5F73, 0xA5FC3, 0xA6208, 0xA6236,
-  0xA624B, 0xA652F, 0xA6534, 0xA6587, 0xA6597, 0xA65A4, 0xA65B9, 0xA65E0, 0xA65E5, 0xA66F0, 0xA6708,
-  0xA6728, 0xA6B20, 0xA6B62, 0xA6B79, 0xA6BB3, 0xA6BCB, 0xA6BD4, 0xA6BDB, 0xA6C0F, 0xA6C14, 0xA6C34,
-  0xA706B, 0xA722A, 0xA7236, 0xA723B, 0xA723F, 0xA7247, 0xA7259, 0xA725B, 0xA72AC, 0xA7384, 0xA7389,
-  0xA74DC, 0xA74E6, 0xA7518, 0xA751F, 0xA7528, 0xA7530, 0xA758B, 0xA7592, 0xA7676, 0xA767D, 0xA76AE,
-  0xA76BF, 0xA76EE, 0xA77DB, 0xA77E2, 0xA77F3, 0xA793A, 0xA79B8, 0xA79BE, 0xA7A74, 0xA7ACB, 0xA7AF9,
-  0xA7C73, 0xA7CF8, 0xA7F36, 0xA7F51, 0xA7F8A, 0xA7FBD, 0xA8001, 0xA800C, 0xA8012, 0xA8033, 0xA807F,
-  0xA8089, 0xA81E3, 0xA81EA, 0xA81F3, 0xA81FC, 0xA820C, 0xA821B, 0xA821F, 0xA826E, 0xA8272, 0xA8278,
-  0xA864D, 0xA866B, 0xA8840, 0xA884C, 0xA8863, 0xA897E, 0xA898B, 0xA89D2, 0xA8A00, 0xA8C37, 0xA8C46,
-  0xA8C55, 0xA8C78, 0xA8C9D, 0xA8D64, 0xA8D70, 0xA8DB3, 0xA8EAB, 0xA8ECA, 0xA8F9B, 0xA8FB0, 0xA8FB5,
-  0xA9091, 0xA9149, 0xA91C6, 0xA91CC, 0xA91D1, 0xA9577, 0xA9580, 0xA961C, 0xA96B6, 0xA96B9, 0xA96E8,
-  0xA9751, 0xA975E, 0xA9762, 0xA9769, 0xA97CB, 0xA97ED, 0xA97F3, 0xA9801, 0xA98A8, 0xA98DB, 0xA98DF,
-  0xA9996, 0xA9999, 0xA99AC, 0xA9AA8, 0xA9AD8, 0xA9ADF, 0xA9B25, 0xA9B2F, 0xA9B32, 0xA9B3C, 0xA9B5A,
-  0xA9CE5, 0xA9E75, 0xA9E7F, 0xA9EA5, 0xA9EBB, 0xA9EC3, 0xA9ECD, 0xA9ED1, 0xA9EF9, 0xA9EFD, 0xA9F0E,
-  0xA9F13, 0xA9F20, 0xA9F3B, 0xA9F4A, 0xA9F52, 0xA9F8D, 0xA9F9C, 0xA9FA0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0xA0020, 0x40010000, 0xA002E, 0x40010000, 0x40010000, 0x4010000, 0x4010000, 0x4010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4110000,
-  0x40010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0xA3012, 0x40010000, 0xA5341,
-  0xA5344, 0xA5345, 0x4010000, 0x4010000, 0x40010000, 0x40010000, 0x40010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x82110000, 0x82110000, 0x245CB,
-  0x245CD, 0x4010000, 0x4010000, 0x245CF, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x40010000, 0x4010000,
-  0x4010000, 0x4010000, 0x245D1, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0xA1100, 0xA1101,
-  0xA11AA, 0xA1102, 0xA11AC, 0xA11AD, 0xA1103, 0xA1104, 0xA1105, 0xA11B0, 0xA11B1, 0xA11B2, 0xA11B3,
-  0xA11B4, 0xA11B5, 0xA111A, 0xA1106, 0xA1107, 0xA1108, 0xA1121, 0xA1109, 0xA110A, 0xA110B, 0xA110C,
-  0xA110D, 0xA110E, 0xA110F, 0xA1110, 0xA1111, 0xA1112, 0xA1161, 0xA1162, 0xA1163, 0xA1164, 0xA1165,
-  0xA1166, 0xA1167, 0xA1168, 0xA1169, 0xA116A, 0xA116B, 0xA116C, 0xA116D, 0xA116E, 0xA116F, 0xA1170,
-  0xA1171, 0xA1172, 0xA1173, 0xA1174, 0xA1175, 0x20000, 0xA1114, 0xA1115, 0xA11C7, 0xA11C8, 0xA11CC,
-  0xA11CE, 0xA11D3, 0xA11D7, 0xA11D9, 0xA111C, 0xA11DD, 0xA11DF, 0xA111D, 0xA111E, 0xA1120, 0xA1122,
-  0xA1123, 0xA1127, 0xA1129, 0xA112B, 0xA112C, 0xA112D, 0xA112E, 0xA112F, 0xA1132, 0xA1136, 0xA1140,
-  0xA1147, 0xA114C, 0xA11F1, 0xA11F2, 0xA1157, 0xA1158, 0xA1159, 0xA1184, 0xA1185, 0xA1188, 0xA1191,
-  0xA1192, 0xA1194, 0xA119E, 0xA11A1, 0, 0x4010000, 0x4010000, 0xA4E00, 0xA4E8C, 0xA4E09, 0xA56DB,
-  0xA4E0A, 0xA4E2D, 0xA4E0B, 0xA7532, 0xA4E59, 0xA4E19, 0xA4E01, 0xA5929, 0xA5730, 0xA4EBA,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0x26172, 0x26175, 0x26178, 0x2617B, 0x2617E, 0x26181, 0x26184, 0x2618A, 0x2618D, 0x26190,
-  0x26193, 0x26196, 0x26199, 0x2619C, 0x2619F, 0x261A2, 0x261A5, 0x261A8, 0x261AB, 0x261AE, 0x261B1,
-  0x261B4, 0x261B7, 0x261BA, 0x261BD, 0x261C0, 0x261C3, 0x261C6, 0x261C9, 0x28070, 0x2807C, 0,
-  0x261D2, 0x261D5, 0x261D8, 0x261DB, 0x261DE, 0x261E7, 0x261EA, 0x261ED, 0x261F0, 0x261F3, 0x261F6,
-  0x261F9, 0x261FC, 0x261FF, 0x26202, 0x26205, 0x26208, 0x2620B, 0x2620E, 0x26211, 0x26214, 0x26217,
-  0x2621A, 0x2621D, 0x26220, 0x26223, 0x26226, 0x26229, 0x2622C, 0x2622F, 0x26232, 0x26235, 0x26238,
-  0x2623B, 0x2623E, 0x26241, 0xA554F, 0xA5E7C, 0xA6587, 0xA7B8F, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x26244, 0x242F5, 0x242F8, 0x2413B,
-  0x24150, 0x24301, 0x24304, 0x24307, 0x2430A, 0x2430D, 0x24310, 0x24129, 0x24675, 0x24677, 0x24679,
-  0x24162, 0xA1100, 0xA1102, 0xA1103, 0xA1105, 0xA1106, 0xA1107, 0xA1109, 0xA110B, 0xA110C, 0xA110E,
-  0xA110F, 0xA1110, 0xA1111, 0xA1112, 0xAAC00, 0xAB098, 0xAB2E4, 0xAB77C, 0xAB9C8, 0xABC14, 0xAC0AC,
-  0xAC544, 0xAC790, 0xACC28, 0xACE74, 0xAD0C0, 0xAD30C, 0xAD558, 0x2477B, 0x2477D, 0xAC6B0,
-  0x4010000, 0xA4E00, 0xA4E8C, 0xA4E09, 0xA56DB, 0xA4E94, 0xA516D, 0xA4E03, 0xA516B, 0xA4E5D,
-  0xA5341, 0xA6708, 0xA706B, 0xA6C34, 0xA6728, 0xA91D1, 0xA571F, 0xA65E5, 0xA682A, 0xA6709, 0xA793E,
-  0xA540D, 0xA7279, 0xA8CA1, 0xA795D, 0xA52B4, 0xA79D8, 0xA7537, 0xA5973, 0xA9069, 0xA512A, 0xA5370,
-  0xA6CE8, 0xA9805, 0xA4F11, 0xA5199, 0xA6B63, 0xA4E0A, 0xA4E2D, 0xA4E0B, 0xA5DE6, 0xA53F3, 0xA533B,
-  0xA5B97, 0xA5B66, 0xA76E3, 0xA4F01, 0xA8CC7, 0xA5354, 0xA591C, 0x24797, 0x24799, 0x2479B, 0x2479D,
-  0x2479F, 0x24138, 0x247A1, 0x247A3, 0x247B1, 0x247B3, 0x247B5, 0x247B7, 0x247B9, 0x247BB, 0x247BD,
-  0x24143, 0x24146, 0x247BF, 0x247C1, 0x247C3, 0x247C5, 0x247C9, 0x247CB, 0x247CD, 0x2613F, 0x26142,
-  0x26145, 0x247CF, 0x26148, 0x2481B, 0x26280, 0xA30A2, 0xA30A4, 0xA30A6, 0xA30A8, 0xA30AA, 0xA30AB,
-  0xA30AD, 0xA30AF, 0xA30B1, 0xA30B3, 0xA30B5, 0xA30B7, 0xA30B9, 0xA30BB, 0xA30BD, 0xA30BF, 0xA30C1,
-  0xA30C4, 0xA30C6, 0xA30C8, 0xA30CA, 0xA30CB, 0xA30CC, 0xA30CD, 0xA30CE, 0xA30CF, 0xA30D2, 0xA30D5,
-  0xA30D8, 0xA30DB, 0xA30DE, 0xA30DF, 0xA30E0, 0xA30E1, 0xA30E2, 0xA30E4, 0xA30E6, 0xA30E8, 0xA30E9,
-  0xA30EA, 0xA30EB, 0xA30EC, 0xA30ED, 0xA30EF, 0xA30F0, 0xA30F1, 0xA30F2, 0x245AD, 0x2809C, 0x280A0,
-  0x280A4, 0x26247, 0x280B0, 0x2624A, 0x2624D, 0x2A062, 0x280BC, 0x26250, 0x26253, 0x26256, 0x280D0,
-  0x280D4, 0x26259, 0x2625C, 0x245AF, 0x2625F, 0x28118, 0x2811C, 0x24020, 0x2A026, 0x2C020, 0x2A058,
-  0x26028, 0x2A03F, 0x2A049, 0x28094, 0x26265, 0x26268, 0x2626B, 0x280C8, 0x2A035, 0x2806C, 0x26283,
-  0x2602D, 0x26286, 0x245B7, 0x245B9, 0x24042, 0x245BB, 0x2628C, 0x2628F, 0x2A02B, 0x2629E, 0x280A8,
-  0x2A05D, 0x262B3, 0x245BF, 0x245C5, 0x2A067, 0x280B8, 0x2A03A, 0x26319, 0x2A030, 0x245C7, 0x2631F,
-  0x26322, 0x26325, 0x26328, 0x2632B, 0x280D8, 0x26331, 0x245C9, 0x2632E, 0x26352, 0x26355, 0x280C0,
-  0x2635B, 0x2635E, 0x26367, 0x2A044, 0x28084, 0x2404E, 0x2A04E, 0x240CC, 0x280CC, 0x28022, 0x26295,
-  0x262B6, 0x262B9, 0x28078, 0x2462F, 0x2627D, 0x280B4, 0x24631, 0x2A053, 0x2605A, 0x242C6, 0x243B9,
-  0x243BC, 0x243BF, 0x243C2, 0x243C5, 0x243C8, 0x243CB, 0x243CE, 0x243D1, 0x262C5, 0x263B8, 0x263BB,
-  0x263BE, 0x263C1, 0x263C4, 0x263C7, 0x263CA, 0x263CD, 0x263D0, 0x263D3, 0x263D6, 0x263D9, 0x263DC,
-  0x263DF, 0x263E2, 0x2467B, 0x2467D, 0x263E5, 0x2467F, 0x24681, 0x243E8, 0x263E8, 0x263EB, 0x24687,
-  0x24689, 0x2468B, 0x2468D, 0x24635, 0x280AC, 0x24167, 0x24637, 0x24639, 0x242BE, 0x2463B, 0x2463D,
-  0x2463F, 0x24641, 0x26075, 0x28074, 0x24643, 0x24645, 0x24647, 0x24649, 0x2464B, 0x2409A, 0x24524,
-  0x26523, 0x26526, 0x26529, 0x2652C, 0x2464D, 0x2464F, 0x24651, 0x2465B, 0x2465D, 0x2465F, 0x24661,
-  0x2414B, 0x2414E, 0x24154, 0x2614B, 0x2614E, 0x2414C, 0x26154, 0x26157, 0x2615A, 0x24158, 0x26160,
-  0x26080, 0x28080, 0x24167, 0x26166, 0x26169, 0x2616C, 0x2601A, 0x2A01A, 0x2C01A, 0x24663, 0x2466F,
-  0x24671, 0x24673, 0x2455D, 0x24683, 0x24685, 0x24633, 0x246F3, 0x24633, 0x246F7, 0x246F9, 0x246FB,
-  0x2472D, 0x24733, 0x2472D, 0x24735, 0x2475F, 0, 0x24761, 0x24763, 0x24765, 0x28098, 0, 0x2476D,
-  0x2476F, 0x24771, 0x243E2, 0x24773, 0x24775, 0x24154, 0x24777, 0x2464E, 0x24779, 0x26292, 0x2477F,
-  0x2463F, 0x262A1, 0x262A7, 0x24783, 0, 0x262AD, 0x24785, 0x24787, 0x24789, 0x2478B, 0x262BC,
-  0x262BF, 0x242D8, 0x242DB, 0x242DE, 0x242E1, 0x242E4, 0x242E7, 0x242EA, 0x242ED, 0x242F0, 0x262D4,
-  0x262D7, 0x262DA, 0x262DD, 0x262E0, 0x262E3, 0x262E6, 0x262E9, 0x262EC, 0x262EF, 0x262F2, 0x262F5,
-  0x262F8, 0x262FB, 0x262FE, 0x26301, 0x26304, 0x26307, 0x2630A, 0x2630D, 0x26310, 0x26313, 0x26316,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x40010000, 0x40010000,
-  0x40010000, 0xAA641, 0x4010000, 0xAA643, 0x4010000, 0xAA645, 0x4010000, 0xAA647, 0x4010000,
-  0xAA649, 0x4010000, 0xAA64B, 0x4010000, 0xAA64D, 0x4010000, 0xAA64F, 0x4010000, 0xAA651,
-  0x4010000, 0xAA653, 0x4010000, 0xAA655, 0x4010000, 0xAA657, 0x4010000, 0xAA659, 0x4010000,
-  0xAA65B, 0x4010000, 0xAA65D, 0x4010000, 0xAA65F, 0x4010000, 0xAA661, 0x4010000, 0xAA663,
-  0x4010000, 0xAA665, 0x4010000, 0xAA667, 0x4010000, 0xAA669, 0x4010000, 0xAA66B, 0x4010000,
-  0xAA66D, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x40010000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x40010000, 0x40010000, 0xAA681, 0x4010000, 0xAA683, 0x4010000, 0xAA685,
-  0x4010000, 0xAA687, 0x4010000, 0xAA689, 0x4010000, 0xAA68B, 0x4010000, 0xAA68D, 0x4010000,
-  0xAA68F, 0x4010000, 0xAA691, 0x4010000, 0xAA693, 0x4010000, 0xAA695, 0x4010000, 0xAA697,
-  0x4010000, 0xAA699, 0x4010000, 0xAA69B, 0x4010000, 0xA044A, 0xA044C, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0,
-  0, 0, 0, 0, 0, 0x40010000, 0x40010000, 0xAA723, 0x4010000, 0xAA725, 0x4010000, 0xAA727, 0x4010000,
-  0xAA729, 0x4010000, 0xAA72B, 0x4010000, 0xAA72D, 0x4010000, 0xAA72F, 0x4010000, 0x4010000,
-  0x4010000, 0xAA733, 0x4010000, 0xAA735, 0x4010000, 0xAA737, 0x4010000, 0xAA739, 0x4010000,
-  0xAA73B, 0x4010000, 0xAA73D, 0x4010000, 0xAA73F, 0x4010000, 0xAA741, 0x4010000, 0xAA743,
-  0x4010000, 0xAA745, 0x4010000, 0xAA747, 0x4010000, 0xAA749, 0x4010000, 0xAA74B, 0x4010000,
-  0xAA74D, 0x4010000, 0xAA74F, 0x4010000, 0xAA751, 0x4010000, 0xAA753, 0x4010000, 0xAA755,
-  0x4010000, 0xAA757, 0x4010000, 0xAA759, 0x4010000, 0xAA75B, 0x4010000, 0xAA75D, 0x4010000,
-  0xAA75F, 0x4010000, 0xAA761, 0x4010000, 0xAA763, 0x4010000, 0xAA765, 0x4010000, 0xAA767,
-  0x4010000, 0xAA769, 0x4010000, 0xAA76B, 0x4010000, 0xAA76D, 0x4010000, 0xAA76F, 0x4010000,
-  0xAA76F, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0xAA77A, 0x4010000, 0xAA77C, 0x4010000, 0xA1D79, 0xAA77F, 0x4010000, 0xAA781, 0x4010000, 0xAA783,
-  0x4010000, 0xAA785, 0x4010000, 0xAA787, 0x4010000, 0x40010000, 0x4010000, 0x4010000, 0xAA78C,
-  0x4010000, 0xA0265, 0x4010000, 0x4010000, 0xAA791, 0x4010000, 0xAA793, 0x4010000, 0x4010000,
-  0x4010000, 0xAA797, 0x4010000, 0xAA799, 0x4010000, 0xAA79B, 0x4010000, 0xAA79D, 0x4010000,
-  0xAA79F, 0x4010000, 0xAA7A1, 0x4010000, 0xAA7A3, 0x4010000, 0xAA7A5, 0x4010000, 0xAA7A7,
-  0x4010000, 0xAA7A9, 0x4010000, 0xA0266, 0xA025C, 0xA0261, 0xA026C, 0xA026A, 0x4010000, 0xA029E,
-  0xA0287, 0xA029D, 0xAAB53, 0xAA7B5, 0x4010000, 0xAA7B7, 0x4010000, 0xAA7B9, 0x4010000, 0xAA7BB,
-  0x4010000, 0xAA7BD, 0x4010000, 0xAA7BF, 0x4010000, 0xAA7C1, 0x4010000, 0xAA7C3, 0x4010000,
-  0xAA794, 0xA0282, 0xA1D8E, 0xAA7C8, 0x4010000, 0xAA7CA, 0x4010000, 0xA0264, 0xAA7CD, 0x4010000,
-  0xAA7CF, 0x4010000, 0xAA7D1, 0x4010000, 0xAA7D3, 0x4010000, 0xAA7D5, 0x4010000, 0xAA7D7,
-  0x4010000, 0xAA7D9, 0x4010000, 0xAA7DB, 0x4010000, 0xA019B, 0, 0, 0, 0, 0xA0073, 0xA0063, 0xA0066,
-  0xA0071, 0xAA7F6, 0x4010000, 0x4010000, 0xA0127, 0xA0153, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4010000, 0x4010000,
-  0x4010000, 0x82310000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4110000,
-  0x82110000, 0x82110000, 0x4110000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x82310000, 0,
-  0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x40010000, 0x40010000, 0, 0, 0, 0, 0, 0, 0x4410000, 0x4410000, 0x4810000, 0x4010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0, 0, 0, 0, 0, 0x4110000, 0x4110000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4110000,
-  0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000,
-  0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x82310000, 0x82110000, 0, 0, 0,
-  0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4310000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4110000, 0x4110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x4110000,
-  0x4110000, 0x4310000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x4110000, 0x4110000, 0x82110000,
-  0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000,
-  0x4110000, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4110000, 0x82110000, 0x4110000, 0x4010000, 0x4010000, 0x82110000, 0x4010000,
-  0x82110000, 0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x4010000, 0x82110000,
-  0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x82110000,
-  0x82110000, 0x4110000, 0x4110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4110000, 0x82310000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0xAA727, 0xAAB37, 0xA026B, 0xAAB52, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0xA028D, 0x40010000,
-  0x40010000, 0, 0, 0, 0, 0xA13A0, 0xA13A1, 0xA13A2, 0xA13A3, 0xA13A4, 0xA13A5, 0xA13A6, 0xA13A7,
-  0xA13A8, 0xA13A9, 0xA13AA, 0xA13AB, 0xA13AC, 0xA13AD, 0xA13AE, 0xA13AF, 0xA13B0, 0xA13B1, 0xA13B2,
-  0xA13B3, 0xA13B4, 0xA13B5, 0xA13B6, 0xA13B7, 0xA13B8, 0xA13B9, 0xA13BA, 0xA13BB, 0xA13BC, 0xA13BD,
-  0xA13BE, 0xA13BF, 0xA13C0, 0xA13C1, 0xA13C2, 0xA13C3, 0xA13C4, 0xA13C5, 0xA13C6, 0xA13C7, 0xA13C8,
-  0xA13C9, 0xA13CA, 0xA13CB, 0xA13CC, 0xA13CD, 0xA13CE, 0xA13CF, 0xA13D0, 0xA13D1, 0xA13D2, 0xA13D3,
-  0xA13D4, 0xA13D5, 0xA13D6, 0xA13D7, 0xA13D8, 0xA13D9, 0xA13DA, 0xA13DB, 0xA13DC, 0xA13DD, 0xA13DE,
-  0xA13DF, 0xA13E0, 0xA13E1, 0xA13E2, 0xA13E3, 0xA13E4, 0xA13E5, 0xA13E6, 0xA13E7, 0xA13E8, 0xA13E9,
-  0xA13EA, 0xA13EB, 0xA13EC, 0xA13ED, 0xA13EE, 0xA13EF, 0x4010000, 0x4010000, 0x4010000, 0x4110000,
-  0x4110000, 0x82110000, 0x4110000, 0x4110000, 0x82110000, 0x4110000, 0x4110000, 0x4010000,
-  0x4110000, 0x82310000, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0,
-  0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0xA8C48, 0xA66F4, 0xA8ECA, 0xA8CC8,
-  0xA6ED1, 0xA4E32, 0xA53E5, 0xA9F9C, 0xA9F9C, 0xA5951, 0xA91D1, 0xA5587, 0xA5948, 0xA61F6, 0xA7669,
-  0xA7F85, 0xA863F, 0xA87BA, 0xA88F8, 0xA908F, 0xA6A02, 0xA6D1B, 0xA70D9, 0xA73DE, 0xA843D, 0xA916A,
-  0xA99F1, 0xA4E82, 0xA5375, 0xA6B04, 0xA721B, 0xA862D, 0xA9E1E, 0xA5D50, 0xA6FEB, 0xA85CD, 0xA8964,
-  0xA62C9, 0xA81D8, 0xA881F, 0xA5ECA, 0xA6717, 0xA6D6A, 0xA72FC, 0xA90CE, 0xA4F86, 0xA51B7, 0xA52DE,
-  0xA64C4, 0xA6AD3, 0xA7210, 0xA76E7, 0xA8001, 0xA8606, 0xA865C, 0xA8DEF, 0xA9732, 0xA9B6F, 0xA9DFA,
-  0xA788C, 0xA797F, 0xA7DA0, 0xA83C9, 0xA9304, 0xA9E7F, 0xA8AD6, 0xA58DF, 0xA5F04, 0xA7C60, 0xA807E,
-  0xA7262, 0xA78CA, 0xA8CC2, 0xA96F7, 0xA58D8, 0xA5C62, 0xA6A13, 0xA6DDA, 0xA6F0F, 0xA7D2F, 0xA7E37,
-  0xA964B, 0xA52D2, 0xA808B, 0xA51DC, 0xA51CC, 0xA7A1C, 0xA7DBE, 0xA83F1, 0xA9675, 0xA8B80, 0xA62CF,
-  0xA6A02, 0xA8AFE, 0xA4E39, 0xA5BE7, 0xA6012, 0xA7387, 0xA7570, 0xA5317, 0xA78FB, 0xA4FBF, 0xA5FA9,
-  0xA4E0D, 0xA6CCC, 0xA6578, 0xA7D22, 0xA53C3, 0xA585E, 0xA7701, 0xA8449, 0xA8AAA, 0xA6BBA, 0xA8FB0,
-  0xA6C88, 0xA62FE, 0xA82E5, 0xA63A0, 0xA7565, 0xA4EAE, 0xA5169, 0xA51C9, 0xA6881, 0xA7CE7, 0xA826F,
-  0xA8AD2, 0xA91CF, 0xA52F5, 0xA5442, 0xA5973, 0xA5EEC, 0xA65C5, 0xA6FFE, 0xA792A, 0xA95AD, 0xA9A6A,
-  0xA9E97, 0xA9ECE, 0xA529B, 0xA66C6, 0xA6B77, 0xA8F62, 0xA5E74, 0xA6190, 0xA6200, 0xA649A, 0xA6F23,
-  0xA7149, 0xA7489, 0xA79CA, 0xA7DF4, 0xA806F, 0xA8F26, 0xA84EE, 0xA9023, 0xA934A, 0xA5217, 0xA52A3,
-  0xA54BD, 0xA70C8, 0xA88C2, 0xA8AAA, 0xA5EC9, 0xA5FF5, 0xA637B, 0xA6BAE, 0xA7C3E, 0xA7375, 0xA4EE4,
-  0xA56F9, 0xA5BE7, 0xA5DBA, 0xA601C, 0xA73B2, 0xA7469, 0xA7F9A, 0xA8046, 0xA9234, 0xA96F6, 0xA9748,
-  0xA9818, 0xA4F8B, 0xA79AE, 0xA91B4, 0xA96B8, 0xA60E1, 0xA4E86, 0xA50DA, 0xA5BEE, 0xA5C3F, 0xA6599,
-  0xA6A02, 0xA71CE, 0xA7642, 0xA84FC, 0xA907C, 0xA9F8D, 0xA6688, 0xA962E, 0xA5289, 0xA677B, 0xA67F3,
-  0xA6D41, 0xA6E9C, 0xA7409, 0xA7559, 0xA786B, 0xA7D10, 0xA985E, 0xA516D, 0xA622E, 0xA9678, 0xA502B,
-  0xA5D19, 0xA6DEA, 0xA8F2A, 0xA5F8B, 0xA6144, 0xA6817, 0xA7387, 0xA9686, 0xA5229, 0xA540F, 0xA5C65,
-  0xA6613, 0xA674E, 0xA68A8, 0xA6CE5, 0xA7406, 0xA75E2, 0xA7F79, 0xA88CF, 0xA88E1, 0xA91CC, 0xA96E2,
-  0xA533F, 0xA6EBA, 0xA541D, 0xA71D0, 0xA7498, 0xA85FA, 0xA96A3, 0xA9C57, 0xA9E9F, 0xA6797, 0xA6DCB,
-  0xA81E8, 0xA7ACB, 0xA7B20, 0xA7C92, 0xA72C0, 0xA7099, 0xA8B58, 0xA4EC0, 0xA8336, 0xA523A, 0xA5207,
-  0xA5EA6, 0xA62D3, 0xA7CD6, 0xA5B85, 0xA6D1E, 0xA66B4, 0xA8F3B, 0xA884C, 0xA964D, 0xA898B, 0xA5ED3,
-  0xA5140, 0xA55C0, 0x4010000, 0x4010000, 0xA585A, 0x4010000, 0xA6674, 0x4010000, 0x4010000,
-  0xA51DE, 0xA732A, 0xA76CA, 0xA793C, 0xA795E, 0xA7965, 0xA798F, 0xA9756, 0xA7CBE, 0xA7FBD,
-  0x4010000, 0xA8612, 0x4010000, 0xA8AF8, 0x4010000, 0x4010000, 0xA9038, 0xA90FD, 0x4010000,
-  0x4010000, 0x4010000, 0xA98EF, 0xA98FC, 0xA9928, 0xA9DB4, 0xA90DE, 0xA96B7, 0xA4FAE, 0xA50E7,
-  0xA514D, 0xA52C9, 0xA52E4, 0xA5351, 0xA559D, 0xA5606, 0xA5668, 0xA5840, 0xA58A8, 0xA5C64, 0xA5C6E,
-  0xA6094, 0xA6168, 0xA618E, 0xA61F2, 0xA654F, 0xA65E2, 0xA6691, 0xA6885, 0xA6D77, 0xA6E1A, 0xA6F22,
-  0xA716E, 0xA722B, 0xA7422, 0xA7891, 0xA793E, 0xA7949, 0xA7948, 0xA7950, 0xA7956, 0xA795D, 0xA798D,
-  0xA798E, 0xA7A40, 0xA7A81, 0xA7BC0, 0xA7DF4, 0xA7E09, 0xA7E41, 0xA7F72, 0xA8005, 0xA81ED, 0xA8279,
-  0xA8279, 0xA8457, 0xA8910, 0xA8996, 0xA8B01, 0xA8B39, 0xA8CD3, 0xA8D08, 0xA8FB6, 0xA9038, 0xA96E3,
-  0xA97FF, 0xA983B, 0xA6075, 0x22875, 0xA8218, 0, 0, 0xA4E26, 0xA51B5, 0xA5168, 0xA4F80, 0xA5145,
-  0xA5180, 0xA52C7, 0xA52FA, 0xA559D, 0xA5555, 0xA5599, 0xA55E2, 0xA585A, 0xA58B3, 0xA5944, 0xA5954,
-  0xA5A62, 0xA5B28, 0xA5ED2, 0xA5ED9, 0xA5F69, 0xA5FAD, 0xA60D8, 0xA614E, 0xA6108, 0xA618E, 0xA6160,
-  0xA61F2, 0xA6234, 0xA63C4, 0xA641C, 0xA6452, 0xA6556, 0xA6674, 0xA6717, 0xA671B, 0xA6756, 0xA6B79,
-  0xA6BBA, 0xA6D41, 0xA6EDB, 0xA6ECB, 0xA6F22, 0xA701E, 0xA716E, 0xA77A7, 0xA7235, 0xA72AF, 0xA732A,
-  0xA7471, 0xA7506, 0xA753B, 0xA761D, 0xA761F, 0xA76CA, 0xA76DB, 0xA76F4, 0xA774A, 0xA7740, 0xA78CC,
-  0xA7AB1, 0xA7BC0, 0xA7C7B, 0xA7D5B, 0xA7DF4, 0xA7F3E, 0xA8005, 0xA8352, 0xA83EF, 0xA8779, 0xA8941,
-  0xA8986, 0xA8996, 0xA8ABF, 0xA8AF8, 0xA8ACB, 0xA8B01, 0xA8AFE, 0xA8AED, 0xA8B39, 0xA8B8A, 0xA8D08,
-  0xA8F38, 0xA9072, 0xA9199, 0xA9276, 0xA967C, 0xA96E3, 0xA9756, 0xA97DB, 0xA97FF, 0xA980B, 0xA983B,
-  0xA9B12, 0xA9F9C, 0x22876, 0x22877, 0x22878, 0xA3B9D, 0xA4018, 0xA4039, 0x22879, 0x2287A, 0x2287B,
-  0xA9F43, 0xA9F8E, 0, 0, 0, 0, 0, 0, 0x24298, 0x24299, 0x2429C, 0x26298, 0x2629B, 0x2483B, 0x2483B,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x2483D, 0x2483F, 0x24841, 0x24843, 0x24845, 0, 0, 0, 0, 0,
-  0x24847, 0x82110000, 0x24849, 0xA05E2, 0xA05D0, 0xA05D3, 0xA05D4, 0xA05DB, 0xA05DC, 0xA05DD,
-  0xA05E8, 0xA05EA, 0xA002B, 0x24579, 0x2457B, 0x26361, 0x26364, 0x2457D, 0x2457F, 0x24581, 0x24583,
-  0x24585, 0x24587, 0x2458B, 0x24597, 0x24599, 0, 0x2459B, 0x2459D, 0x2459F, 0x245A1, 0x245A3, 0,
-  0x245A5, 0, 0x245A7, 0x245A9, 0, 0x245AB, 0x2478D, 0, 0x2478F, 0x24791, 0x24793, 0x24361, 0x24795,
-  0x2484B, 0x2484D, 0x2484F, 0x24851, 0x2486F, 0xA0671, 0xA0671, 0xA067B, 0xA067B, 0xA067B, 0xA067B,
-  0xA067E, 0xA067E, 0xA067E, 0xA067E, 0xA0680, 0xA0680, 0xA0680, 0xA0680, 0xA067A, 0xA067A, 0xA067A,
-  0xA067A, 0xA067F, 0xA067F, 0xA067F, 0xA067F, 0xA0679, 0xA0679, 0xA0679, 0xA0679, 0xA06A4, 0xA06A4,
-  0xA06A4, 0xA06A4, 0xA06A6, 0xA06A6, 0xA06A6, 0xA06A6, 0xA0684, 0xA0684, 0xA0684, 0xA0684, 0xA0683,
-  0xA0683, 0xA0683, 0xA0683, 0xA0686, 0xA0686, 0xA0686, 0xA0686, 0xA0687, 0xA0687, 0xA0687, 0xA0687,
-  0xA068D, 0xA068D, 0xA068C, 0xA068C, 0xA068E, 0xA068E, 0xA0688, 0xA0688, 0xA0698, 0xA0698, 0xA0691,
-  0xA0691, 0xA06A9, 0xA06A9, 0xA06A9, 0xA06A9, 0xA06AF, 0xA06AF, 0xA06AF, 0xA06AF, 0xA06B3, 0xA06B3,
-  0xA06B3, 0xA06B3, 0xA06B1, 0xA06B1, 0xA06B1, 0xA06B1, 0xA06BA, 0xA06BA, 0xA06BB, 0xA06BB, 0xA06BB,
-  0xA06BB, 0xA06C0, 0xA06C0, 0xA06C1, 0xA06C1, 0xA06C1, 0xA06C1, 0xA06BE, 0xA06BE, 0xA06BE, 0xA06BE,
-  0xA06D2, 0xA06D2, 0xA06D3, 0xA06D3, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0xA06AD, 0xA06AD, 0xA06AD, 0xA06AD, 0xA06C7, 0xA06C7, 0xA06C6,
-  0xA06C6, 0xA06C8, 0xA06C8, 0x245D9, 0xA06CB, 0xA06CB, 0xA06C5, 0xA06C5, 0xA06C9, 0xA06C9, 0xA06D0,
-  0xA06D0, 0xA06D0, 0xA06D0, 0xA0649, 0xA0649, 0x24577, 0x24577, 0x24871, 0x24871, 0x2468F, 0x2468F,
-  0x24691, 0x24691, 0x24693, 0x24693, 0x24695, 0x24695, 0x24697, 0x24697, 0x24697, 0x24699, 0x24699,
-  0x24699, 0xA06CC, 0xA06CC, 0xA06CC, 0xA06CC, 0x2469B, 0x2469D, 0x2469F, 0x24699, 0x246A1, 0x246A3,
-  0x24514, 0x244B4, 0x246A5, 0x246A7, 0x246A9, 0x2440C, 0x2440F, 0x24415, 0x24418, 0x246AB, 0x246AD,
-  0x246AF, 0x246B1, 0x246B3, 0x246B5, 0x2442E, 0x2440D, 0x24410, 0x2410D, 0x24420, 0x246B7, 0x24416,
-  0x2442D, 0x2442A, 0x244D2, 0x24433, 0x2443C, 0x2443F, 0x246B9, 0x2444E, 0x24451, 0x246BB, 0x246BD,
-  0x24454, 0x246BF, 0x2445D, 0x24112, 0x246C1, 0x24466, 0x246C3, 0x246C5, 0x2446F, 0x24511, 0x246C7,
-  0x246C9, 0x246CB, 0x24472, 0x246CD, 0x246CF, 0x246D1, 0x246D3, 0x246D5, 0x246D7, 0x246D9, 0x244F9,
-  0x246DB, 0x246DD, 0x24481, 0x24478, 0x24484, 0x24010, 0x24001, 0x2400A, 0x24011, 0x2410C, 0x2441F,
-  0x2443A, 0x24428, 0x24425, 0x24400, 0x244A2, 0x246DF, 0x244AB, 0x246E1, 0x246E3, 0x246E5, 0x2449C,
-  0x246E7, 0x246E9, 0x244CB, 0x24426, 0x246B6, 0x2448F, 0x246EB, 0x244E3, 0x246ED, 0x246EF, 0x246F1,
-  0x263EE, 0x263F1, 0x263F4, 0x263F7, 0x263FA, 0x263FD, 0x246FD, 0x246FF, 0x2469F, 0x24701, 0x24699,
-  0x246A1, 0x2410A, 0x24703, 0x246A5, 0x24705, 0x246A7, 0x246A9, 0x24707, 0x24709, 0x24418, 0x2470B,
-  0x246AB, 0x246AD, 0x2470D, 0x2470F, 0x246B1, 0x24711, 0x246B3, 0x246B5, 0x246C7, 0x246C9, 0x246CD,
-  0x246CF, 0x246D1, 0x246D9, 0x244F9, 0x246DB, 0x246DD, 0x24010, 0x24001, 0x2400A, 0x24713, 0x2443A,
-  0x24715, 0x24717, 0x244AB, 0x24719, 0x246E1, 0x246E3, 0x246F1, 0x2471B, 0x2471D, 0x2448F, 0x244AD,
-  0x246EB, 0x244E3, 0x2469B, 0x2469D, 0x2471F, 0x2469F, 0x24721, 0x246A3, 0x24514, 0x244B4, 0x246A5,
-  0x24723, 0x2440C, 0x2440F, 0x24415, 0x24418, 0x24725, 0x246B1, 0x2442E, 0x2440D, 0x24410, 0x2410D,
-  0x24420, 0x24416, 0x2442D, 0x2442A, 0x244D2, 0x24433, 0x2443C, 0x24727, 0x2443F, 0x246B9, 0x2444E,
-  0x24451, 0x246BB, 0x246BD, 0x246BF, 0x2445D, 0x24112, 0x246C1, 0x24466, 0x246C3, 0x246C5, 0x2446F,
-  0x24511, 0x246CB, 0x24472, 0x246D3, 0x246D5, 0x246D7, 0x246D9, 0x244F9, 0x24481, 0x24478, 0x24484,
-  0x24010, 0x24006, 0x24011, 0x2410C, 0x2441F, 0x2443A, 0x24400, 0x244A2, 0x246DF, 0x244AB, 0x24729,
-  0x246E5, 0x2449C, 0x2472B, 0x244CB, 0x24426, 0x246B6, 0x2448F, 0x2400B, 0x2469F, 0x24721, 0x246A5,
-  0x24723, 0x24418, 0x24725, 0x246B1, 0x24873, 0x24433, 0x2472F, 0x24448, 0x24731, 0x246D9, 0x244F9,
-  0x24010, 0x244AB, 0x24729, 0x2448F, 0x2400B, 0x26403, 0x26406, 0x26409, 0x24737, 0x24739, 0x2473B,
-  0x2473D, 0x2473F, 0x24741, 0x24743, 0x24745, 0x24747, 0x24749, 0x2444F, 0x2447C, 0x24401, 0x24446,
-  0x244C1, 0x244B5, 0x2474B, 0x2474D, 0x2474F, 0x24751, 0x24445, 0x24442, 0x24753, 0x24448, 0x24755,
-  0x24757, 0x24759, 0x2475B, 0x24737, 0x24739, 0x2473B, 0x2473D, 0x2473F, 0x24741, 0x24743, 0x24745,
-  0x24747, 0x24749, 0x2444F, 0x2447C, 0x24401, 0x24446, 0x244C1, 0x244B5, 0x2474B, 0x2474D, 0x2474F,
-  0x24751, 0x24445, 0x24442, 0x24753, 0x24448, 0x24755, 0x24757, 0x24759, 0x2475B, 0x24445, 0x24442,
-  0x24753, 0x24448, 0x2472F, 0x24731, 0x24454, 0x2442D, 0x2442A, 0x244D2, 0x24445, 0x24442, 0x24753,
-  0x24454, 0x246BF, 0x2475D, 0x2475D, 0x40010000, 0x40010000, 0x2640C, 0x2640F, 0x2640F, 0x26412,
-  0x26415, 0x26418, 0x2641B, 0x2641E, 0x26421, 0x26421, 0x26424, 0x26427, 0x2642A, 0x2642D, 0x26430,
-  0x26433, 0x26433, 0x26436, 0x26439, 0x26439, 0x2643C, 0x2643C, 0x2643F, 0x26442, 0x26442, 0x26445,
-  0x26448, 0x26448, 0x2644B, 0x2644B, 0x2644E, 0x26451, 0x26451, 0x26454, 0x26454, 0x26457, 0x2645A,
-  0x2645D, 0x26460, 0x26460, 0x26463, 0x26466, 0x26469, 0x2646C, 0x2646F, 0x2646F, 0x26472, 0x26475,
-  0x26478, 0x2647B, 0x2647E, 0x26481, 0x26481, 0x26484, 0x26484, 0x26487, 0x26487, 0x2648A, 0x2610C,
-  0x2648D, 0x26490, 0x26493, 0x2641F, 0x26496, 0x40010000, 0x40010000, 0x26499, 0x2649C, 0x2649F,
-  0x264A2, 0x264A5, 0x264A8, 0x264A8, 0x26400, 0x264AB, 0x264AE, 0x264B1, 0x264B1, 0x264B4, 0x264B7,
-  0x264BA, 0x264BD, 0x264C0, 0x264C3, 0x264C6, 0x264C9, 0x264CC, 0x264CF, 0x264D2, 0x264D5, 0x264D8,
-  0x264DB, 0x264DE, 0x264E1, 0x264E4, 0x264E7, 0x264EA, 0x264ED, 0x264F0, 0x264F3, 0x26472, 0x26478,
-  0x264F6, 0x264F9, 0x264FC, 0x264FF, 0x26502, 0x26505, 0x26502, 0x264FC, 0x26508, 0x2650B, 0x2650E,
-  0x26511, 0x26514, 0x26505, 0x2645D, 0x2643F, 0x26517, 0x2651A, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x2651D, 0x26520, 0x28004, 0x28108,
-  0x2810C, 0x28110, 0x28114, 0x28009, 0x2800E, 0x26000, 0x2EB00, 0x2E112, 0x28120, 0x40010000,
-  0x40010000, 0x40010000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000,
-  0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0xA002C, 0xA3001, 0,
-  0xA003A, 0xA003B, 0xA0021, 0xA003F, 0xA3016, 0xA3017, 0, 0, 0, 0, 0, 0, 0, 0, 0xA2014, 0xA2013,
-  0xA005F, 0xA005F, 0xA0028, 0xA0029, 0xA007B, 0xA007D, 0xA3014, 0xA3015, 0xA3010, 0xA3011, 0xA300A,
-  0xA300B, 0xA3008, 0xA3009, 0xA300C, 0xA300D, 0xA300E, 0xA300F, 0x40010000, 0x40010000, 0xA005B,
-  0xA005D, 0x2458F, 0x2458F, 0x2458F, 0x2458F, 0xA005F, 0xA005F, 0xA005F, 0xA002C, 0xA3001, 0, 0,
-  0xA003B, 0xA003A, 0xA003F, 0xA0021, 0xA2014, 0xA0028, 0xA0029, 0xA007B, 0xA007D, 0xA3014, 0xA3015,
-  0xA0023, 0xA0026, 0xA002A, 0xA002B, 0xA002D, 0xA003C, 0xA003E, 0xA003D, 0, 0xA005C, 0xA0024,
-  0xA0025, 0xA0040, 0, 0, 0, 0, 0x24801, 0x24803, 0x243EE, 0x8010000, 0x243F1, 0, 0x243F4, 0x24403,
-  0x243F7, 0x24406, 0x243FA, 0x24409, 0x243FD, 0x24805, 0x24807, 0x24809, 0xA0621, 0xA0622, 0xA0622,
-  0xA0623, 0xA0623, 0xA0624, 0xA0624, 0xA0625, 0xA0625, 0xA0626, 0xA0626, 0xA0626, 0xA0626, 0xA0627,
-  0xA0627, 0xA0628, 0xA0628, 0xA0628, 0xA0628, 0xA0629, 0xA0629, 0xA062A, 0xA062A, 0xA062A, 0xA062A,
-  0xA062B, 0xA062B, 0xA062B, 0xA062B, 0xA062C, 0xA062C, 0xA062C, 0xA062C, 0xA062D, 0xA062D, 0xA062D,
-  0xA062D, 0xA062E, 0xA062E, 0xA062E, 0xA062E, 0xA062F, 0xA062F, 0xA0630, 0xA0630, 0xA0631, 0xA0631,
-  0xA0632, 0xA0632, 0xA0633, 0xA0633, 0xA0633, 0xA0633, 0xA0634, 0xA0634, 0xA0634, 0xA0634, 0xA0635,
-  0xA0635, 0xA0635, 0xA0635, 0xA0636, 0xA0636, 0xA0636, 0xA0636, 0xA0637, 0xA0637, 0xA0637, 0xA0637,
-  0xA0638, 0xA0638, 0xA0638, 0xA0638, 0xA0639, 0xA0639, 0xA0639, 0xA0639, 0xA063A, 0xA063A, 0xA063A,
-  0xA063A, 0xA0641, 0xA0641, 0xA0641, 0xA0641, 0xA0642, 0xA0642, 0xA0642, 0xA0642, 0xA0643, 0xA0643,
-  0xA0643, 0xA0643, 0xA0644, 0xA0644, 0xA0644, 0xA0644, 0xA0645, 0xA0645, 0xA0645, 0xA0645, 0xA0646,
-  0xA0646, 0xA0646, 0xA0646, 0xA0647, 0xA0647, 0xA0647, 0xA0647, 0xA0648, 0xA0648, 0xA0649, 0xA0649,
-  0xA064A, 0xA064A, 0xA064A, 0xA064A, 0x2480B, 0x2480B, 0x2480D, 0x2480D, 0x2480F, 0x2480F, 0x24016,
-  0x24016, 0, 0, 0x20000, 0, 0xA0021, 0xA0022, 0xA0023, 0xA0024, 0xA0025, 0xA0026, 0xA0027, 0xA0028,
-  0xA0029, 0xA002A, 0xA002B, 0xA002C, 0xA002D, 0xA002E, 0xA002F, 0xA0030, 0xA0031, 0xA0032, 0xA0033,
-  0xA0034, 0xA0035, 0xA0036, 0xA0037, 0xA0038, 0xA0039, 0xA003A, 0xA003B, 0xA003C, 0xA003D, 0xA003E,
-  0xA003F, 0xA0040, 0xA0061, 0xA0062, 0xA0063, 0xA0064, 0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069,
-  0xA006A, 0xA006B, 0xA006C, 0xA006D, 0xA006E, 0xA006F, 0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074,
-  0xA0075, 0xA0076, 0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA005B, 0xA005C, 0xA005D, 0xA005E, 0xA005F,
-  0xA0060, 0xA0061, 0xA0062, 0xA0063, 0xA0064, 0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069, 0xA006A,
-  0xA006B, 0xA006C, 0xA006D, 0xA006E, 0xA006F, 0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074, 0xA0075,
-  0xA0076, 0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA007B, 0xA007C, 0xA007D, 0xA007E, 0xA2985, 0xA2986,
-  0xA002E, 0xA300C, 0xA300D, 0xA3001, 0xA30FB, 0xA30F2, 0xA30A1, 0xA30A3, 0xA30A5, 0xA30A7, 0xA30A9,
-  0xA30E3, 0xA30E5, 0xA30E7, 0xA30C3, 0xA30FC, 0xA30A2, 0xA30A4, 0xA30A6, 0xA30A8, 0xA30AA, 0xA30AB,
-  0xA30AD, 0xA30AF, 0xA30B1, 0xA30B3, 0xA30B5, 0xA30B7, 0xA30B9, 0xA30BB, 0xA30BD, 0xA30BF, 0xA30C1,
-  0xA30C4, 0xA30C6, 0xA30C8, 0xA30CA, 0xA30CB, 0xA30CC, 0xA30CD, 0xA30CE, 0xA30CF, 0xA30D2, 0xA30D5,
-  0xA30D8, 0xA30DB, 0xA30DE, 0xA30DF, 0xA30E0, 0xA30E1, 0xA30E2, 0xA30E4, 0xA30E6, 0xA30E8, 0xA30E9,
-  0xA30EA, 0xA30EB, 0xA30EC, 0xA30ED, 0xA30EF, 0xA30F3, 0xA3099, 0xA309A, 0x20000, 0xA1100, 0xA1101,
-  0xA11AA, 0xA1102, 0xA11AC, 0xA11AD, 0xA1103, 0xA1104, 0xA1105, 0xA11B0, 0xA11B1, 0xA11B2, 0xA11B3,
-  0xA11B4, 0xA11B5, 0xA111A, 0xA1106, 0xA1107, 0xA1108, 0xA1121, 0xA1109, 0xA110A, 0xA110B, 0xA110C,
-  0xA110D, 0xA110E, 0xA110F, 0xA1110, 0xA1111, 0xA1112, 0, 0, 0, 0xA1161, 0xA1162, 0xA1163, 0xA1164,
-  0xA1165, 0xA1166, 0, 0, 0xA1167, 0xA1168, 0xA1169, 0xA116A, 0xA116B, 0xA116C, 0, 0, 0xA116D,
-  0xA116E, 0xA116F, 0xA1170, 0xA1171, 0xA1172, 0, 0, 0xA1173, 0xA1174, 0xA1175, 0, 0, 0, 0xA00A2,
-  0xA00A3, 0xA00AC, 0x24653, 0xA00A6, 0xA00A5, 0xA20A9, 0, 0xA2502, 0xA2190, 0xA2191, 0xA2192,
-  0xA2193, 0xA25A0, 0xA25CB, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x40010000,
-  0x4010000, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x4010000, 0x4010000, 0, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0x40010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0, 0, 0x82110000,
-  0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000,
-  0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000,
-  0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000, 0x20010000,
-  0x20010000, 0x20010000, 0x20010000, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x2287C, 0x2287D, 0x2287E, 0x2287F, 0x22880, 0x22881, 0x22882,
-  0x22883, 0x22884, 0x22885, 0x22886, 0x22887, 0x22888, 0x22889, 0x2288A, 0x2288B, 0x2288C, 0x2288D,
-  0x2288E, 0x2288F, 0x22890, 0x22891, 0x22892, 0x22893, 0x22894, 0x22895, 0x22896, 0x22897, 0x22898,
-  0x22899, 0x2289A, 0x2289B, 0x2289C, 0x2289D, 0x2289E, 0x2289F, 0x228A0, 0x228A1, 0x228A2, 0x228A3,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x228A4,
-  0x228A5, 0x228A6, 0x228A7, 0x228A8, 0x228A9, 0x228AA, 0x228AB, 0x228AC, 0x228AD, 0x228AE, 0x228AF,
-  0x228B0, 0x228B1, 0x228B2, 0x228B3, 0x228B4, 0x228B5, 0x228B6, 0x228B7, 0x228B8, 0x228B9, 0x228BA,
-  0x228BB, 0x228BC, 0x228BD, 0x228BE, 0x228BF, 0x228C0, 0x228C1, 0x228C2, 0x228C3, 0x228C4, 0x228C5,
-  0x228C6, 0x228C7, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x4010000, 0x228C8, 0x228C9, 0x228CA, 0x228CB, 0x228CC, 0x228CD, 0x228CE, 0x228CF, 0x228D0,
-  0x228D1, 0x228D2, 0, 0x228D3, 0x228D4, 0x228D5, 0x228D6, 0x228D7, 0x228D8, 0x228D9, 0x228DA,
-  0x228DB, 0x228DC, 0x228DD, 0x228DE, 0x228DF, 0x228E0, 0x228E1, 0, 0x228E2, 0x228E3, 0x228E4,
-  0x228E5, 0x228E6, 0x228E7, 0x228E8, 0, 0x228E9, 0x228EA, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000,
-  0x4010000, 0, 0, 0, 0x4010000, 0xA02D0, 0xA02D1, 0xA00E6, 0xA0299, 0xA0253, 0, 0xA02A3, 0xAAB66,
-  0xA02A5, 0xA02A4, 0xA0256, 0xA0257, 0xA1D91, 0xA0258, 0xA025E, 0xA02A9, 0xA0264, 0xA0262, 0xA0260,
-  0xA029B, 0xA0127, 0xA029C, 0xA0267, 0xA0284, 0xA02AA, 0xA02AB, 0xA026C, 0x228EB, 0xAA78E, 0xA026E,
-  0x228EC, 0xA028E, 0x228ED, 0xA00F8, 0xA0276, 0xA0277, 0xA0071, 0xA027A, 0x228EE, 0xA027D, 0xA027E,
-  0xA0280, 0xA02A8, 0xA02A6, 0xAAB67, 0xA02A7, 0xA0288, 0xA2C71, 0, 0xA028F, 0xA02A1, 0xA02A2,
-  0xA0298, 0xA01C0, 0xA01C1, 0xA01C2, 0x228EF, 0x228F0, 0, 0, 0, 0, 0, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0x8010000, 0, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0, 0x8010000, 0x8010000, 0, 0, 0, 0x8010000, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0, 0, 0, 0, 0, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0, 0x8010000, 0x8010000, 0, 0, 0, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0, 0, 0, 0x40010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0, 0, 0, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0, 0, 0, 0, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0, 0, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x82110000, 0x82110000, 0x82110000, 0,
-  0x82110000, 0x82110000, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0, 0x8010000, 0x8010000, 0x8010000, 0, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0, 0, 0x82110000, 0x82110000, 0x82110000, 0, 0, 0, 0, 0x82310000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0,
-  0, 0, 0, 0, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x9010000, 0x8010000,
-  0x9010000, 0x8010000, 0x9010000, 0x9010000, 0x8010000, 0x8010000, 0x8810000, 0x9010000, 0x9010000,
-  0x9010000, 0x9010000, 0x9010000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8810000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x9010000, 0x8410000, 0x8410000, 0x8410000, 0x9010000,
-  0x8010000, 0x8010000, 0x9010000, 0x82110000, 0x82110000, 0, 0, 0, 0, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x9010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0, 0, 0, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0, 0, 0, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8410000, 0x9010000, 0x8410000, 0x9010000, 0x9010000, 0x9010000, 0x8410000,
-  0x8410000, 0x8410000, 0x9010000, 0x8410000, 0x8410000, 0x9010000, 0x8410000, 0x9010000, 0x9010000,
-  0x8410000, 0x9010000, 0, 0, 0, 0, 0, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0x9010000, 0x9010000, 0x9010000, 0x9010000, 0x8410000, 0x8410000,
-  0x8010000, 0x228F1, 0x228F2, 0x228F3, 0x228F4, 0x228F5, 0x228F6, 0x228F7, 0x228F8, 0x228F9,
-  0x228FA, 0x228FB, 0x228FC, 0x228FD, 0x228FE, 0x228FF, 0x22900, 0x22901, 0x22902, 0x22903, 0x22904,
-  0x22905, 0x22906, 0x22907, 0x22908, 0x22909, 0x2290A, 0x2290B, 0x2290C, 0x2290D, 0x2290E, 0x2290F,
-  0x22910, 0x22911, 0x22912, 0x22913, 0x22914, 0x22915, 0x22916, 0x22917, 0x22918, 0x22919, 0x2291A,
-  0x2291B, 0x2291C, 0x2291D, 0x2291E, 0x2291F, 0x22920, 0x22921, 0x22922, 0x22923, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0, 0, 0, 0, 0, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8810000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x9010000, 0x8410000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0x10010000, 0x10010000, 0x10010000, 0x10010000,
-  0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0, 0, 0, 0, 0, 0,
-  0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000,
-  0x10010000, 0x10010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x22924,
-  0x22925, 0x22926, 0x22927, 0x22928, 0x22929, 0x2292A, 0x2292B, 0x2292C, 0x2292D, 0x2292E, 0x2292F,
-  0x22930, 0x22931, 0x22932, 0x22933, 0x22934, 0x22935, 0x22936, 0x22937, 0x22938, 0x22939, 0, 0, 0,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x40010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0, 0, 0, 0, 0, 0, 0x8010000,
-  0x8010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000,
-  0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000,
-  0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000,
-  0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0x10010000, 0,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0, 0x82110000, 0x82110000, 0x8010000, 0, 0, 0x8010000, 0x8010000, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0x9010000, 0x8410000, 0x8410000, 0x8010000, 0x8410000, 0x8410000, 0, 0,
-  0, 0, 0, 0, 0, 0, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0, 0, 0, 0, 0, 0, 0x8410000,
-  0x8410000, 0x8410000, 0x9010000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x8410000, 0x8410000,
-  0x8410000, 0x9010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0, 0, 0, 0,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x9010000, 0x9010000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0,
-  0, 0, 0, 0, 0x8410000, 0x8010000, 0x8410000, 0x8410000, 0x9010000, 0x9010000, 0x9010000,
-  0x8010000, 0x8410000, 0x9010000, 0x9010000, 0x8410000, 0x8410000, 0x9010000, 0x8410000, 0x8410000,
-  0x8010000, 0x8410000, 0x9010000, 0x9010000, 0x8410000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x9010000, 0x8410000, 0x8810000, 0, 0, 0, 0, 0x4110000, 0x82110000, 0x4110000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82310000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0,
-  0, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x82310000, 0x4010000,
-  0x4010000, 0x82110000, 0x82110000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82310000, 0x4110000,
-  0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4110000,
-  0x82310000, 0x82110000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x82110000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82310000, 0x82310000, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x4010000, 0, 0, 0,
-  0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x4110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x4110000, 0x4310000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4010000, 0x4110000, 0x82110000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000,
-  0x82110000, 0x4110000, 0x4110000, 0x82110000, 0x4310000, 0x82110000, 0x82110000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4010000, 0x4010000,
-  0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000,
-  0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82310000, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x4110000, 0x4110000,
-  0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0,
-  0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0, 0x82110000, 0x82110000, 0x4010000, 0x4110000, 0x4110000, 0x82110000, 0x4110000,
-  0x4110000, 0x4110000, 0x4110000, 0, 0, 0x4110000, 0x4110000, 0, 0, 0x4110000, 0x4110000,
-  0x4310000, 0, 0, 0x4010000, 0, 0, 0, 0, 0, 0, 0x4110000, 0, 0, 0, 0, 0, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4110000, 0, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0, 0,
-  0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000,
-  0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0, 0x4110000, 0, 0, 0x4110000, 0, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0,
-  0x4110000, 0x4110000, 0x82310000, 0x4310000, 0x82310000, 0x4010000, 0x82110000, 0x4010000,
-  0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4110000, 0x82310000, 0x82110000, 0x82110000,
-  0x4110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x82110000,
-  0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4110000, 0x4110000,
-  0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000,
-  0x82110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x4110000,
-  0x82310000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x4110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0, 0x4110000, 0x4110000, 0x4110000, 0x4110000,
-  0x82110000, 0x82110000, 0x4110000, 0x82310000, 0x82110000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0, 0,
-  0x4110000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4110000, 0x82110000, 0x4110000, 0x82310000,
-  0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x82110000, 0x4110000, 0x82110000, 0x4110000, 0x4110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4310000, 0x82110000, 0x4010000,
-  0x4010000, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x82110000, 0x4110000, 0x82110000,
-  0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82310000, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x82310000, 0x82110000,
-  0x4010000, 0, 0, 0, 0, 0x2293A, 0x2293B, 0x2293C, 0x2293D, 0x2293E, 0x2293F, 0x22940, 0x22941,
-  0x22942, 0x22943, 0x22944, 0x22945, 0x22946, 0x22947, 0x22948, 0x22949, 0x2294A, 0x2294B, 0x2294C,
-  0x2294D, 0x2294E, 0x2294F, 0x22950, 0x22951, 0x22952, 0x22953, 0x22954, 0x22955, 0x22956, 0x22957,
-  0x22958, 0x22959, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x4010000, 0,
-  0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0,
-  0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0,
-  0x4110000, 0x4110000, 0, 0, 0x82110000, 0x82110000, 0x4310000, 0x82310000, 0x4010000, 0x4110000,
-  0x4010000, 0x4110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4110000,
-  0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0, 0x82110000, 0x82110000,
-  0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x82310000, 0x4010000, 0x4010000, 0x4010000,
-  0x4110000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x6110000, 0x6110000, 0x82110000, 0x82110000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000,
-  0x82310000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4010000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x82310000, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4110000, 0x82110000,
-  0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x82110000, 0x82310000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000,
-  0x4110000, 0x82110000, 0x4110000, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x4110000, 0x6310000, 0, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x82110000, 0x82110000, 0x4110000, 0x82110000,
-  0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0,
-  0, 0, 0x82110000, 0, 0x82110000, 0x82110000, 0, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82310000, 0x82310000, 0x4010000, 0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x4110000,
-  0x4110000, 0x4110000, 0, 0x82110000, 0x82110000, 0, 0x4110000, 0x4110000, 0x82110000, 0x4110000,
-  0x82310000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x82110000,
-  0x82110000, 0x4110000, 0x4110000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0x82110000,
-  0x82110000, 0x4010000, 0x4110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0, 0, 0, 0x4110000, 0x4110000, 0x82110000, 0x4310000, 0x82310000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0, 0, 0, 0, 0, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x82110000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4110000, 0x4110000, 0x4110000,
-  0x82110000, 0x82110000, 0x82310000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x2295A, 0x2295B, 0x2295C, 0x2295D,
-  0x2295E, 0x2295F, 0x22960, 0x22961, 0x22962, 0x22963, 0x22964, 0x22965, 0x22966, 0x22967, 0x22968,
-  0x22969, 0x2296A, 0x2296B, 0x2296C, 0x2296D, 0x2296E, 0x2296F, 0x22970, 0x22971, 0x22972, 0x22973,
-  0x22974, 0x22975, 0x22976, 0x22977, 0x22978, 0x22979, 0x2297A, 0x2297B, 0x2297C, 0x2297D, 0x2297E,
-  0x2297F, 0x22980, 0x22981, 0x22982, 0x22983, 0x22984, 0x22985, 0x22986, 0x22987, 0x22988, 0x22989,
-  0x2298A, 0x2298B, 0x2298C, 0x2298D, 0x2298E, 0x2298F, 0x22990, 0x22991, 0x22992, 0, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0x82110000,
-  0x4010000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000,
-  0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000,
-  0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000,
-  0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000, 0x4110000,
-  0x4110000, 0x4110000, 0x4110000, 0x4110000, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x4010000, 0x4010000,
-  0x40010000, 0x4010000, 0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4110000, 0x4110000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0, 0,
-  0, 0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0, 0,
-  0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x4010000, 0x82110000, 0x82110000, 0x4010000,
-  0x20000, 0x20000, 0x20000, 0x20000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0xA0061, 0xA0062, 0xA0063, 0xA0064, 0xA0065,
-  0xA0066, 0xA0067, 0xA0068, 0xA0069, 0xA006A, 0xA0030, 0xA0031, 0xA0032, 0xA0033, 0xA0034, 0xA0035,
-  0xA0036, 0xA0037, 0xA0038, 0xA0039, 0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0, 0, 0, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x24811, 0x2453E,
-  0x2653E, 0x26541, 0x26544, 0x26547, 0x2654A, 0x4110000, 0x4110000, 0x82110000, 0x82110000,
-  0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4110000, 0x4110000, 0x4110000, 0x4110000,
-  0x4110000, 0x4110000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000, 0x20000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x4010000, 0x4010000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x2454D,
-  0x24550, 0x2654D, 0x26550, 0x26553, 0x26556, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x40010000, 0x40010000, 0, 0, 0, 0, 0, 0x40010000, 0x40010000, 0x82110000,
-  0x82110000, 0x82110000, 0x40010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xA0071, 0xA0072, 0xA0073,
-  0xA0074, 0xA0075, 0xA0076, 0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA0061, 0xA0062, 0xA0063, 0xA0064,
-  0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069, 0xA006A, 0xA006B, 0xA006C, 0xA006D, 0xA006E, 0xA006F,
-  0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074, 0xA0075, 0xA0076, 0xA0077, 0xA0078, 0xA0079, 0xA007A,
-  0xA0061, 0xA0062, 0xA0063, 0xA0064, 0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069, 0xA006A, 0xA006B,
-  0xA006C, 0xA006D, 0xA006E, 0xA006F, 0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074, 0xA0075, 0xA0076,
-  0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA0061, 0xA0062, 0xA0063, 0xA0064, 0xA0065, 0xA0066, 0xA0067,
-  0, 0xA0069, 0xA006A, 0xA006B, 0xA006C, 0xA006D, 0xA006E, 0xA006F, 0xA0070, 0xA0071, 0xA0072,
-  0xA0073, 0xA0074, 0xA0075, 0xA0076, 0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA0061, 0xA0062, 0xA0063,
-  0xA0064, 0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069, 0xA006A, 0xA006B, 0xA006C, 0xA006D, 0xA006E,
-  0xA006F, 0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074, 0xA0075, 0xA0076, 0xA0077, 0xA0078, 0xA0079,
-  0xA007A, 0xA0061, 0xA0062, 0xA0063, 0xA0064, 0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069, 0xA006A,
-  0xA006B, 0xA006C, 0xA006D, 0xA006E, 0xA006F, 0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074, 0xA0075,
-  0xA0076, 0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA0061, 0, 0xA0063, 0xA0064, 0, 0, 0xA0067, 0, 0,
-  0xA006A, 0xA006B, 0, 0, 0xA006E, 0xA006F, 0xA0070, 0xA0071, 0, 0xA0073, 0xA0074, 0xA0075, 0xA0076,
-  0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA0061, 0xA0062, 0xA0063, 0xA0064, 0, 0xA0066, 0, 0xA0068,
-  0xA0069, 0xA006A, 0xA006B, 0xA006C, 0xA006D, 0xA006E, 0, 0xA0070, 0xA0071, 0xA0072, 0xA0073,
-  0xA0074, 0xA0075, 0xA0076, 0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA0077, 0xA0078, 0xA0079, 0xA007A,
-  0xA0061, 0xA0062, 0, 0xA0064, 0xA0065, 0xA0066, 0xA0067, 0, 0, 0xA006A, 0xA006B, 0xA006C, 0xA006D,
-  0xA006E, 0xA006F, 0xA0070, 0xA0071, 0, 0xA0073, 0xA0074, 0xA0075, 0xA0076, 0xA0077, 0xA0078,
-  0xA0079, 0, 0xA0061, 0xA0062, 0xA0063, 0xA0064, 0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069,
-  0xA006A, 0xA006B, 0xA006C, 0xA006D, 0xA006E, 0xA006F, 0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074,
-  0xA0075, 0xA0076, 0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA0061, 0xA0062, 0, 0xA0064, 0xA0065,
-  0xA0066, 0xA0067, 0, 0xA0069, 0xA006A, 0xA006B, 0xA006C, 0xA006D, 0, 0xA006F, 0, 0, 0, 0xA0073,
-  0xA0074, 0xA0075, 0xA0076, 0xA0077, 0xA0078, 0xA0079, 0, 0xA0061, 0xA0062, 0xA0063, 0xA0064,
-  0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069, 0xA006A, 0xA006B, 0xA006C, 0xA006D, 0xA006E, 0xA006F,
-  0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074, 0xA0075, 0xA0076, 0xA0077, 0xA0078, 0xA0079, 0xA007A,
-  0xA0061, 0xA0062, 0xA0063, 0xA0064, 0xA0065, 0xA0066, 0xA0067, 0xA0068, 0xA0069, 0xA006A, 0xA006B,
-  0xA006C, 0xA006D, 0xA006E, 0xA006F, 0xA0070, 0xA0071, 0xA0072, 0xA0073, 0xA0074, 0xA0075, 0xA0076,
-  0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA0061, 0xA0062, 0xA0063, 0xA0064, 0xA0065, 0xA0066, 0xA0067,
-  0xA0068, 0xA0069, 0xA006A, 0xA0077, 0xA0078, 0xA0079, 0xA007A, 0xA0131, 0xA0237, 0, 0, 0xA03B1,
-  0xA03B2, 0xA03B3, 0xA03B4, 0xA03B5, 0xA03B6, 0xA03B7, 0xA03B8, 0xA03B9, 0xA03BA, 0xA03BB, 0xA03BC,
-  0xA03BD, 0xA03BE, 0xA03BF, 0xA03C0, 0xA03C1, 0xA03B8, 0xA03C3, 0xA03C4, 0xA03C5, 0xA03C6, 0xA03C7,
-  0xA03C8, 0xA03C9, 0xA2207, 0xA03B1, 0xA03B2, 0xA03B3, 0xA03B4, 0xA03B5, 0xA03B6, 0xA03B7, 0xA03B8,
-  0xA03B9, 0xA03BA, 0xA03BB, 0xA03BC, 0xA03BD, 0xA03BE, 0xA03BF, 0xA03C0, 0xA03C1, 0xA03C3, 0xA03C3,
-  0xA03C4, 0xA03C5, 0xA03C6, 0xA03C7, 0xA03C8, 0xA03C9, 0xA2202, 0xA03B5, 0xA03B8, 0xA03BA, 0xA03C6,
-  0xA03C1, 0xA03C0, 0xA03B1, 0xA03B2, 0xA03B3, 0xA03B4, 0xA03B5, 0xA03B6, 0xA03B7, 0xA03B8, 0xA03B9,
-  0xA03BA, 0xA03BB, 0xA03BC, 0xA03BD, 0xA03BE, 0xA03BF, 0xA03C0, 0xA03C1, 0xA03B8, 0xA03C3, 0xA03C4,
-  0xA03C5, 0xA03C6, 0xA03C7, 0xA03C8, 0xA03C9, 0xA2207, 0xA03B1, 0xA03B2, 0xA03B3, 0xA03B4, 0xA03B5,
-  0xA03B6, 0xA03B7, 0xA03B8, 0xA03B9, 0xA03BA, 0xA03BB, 0xA03BC, 0xA03BD, 0xA03BE, 0xA03BF, 0xA03C0,
-  0xA03C1, 0xA03C3, 0xA03C3, 0xA03C4, 0xA03C5, 0xA03C6, 0xA03C7, 0xA03C8, 0xA03C9, 0xA2202, 0xA03B5,
-  0xA03B8, 0xA03BA, 0xA03C6, 0xA03C1, 0xA03C0, 0xA03B1, 0xA03B2, 0xA03B3, 0xA03B4, 0xA03B5, 0xA03B6,
-  0xA03B7, 0xA03B8, 0xA03B9, 0xA03BA, 0xA03BB, 0xA03BC, 0xA03BD, 0xA03BE, 0xA03BF, 0xA03C0, 0xA03C1,
-  0xA03B8, 0xA03C3, 0xA03C4, 0xA03C5, 0xA03C6, 0xA03C7, 0xA03C8, 0xA03C9, 0xA2207, 0xA03B1, 0xA03B2,
-  0xA03B3, 0xA03B4, 0xA03B5, 0xA03B6, 0xA03B7, 0xA03B8, 0xA03B9, 0xA03BA, 0xA03BB, 0xA03BC, 0xA03BD,
-  0xA03BE, 0xA03BF, 0xA03C0, 0xA03C1, 0xA03C3, 0xA03C3, 0xA03C4, 0xA03C5, 0xA03C6, 0xA03C7, 0xA03C8,
-  0xA03C9, 0xA2202, 0xA03B5, 0xA03B8, 0xA03BA, 0xA03C6, 0xA03C1, 0xA03C0, 0xA03B1, 0xA03B2, 0xA03B3,
-  0xA03B4, 0xA03B5, 0xA03B6, 0xA03B7, 0xA03B8, 0xA03B9, 0xA03BA, 0xA03BB, 0xA03BC, 0xA03BD, 0xA03BE,
-  0xA03BF, 0xA03C0, 0xA03C1, 0xA03B8, 0xA03C3, 0xA03C4, 0xA03C5, 0xA03C6, 0xA03C7, 0xA03C8, 0xA03C9,
-  0xA2207, 0xA03B1, 0xA03B2, 0xA03B3, 0xA03B4, 0xA03B5, 0xA03B6, 0xA03B7, 0xA03B8, 0xA03B9, 0xA03BA,
-  0xA03BB, 0xA03BC, 0xA03BD, 0xA03BE, 0xA03BF, 0xA03C0, 0xA03C1, 0xA03C3, 0xA03C3, 0xA03C4, 0xA03C5,
-  0xA03C6, 0xA03C7, 0xA03C8, 0xA03C9, 0xA2202, 0xA03B5, 0xA03B8, 0xA03BA, 0xA03C6, 0xA03C1, 0xA03C0,
-  0xA03C1, 0xA03B8, 0xA03C3, 0xA03C4, 0xA03C5, 0xA03C6, 0xA03C7, 0xA03C8, 0xA03C9, 0xA2207, 0xA03B1,
-  0xA03B2, 0xA03B3, 0xA03B4, 0xA03B5, 0xA03B6, 0xA03B7, 0xA03B8, 0xA03B9, 0xA03BA, 0xA03BB, 0xA03BC,
-  0xA03BD, 0xA03BE, 0xA03BF, 0xA03C0, 0xA03C1, 0xA03C3, 0xA03C3, 0xA03C4, 0xA03C5, 0xA03C6, 0xA03C7,
-  0xA03C8, 0xA03C9, 0xA2202, 0xA03B5, 0xA03B8, 0xA03BA, 0xA03C6, 0xA03C1, 0xA03C0, 0xA03DD, 0xA03DD,
-  0, 0, 0xA0030, 0xA0031, 0xA0032, 0xA0033, 0xA0034, 0xA0035, 0xA0036, 0xA0037, 0xA0038, 0xA0039,
-  0xA0030, 0xA0031, 0xA0032, 0xA0033, 0xA0034, 0xA0035, 0xA0036, 0xA0037, 0xA0038, 0xA0039, 0xA0030,
-  0xA0031, 0xA0032, 0xA0033, 0xA0034, 0xA0035, 0xA0036, 0xA0037, 0xA0038, 0xA0039, 0xA0030, 0xA0031,
-  0xA0032, 0xA0033, 0xA0034, 0xA0035, 0xA0036, 0xA0037, 0xA0038, 0xA0039, 0xA0030, 0xA0031, 0xA0032,
-  0xA0033, 0xA0034, 0xA0035, 0xA0036, 0xA0037, 0xA0038, 0xA0039, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0, 0, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0, 0x82110000, 0x82110000, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0, 0, 0, 0, 0, 0xA0430, 0xA0431, 0xA0432, 0xA0433, 0xA0434, 0xA0435,
-  0xA0436, 0xA0437, 0xA0438, 0xA043A, 0xA043B, 0xA043C, 0xA043E, 0xA043F, 0xA0440, 0xA0441, 0xA0442,
-  0xA0443, 0xA0444, 0xA0445, 0xA0446, 0xA0447, 0xA0448, 0xA044B, 0xA044D, 0xA044E, 0xAA689, 0xA04D9,
-  0xA0456, 0xA0458, 0xA04E9, 0xA04AF, 0xA04CF, 0xA0430, 0xA0431, 0xA0432, 0xA0433, 0xA0434, 0xA0435,
-  0xA0436, 0xA0437, 0xA0438, 0xA043A, 0xA043B, 0xA043E, 0xA043F, 0xA0441, 0xA0443, 0xA0444, 0xA0445,
-  0xA0446, 0xA0447, 0xA0448, 0xA044A, 0xA044B, 0xA0491, 0xA0456, 0xA0455, 0xA045F, 0xA04AB, 0xAA651,
-  0xA04B1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x82110000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x82110000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x82110000,
-  0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0, 0, 0, 0, 0x40010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0x4010000, 0x4010000,
-  0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x82110000, 0x82110000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x82110000, 0, 0,
-  0, 0, 0, 0, 0, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0, 0x4010000, 0x4010000, 0,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0, 0, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x22993, 0x22994, 0x22995,
-  0x22996, 0x22997, 0x22998, 0x22999, 0x2299A, 0x2299B, 0x2299C, 0x2299D, 0x2299E, 0x2299F, 0x229A0,
-  0x229A1, 0x229A2, 0x229A3, 0x229A4, 0x229A5, 0x229A6, 0x229A7, 0x229A8, 0x229A9, 0x229AA, 0x229AB,
-  0x229AC, 0x229AD, 0x229AE, 0x229AF, 0x229B0, 0x229B1, 0x229B2, 0x229B3, 0x229B4, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000, 0x8410000,
-  0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0x82110000, 0xA010000, 0,
-  0, 0, 0, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0, 0, 0, 0, 0x8010000, 0x8010000, 0, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000, 0x8010000,
-  0x8010000, 0x8010000, 0x8010000, 0xA0627, 0xA0628, 0xA062C, 0xA062F, 0, 0xA0648, 0xA0632, 0xA062D,
-  0xA0637, 0xA064A, 0xA0643, 0xA0644, 0xA0645, 0xA0646, 0xA0633, 0xA0639, 0xA0641, 0xA0635, 0xA0642,
-  0xA0631, 0xA0634, 0xA062A, 0xA062B, 0xA062E, 0xA0630, 0xA0636, 0xA0638, 0xA063A, 0xA066E, 0xA06BA,
-  0xA06A1, 0xA066F, 0, 0xA0628, 0xA062C, 0, 0xA0647, 0, 0, 0xA062D, 0, 0xA064A, 0xA0643, 0xA0644,
-  0xA0645, 0xA0646, 0xA0633, 0xA0639, 0xA0641, 0xA0635, 0xA0642, 0, 0xA0634, 0xA062A, 0xA062B,
-  0xA062E, 0, 0xA0636, 0, 0xA063A, 0, 0, 0, 0, 0, 0, 0xA062C, 0, 0, 0, 0, 0xA062D, 0, 0xA064A, 0,
-  0xA0644, 0, 0xA0646, 0xA0633, 0xA0639, 0, 0xA0635, 0xA0642, 0, 0xA0634, 0, 0, 0xA062E, 0, 0xA0636,
-  0, 0xA063A, 0, 0xA06BA, 0, 0xA066F, 0, 0xA0628, 0xA062C, 0, 0xA0647, 0, 0, 0xA062D, 0xA0637,
-  0xA064A, 0xA0643, 0, 0xA0645, 0xA0646, 0xA0633, 0xA0639, 0xA0641, 0xA0635, 0xA0642, 0, 0xA0634,
-  0xA062A, 0xA062B, 0xA062E, 0, 0xA0636, 0xA0638, 0xA063A, 0xA066E, 0, 0xA06A1, 0, 0xA0627, 0xA0628,
-  0xA062C, 0xA062F, 0xA0647, 0xA0648, 0xA0632, 0xA062D, 0xA0637, 0xA064A, 0, 0xA0644, 0xA0645,
-  0xA0646, 0xA0633, 0xA0639, 0xA0641, 0xA0635, 0xA0642, 0xA0631, 0xA0634, 0xA062A, 0xA062B, 0xA062E,
-  0xA0630, 0xA0636, 0xA0638, 0xA063A, 0, 0, 0, 0, 0, 0xA0628, 0xA062C, 0xA062F, 0, 0xA0648, 0xA0632,
-  0xA062D, 0xA0637, 0xA064A, 0, 0xA0644, 0xA0645, 0xA0646, 0xA0633, 0xA0639, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0, 0, 0, 0, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0, 0, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0, 0x2481D, 0x2481F, 0x24821, 0x24823, 0x24825, 0x24827, 0x24829, 0x2482B, 0x2482D,
-  0x2482F, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x2636A, 0x2636D, 0x26370,
-  0x26373, 0x26376, 0x26379, 0x2637C, 0x2637F, 0x26382, 0x26385, 0x26388, 0x2638B, 0x2638E, 0x26391,
-  0x26394, 0x26397, 0x2639A, 0x2639D, 0x263A0, 0x263A3, 0x263A6, 0x263A9, 0x263AC, 0x263AF, 0x263B2,
-  0x263B5, 0x26559, 0xA0063, 0xA0072, 0x24765, 0x24859, 0x40010000, 0xA0071, 0xA0072, 0xA0073,
-  0xA0074, 0xA0075, 0xA0076, 0xA0077, 0xA0078, 0xA0079, 0xA007A, 0x2485B, 0x24633, 0x2485D, 0x24664,
-  0x2655C, 0x24861, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x24863, 0x24865, 0x24867, 0x40010000, 0x40010000, 0x40010000,
-  0x24869, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000, 0x4010000,
-  0x4010000, 0x4010000, 0x40010000, 0, 0, 0x2486B, 0x2486D, 0xA30B5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0xA624B, 0xA5B57, 0xA53CC, 0xA30C7, 0xA4E8C, 0xA591A, 0xA89E3, 0xA5929, 0xA4EA4, 0xA6620,
-  0xA7121, 0xA6599, 0xA524D, 0xA5F8C, 0xA518D, 0xA65B0, 0xA521D, 0xA7D42, 0xA751F, 0xA8CA9, 0xA58F0,
-  0xA5439, 0xA6F14, 0xA6295, 0xA6355, 0xA4E00, 0xA4E09, 0xA904A, 0xA5DE6, 0xA4E2D, 0xA53F3, 0xA6307,
-  0xA8D70, 0xA6253, 0xA7981, 0xA7A7A, 0xA5408, 0xA6E80, 0xA6709, 0xA6708, 0xA7533, 0xA5272, 0xA55B6,
-  0xA914D, 0, 0, 0, 0, 0x2655F, 0x26562, 0x26565, 0x26568, 0x2656B, 0x2656E, 0x26571, 0x26574,
-  0x26262, 0, 0, 0, 0, 0, 0, 0, 0xA5F97, 0xA53EF, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0, 0, 0, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0, 0, 0, 0, 0,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0x40010000, 0, 0, 0, 0, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0, 0, 0, 0, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000,
-  0x40010000, 0x40010000, 0x40010000, 0x40010000, 0x40010000, 0xA0030, 0xA0031, 0xA0032, 0xA0033,
-  0xA0034, 0xA0035, 0xA0036, 0xA0037, 0xA0038, 0xA0039, 0x40010000, 0, 0, 0, 0, 0, 0xA4E3D, 0xA4E38,
-  0xA4E41, 0x229B5, 0xA4F60, 0xA4FAE, 0xA4FBB, 0xA5002, 0xA507A, 0xA5099, 0xA50E7, 0xA50CF, 0xA349E,
-  0x229B6, 0xA514D, 0xA5154, 0xA5164, 0xA5177, 0x229B7, 0xA34B9, 0xA5167, 0xA518D, 0x229B8, 0xA5197,
-  0xA51A4, 0xA4ECC, 0xA51AC, 0xA51B5, 0x229B9, 0xA51F5, 0xA5203, 0xA34DF, 0xA523B, 0xA5246, 0xA5272,
-  0xA5277, 0xA3515, 0xA52C7, 0xA52C9, 0xA52E4, 0xA52FA, 0xA5305, 0xA5306, 0xA5317, 0xA5349, 0xA5351,
-  0xA535A, 0xA5373, 0xA537D, 0xA537F, 0xA537F, 0xA537F, 0x229BA, 0xA7070, 0xA53CA, 0xA53DF, 0x229BB,
-  0xA53EB, 0xA53F1, 0xA5406, 0xA549E, 0xA5438, 0xA5448, 0xA5468, 0xA54A2, 0xA54F6, 0xA5510, 0xA5553,
-  0xA5563, 0xA5584, 0xA5584, 0xA5599, 0xA55AB, 0xA55B3, 0xA55C2, 0xA5716, 0xA5606, 0xA5717, 0xA5651,
-  0xA5674, 0xA5207, 0xA58EE, 0xA57CE, 0xA57F4, 0xA580D, 0xA578B, 0xA5832, 0xA5831, 0xA58AC, 0x229BC,
-  0xA58F2, 0xA58F7, 0xA5906, 0xA591A, 0xA5922, 0xA5962, 0x229BD, 0x229BE, 0xA59EC, 0xA5A1B, 0xA5A27,
-  0xA59D8, 0xA5A66, 0xA36EE, 0xA36FC, 0xA5B08, 0xA5B3E, 0xA5B3E, 0x229BF, 0xA5BC3, 0xA5BD8, 0xA5BE7,
-  0xA5BF3, 0x229C0, 0xA5BFF, 0xA5C06, 0xA5F53, 0xA5C22, 0xA3781, 0xA5C60, 0xA5C6E, 0xA5CC0, 0xA5C8D,
-  0x229C1, 0xA5D43, 0x229C2, 0xA5D6E, 0xA5D6B, 0xA5D7C, 0xA5DE1, 0xA5DE2, 0xA382F, 0xA5DFD, 0xA5E28,
-  0xA5E3D, 0xA5E69, 0xA3862, 0x229C3, 0xA387C, 0xA5EB0, 0xA5EB3, 0xA5EB6, 0xA5ECA, 0x229C4, 0xA5EFE,
-  0x229C5, 0x229C5, 0xA8201, 0xA5F22, 0xA5F22, 0xA38C7, 0x229C6, 0x229C7, 0xA5F62, 0xA5F6B, 0xA38E3,
-  0xA5F9A, 0xA5FCD, 0xA5FD7, 0xA5FF9, 0xA6081, 0xA393A, 0xA391C, 0xA6094, 0x229C8, 0xA60C7, 0xA6148,
-  0xA614C, 0xA614E, 0xA614C, 0xA617A, 0xA618E, 0xA61B2, 0xA61A4, 0xA61AF, 0xA61DE, 0xA61F2, 0xA61F6,
-  0xA6210, 0xA621B, 0xA625D, 0xA62B1, 0xA62D4, 0xA6350, 0x229C9, 0xA633D, 0xA62FC, 0xA6368, 0xA6383,
-  0xA63E4, 0x229CA, 0xA6422, 0xA63C5, 0xA63A9, 0xA3A2E, 0xA6469, 0xA647E, 0xA649D, 0xA6477, 0xA3A6C,
-  0xA654F, 0xA656C, 0x229CB, 0xA65E3, 0xA66F8, 0xA6649, 0xA3B19, 0xA6691, 0xA3B08, 0xA3AE4, 0xA5192,
-  0xA5195, 0xA6700, 0xA669C, 0xA80AD, 0xA43D9, 0xA6717, 0xA671B, 0xA6721, 0xA675E, 0xA6753, 0x229CC,
-  0xA3B49, 0xA67FA, 0xA6785, 0xA6852, 0xA6885, 0x229CD, 0xA688E, 0xA681F, 0xA6914, 0xA3B9D, 0xA6942,
-  0xA69A3, 0xA69EA, 0xA6AA8, 0x229CE, 0xA6ADB, 0xA3C18, 0xA6B21, 0x229CF, 0xA6B54, 0xA3C4E, 0xA6B72,
-  0xA6B9F, 0xA6BBA, 0xA6BBB, 0x229D0, 0x229D1, 0x229D2, 0xA6C4E, 0x229D3, 0xA6CBF, 0xA6CCD, 0xA6C67,
-  0xA6D16, 0xA6D3E, 0xA6D77, 0xA6D41, 0xA6D69, 0xA6D78, 0xA6D85, 0x229D4, 0xA6D34, 0xA6E2F, 0xA6E6E,
-  0xA3D33, 0xA6ECB, 0xA6EC7, 0x229D5, 0xA6DF9, 0xA6F6E, 0x229D6, 0x229D7, 0xA6FC6, 0xA7039, 0xA701E,
-  0xA701B, 0xA3D96, 0xA704A, 0xA707D, 0xA7077, 0xA70AD, 0x229D8, 0xA7145, 0x229D9, 0xA719C, 0x229DA,
-  0xA7228, 0xA7235, 0xA7250, 0x229DB, 0xA7280, 0xA7295, 0x229DC, 0x229DD, 0xA737A, 0xA738B, 0xA3EAC,
-  0xA73A5, 0xA3EB8, 0xA3EB8, 0xA7447, 0xA745C, 0xA7471, 0xA7485, 0xA74CA, 0xA3F1B, 0xA7524, 0x229DE,
-  0xA753E, 0x229DF, 0xA7570, 0x229E0, 0xA7610, 0x229E1, 0x229E2, 0x229E3, 0xA3FFC, 0xA4008, 0xA76F4,
-  0x229E4, 0x229E5, 0x229E6, 0x229E7, 0xA771E, 0xA771F, 0xA771F, 0xA774A, 0xA4039, 0xA778B, 0xA4046,
-  0xA4096, 0x229E8, 0xA784E, 0xA788C, 0xA78CC, 0xA40E3, 0x229E9, 0xA7956, 0x229EA, 0x229EB, 0xA798F,
-  0xA79EB, 0xA412F, 0xA7A40, 0xA7A4A, 0xA7A4F, 0x229EC, 0x229ED, 0x229ED, 0xA7AEE, 0xA4202, 0x229EE,
-  0xA7BC6, 0xA7BC9, 0xA4227, 0x229EF, 0xA7CD2, 0xA42A0, 0xA7CE8, 0xA7CE3, 0xA7D00, 0x229F0, 0xA7D63,
-  0xA4301, 0xA7DC7, 0xA7E02, 0xA7E45, 0xA4334, 0x229F1, 0x229F2, 0xA4359, 0x229F3, 0xA7F7A, 0x229F4,
-  0xA7F95, 0xA7FFA, 0xA8005, 0x229F5, 0x229F6, 0xA8060, 0x229F7, 0xA8070, 0x229F8, 0xA43D5, 0xA80B2,
-  0xA8103, 0xA440B, 0xA813E, 0xA5AB5, 0x229F9, 0x229FA, 0x229FB, 0x229FC, 0xA8201, 0xA8204, 0xA8F9E,
-  0xA446B, 0xA8291, 0xA828B, 0xA829D, 0xA52B3, 0xA82B1, 0xA82B3, 0xA82BD, 0xA82E6, 0x229FD, 0xA82E5,
-  0xA831D, 0xA8363, 0xA83AD, 0xA8323, 0xA83BD, 0xA83E7, 0xA8457, 0xA8353, 0xA83CA, 0xA83CC, 0xA83DC,
-  0x229FE, 0x229FF, 0x22A00, 0xA452B, 0xA84F1, 0xA84F3, 0xA8516, 0x22A01, 0xA8564, 0x22A02, 0xA455D,
-  0xA4561, 0x22A03, 0x22A04, 0xA456B, 0xA8650, 0xA865C, 0xA8667, 0xA8669, 0xA86A9, 0xA8688, 0xA870E,
-  0xA86E2, 0xA8779, 0xA8728, 0xA876B, 0xA8786, 0xA45D7, 0xA87E1, 0xA8801, 0xA45F9, 0xA8860, 0xA8863,
-  0x22A05, 0xA88D7, 0xA88DE, 0xA4635, 0xA88FA, 0xA34BB, 0x22A06, 0x22A07, 0xA46BE, 0xA46C7, 0xA8AA0,
-  0xA8AED, 0xA8B8A, 0xA8C55, 0x22A08, 0xA8CAB, 0xA8CC1, 0xA8D1B, 0xA8D77, 0x22A09, 0x22A0A, 0xA8DCB,
-  0xA8DBC, 0xA8DF0, 0x22A0B, 0xA8ED4, 0xA8F38, 0x22A0C, 0x22A0D, 0xA9094, 0xA90F1, 0xA9111, 0x22A0E,
-  0xA911B, 0xA9238, 0xA92D7, 0xA92D8, 0xA927C, 0xA93F9, 0xA9415, 0x22A0F, 0xA958B, 0xA4995, 0xA95B7,
-  0x22A10, 0xA49E6, 0xA96C3, 0xA5DB2, 0xA9723, 0x22A11, 0x22A12, 0xA4A6E, 0xA4A76, 0xA97E0, 0x22A13,
-  0xA4AB2, 0x22A14, 0xA980B, 0xA980B, 0xA9829, 0x22A15, 0xA98E2, 0xA4B33, 0xA9929, 0xA99A7, 0xA99C2,
-  0xA99FE, 0xA4BCE, 0x22A16, 0xA9B12, 0xA9C40, 0xA9CFD, 0xA4CCE, 0xA4CED, 0xA9D67, 0x22A17, 0xA4CF8,
-  0x22A18, 0x22A19, 0x22A1A, 0xA9EBB, 0xA4D56, 0xA9EF9, 0xA9EFE, 0xA9F05, 0xA9F0F, 0xA9F16, 0xA9F3B,
-  0x22A1B, 0, 0
-};
-
-const std::uint16_t uni_data_index[] = {
-  0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
-  26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 13, 13, 13, 13, 13, 13, 36, 37, 38, 39, 40, 41, 41, 41,
-  41, 42, 41, 41, 43, 44, 45, 46, 13, 47, 48, 49, 50, 51, 52, 53, 13, 13, 13, 54, 55, 56, 57, 58,
-  59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 13, 13, 70, 71, 41, 72, 73, 74, 75, 76, 77, 78, 79,
-  80, 81, 41, 82, 83, 84, 85, 86, 86, 87, 88, 89, 90, 91, 92, 93, 41, 94, 95, 96, 97, 74, 74, 98,
-  99, 100, 86, 101, 102, 74, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 41, 115,
-  41, 116, 13, 13, 117, 118, 119, 120, 13, 121, 122, 123, 124, 125, 126, 127, 128, 129, 122, 123,
-  130, 131, 132, 133, 134, 135, 136, 123, 137, 138, 139, 127, 140, 141, 122, 123, 142, 143, 144,
-  127, 145, 146, 147, 148, 149, 150, 151, 133, 152, 153, 154, 123, 155, 156, 157, 127, 158, 159,
-  154, 123, 160, 161, 162, 127, 163, 164, 154, 13, 165, 166, 167, 127, 13, 168, 169, 13, 170, 171,
-  172, 133, 173, 174, 13, 13, 175, 176, 177, 8, 8, 178, 13, 179, 180, 181, 182, 8, 8, 183, 184, 13,
-  185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 8, 8, 13, 13, 196, 197, 13, 198, 199, 200,
-  201, 202, 203, 204, 205, 13, 13, 206, 13, 13, 13, 13, 13, 207, 208, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 209, 210, 13, 13, 209, 13, 13, 211, 212, 213, 13, 13, 13, 212, 13, 13, 13,
-  214, 13, 215, 13, 216, 13, 13, 13, 13, 13, 217, 218, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 174, 219, 13, 13, 13, 13, 13, 220, 13, 221, 13, 222, 13, 223, 224, 225, 13, 13,
-  13, 226, 227, 228, 229, 216, 230, 229, 231, 231, 231, 231, 231, 232, 233, 231, 234, 13, 13, 13,
-  13, 235, 13, 236, 237, 238, 239, 13, 240, 241, 13, 13, 177, 13, 229, 242, 40, 40, 13, 243, 13, 13,
-  13, 244, 245, 246, 229, 229, 240, 41, 41, 247, 248, 8, 249, 13, 13, 250, 251, 13, 252, 253, 254,
-  13, 255, 13, 13, 13, 256, 257, 13, 13, 258, 259, 260, 13, 13, 13, 261, 262, 263, 264, 145, 265,
-  266, 267, 13, 13, 268, 269, 270, 271, 272, 273, 13, 274, 275, 276, 41, 41, 41, 41, 277, 278, 279,
-  280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298,
-  299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
-  318, 319, 40, 320, 41, 41, 321, 322, 323, 324, 325, 326, 327, 328, 328, 329, 40, 40, 40, 40, 40,
-  40, 40, 40, 40, 330, 331, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 332, 333, 13,
-  13, 13, 334, 40, 335, 40, 40, 40, 40, 40, 40, 40, 40, 216, 8, 336, 8, 337, 338, 339, 340, 341,
-  342, 343, 344, 345, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
-  40, 40, 40, 40, 40, 40, 40, 40, 346, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
-  40, 40, 40, 40, 40, 40, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 40, 40,
-  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 347, 40, 40, 40, 40, 40, 40, 348, 40, 40,
-  40, 40, 40, 349, 40, 40, 40, 40, 40, 40, 40, 40, 40, 350, 40, 40, 40, 40, 40, 40, 40, 40, 351,
-  352, 353, 13, 13, 13, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 13, 13, 364, 13, 13, 13,
-  365, 366, 13, 367, 368, 368, 368, 368, 41, 41, 40, 40, 40, 40, 40, 369, 8, 8, 40, 370, 40, 40, 40,
-  40, 40, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 8, 8, 386, 40,
-  387, 388, 174, 13, 13, 13, 13, 389, 218, 13, 13, 13, 13, 390, 391, 13, 13, 392, 393, 394, 395,
-  396, 397, 398, 13, 13, 40, 40, 399, 13, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
-  411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429,
-  430, 431, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 40, 40, 40, 40, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 215, 40, 40, 40, 432, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 433, 13, 177, 8, 434, 435, 436, 437, 438, 439, 13, 13, 13, 13, 13, 440, 40, 40, 441, 442,
-  443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 8, 453, 454, 13, 455, 456, 231, 231, 231, 457,
-  458, 13, 13, 459, 460, 229, 41, 461, 13, 13, 462, 13, 463, 464, 13, 215, 116, 13, 13, 465, 466,
-  467, 468, 236, 13, 13, 469, 470, 471, 472, 13, 473, 13, 13, 13, 474, 475, 476, 477, 478, 479, 480,
-  368, 13, 13, 481, 482, 483, 484, 485, 486, 487, 13, 13, 488, 229, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 489, 13, 490, 13, 13, 177,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
-  510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 8, 8, 521, 522, 523, 524, 525, 526, 527,
-  528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546,
-  547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 40, 557, 558, 559, 560, 561, 562, 563, 564, 8,
-  8, 565, 566, 567, 41, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582,
-  583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 8, 596, 13, 213, 597, 240, 240,
-  8, 8, 13, 13, 13, 13, 13, 13, 13, 195, 598, 13, 13, 599, 40, 40, 40, 40, 600, 601, 602, 8, 8, 13,
-  13, 603, 8, 8, 8, 8, 8, 8, 8, 8, 13, 215, 13, 13, 13, 139, 604, 605, 13, 13, 606, 13, 195, 13, 13,
-  607, 13, 608, 13, 13, 609, 235, 8, 8, 610, 611, 612, 13, 13, 13, 13, 13, 13, 240, 229, 613, 614,
-  615, 13, 177, 13, 13, 145, 13, 13, 13, 616, 617, 618, 619, 136, 620, 13, 13, 13, 489, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 367, 13, 235, 145, 8, 621, 622,
-  623, 624, 8, 8, 8, 8, 625, 74, 74, 626, 74, 627, 74, 74, 74, 105, 628, 8, 8, 8, 74, 629, 74, 630,
-  74, 631, 74, 632, 8, 8, 74, 74, 74, 633, 74, 634, 74, 74, 635, 636, 74, 637, 638, 638, 74, 74, 74,
-  74, 8, 8, 639, 640, 641, 642, 74, 74, 74, 643, 74, 644, 74, 645, 646, 647, 648, 8, 8, 8, 8, 8, 74,
-  74, 74, 74, 638, 8, 8, 8, 649, 650, 651, 652, 74, 74, 74, 653, 654, 86, 655, 656, 657, 658, 659,
-  74, 660, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 661, 662, 74, 74, 663, 664, 665, 666, 8, 667, 74,
-  74, 668, 669, 670, 671, 8, 672, 673, 8, 8, 674, 675, 8, 74, 642, 676, 13, 13, 677, 678, 679, 333,
-  680, 254, 13, 13, 681, 682, 13, 220, 229, 683, 13, 684, 685, 686, 13, 13, 687, 254, 13, 13, 688,
-  689, 13, 174, 241, 13, 136, 690, 691, 692, 8, 8, 8, 693, 608, 229, 13, 13, 694, 695, 229, 696,
-  122, 123, 697, 698, 699, 700, 701, 702, 13, 13, 703, 704, 705, 706, 8, 13, 13, 13, 707, 708, 709,
-  710, 8, 13, 13, 13, 711, 712, 229, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 13, 713, 714, 715, 716, 8, 8,
-  13, 13, 13, 717, 718, 229, 601, 8, 13, 13, 719, 720, 229, 13, 489, 8, 13, 721, 722, 13, 367, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 13, 690, 723, 8, 8, 8, 8, 8, 8, 724, 725, 13, 13, 13, 726, 727,
-  728, 13, 729, 730, 229, 8, 8, 8, 8, 731, 13, 13, 732, 733, 8, 734, 13, 13, 735, 736, 737, 13, 13,
-  738, 739, 740, 13, 13, 13, 13, 220, 229, 8, 8, 8, 8, 8, 741, 8, 8, 8, 8, 8, 13, 13, 710, 229, 123,
-  13, 713, 742, 235, 13, 215, 13, 13, 743, 744, 745, 8, 8, 8, 8, 746, 13, 13, 747, 748, 229, 749,
-  13, 750, 751, 229, 13, 13, 177, 229, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 752, 753,
-  154, 13, 754, 755, 756, 8, 8, 8, 8, 8, 139, 13, 757, 40, 758, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  229, 8, 8, 8, 8, 8, 8, 13, 13, 13, 13, 13, 13, 236, 241, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 489, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 13, 13, 13, 13, 13, 13, 740, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 8, 759, 760, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 195, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 367, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 13, 761, 762, 229, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 220, 13, 236, 467, 13, 13, 13, 13, 236, 229, 13, 240, 763, 13, 13, 13, 764,
-  235, 765, 136, 766, 13, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 13, 13, 13, 229, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 767, 768, 13, 13, 13, 195, 769, 770,
-  13, 489, 8, 8, 13, 13, 13, 13, 771, 772, 773, 773, 774, 683, 8, 8, 8, 8, 775, 776, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 235, 8, 777, 13, 236, 8, 8, 8, 8, 8, 8, 13, 13, 13, 13, 13, 13, 13, 740, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 778, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 740, 779, 8, 780, 781, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 177, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 13, 13, 13, 13, 13, 195,
-  215, 220, 782, 783, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 40, 40, 40, 40, 40, 40, 40, 40, 40,
-  40, 40, 40, 40, 784, 343, 785, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
-  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 786, 40, 602, 40, 602, 41, 41, 247, 41, 787, 13, 13, 13,
-  13, 13, 13, 13, 489, 8, 8, 8, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 235, 13,
-  13, 788, 13, 13, 789, 790, 791, 792, 13, 793, 794, 795, 13, 796, 8, 40, 40, 40, 40, 797, 8, 8, 8,
-  8, 8, 8, 8, 13, 489, 13, 489, 40, 40, 40, 40, 40, 432, 13, 220, 8, 8, 8, 8, 8, 8, 8, 8, 344, 798,
-  799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 344, 798, 799, 810, 811, 812, 813, 814,
-  815, 816, 817, 818, 343, 344, 798, 799, 800, 801, 812, 803, 804, 805, 816, 817, 818, 343, 344,
-  798, 799, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 832, 834,
-  835, 836, 837, 838, 839, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 41, 41, 41, 840, 41, 41, 841, 468, 842,
-  843, 71, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 13, 236, 844, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 845, 846, 847, 848, 849,
-  850, 851, 8, 852, 8, 8, 8, 8, 8, 8, 8, 13, 13, 215, 853, 467, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 13, 854, 8, 13, 13, 855, 856, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 855, 229, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13,
-  761, 857, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13, 236, 858, 859, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 860, 236, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 861, 787, 8, 8, 862, 863, 864,
-  86, 865, 866, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 867, 74, 74, 74, 76, 8, 8, 8, 8,
-  867, 74, 74, 91, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 868, 869, 870, 871, 872, 873, 874, 875, 876,
-  877, 878, 877, 8, 8, 8, 320, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 40, 40, 879, 40, 40,
-  40, 40, 40, 40, 880, 881, 882, 882, 882, 40, 399, 883, 884, 885, 344, 886, 13, 887, 13, 13, 888,
-  889, 8, 8, 8, 133, 13, 890, 891, 892, 893, 894, 895, 399, 8, 8, 8, 8, 8, 8, 8, 8, 8, 40, 40, 40,
-  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
-  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
-  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 896, 601, 601, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
-  40, 40, 216, 879, 602, 879, 40, 40, 40, 897, 216, 40, 40, 897, 40, 369, 879, 320, 666, 8, 8, 40,
-  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 897, 369, 601,
-  898, 40, 40, 40, 899, 900, 901, 666, 40, 40, 40, 40, 40, 40, 40, 40, 40, 902, 40, 40, 40, 40, 40,
-  903, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 8, 8, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 240, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 240, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 139, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 240, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 904, 905, 906, 907, 908, 909, 910, 911, 912,
-  913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931,
-  932, 933, 934, 935, 936, 937, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 195,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-  13, 13, 229
-};
-
-const char32_t uni_chars_to[] = {
-  0x635, 0x644, 0x649, 0x20, 0x627, 0x644, 0x644, 0x647, 0x20, 0x639, 0x644, 0x64A, 0x647, 0x20,
-  0x648, 0x633, 0x644, 0x645, 0x62C, 0x644, 0x20, 0x62C, 0x644, 0x627, 0x644, 0x647, 0x72, 0x61,
-  0x64, 0x2215, 0x73, 0x32, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30AD, 0x30ED, 0x30B0,
-  0x30E9, 0x30E0, 0x30D1, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB,
-  0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x30D6, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x30B0, 0x30E9,
-  0x30E0, 0x30C8, 0x30F3, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x30AF, 0x30EB, 0x30BC, 0x30A4,
-  0x30ED, 0x30DF, 0x30EA, 0x30D0, 0x30FC, 0x30EB, 0x30EC, 0x30F3, 0x30C8, 0x30B2, 0x30F3, 0x30AD,
-  0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x30D4, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x30A8, 0x30B9, 0x30AF,
-  0x30FC, 0x30C9, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C9, 0x30B7, 0x30EA, 0x30F3, 0x30B0, 0x28,
-  0xC624, 0xC804, 0x29, 0x6B, 0x63, 0x61, 0x6C, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x28, 0xC624,
-  0xD6C4, 0x29, 0x6D, 0x2215, 0x73, 0x32, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x76, 0x69, 0x69, 0x69,
-  0x222B, 0x222B, 0x222B, 0x222B, 0x31, 0x2044, 0x31, 0x30, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x63,
-  0x2215, 0x6B, 0x67, 0x30A2, 0x30D1, 0x30FC, 0x30C8, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x30A2,
-  0x30F3, 0x30DA, 0x30A2, 0x30D0, 0x30FC, 0x30EC, 0x30EB, 0x682A, 0x5F0F, 0x4F1A, 0x793E, 0x30A4,
-  0x30CB, 0x30F3, 0x30B0, 0x30EB, 0x30FC, 0x30D6, 0x30EB, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x30A8,
-  0x30FC, 0x30AB, 0x30FC, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x2032, 0x2032, 0x2032, 0x2032, 0x30B5,
-  0x30A4, 0x30AF, 0x30EB, 0x30E1, 0x30AC, 0x30C8, 0x30F3, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x30AB,
-  0x30ED, 0x30EA, 0x30FC, 0x30DD, 0x30A4, 0x30F3, 0x30C8, 0x28, 0x31, 0x30, 0x29, 0x28, 0x31, 0x31,
-  0x29, 0x28, 0x31, 0x32, 0x29, 0x28, 0x31, 0x33, 0x29, 0x28, 0x31, 0x34, 0x29, 0x28, 0x31, 0x35,
-  0x29, 0x28, 0x31, 0x36, 0x29, 0x28, 0x31, 0x37, 0x29, 0x28, 0x31, 0x38, 0x29, 0x28, 0x31, 0x39,
-  0x29, 0x28, 0x32, 0x30, 0x29, 0x627, 0x643, 0x628, 0x631, 0x645, 0x62D, 0x645, 0x62F, 0x635,
-  0x644, 0x639, 0x645, 0x631, 0x633, 0x648, 0x644, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x30AE, 0x30EB,
-  0x30C0, 0x30FC, 0x631, 0x6CC, 0x627, 0x644, 0x3D, 0x3D, 0x3D, 0x32, 0x2044, 0x33, 0x31, 0x2044,
-  0x35, 0x32, 0x2044, 0x35, 0x20, 0x308, 0x301, 0x33, 0x2044, 0x35, 0x31, 0x2044, 0x34, 0x31,
-  0x2044, 0x32, 0x33, 0x2044, 0x34, 0x31, 0x30, 0x6708, 0x31, 0x31, 0x6708, 0x31, 0x32, 0x6708,
-  0x65, 0x72, 0x67, 0x6D, 0x6D, 0x32, 0x63, 0x6D, 0x32, 0x34, 0x2044, 0x35, 0x6B, 0x6D, 0x32, 0x6D,
-  0x6D, 0x33, 0x63, 0x6D, 0x33, 0x31, 0x2044, 0x36, 0x6B, 0x6D, 0x33, 0x35, 0x2044, 0x36, 0x6B,
-  0x70, 0x61, 0x6D, 0x70, 0x61, 0x67, 0x70, 0x61, 0x31, 0x2044, 0x38, 0x28, 0x1100, 0x29, 0x28,
-  0x1102, 0x29, 0x28, 0x1103, 0x29, 0x28, 0x1105, 0x29, 0x28, 0x1106, 0x29, 0x28, 0x1107, 0x29,
-  0x28, 0x1109, 0x29, 0x33, 0x2044, 0x38, 0x28, 0x110B, 0x29, 0x28, 0x110C, 0x29, 0x28, 0x110E,
-  0x29, 0x28, 0x110F, 0x29, 0x28, 0x1110, 0x29, 0x28, 0x1111, 0x29, 0x28, 0x1112, 0x29, 0x28,
-  0xAC00, 0x29, 0x28, 0xB098, 0x29, 0x28, 0xB2E4, 0x29, 0x28, 0xB77C, 0x29, 0x28, 0xB9C8, 0x29,
-  0x28, 0xBC14, 0x29, 0x28, 0xC0AC, 0x29, 0x28, 0xC544, 0x29, 0x28, 0xC790, 0x29, 0x28, 0xCC28,
-  0x29, 0x28, 0xCE74, 0x29, 0x28, 0xD0C0, 0x29, 0x28, 0xD30C, 0x29, 0x28, 0xD558, 0x29, 0x28,
-  0xC8FC, 0x29, 0x35, 0x2044, 0x38, 0x37, 0x2044, 0x38, 0x28, 0x4E00, 0x29, 0x28, 0x4E8C, 0x29,
-  0x28, 0x4E09, 0x29, 0x28, 0x56DB, 0x29, 0x28, 0x4E94, 0x29, 0x30, 0x2044, 0x33, 0x222E, 0x222E,
-  0x222E, 0x28, 0x516D, 0x29, 0x28, 0x4E03, 0x29, 0x28, 0x516B, 0x29, 0x28, 0x4E5D, 0x29, 0x28,
-  0x5341, 0x29, 0x28, 0x6708, 0x29, 0x28, 0x706B, 0x29, 0x28, 0x6C34, 0x29, 0x28, 0x6728, 0x29,
-  0x28, 0x91D1, 0x29, 0x28, 0x571F, 0x29, 0x28, 0x65E5, 0x29, 0x28, 0x682A, 0x29, 0x28, 0x6709,
-  0x29, 0x28, 0x793E, 0x29, 0x28, 0x540D, 0x29, 0x28, 0x7279, 0x29, 0x28, 0x8CA1, 0x29, 0x28,
-  0x795D, 0x29, 0x28, 0x52B4, 0x29, 0x28, 0x4EE3, 0x29, 0x28, 0x547C, 0x29, 0x28, 0x5B66, 0x29,
-  0x28, 0x76E3, 0x29, 0x28, 0x4F01, 0x29, 0x28, 0x8CC7, 0x29, 0x28, 0x5354, 0x29, 0x28, 0x796D,
-  0x29, 0x28, 0x4F11, 0x29, 0x28, 0x81EA, 0x29, 0x28, 0x81F3, 0x29, 0x70, 0x74, 0x65, 0x30A2,
-  0x30FC, 0x30EB, 0x30A4, 0x30F3, 0x30C1, 0x30A6, 0x30A9, 0x30F3, 0x30AA, 0x30F3, 0x30B9, 0x30AA,
-  0x30FC, 0x30E0, 0x30AB, 0x30A4, 0x30EA, 0x30AC, 0x30ED, 0x30F3, 0x30AC, 0x30F3, 0x30DE, 0x30AE,
-  0x30CB, 0x30FC, 0x3014, 0x6557, 0x3015, 0x30B1, 0x30FC, 0x30B9, 0x30B3, 0x30EB, 0x30CA, 0x30B3,
-  0x30FC, 0x30DD, 0x61, 0x2F, 0x63, 0x61, 0x2F, 0x73, 0x78, 0x69, 0x69, 0x63, 0x2F, 0x6F, 0x63,
-  0x2F, 0x75, 0x30EB, 0x30D4, 0x30FC, 0x6C, 0x74, 0x64, 0x30BB, 0x30F3, 0x30C1, 0x30C0, 0x30FC,
-  0x30B9, 0x20, 0x308, 0x342, 0x30CE, 0x30C3, 0x30C8, 0x30CF, 0x30A4, 0x30C4, 0x6C, 0x6F, 0x67,
-  0x30E4, 0x30FC, 0x30C9, 0x66, 0x66, 0x69, 0x66, 0x66, 0x6C, 0x30D1, 0x30FC, 0x30C4, 0x6D, 0x69,
-  0x6C, 0x20, 0x313, 0x300, 0x6D, 0x6F, 0x6C, 0x20, 0x313, 0x301, 0x70, 0x70, 0x6D, 0x20, 0x313,
-  0x342, 0x30D4, 0x30AF, 0x30EB, 0x30E4, 0x30FC, 0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x76, 0x2215, 0x6D,
-  0x61, 0x2215, 0x6D, 0x74, 0x65, 0x6C, 0x31, 0x30, 0x70B9, 0x20, 0x314, 0x300, 0x20, 0x314, 0x301,
-  0x20, 0x314, 0x342, 0xFB2, 0xF71, 0xF80, 0x31, 0x30, 0x65E5, 0x31, 0x31, 0x65E5, 0x31, 0x32,
-  0x65E5, 0x31, 0x33, 0x65E5, 0x31, 0x34, 0x65E5, 0x31, 0x35, 0x65E5, 0x31, 0x36, 0x65E5, 0x31,
-  0x37, 0x65E5, 0x31, 0x38, 0x65E5, 0x31, 0x39, 0x65E5, 0x32, 0x30, 0x65E5, 0x32, 0x31, 0x65E5,
-  0x32, 0x32, 0x65E5, 0x32, 0x33, 0x65E5, 0x32, 0x34, 0x65E5, 0x32, 0x35, 0x65E5, 0x32, 0x36,
-  0x65E5, 0x32, 0x37, 0x65E5, 0x32, 0x38, 0x65E5, 0x32, 0x39, 0x65E5, 0x33, 0x30, 0x65E5, 0x33,
-  0x31, 0x65E5, 0x67, 0x61, 0x6C, 0x30D5, 0x30E9, 0x30F3, 0x20, 0x308, 0x300, 0x30DA, 0x30CB,
-  0x30D2, 0x30D8, 0x30EB, 0x30C4, 0x30DA, 0x30F3, 0x30B9, 0x30DA, 0x30FC, 0x30B8, 0x30D9, 0x30FC,
-  0x30BF, 0x30DD, 0x30F3, 0x30C9, 0x30DC, 0x30EB, 0x30C8, 0xFB3, 0xF71, 0xF80, 0x28, 0x31, 0x29,
-  0x28, 0x32, 0x29, 0x28, 0x33, 0x29, 0x28, 0x34, 0x29, 0x28, 0x35, 0x29, 0x28, 0x36, 0x29, 0x28,
-  0x37, 0x29, 0x28, 0x38, 0x29, 0x28, 0x39, 0x29, 0x30DB, 0x30FC, 0x30EB, 0x30DB, 0x30FC, 0x30F3,
-  0x66, 0x61, 0x78, 0x30DE, 0x30A4, 0x30EB, 0x30DE, 0x30C3, 0x30CF, 0x5E9, 0x5BC, 0x5C1, 0x5E9,
-  0x5BC, 0x5C2, 0x30DE, 0x30EB, 0x30AF, 0x28, 0x61, 0x29, 0x28, 0x62, 0x29, 0x28, 0x63, 0x29, 0x28,
-  0x64, 0x29, 0x28, 0x65, 0x29, 0x28, 0x66, 0x29, 0x28, 0x67, 0x29, 0x28, 0x68, 0x29, 0x28, 0x69,
-  0x29, 0x28, 0x6A, 0x29, 0x28, 0x6B, 0x29, 0x28, 0x6C, 0x29, 0x28, 0x6D, 0x29, 0x28, 0x6E, 0x29,
-  0x28, 0x6F, 0x29, 0x28, 0x70, 0x29, 0x28, 0x71, 0x29, 0x28, 0x72, 0x29, 0x28, 0x73, 0x29, 0x28,
-  0x74, 0x29, 0x28, 0x75, 0x29, 0x28, 0x76, 0x29, 0x28, 0x77, 0x29, 0x28, 0x78, 0x29, 0x28, 0x79,
-  0x29, 0x28, 0x7A, 0x29, 0x31, 0x31, 0x70B9, 0x31, 0x32, 0x70B9, 0x31, 0x33, 0x70B9, 0x31, 0x34,
-  0x70B9, 0x31, 0x35, 0x70B9, 0x31, 0x36, 0x70B9, 0x31, 0x37, 0x70B9, 0x31, 0x38, 0x70B9, 0x31,
-  0x39, 0x70B9, 0x32, 0x30, 0x70B9, 0x32, 0x31, 0x70B9, 0x32, 0x32, 0x70B9, 0x32, 0x33, 0x70B9,
-  0x32, 0x34, 0x70B9, 0x68, 0x70, 0x61, 0x62, 0x61, 0x72, 0x64, 0x6D, 0x32, 0x64, 0x6D, 0x33, 0x20,
-  0x64C, 0x651, 0x20, 0x64D, 0x651, 0x20, 0x64E, 0x651, 0x20, 0x64F, 0x651, 0x20, 0x650, 0x651,
-  0x20, 0x651, 0x670, 0x646, 0x62C, 0x649, 0x640, 0x64E, 0x651, 0x640, 0x64F, 0x651, 0x640, 0x650,
-  0x651, 0x62A, 0x62C, 0x645, 0x62A, 0x62D, 0x62C, 0x62A, 0x62D, 0x645, 0x62A, 0x62E, 0x645, 0x62A,
-  0x645, 0x62C, 0x62A, 0x645, 0x62D, 0x62A, 0x645, 0x62E, 0x62C, 0x645, 0x62D, 0x62D, 0x645, 0x64A,
-  0x62D, 0x645, 0x649, 0x633, 0x62D, 0x62C, 0x633, 0x62C, 0x62D, 0x633, 0x62C, 0x649, 0x633, 0x645,
-  0x62D, 0x633, 0x645, 0x62C, 0x633, 0x645, 0x645, 0x635, 0x62D, 0x62D, 0x635, 0x645, 0x645, 0x634,
-  0x62D, 0x645, 0x634, 0x62C, 0x64A, 0x634, 0x645, 0x62E, 0x634, 0x645, 0x645, 0x636, 0x62D, 0x649,
-  0x636, 0x62E, 0x645, 0x637, 0x645, 0x62D, 0x637, 0x645, 0x645, 0x637, 0x645, 0x64A, 0x639, 0x62C,
-  0x645, 0x639, 0x645, 0x645, 0x639, 0x645, 0x649, 0x63A, 0x645, 0x645, 0x63A, 0x645, 0x64A, 0x63A,
-  0x645, 0x649, 0x641, 0x62E, 0x645, 0x642, 0x645, 0x62D, 0x642, 0x645, 0x645, 0x644, 0x62D, 0x645,
-  0x644, 0x62D, 0x64A, 0x644, 0x62D, 0x649, 0x644, 0x62C, 0x62C, 0x644, 0x62E, 0x645, 0x644, 0x645,
-  0x62D, 0x645, 0x62D, 0x62C, 0x645, 0x62D, 0x64A, 0x645, 0x62C, 0x62D, 0x645, 0x62C, 0x645, 0x645,
-  0x62E, 0x645, 0x645, 0x62C, 0x62E, 0x647, 0x645, 0x62C, 0x647, 0x645, 0x645, 0x646, 0x62D, 0x645,
-  0x646, 0x62D, 0x649, 0x646, 0x62C, 0x645, 0x646, 0x645, 0x64A, 0x646, 0x645, 0x649, 0x64A, 0x645,
-  0x645, 0x628, 0x62E, 0x64A, 0x62A, 0x62C, 0x64A, 0x62A, 0x62C, 0x649, 0x62A, 0x62E, 0x64A, 0x62A,
-  0x62E, 0x649, 0x62A, 0x645, 0x64A, 0x62A, 0x645, 0x649, 0x62C, 0x645, 0x64A, 0x62C, 0x62D, 0x649,
-  0x62C, 0x645, 0x649, 0x633, 0x62E, 0x649, 0x635, 0x62D, 0x64A, 0x634, 0x62D, 0x64A, 0x636, 0x62D,
-  0x64A, 0x644, 0x62C, 0x64A, 0x644, 0x645, 0x64A, 0x64A, 0x62D, 0x64A, 0x64A, 0x62C, 0x64A, 0x64A,
-  0x645, 0x64A, 0x645, 0x645, 0x64A, 0x642, 0x645, 0x64A, 0x646, 0x62D, 0x64A, 0x639, 0x645, 0x64A,
-  0x643, 0x645, 0x64A, 0x646, 0x62C, 0x62D, 0x645, 0x62E, 0x64A, 0x644, 0x62C, 0x645, 0x643, 0x645,
-  0x645, 0x62C, 0x62D, 0x64A, 0x62D, 0x62C, 0x64A, 0x645, 0x62C, 0x64A, 0x641, 0x645, 0x64A, 0x628,
-  0x62D, 0x64A, 0x633, 0x62E, 0x64A, 0x646, 0x62C, 0x64A, 0x635, 0x644, 0x6D2, 0x642, 0x644, 0x6D2,
-  0x6B, 0x68, 0x7A, 0x6D, 0x68, 0x7A, 0x67, 0x68, 0x7A, 0x74, 0x68, 0x7A, 0x31, 0x2044, 0x37, 0x31,
-  0x2044, 0x39, 0x3A, 0x3A, 0x3D, 0x2035, 0x2035, 0x2035, 0x31, 0x2044, 0x33, 0x1D158, 0x1D165,
-  0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158,
-  0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F,
-  0x1D1BA, 0x1D165, 0x1D16F, 0x3014, 0x73, 0x3015, 0x70, 0x70, 0x76, 0x3014, 0x672C, 0x3015, 0x3014,
-  0x4E09, 0x3015, 0x3014, 0x4E8C, 0x3015, 0x3014, 0x5B89, 0x3015, 0x3014, 0x70B9, 0x3015, 0x3014,
-  0x6253, 0x3015, 0x3014, 0x76D7, 0x3015, 0x3014, 0x52DD, 0x3015, 0x626, 0x627, 0x5E9, 0x5C1, 0x5E9,
-  0x5C2, 0x5D0, 0x5B7, 0x5D0, 0x5B8, 0x5D0, 0x5BC, 0x5D1, 0x5BC, 0x5D2, 0x5BC, 0x5D3, 0x5BC, 0x20,
-  0x333, 0x5D4, 0x5BC, 0x21, 0x21, 0x20, 0x305, 0x3F, 0x3F, 0x3F, 0x21, 0x21, 0x3F, 0x5D5, 0x5BC,
-  0x5D6, 0x5BC, 0x5D8, 0x5BC, 0x5D9, 0x5BC, 0x5DA, 0x5BC, 0x5DB, 0x5BC, 0x5DC, 0x5BC, 0x5DE, 0x5BC,
-  0x5E0, 0x5BC, 0x5E1, 0x5BC, 0x5E3, 0x5BC, 0x4EE4, 0x548C, 0x30AE, 0x30AC, 0x72, 0x73, 0xB0, 0x63,
-  0xB0, 0x66, 0x30C7, 0x30B7, 0x30C9, 0x30EB, 0x30CA, 0x30CE, 0x6E, 0x6F, 0x30D4, 0x30B3, 0x73,
-  0x6D, 0x74, 0x6D, 0x30D3, 0x30EB, 0x30DA, 0x30BD, 0x30DB, 0x30F3, 0x20, 0x3099, 0x20, 0x309A,
-  0x3088, 0x308A, 0x30B3, 0x30C8, 0x565, 0x582, 0x627, 0x674, 0x648, 0x674, 0x6C7, 0x674, 0x64A,
-  0x674, 0x915, 0x93C, 0x916, 0x93C, 0x917, 0x93C, 0x91C, 0x93C, 0x921, 0x93C, 0x922, 0x93C, 0x92B,
-  0x93C, 0x92F, 0x93C, 0x9A1, 0x9BC, 0x9A2, 0x9BC, 0x9AF, 0x9BC, 0xA32, 0xA3C, 0xA38, 0xA3C, 0xA16,
-  0xA3C, 0xA17, 0xA3C, 0xA1C, 0xA3C, 0xA2B, 0xA3C, 0xB21, 0xB3C, 0xB22, 0xB3C, 0xE4D, 0xE32, 0xECD,
-  0xEB2, 0xEAB, 0xE99, 0xEAB, 0xEA1, 0x69, 0x76, 0xF42, 0xFB7, 0xF4C, 0xFB7, 0xF51, 0xFB7, 0xF56,
-  0xFB7, 0xF5B, 0xFB7, 0xF40, 0xFB5, 0xF71, 0xF72, 0xF71, 0xF74, 0xFB2, 0xF80, 0xFB3, 0xF80, 0xF92,
-  0xFB7, 0xF9C, 0xFB7, 0xFA1, 0xFB7, 0xFA6, 0xFB7, 0xFAB, 0xFB7, 0xF90, 0xFB5, 0x69, 0x78, 0x30EA,
-  0x30E9, 0x30EC, 0x30E0, 0x6D, 0x76, 0x660E, 0x6CBB, 0x6E, 0x61, 0x3BC, 0x61, 0x6B, 0x61, 0x6B,
-  0x62, 0x6D, 0x62, 0x67, 0x62, 0x70, 0x66, 0x6E, 0x66, 0x3BC, 0x66, 0x3BC, 0x67, 0x6D, 0x67, 0x3BC,
-  0x6C, 0x6D, 0x6C, 0x64, 0x6C, 0x20, 0x304, 0x20, 0x301, 0x2ADD, 0x338, 0x20, 0x327, 0x6B, 0x6C,
-  0x66, 0x6D, 0x6E, 0x6D, 0x3BC, 0x6D, 0x70, 0x73, 0x73, 0x73, 0x69, 0x307, 0x69, 0x6A, 0x6C, 0xB7,
-  0x2BC, 0x6E, 0x6E, 0x73, 0x3BC, 0x73, 0x6D, 0x73, 0x33, 0x32, 0x33, 0x33, 0x33, 0x34, 0x64, 0x61,
-  0x61, 0x75, 0x6F, 0x76, 0x70, 0x63, 0x6E, 0x76, 0x3BC, 0x76, 0x69, 0x75, 0x5E73, 0x6210, 0x662D,
-  0x548C, 0x5927, 0x6B63, 0x626, 0x648, 0x626, 0x6C7, 0x626, 0x6C6, 0x626, 0x6C8, 0x626, 0x6D0,
-  0x626, 0x649, 0x626, 0x62C, 0x626, 0x62D, 0x626, 0x645, 0x626, 0x64A, 0x628, 0x62C, 0x628, 0x645,
-  0x628, 0x649, 0x628, 0x64A, 0x62A, 0x649, 0x62A, 0x64A, 0x62B, 0x62C, 0x62B, 0x645, 0x62B, 0x649,
-  0x62B, 0x64A, 0x62E, 0x62D, 0x636, 0x62C, 0x636, 0x645, 0x637, 0x62D, 0x638, 0x645, 0x63A, 0x62C,
-  0x641, 0x62C, 0x641, 0x62D, 0x641, 0x649, 0x641, 0x64A, 0x642, 0x62D, 0x642, 0x649, 0x642, 0x64A,
-  0x643, 0x627, 0x643, 0x62C, 0x643, 0x62D, 0x643, 0x62E, 0x643, 0x644, 0x643, 0x649, 0x643, 0x64A,
-  0x646, 0x62E, 0x646, 0x649, 0x646, 0x64A, 0x647, 0x62C, 0x647, 0x649, 0x647, 0x64A, 0x64A, 0x649,
-  0x630, 0x670, 0x631, 0x670, 0x649, 0x670, 0x6B, 0x76, 0x61, 0x2BE, 0x70, 0x77, 0x6E, 0x77, 0x3BC,
-  0x77, 0x626, 0x631, 0x626, 0x632, 0x626, 0x646, 0x628, 0x632, 0x628, 0x646, 0x62A, 0x631, 0x62A,
-  0x632, 0x62A, 0x646, 0x62B, 0x631, 0x62B, 0x632, 0x62B, 0x646, 0x645, 0x627, 0x646, 0x631, 0x646,
-  0x632, 0x646, 0x646, 0x64A, 0x631, 0x64A, 0x632, 0x626, 0x62E, 0x626, 0x647, 0x628, 0x647, 0x62A,
-  0x647, 0x635, 0x62E, 0x646, 0x647, 0x647, 0x670, 0x6D, 0x77, 0x633, 0x647, 0x634, 0x647, 0x6B,
-  0x77, 0x6B, 0x3C9, 0x637, 0x649, 0x637, 0x64A, 0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649, 0x63A,
-  0x64A, 0x633, 0x649, 0x633, 0x64A, 0x634, 0x649, 0x634, 0x64A, 0x635, 0x649, 0x635, 0x64A, 0x636,
-  0x649, 0x636, 0x64A, 0x634, 0x62E, 0x634, 0x631, 0x633, 0x631, 0x635, 0x631, 0x636, 0x631, 0x627,
-  0x64B, 0x6D, 0x3C9, 0x62, 0x71, 0x63, 0x63, 0x63, 0x64, 0x64, 0x17E, 0x6C, 0x6A, 0x6E, 0x6A, 0x64,
-  0x62, 0x67, 0x79, 0x68, 0x61, 0x69, 0x6E, 0x6B, 0x6B, 0x6B, 0x74, 0x6C, 0x6E, 0xCC38, 0xACE0,
-  0xC8FC, 0xC758, 0x6C, 0x78, 0x64, 0x7A, 0x70, 0x68, 0x70, 0x72, 0x73, 0x72, 0x73, 0x76, 0x77,
-  0x62, 0x5E4, 0x5BC, 0x5E6, 0x5BC, 0x5E7, 0x5BC, 0x5E8, 0x5BC, 0x5EA, 0x5BC, 0x33, 0x36, 0x33,
-  0x37, 0x33, 0x38, 0x33, 0x39, 0x34, 0x30, 0x34, 0x32, 0x34, 0x33, 0x20, 0x306, 0x20, 0x307, 0x20,
-  0x30A, 0x20, 0x328, 0x20, 0x303, 0x20, 0x30B, 0x34, 0x34, 0x34, 0x35, 0x34, 0x36, 0x34, 0x37,
-  0x34, 0x38, 0x34, 0x39, 0x35, 0x30, 0x33, 0x6708, 0x34, 0x6708, 0x35, 0x6708, 0x36, 0x6708, 0x20,
-  0x3B9, 0x37, 0x6708, 0x38, 0x6708, 0x39, 0x6708, 0x68, 0x67, 0x1F00, 0x3B9, 0x1F01, 0x3B9, 0x1F02,
-  0x3B9, 0x1F03, 0x3B9, 0x1F04, 0x3B9, 0x1F05, 0x3B9, 0x1F06, 0x3B9, 0x1F07, 0x3B9, 0x1F20, 0x3B9,
-  0x1F21, 0x3B9, 0x1F22, 0x3B9, 0x1F23, 0x3B9, 0x1F24, 0x3B9, 0x1F25, 0x3B9, 0x1F26, 0x3B9, 0x1F27,
-  0x3B9, 0x1F60, 0x3B9, 0x1F61, 0x3B9, 0x1F62, 0x3B9, 0x1F63, 0x3B9, 0x1F64, 0x3B9, 0x1F65, 0x3B9,
-  0x1F66, 0x3B9, 0x1F67, 0x3B9, 0x20, 0x64B, 0x640, 0x64B, 0x640, 0x651, 0x20, 0x652, 0x640, 0x652,
-  0x644, 0x622, 0x644, 0x623, 0x644, 0x625, 0x1D157, 0x1D165, 0x1F70, 0x3B9, 0x3B1, 0x3B9, 0x3AC,
-  0x3B9, 0x1FB6, 0x3B9, 0x65, 0x76, 0x30, 0x2C, 0x31, 0x2C, 0x32, 0x2C, 0x33, 0x2C, 0x34, 0x2C,
-  0x35, 0x2C, 0x36, 0x2C, 0x37, 0x2C, 0x38, 0x2C, 0x39, 0x2C, 0x20, 0x342, 0x1F74, 0x3B9, 0x3B7,
-  0x3B9, 0x3AE, 0x3B9, 0x1FC6, 0x3B9, 0x73, 0x74, 0x574, 0x576, 0x574, 0x565, 0x574, 0x56B, 0x57E,
-  0x576, 0x574, 0x56D, 0x5D9, 0x5B4, 0x5F2, 0x5B7, 0x5D5, 0x5B9, 0x5D1, 0x5BF, 0x5DB, 0x5BF, 0x5E4,
-  0x5BF, 0x1F7C, 0x3B9, 0x3C9, 0x3B9, 0x3CE, 0x3B9, 0x77, 0x7A, 0x68, 0x76, 0x73, 0x64, 0x1FF6,
-  0x3B9, 0x77, 0x63, 0x6D, 0x63, 0x6D, 0x64, 0x6D, 0x72, 0x64, 0x6A, 0x307B, 0x304B, 0x30B3, 0x30B3,
-  0x5D0, 0x5DC, 0x626, 0x6D5, 0x62B, 0x647, 0x242EE, 0x2284A, 0x22844, 0x233D5, 0x25249, 0x25CD0,
-  0x27ED3, 0x10428, 0x10429, 0x1042A, 0x1042B, 0x1042C, 0x1042D, 0x1042E, 0x1042F, 0x10430, 0x10431,
-  0x10432, 0x10433, 0x10434, 0x10435, 0x10436, 0x10437, 0x10438, 0x10439, 0x1043A, 0x1043B, 0x1043C,
-  0x1043D, 0x1043E, 0x1043F, 0x10440, 0x10441, 0x10442, 0x10443, 0x10444, 0x10445, 0x10446, 0x10447,
-  0x10448, 0x10449, 0x1044A, 0x1044B, 0x1044C, 0x1044D, 0x1044E, 0x1044F, 0x104D8, 0x104D9, 0x104DA,
-  0x104DB, 0x104DC, 0x104DD, 0x104DE, 0x104DF, 0x104E0, 0x104E1, 0x104E2, 0x104E3, 0x104E4, 0x104E5,
-  0x104E6, 0x104E7, 0x104E8, 0x104E9, 0x104EA, 0x104EB, 0x104EC, 0x104ED, 0x104EE, 0x104EF, 0x104F0,
-  0x104F1, 0x104F2, 0x104F3, 0x104F4, 0x104F5, 0x104F6, 0x104F7, 0x104F8, 0x104F9, 0x104FA, 0x104FB,
-  0x10597, 0x10598, 0x10599, 0x1059A, 0x1059B, 0x1059C, 0x1059D, 0x1059E, 0x1059F, 0x105A0, 0x105A1,
-  0x105A3, 0x105A4, 0x105A5, 0x105A6, 0x105A7, 0x105A8, 0x105A9, 0x105AA, 0x105AB, 0x105AC, 0x105AD,
-  0x105AE, 0x105AF, 0x105B0, 0x105B1, 0x105B3, 0x105B4, 0x105B5, 0x105B6, 0x105B7, 0x105B8, 0x105B9,
-  0x105BB, 0x105BC, 0x1DF04, 0x1DF05, 0x1DF06, 0x1DF08, 0x1DF0A, 0x1DF1E, 0x10CC0, 0x10CC1, 0x10CC2,
-  0x10CC3, 0x10CC4, 0x10CC5, 0x10CC6, 0x10CC7, 0x10CC8, 0x10CC9, 0x10CCA, 0x10CCB, 0x10CCC, 0x10CCD,
-  0x10CCE, 0x10CCF, 0x10CD0, 0x10CD1, 0x10CD2, 0x10CD3, 0x10CD4, 0x10CD5, 0x10CD6, 0x10CD7, 0x10CD8,
-  0x10CD9, 0x10CDA, 0x10CDB, 0x10CDC, 0x10CDD, 0x10CDE, 0x10CDF, 0x10CE0, 0x10CE1, 0x10CE2, 0x10CE3,
-  0x10CE4, 0x10CE5, 0x10CE6, 0x10CE7, 0x10CE8, 0x10CE9, 0x10CEA, 0x10CEB, 0x10CEC, 0x10CED, 0x10CEE,
-  0x10CEF, 0x10CF0, 0x10CF1, 0x10CF2, 0x10D70, 0x10D71, 0x10D72, 0x10D73, 0x10D74, 0x10D75, 0x10D76,
-  0x10D77, 0x10D78, 0x10D79, 0x10D7A, 0x10D7B, 0x10D7C, 0x10D7D, 0x10D7E, 0x10D7F, 0x10D80, 0x10D81,
-  0x10D82, 0x10D83, 0x10D84, 0x10D85, 0x118C0, 0x118C1, 0x118C2, 0x118C3, 0x118C4, 0x118C5, 0x118C6,
-  0x118C7, 0x118C8, 0x118C9, 0x118CA, 0x118CB, 0x118CC, 0x118CD, 0x118CE, 0x118CF, 0x118D0, 0x118D1,
-  0x118D2, 0x118D3, 0x118D4, 0x118D5, 0x118D6, 0x118D7, 0x118D8, 0x118D9, 0x118DA, 0x118DB, 0x118DC,
-  0x118DD, 0x118DE, 0x118DF, 0x16E60, 0x16E61, 0x16E62, 0x16E63, 0x16E64, 0x16E65, 0x16E66, 0x16E67,
-  0x16E68, 0x16E69, 0x16E6A, 0x16E6B, 0x16E6C, 0x16E6D, 0x16E6E, 0x16E6F, 0x16E70, 0x16E71, 0x16E72,
-  0x16E73, 0x16E74, 0x16E75, 0x16E76, 0x16E77, 0x16E78, 0x16E79, 0x16E7A, 0x16E7B, 0x16E7C, 0x16E7D,
-  0x16E7E, 0x16E7F, 0x16EBB, 0x16EBC, 0x16EBD, 0x16EBE, 0x16EBF, 0x16EC0, 0x16EC1, 0x16EC2, 0x16EC3,
-  0x16EC4, 0x16EC5, 0x16EC6, 0x16EC7, 0x16EC8, 0x16EC9, 0x16ECA, 0x16ECB, 0x16ECC, 0x16ECD, 0x16ECE,
-  0x16ECF, 0x16ED0, 0x16ED1, 0x16ED2, 0x16ED3, 0x1E922, 0x1E923, 0x1E924, 0x1E925, 0x1E926, 0x1E927,
-  0x1E928, 0x1E929, 0x1E92A, 0x1E92B, 0x1E92C, 0x1E92D, 0x1E92E, 0x1E92F, 0x1E930, 0x1E931, 0x1E932,
-  0x1E933, 0x1E934, 0x1E935, 0x1E936, 0x1E937, 0x1E938, 0x1E939, 0x1E93A, 0x1E93B, 0x1E93C, 0x1E93D,
-  0x1E93E, 0x1E93F, 0x1E940, 0x1E941, 0x1E942, 0x1E943, 0x20122, 0x2063A, 0x2051C, 0x2054B, 0x291DF,
-  0x20A2C, 0x20B63, 0x214E4, 0x216A8, 0x216EA, 0x219C8, 0x21B18, 0x21DE4, 0x21DE6, 0x22183, 0x2A392,
-  0x22331, 0x232B8, 0x261DA, 0x226D4, 0x22B0C, 0x22BF1, 0x2300A, 0x233C3, 0x2346D, 0x236A3, 0x238A7,
-  0x23A8D, 0x21D0B, 0x23AFA, 0x23CBC, 0x23D1E, 0x23ED1, 0x23F5E, 0x23F8E, 0x20525, 0x24263, 0x243AB,
-  0x24608, 0x24735, 0x24814, 0x24C36, 0x24C92, 0x2219F, 0x24FA1, 0x24FB8, 0x25044, 0x250F3, 0x250F2,
-  0x25119, 0x25133, 0x2541D, 0x25626, 0x2569A, 0x256C5, 0x2597C, 0x25AA7, 0x25BAB, 0x25C80, 0x25F86,
-  0x26228, 0x26247, 0x262D9, 0x2633E, 0x264DA, 0x26523, 0x265A8, 0x2335F, 0x267A7, 0x267B5, 0x23393,
-  0x2339C, 0x26B3C, 0x26C36, 0x26D6B, 0x26CD5, 0x273CA, 0x26F2C, 0x26FB1, 0x270D2, 0x27667, 0x278AE,
-  0x27966, 0x27CA8, 0x27F2F, 0x20804, 0x208DE, 0x285D2, 0x285ED, 0x2872E, 0x28BFA, 0x28D77, 0x29145,
-  0x2921A, 0x2940A, 0x29496, 0x295B6, 0x29B30, 0x2A0CE, 0x2A105, 0x2A20E, 0x2A291, 0x2A600
-};
-
-const std::uint8_t comp_disallowed_std3[3] = {
-  0x3C, 0x3D, 0x3E
-};
-
-const std::uint8_t ascii_data[128] = {
-  0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
-  0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
-  0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x1, 0x1, 0x5, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
-  0x1, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
-  0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x5, 0x5, 0x5, 0x5,
-  0x5, 0x5, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
-  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x5, 0x5, 0x5, 0x5, 0x5
-};
-
-// END-GENERATED
-
-} // namespace upa::idna::util
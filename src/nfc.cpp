@@ -4,197 +4,45 @@
 //
 #ifndef UPA_MODULE
 # include "upa/idna/nfc.h"
-# include <algorithm>
-# include <utility> // std::move
 #endif // UPA_MODULE
 
-#include "nfc_table.h"
+#include "upa/idna/detail/nfc_impl.h"
 
 namespace upa::idna {
 
-namespace hangul {
-    constexpr char32_t SBase = 0xAC00;
-    constexpr char32_t LBase = 0x1100;
-    constexpr char32_t VBase = 0x1161;
-    constexpr char32_t TBase = 0x11A7;
-    constexpr char32_t LCount = 19;
-    constexpr char32_t VCount = 21;
-    constexpr char32_t TCount = 28;
-    constexpr char32_t NCount = VCount * TCount; // 588
-    constexpr char32_t SCount = LCount * NCount; // 11172
-} // namespace hangul
+// The algorithms are in detail/nfc_impl.h
 
-void compose(std::u32string& str)
-{
-    if (str.empty())
-        return;
-    std::size_t dest = 0;
-
-    std::size_t i = 1;
-    for (; i < str.length(); ++i) {
-        auto last = str[i - 1];
-        const auto ch = str[i];
-
-        // 1. check to see if two current characters are L and V
-        if (last >= hangul::LBase && last < hangul::LBase + hangul::LCount) {
-            if (ch >= hangul::VBase && ch < hangul::VBase + hangul::VCount) {
-                const auto LIndex = last - hangul::LBase;
-                const auto VIndex = ch - hangul::VBase;
-                // make syllable of form LV
-                last = hangul::SBase + (LIndex * hangul::VCount + VIndex) * hangul::TCount;
-                ++i; // ch consumed
-                // check to see if the next character is T
-                if (i < str.length()) {
-                    const auto next_ch = str[i];
-                    if (next_ch > hangul::TBase && next_ch < hangul::TBase + hangul::TCount) {
-                        // make syllable of form LVT
-                        last += next_ch - hangul::TBase; // TIndex
-                        ++i; // next_ch consumed
-                    }
-                }
-            }
-            str[dest++] = last;
-        }
-        // 2. check to see if two current characters are LV and T
-        else if (last >= hangul::SBase && last < hangul::SBase + hangul::SCount) {
-            // SIndex = last - hangul::SBase
-            if ((last - hangul::SBase) % hangul::TCount == 0 &&
-                ch > hangul::TBase && ch < hangul::TBase + hangul::TCount) {
-                // make syllable of form LVT
-                last += ch - hangul::TBase; // TIndex
-                ++i; // ch consumed
-            }
-            str[dest++] = last;
-        }
-        else {
-            const auto L_dest = dest++;
-            auto L_info = normalize::get_composition_info(last);
-            int prev_ccc = -1;
-            for (; i < str.length(); ++i) {
-                const auto C = str[i];
-                const int C_ccc = normalize::get_ccc(C);
-                if (L_info != 0 && prev_ccc < C_ccc) {
-                    // Check <last, C> has canonically equivalent Primary Composite
-                    const auto* comp_arr = normalize::get_composition_data(L_info);
-                    const auto* comp_arr_end = comp_arr + normalize::get_composition_len(L_info);
-                    const auto* comp = std::lower_bound(comp_arr, comp_arr_end, C,
-                        [](const normalize::codepoint_key_val& a, char32_t b) { return a.key < b; });
-                    if (comp != comp_arr_end && comp->key == C) {
-                        last = comp->val;
-                        L_info = normalize::get_composition_info(last);
-                        continue;
-                    }
-                }
-
-                if (C_ccc == 0)
-                    break;
-                prev_ccc = C_ccc;
-                str[dest++] = C;
-            }
-            str[L_dest] = last;
-        }
-    }
-    if (i == str.length())
-        str[dest++] = str[i - 1];
-    str.resize(dest);
+void compose(std::u32string& str) {
+    normalize::compose(str);
 }
 
-void canonical_decompose(std::u32string& str)
-{
-    std::u32string out;
-
-    for (auto cp : str) {
-        if (cp >= hangul::SBase && cp < hangul::SBase + hangul::SCount) {
-            // Hangul Decomposition Algorithm
-            const auto SIndex = cp - hangul::SBase;
-            out += static_cast<char32_t>(hangul::LBase + SIndex / hangul::NCount); // L
-            out += static_cast<char32_t>(hangul::VBase + (SIndex % hangul::NCount) / hangul::TCount); // V
-            if (SIndex % hangul::TCount != 0)
-                out += static_cast<char32_t>(hangul::TBase + SIndex % hangul::TCount); // T
-        } else {
-            const auto cp_info = normalize::get_decomposition_info(cp);
-            if (cp_info) {
-                // decompose
-                out.append(
-                    normalize::get_decomposition_chars(cp_info),
-                    normalize::get_decomposition_len(cp_info)
-                );
-            } else {
-                // no decomposition
-                out += cp;
-            }
-        }
-    }
-
-    // Canonical Ordering Algorithm
-    // Use Insertion sort:
-    // https://en.wikipedia.org/wiki/Insertion_sort
-    for (std::size_t i = 1; i < out.length(); ++i) {
-        const auto ccc = normalize::get_ccc(out[i]);
-
-        // is there a need to sort?
-        if (ccc != 0 && normalize::get_ccc(out[i - 1]) > ccc) {
-            // sort
-            const auto cp = out[i];
-            std::size_t j = i;
-            do {
-                out[j] = out[j - 1]; --j;
-            } while (j != 0 && normalize::get_ccc(out[j - 1]) > ccc);
-            out[j] = cp;
-        }
-    }
-
-    str = std::move(out);
+void canonical_decompose(std::u32string& str) {
+    normalize::canonical_decompose(str);
 }
 
-namespace {
+void canonical_decompose(std::u32string& str, std::u32string& buff) {
+    normalize::canonical_decompose(str, buff);
+}
 
-// Quick Check Algorithm
-// https://unicode.org/reports/tr15/#Detecting_Normalization_Forms
-template <bool return_on_maybe>
-inline normalize::qc quick_check(const char32_t* first, const char32_t* last) {
-    std::uint8_t last_canonical_class = 0;
-    auto result = normalize::qc::yes;
-    for (const char32_t* it = first; it != last; ++it) {
-        const char32_t ch = *it;
-        const std::uint8_t canonical_class = normalize::get_ccc(ch);
-        if (last_canonical_class > canonical_class && canonical_class != 0)
-            return normalize::qc::no;
-        const auto check = normalize::get_quick_check(ch);
-        if constexpr (return_on_maybe) {
-            if (check != normalize::qc::yes)
-                return check;
-        } else {
-            if (check == normalize::qc::no)
-                return normalize::qc::no;
-            if (check == normalize::qc::maybe)
-                result = normalize::qc::maybe;
-        }
-        last_canonical_class = canonical_class;
-    }
-    return result;
+void normalize_nfc(std::u32string& str) {
+    normalize::normalize_nfc(str);
 }
 
-} // namespace
+void normalize_nfc(std::u32string& str, std::u32string& buff) {
+    normalize::normalize_nfc(str, buff);
+}
 
-void normalize_nfc(std::u32string& str) {
-    const auto qc = quick_check<true>(str.data(), str.data() + str.size());
-    if (qc != normalize::qc::yes) {
-        canonical_decompose(str);
-        compose(str);
-    }
+bool normalize_nfc_to(const char32_t* first, const char32_t* last, std::u32string& out) {
+    return normalize::normalize_nfc_to(first, last, out);
 }
 
 bool is_normalized_nfc(const char32_t* first, const char32_t* last) {
-    const auto qc = quick_check<false>(first, last);
-    if (qc == normalize::qc::maybe) {
-        std::u32string str{ first, last };
-        canonical_decompose(str);
-        compose(str);
-        return std::equal(first, last, str.data(), str.data() + str.length());
-    }
-    return qc == normalize::qc::yes;
+    std::u32string buff;
+    return normalize::is_normalized_nfc(first, last, buff);
 }
 
+bool is_normalized_nfc(const char32_t* first, const char32_t* last, std::u32string& buff) {
+    return normalize::is_normalized_nfc(first, last, buff);
+}
 
 } // namespace upa::idna
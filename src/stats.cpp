@@ -0,0 +1,194 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#ifndef UPA_MODULE
+# include "upa/idna/stats.h"
+# ifdef UPA_IDNA_STATS
+#  include <algorithm>
+#  include <atomic>
+#  include <chrono>
+#  include <cstddef>
+#  include <cstdint>
+#  include <mutex>
+#  include <vector>
+#  if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#   ifdef _MSC_VER
+#    include <intrin.h>
+#   else
+#    include <x86intrin.h>
+#   endif
+#  endif
+# endif // UPA_IDNA_STATS
+#endif // UPA_MODULE
+
+#include "upa/idna/detail/stats.h"
+
+#ifdef UPA_IDNA_STATS
+
+namespace upa::idna {
+namespace {
+
+constexpr std::size_t kStageCount = static_cast<std::size_t>(stats_stage::count);
+constexpr std::size_t kQuickCheckCount = static_cast<std::size_t>(stats_quick_check::count);
+
+// Counters of one thread: they are written by the owner thread only, and read
+// by get_stats(), so relaxed loads and stores are sufficient
+struct thread_counters {
+    thread_counters();
+    ~thread_counters();
+
+    std::atomic<std::uint64_t> calls[kStageCount]{};
+    std::atomic<std::uint64_t> bytes[kStageCount]{};
+    std::atomic<std::uint64_t> cycles[kStageCount]{};
+    std::atomic<std::uint64_t> quick_check[kQuickCheckCount]{};
+};
+
+inline void increase(std::atomic<std::uint64_t>& counter, std::uint64_t value) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+// All threads' counters
+struct stats_registry {
+    std::mutex mutex;
+    std::vector<const thread_counters*> threads;
+    stats_snapshot finished{}; // counters of the finished threads
+    stats_snapshot baseline{}; // counters at the last reset_stats() call
+};
+
+stats_registry& registry() {
+    // Intentionally leaked: it is used by the threads finishing after static destruction
+    static auto* reg = new stats_registry;
+    return *reg;
+}
+
+void add_counters(stats_snapshot& dest, const thread_counters& src) noexcept {
+    for (std::size_t ind = 0; ind < kStageCount; ++ind) {
+        dest.stages[ind].calls += src.calls[ind].load(std::memory_order_relaxed);
+        dest.stages[ind].bytes += src.bytes[ind].load(std::memory_order_relaxed);
+        dest.stages[ind].cycles += src.cycles[ind].load(std::memory_order_relaxed);
+    }
+    for (std::size_t ind = 0; ind < kQuickCheckCount; ++ind)
+        dest.quick_check[ind] += src.quick_check[ind].load(std::memory_order_relaxed);
+}
+
+thread_counters::thread_counters() {
+    auto& reg = registry();
+    const std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.threads.push_back(this);
+}
+
+thread_counters::~thread_counters() {
+    auto& reg = registry();
+    const std::lock_guard<std::mutex> lock(reg.mutex);
+    add_counters(reg.finished, *this);
+    reg.threads.erase(std::find(reg.threads.begin(), reg.threads.end(), this));
+}
+
+thread_counters& local_counters() {
+    thread_local thread_counters counters;
+    return counters;
+}
+
+// The innermost timed scope of the thread
+thread_local detail::stats_scope* active_scope = nullptr;
+
+std::atomic<bool> timing_enabled{ false };
+
+inline std::uint64_t read_cycles() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+} // namespace
+
+namespace detail {
+
+void stats_scope::start(std::size_t bytes) noexcept {
+    if (stage_ != stats_no_stage) {
+        auto& counters = local_counters();
+        const auto ind = static_cast<std::size_t>(stage_);
+        increase(counters.calls[ind], 1);
+        increase(counters.bytes[ind], bytes);
+    }
+    if (timing_enabled.load(std::memory_order_relaxed)) {
+        // pause the enclosing scope
+        const std::uint64_t now = read_cycles();
+        parent_ = active_scope;
+        if (parent_ != nullptr)
+            parent_->elapsed_ += now - parent_->start_;
+        start_ = now;
+        timed_ = true;
+        active_scope = this;
+    }
+}
+
+void stats_scope::stop() noexcept {
+    if (timed_) {
+        const std::uint64_t now = read_cycles();
+        elapsed_ += now - start_;
+        if (stage_ != stats_no_stage)
+            increase(local_counters().cycles[static_cast<std::size_t>(stage_)], elapsed_);
+        // resume the enclosing scope
+        active_scope = parent_;
+        if (parent_ != nullptr)
+            parent_->start_ = now;
+    }
+}
+
+void stats_add_quick_check(stats_quick_check qc) noexcept {
+    increase(local_counters().quick_check[static_cast<std::size_t>(qc)], 1);
+}
+
+} // namespace detail
+
+stats_snapshot get_stats() {
+    auto& reg = registry();
+    const std::lock_guard<std::mutex> lock(reg.mutex);
+    stats_snapshot res = reg.finished;
+    for (const auto* counters : reg.threads)
+        add_counters(res, *counters);
+    for (std::size_t ind = 0; ind < kStageCount; ++ind) {
+        res.stages[ind].calls -= reg.baseline.stages[ind].calls;
+        res.stages[ind].bytes -= reg.baseline.stages[ind].bytes;
+        res.stages[ind].cycles -= reg.baseline.stages[ind].cycles;
+    }
+    for (std::size_t ind = 0; ind < kQuickCheckCount; ++ind)
+        res.quick_check[ind] -= reg.baseline.quick_check[ind];
+    return res;
+}
+
+void reset_stats() {
+    auto& reg = registry();
+    const std::lock_guard<std::mutex> lock(reg.mutex);
+    // The counters are owned by threads, so the current sums become the baseline
+    reg.baseline = reg.finished;
+    for (const auto* counters : reg.threads)
+        add_counters(reg.baseline, *counters);
+}
+
+void set_stats_timing(bool enable) noexcept {
+    timing_enabled.store(enable, std::memory_order_relaxed);
+}
+
+const char* stats_stage_name(stats_stage stage) noexcept {
+    switch (stage) {
+    case stats_stage::map: return "map";
+    case stats_stage::normalize_nfc: return "normalize_nfc";
+    case stats_stage::canonical_decompose: return "canonical_decompose";
+    case stats_stage::compose: return "compose";
+    case stats_stage::punycode_encode: return "punycode::encode";
+    case stats_stage::punycode_decode: return "punycode::decode";
+    case stats_stage::validate_label: return "validate_label";
+    case stats_stage::validate_bidi: return "validate_bidi";
+    default: return "?";
+    }
+}
+
+} // namespace upa::idna
+
+#endif // UPA_IDNA_STATS
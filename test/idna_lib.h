@@ -5,11 +5,32 @@
 #ifndef IDNA_LIB_H
 #define IDNA_LIB_H
 
+#include <cstddef>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace idna_lib {
     bool toASCII(std::string& output, const std::string& input, bool transitional, bool is_input_ascii = false);
+    bool toASCIIReuse(std::string& output, const std::string& input, bool transitional);
+    // On failure `statuses` receives the UTS46 status codes matching the reported error
+    bool toASCIIError(std::string& output, const std::string& input, bool transitional,
+        std::vector<std::string>& statuses);
+    // Converts all inputs at once; each output item is (success, result). Uses
+    // parallel conversion if thread_count != 0
+    void toASCIIBatch(std::vector<std::pair<bool, std::string>>& output, const std::vector<std::string>& input,
+        bool transitional, unsigned thread_count = 0);
+    // Uses the context with the processing limits: the input size in bytes, the
+    // mapped domain and label lengths and the combining marks sequence length
+    bool toASCIILimited(std::string& output, const std::string& input, bool transitional,
+        std::size_t max_input_size, std::size_t max_mapped_length, std::size_t max_label_length,
+        std::size_t max_combining_length);
+    // Uses the same result cache for all calls
+    bool toASCIICached(std::string& output, const std::string& input, bool transitional);
     bool toUnicode(std::string& output, const std::string& input, bool is_input_ascii = false);
+    bool toUnicodeCached(std::string& output, const std::string& input);
+    bool toUnicode16(std::string& output, const std::string& input);
+    bool toUnicode32(std::string& output, const std::string& input);
 } // namespace idna_lib
 
 #endif // IDNA_LIB_H
@@ -11,6 +11,7 @@
 // conversion
 #include <algorithm>
 #include <iterator>
+#include <string_view>
 
 
 namespace {
@@ -44,17 +45,178 @@ namespace idna_lib {
         return res;
     }
 
-    bool toUnicode(std::string& output, const std::string& input, bool is_input_ascii) {
-        std::u32string domain;
+    // Uses the same context for all calls
+    bool toASCIIReuse(std::string& output, const std::string& input, bool transitional) {
+        static upa::idna::context ctx;
 
-        bool res = upa::idna::to_unicode(domain, input.data(), input.data() + input.length(),
-            // upa::idna::Option::VerifyDnsLength |
+        const bool res = upa::idna::to_ascii(ctx, output, input.data(), input.data() + input.length(),
+            upa::idna::Option::VerifyDnsLength |
+            upa::idna::Option::CheckHyphens |
+            upa::idna::Option::CheckBidi |
+            upa::idna::Option::CheckJoiners |
+            upa::idna::Option::UseSTD3ASCIIRules |
+            (transitional ? upa::idna::Option::Transitional : upa::idna::Option::Default)
+        );
+
+        if (!res) output.clear();
+
+        return res;
+    }
+
+    bool toASCIIError(std::string& output, const std::string& input, bool transitional,
+        std::vector<std::string>& statuses) {
+        upa::idna::error_info err;
+
+        const bool res = upa::idna::to_ascii(output, input.data(), input.data() + input.length(),
+            upa::idna::Option::VerifyDnsLength |
+            upa::idna::Option::CheckHyphens |
+            upa::idna::Option::CheckBidi |
+            upa::idna::Option::CheckJoiners |
+            upa::idna::Option::UseSTD3ASCIIRules |
+            (transitional ? upa::idna::Option::Transitional : upa::idna::Option::Default),
+            err
+        );
+
+        using upa::idna::error_code;
+        switch (err.code) {
+        case error_code::ok: statuses = {}; break;
+        case error_code::disallowed: statuses = { "V7", "U1" }; break;
+        case error_code::not_nfc: statuses = { "V1" }; break;
+        case error_code::hyphen_3_4: statuses = { "V2" }; break;
+        case error_code::hyphen_start_end: statuses = { "V3" }; break;
+        case error_code::xn_prefix: statuses = { "V4" }; break;
+        case error_code::leading_mark: statuses = { "V6" }; break;
+        case error_code::joiner: statuses = { "C1", "C2" }; break;
+        case error_code::bidi: statuses = { "B1", "B2", "B3", "B4", "B5", "B6" }; break;
+        case error_code::punycode_invalid: statuses = { "P4" }; break;
+        case error_code::punycode_overflow: statuses = { "P4", "A3" }; break;
+        case error_code::label_length: statuses = { "A4_2", "X4_2" }; break;
+        case error_code::domain_length: statuses = { "A4_1" }; break;
+        case error_code::limit_exceeded: statuses = {}; break;
+        }
+
+        if (!res) output.clear();
+
+        return res;
+    }
+
+    bool toASCIILimited(std::string& output, const std::string& input, bool transitional,
+        std::size_t max_input_size, std::size_t max_mapped_length, std::size_t max_label_length,
+        std::size_t max_combining_length) {
+        upa::idna::limits lim;
+        lim.max_input_size = max_input_size;
+        lim.max_mapped_length = max_mapped_length;
+        lim.max_label_length = max_label_length;
+        lim.max_combining_length = max_combining_length;
+        upa::idna::context ctx(lim);
+
+        const bool res = upa::idna::to_ascii(ctx, output, input.data(), input.data() + input.length(),
+            upa::idna::Option::VerifyDnsLength |
+            upa::idna::Option::CheckHyphens |
+            upa::idna::Option::CheckBidi |
+            upa::idna::Option::CheckJoiners |
+            upa::idna::Option::UseSTD3ASCIIRules |
+            (transitional ? upa::idna::Option::Transitional : upa::idna::Option::Default)
+        );
+
+        if (!res) output.clear();
+
+        return res;
+    }
+
+    // Small cache, so the entries are evicted during tests
+    upa::idna::result_cache& test_cache() {
+        static upa::idna::result_cache cache(512, 4);
+        return cache;
+    }
+
+    bool toASCIICached(std::string& output, const std::string& input, bool transitional) {
+        const bool res = test_cache().to_ascii(output, input.data(), input.data() + input.length(),
+            upa::idna::Option::VerifyDnsLength |
+            upa::idna::Option::CheckHyphens |
+            upa::idna::Option::CheckBidi |
+            upa::idna::Option::CheckJoiners |
+            upa::idna::Option::UseSTD3ASCIIRules |
+            (transitional ? upa::idna::Option::Transitional : upa::idna::Option::Default)
+        );
+
+        if (!res) output.clear();
+
+        return res;
+    }
+
+    void toASCIIBatch(std::vector<std::pair<bool, std::string>>& output, const std::vector<std::string>& input,
+        bool transitional, unsigned thread_count) {
+        const std::vector<std::string_view> views(input.begin(), input.end());
+        const upa::idna::Option options =
+            upa::idna::Option::VerifyDnsLength |
             upa::idna::Option::CheckHyphens |
             upa::idna::Option::CheckBidi |
             upa::idna::Option::CheckJoiners |
             upa::idna::Option::UseSTD3ASCIIRules |
+            (transitional ? upa::idna::Option::Transitional : upa::idna::Option::Default);
+        // the result is reused by the subsequent calls, so its buffers are kept
+        static upa::idna::batch_result result;
+
+        if (thread_count != 0)
+            upa::idna::to_ascii_batch_parallel(result, views.data(), views.size(), options, thread_count);
+        else
+            upa::idna::to_ascii_batch(result, views.data(), views.size(), options);
+
+        output.clear();
+        for (std::size_t ind = 0; ind < result.size(); ++ind)
+            output.emplace_back(result[ind].ok, result.value(ind));
+    }
+
+    constexpr upa::idna::Option unicode_options =
+        // upa::idna::Option::VerifyDnsLength |
+        upa::idna::Option::CheckHyphens |
+        upa::idna::Option::CheckBidi |
+        upa::idna::Option::CheckJoiners |
+        upa::idna::Option::UseSTD3ASCIIRules;
+
+    bool toUnicode(std::string& output, const std::string& input, bool is_input_ascii) {
+        output.clear();
+
+        return upa::idna::to_unicode(output, input.data(), input.data() + input.length(),
+            unicode_options |
             (is_input_ascii ? upa::idna::Option::InputASCII : upa::idna::Option::Default)
         );
+    }
+
+    bool toUnicodeCached(std::string& output, const std::string& input) {
+        output.clear();
+
+        return test_cache().to_unicode(output, input.data(), input.data() + input.length(),
+            unicode_options);
+    }
+
+    // Uses the UTF-16 output of to_unicode
+    bool toUnicode16(std::string& output, const std::string& input) {
+        std::u16string domain;
+
+        bool res = upa::idna::to_unicode(domain, input.data(), input.data() + input.length(),
+            unicode_options);
+
+        // to utf-8
+        std::u32string domain32;
+        for (std::size_t i = 0; i < domain.length(); ++i) {
+            char32_t cp = domain[i];
+            if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < domain.length())
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (domain[++i] - 0xDC00);
+            domain32.push_back(cp);
+        }
+        output = utf8_from_utf32(domain32);
+
+        return res;
+    }
+
+    // Uses the UTF-32 output of to_unicode
+    bool toUnicode32(std::string& output, const std::string& input) {
+        std::u32string domain;
+
+        bool res = upa::idna::to_unicode(domain, input.data(), input.data() + input.length(),
+            unicode_options);
 
         // to utf-8
         output = utf8_from_utf32(domain);
@@ -3,15 +3,22 @@
 // found in the LICENSE file.
 //
 #include "idna_lib.h"
+#include "upa/idna/idna.h"
+#include "upa/idna/cache.h"
+#include "upa/idna/static.h"
+#include "upa/idna/detail/idna_impl.h"
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <string>
+#include <utility>
+#include <vector>
 
 // clang requires to decalare 'operator <<' prior to the call site (DataDrivenTest::assert_equal)
 template <class CharT, class Traits>
@@ -25,12 +32,16 @@ inline std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, T
 
 int run_idna_tests_v2(const std::filesystem::path& file_name);
 int run_punycode_tests(const std::filesystem::path& file_name);
+int run_error_info_tests();
+int run_cache_tests();
 static std::string get_column8(const std::string& line, std::size_t& pos);
 //static std::u16string get_column16(const std::string& line, std::size_t& pos);
 static std::u32string get_column32(const std::string& line, std::size_t& pos);
 static std::string get_column8_idna(const std::string& line, std::size_t& pos, const std::string& def = "");
 static bool is_error(const std::string& col);
 static bool is_error_of_to_unicode(const std::string& col);
+static bool has_status(const std::string& col, const std::vector<std::string>& statuses);
+static bool to_ascii_code_points(std::string& output, const std::string& input, bool transitional);
 
 int main()
 {
@@ -42,6 +53,9 @@ int main()
     err |= run_punycode_tests("data/punycode-test.txt");
     err |= run_punycode_tests("data/punycode-test-mano.txt");
 
+    err |= run_error_info_tests();
+    err |= run_cache_tests();
+
     return err;
 }
 
@@ -68,6 +82,8 @@ int run_idna_tests_v2(const std::filesystem::path& file_name)
     std::string line;
     std::string output;
     std::string case_name;
+    std::vector<std::string> sources;
+    std::vector<std::string> statuses;
     while (std::getline(file, line)) {
         line_num++;
         // Comments are indicated with hash marks
@@ -88,6 +104,7 @@ int run_idna_tests_v2(const std::filesystem::path& file_name)
 
                 // source
                 const std::string& source(c1);
+                sources.push_back(source);
                 const bool is_input_ascii = std::all_of(source.begin(), source.end(),
                     [](char c) { return static_cast<unsigned char>(c) < 0x80; });
 
@@ -118,6 +135,18 @@ int run_idna_tests_v2(const std::filesystem::path& file_name)
                         tc.assert_equal(exp_unicode_ok, ok, "ASCII to_unicode success");
                         tc.assert_equal(exp_unicode, output, "ASCII to_unicode output");
                     }
+                    ok = idna_lib::toUnicode16(output, source);
+                    tc.assert_equal(exp_unicode_ok, ok, "UTF-16 to_unicode success");
+                    tc.assert_equal(exp_unicode, output, "UTF-16 to_unicode output");
+                    ok = idna_lib::toUnicode32(output, source);
+                    tc.assert_equal(exp_unicode_ok, ok, "UTF-32 to_unicode success");
+                    tc.assert_equal(exp_unicode, output, "UTF-32 to_unicode output");
+                    // the second call gets the cached result
+                    for (int pass = 0; pass < 2; ++pass) {
+                        ok = idna_lib::toUnicodeCached(output, source);
+                        tc.assert_equal(exp_unicode_ok, ok, "to_unicode (cache) success");
+                        tc.assert_equal(exp_unicode, output, "to_unicode (cache) output");
+                    }
 
                     // to_ascii
                     ok = idna_lib::toASCII(output, source, false);
@@ -130,6 +159,24 @@ int run_idna_tests_v2(const std::filesystem::path& file_name)
                         if (exp_ascii_ok && ok)
                             tc.assert_equal(exp_ascii, output, "ASCII to_ascii output");
                     }
+                    ok = idna_lib::toASCIIReuse(output, source, false);
+                    tc.assert_equal(exp_ascii_ok, ok, "to_ascii (context) success");
+                    if (exp_ascii_ok && ok)
+                        tc.assert_equal(exp_ascii, output, "to_ascii (context) output");
+                    ok = to_ascii_code_points(output, source, false);
+                    tc.assert_equal(exp_ascii_ok, ok, "to_ascii (code points) success");
+                    if (exp_ascii_ok && ok)
+                        tc.assert_equal(exp_ascii, output, "to_ascii (code points) output");
+                    ok = idna_lib::toASCIIError(output, source, false, statuses);
+                    tc.assert_equal(exp_ascii_ok, ok, "to_ascii (error) success");
+                    if (!exp_ascii_ok && !ok)
+                        tc.assert_equal(true, has_status(c5, statuses), "to_ascii (error) status");
+                    for (int pass = 0; pass < 2; ++pass) {
+                        ok = idna_lib::toASCIICached(output, source, false);
+                        tc.assert_equal(exp_ascii_ok, ok, "to_ascii (cache) success");
+                        if (exp_ascii_ok && ok)
+                            tc.assert_equal(exp_ascii, output, "to_ascii (cache) output");
+                    }
 
                     // to_ascii transitional
                     ok = idna_lib::toASCII(output, source, true);
@@ -142,6 +189,24 @@ int run_idna_tests_v2(const std::filesystem::path& file_name)
                         if (exp_ascii_trans_ok && ok)
                             tc.assert_equal(exp_ascii_trans, output, "ASCII to_ascii transitional output");
                     }
+                    ok = idna_lib::toASCIIReuse(output, source, true);
+                    tc.assert_equal(exp_ascii_trans_ok, ok, "to_ascii (context) transitional success");
+                    if (exp_ascii_trans_ok && ok)
+                        tc.assert_equal(exp_ascii_trans, output, "to_ascii (context) transitional output");
+                    ok = to_ascii_code_points(output, source, true);
+                    tc.assert_equal(exp_ascii_trans_ok, ok, "to_ascii (code points) transitional success");
+                    if (exp_ascii_trans_ok && ok)
+                        tc.assert_equal(exp_ascii_trans, output, "to_ascii (code points) transitional output");
+                    ok = idna_lib::toASCIIError(output, source, true, statuses);
+                    tc.assert_equal(exp_ascii_trans_ok, ok, "to_ascii (error) transitional success");
+                    if (!exp_ascii_trans_ok && !ok)
+                        tc.assert_equal(true, has_status(c7, statuses), "to_ascii (error) transitional status");
+                    for (int pass = 0; pass < 2; ++pass) {
+                        ok = idna_lib::toASCIICached(output, source, true);
+                        tc.assert_equal(exp_ascii_trans_ok, ok, "to_ascii (cache) transitional success");
+                        if (exp_ascii_trans_ok && ok)
+                            tc.assert_equal(exp_ascii_trans, output, "to_ascii (cache) transitional output");
+                    }
                 });
             }
             catch (const utf_error& ex) {
@@ -154,6 +219,73 @@ int run_idna_tests_v2(const std::filesystem::path& file_name)
             }
         }
     }
+
+    // the batch conversion gives the same results as to_ascii
+    ddt.test_case("to_ascii_batch", [&](DataDrivenTest::TestCase& tc) {
+        std::vector<std::pair<bool, std::string>> batch_output;
+        for (const unsigned thread_count : { 0u, 4u }) {
+            for (const bool transitional : { false, true }) {
+                idna_lib::toASCIIBatch(batch_output, sources, transitional, thread_count);
+                tc.assert_equal(sources.size(), batch_output.size(), "to_ascii_batch size");
+                for (std::size_t ind = 0; ind < batch_output.size(); ++ind) {
+                    const bool ok = idna_lib::toASCII(output, sources[ind], transitional);
+                    tc.assert_equal(ok, batch_output[ind].first, "to_ascii_batch success");
+                    if (ok)
+                        tc.assert_equal(output, batch_output[ind].second, "to_ascii_batch output");
+                }
+            }
+        }
+    });
+
+    // the limits which are not exceeded do not change the results
+    ddt.test_case("to_ascii_limits", [&](DataDrivenTest::TestCase& tc) {
+        std::string limited_output;
+        for (const auto& source : sources) {
+            for (const bool transitional : { false, true }) {
+                const bool ok = idna_lib::toASCII(output, source, transitional);
+                const bool limited_ok = idna_lib::toASCIILimited(limited_output, source, transitional,
+                    4096, 1024, 1024, 64);
+                tc.assert_equal(ok, limited_ok, "to_ascii (limits) success");
+                if (ok)
+                    tc.assert_equal(output, limited_output, "to_ascii (limits) output");
+            }
+        }
+    });
+
+    // the exceeded limits
+    ddt.test_case("to_ascii_limits exceeded", [&](DataDrivenTest::TestCase& tc) {
+        const struct {
+            const char* input;
+            bool ok;
+            std::size_t max_input_size;
+            std::size_t max_mapped_length;
+            std::size_t max_label_length;
+            std::size_t max_combining_length;
+        } cases[] = {
+            { "abcdefgh.com", true, 12, 100, 100, 100 },
+            { "abcdefgh.com", false, 11, 100, 100, 100 },
+            { "abcdefgh.com", true, 100, 12, 100, 100 },
+            { "abcdefgh.com", false, 100, 11, 100, 100 },
+            { "abcdefgh.com", true, 100, 100, 8, 100 },
+            { "abcdefghi.com", false, 100, 100, 8, 100 },
+            // the mapped label lengths: U+00E1, U+00AD (ignored), U+FF0E (mapped to ".")
+            { "\xC3\xA1" "bcdefgh.com", true, 100, 100, 8, 100 },
+            { "\xC3\xA1" "bcdefghi.com", false, 100, 100, 8, 100 },
+            { "\xC3\xA1" "bcd\xC2\xAD" "efgh.com", true, 100, 100, 8, 100 },
+            { "\xC3\xA1" "bcdef\xEF\xBC\x8E" "com", true, 100, 10, 6, 100 },
+            { "\xC3\xA1" "bcdef\xEF\xBC\x8E" "com", false, 100, 9, 6, 100 },
+            { "\xC3\xA1" "bcdefg\xEF\xBC\x8E" "com", false, 100, 100, 6, 100 },
+            // the combining marks: U+0301, U+0302
+            { "xa\xCC\x81\xCC\x82", true, 100, 100, 100, 2 },
+            { "xa\xCC\x81\xCC\x82\xCC\x81", false, 100, 100, 100, 2 },
+        };
+        for (const auto& c : cases) {
+            const bool ok = idna_lib::toASCIILimited(output, c.input, false,
+                c.max_input_size, c.max_mapped_length, c.max_label_length, c.max_combining_length);
+            tc.assert_equal(c.ok, ok, c.input);
+        }
+    });
+
     return ddt.result();
 }
 
@@ -318,6 +450,39 @@ inline bool is_error_of_to_unicode(const std::string& col) {
     return false;
 }
 
+// The ToASCII by the portable processing functions of `static_to_ascii`:
+// detail::map_code_points and detail::mapped_to_ascii
+static bool to_ascii_code_points(std::string& output, const std::string& input, bool transitional) {
+    const auto options =
+        upa::idna::Option::VerifyDnsLength |
+        upa::idna::Option::CheckHyphens |
+        upa::idna::Option::CheckBidi |
+        upa::idna::Option::CheckJoiners |
+        upa::idna::Option::UseSTD3ASCIIRules |
+        upa::idna::Option::FailFast |
+        (transitional ? upa::idna::Option::Transitional : upa::idna::Option::Default);
+    upa::idna::detail::buffers buff;
+    output.clear();
+    const bool res =
+        upa::idna::detail::map_code_points(buff.mapped, input.data(), input.data() + input.length(),
+            options, buff.nfc) &&
+        upa::idna::detail::mapped_to_ascii(output, buff.mapped, options, buff);
+    if (!res) output.clear();
+    return res;
+}
+
+// Returns true if the status column "[<code>, ...]" contains one of the `statuses`
+inline bool has_status(const std::string& col, const std::vector<std::string>& statuses) {
+    for (const auto& status : statuses) {
+        for (auto pos = col.find(status); pos != col.npos; pos = col.find(status, pos + 1)) {
+            const auto end = pos + status.length();
+            if ((col[pos - 1] == '[' || col[pos - 1] == ' ') && (col[end] == ',' || col[end] == ']'))
+                return true;
+        }
+    }
+    return false;
+}
+
 // stream operator
 template <class CharT, class Traits, class StrT>
 inline std::basic_ostream<CharT, Traits>& output_str(std::basic_ostream<CharT, Traits>& os, const StrT& str, const int width) {
@@ -353,6 +518,36 @@ inline std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, T
 
 #include "upa/idna/punycode.h"
 
+// Checks the fixed capacity punycode::encode or punycode::decode, called as
+// convert(output, output_length): the output of exact capacity succeeds, and
+// the output of one code unit less returns status::big_output; nothing is
+// written past the capacity
+template <typename CharT, class FunT>
+static void check_fixed_capacity(DataDrivenTest::TestCase& tc, const std::basic_string<CharT>& expected,
+    FunT convert, const std::string& name) {
+    using upa::idna::punycode::status;
+    constexpr auto guard = static_cast<CharT>(0x7F);
+    constexpr std::size_t guard_length = 4;
+    std::vector<CharT> buff(expected.length() + guard_length, guard);
+
+    std::size_t output_length = expected.length();
+    status res = convert(buff.data(), output_length);
+    tc.assert_equal(static_cast<int>(status::success), static_cast<int>(res), name + " success");
+    tc.assert_equal(expected.length(), output_length, name + " output_length");
+    tc.assert_equal(expected, std::basic_string<CharT>(buff.data(), output_length), name);
+    tc.assert_equal(true, std::all_of(buff.begin() + expected.length(), buff.end(),
+        [&](CharT c) { return c == guard; }), name + " guard");
+
+    if (!expected.empty()) {
+        std::fill(buff.begin(), buff.end(), guard);
+        output_length = expected.length() - 1;
+        res = convert(buff.data(), output_length);
+        tc.assert_equal(static_cast<int>(status::big_output), static_cast<int>(res), name + " (small) big_output");
+        tc.assert_equal(true, std::all_of(buff.begin() + expected.length() - 1, buff.end(),
+            [&](CharT c) { return c == guard; }), name + " (small) guard");
+    }
+}
+
 int run_punycode_tests(const std::filesystem::path& file_name)
 {
     DataDrivenTest ddt;
@@ -404,6 +599,16 @@ int run_punycode_tests(const std::filesystem::path& file_name)
                     ok = upa::idna::punycode::decode(out_decoded, inp_encoded.data(), inp_encoded.data() + inp_encoded.length()) == upa::idna::punycode::status::success;
                     tc.assert_equal(true, ok, "punycode::decode success");
                     tc.assert_equal(inp_source, out_decoded, "punycode::decode");
+
+                    // fixed capacity output
+                    check_fixed_capacity(tc, inp_encoded8, [&](char* output, std::size_t& output_length) {
+                        return upa::idna::punycode::encode(output, output_length,
+                            inp_source.data(), inp_source.data() + inp_source.length());
+                    }, "punycode::encode (fixed)");
+                    check_fixed_capacity(tc, inp_source, [&](char32_t* output, std::size_t& output_length) {
+                        return upa::idna::punycode::decode(output, output_length,
+                            inp_encoded.data(), inp_encoded.data() + inp_encoded.length());
+                    }, "punycode::decode (fixed)");
                 });
             }
             catch (const std::exception& ex) {
@@ -413,5 +618,320 @@ int run_punycode_tests(const std::filesystem::path& file_name)
         }
         case_name.clear();
     }
+
+    ddt.test_case("fixed capacity, empty input", [&](DataDrivenTest::TestCase& tc) {
+        const std::u32string empty;
+        check_fixed_capacity(tc, std::string{}, [&](char* output, std::size_t& output_length) {
+            return upa::idna::punycode::encode(output, output_length, empty.data(), empty.data());
+        }, "punycode::encode (fixed)");
+        check_fixed_capacity(tc, std::u32string{}, [&](char32_t* output, std::size_t& output_length) {
+            return upa::idna::punycode::decode(output, output_length, empty.data(), empty.data());
+        }, "punycode::decode (fixed)");
+    });
+
+    // The labels longer than kInsertCodePoints (1024) code points are decoded
+    // by placing the code points in order of their insert positions
+    ddt.test_case("long label round-trip", [&](DataDrivenTest::TestCase& tc) {
+        // code points in the pseudo-random order, so the insert positions are mixed
+        std::uint32_t rnd = 12345;
+        const auto next_rnd = [&]() {
+            rnd = rnd * 1103515245u + 12345u;
+            return rnd >> 8;
+        };
+        for (const std::uint32_t ascii_ratio : { 0u, 4u }) {
+            std::u32string source;
+            for (int ind = 0; ind < 2000; ++ind) {
+                const auto r = next_rnd();
+                if (ascii_ratio != 0 && r % ascii_ratio == 0)
+                    source.push_back(static_cast<char32_t>('a' + (r >> 4) % 26));
+                else if (r % 3 == 0)
+                    source.push_back(static_cast<char32_t>(0xC0 + (r >> 4) % 0x100));
+                else if (r % 3 == 1)
+                    source.push_back(static_cast<char32_t>(0x4E00 + (r >> 4) % 0x5000));
+                else
+                    source.push_back(static_cast<char32_t>(0x10000 + (r >> 4) % 0x20000));
+            }
+
+            std::string encoded;
+            auto res = upa::idna::punycode::encode(encoded, source.data(), source.data() + source.length());
+            tc.assert_equal(true, res == upa::idna::punycode::status::success, "punycode::encode success");
+            const std::u32string encoded32{ encoded.begin(), encoded.end() };
+
+            std::u32string decoded;
+            res = upa::idna::punycode::decode(decoded, encoded32.data(), encoded32.data() + encoded32.length());
+            tc.assert_equal(true, res == upa::idna::punycode::status::success, "punycode::decode success");
+            tc.assert_equal(true, source == decoded, "punycode::decode");
+
+            check_fixed_capacity(tc, source, [&](char32_t* output, std::size_t& output_length) {
+                return upa::idna::punycode::decode(output, output_length,
+                    encoded32.data(), encoded32.data() + encoded32.length());
+            }, "punycode::decode (fixed)");
+        }
+    });
+
     return ddt.result();
 }
+
+//
+// The error_info of to_ascii
+//
+
+int run_error_info_tests()
+{
+    DataDrivenTest ddt;
+    ddt.config_show_passed(false);
+    ddt.config_debug_break(false);
+
+    std::cout << "========== to_ascii error_info ==========\n";
+
+    using upa::idna::error_code;
+    const auto options = upa::idna::domain_options(true, false);
+
+    ddt.test_case("to_ascii error_info", [&](DataDrivenTest::TestCase& tc) {
+        const struct {
+            const char* input;
+            error_code code;
+            std::size_t label_index;
+            std::size_t offset;
+        } cases[] = {
+            { "abc.ab--c.com", error_code::hyphen_3_4, 1, 2 },
+            { "abc.-bc", error_code::hyphen_start_end, 1, 0 },
+            { "abc.a_b", error_code::disallowed, 1, 1 },
+            // U+200C ZERO WIDTH NON-JOINER
+            { "abc.a\xE2\x80\x8C" "b", error_code::joiner, 1, 1 },
+            // U+05D0 U+05D1 HEBREW LETTER ALEF, BET: "a" is not allowed in the RTL label
+            { "abc.\xD7\x90\xD7\x91" "a.com", error_code::bidi, 1, 2 },
+            // the offset in the decoded A-label: "xn--ab-j1t" is "a" U+200C "b"
+            { "abc.xn--ab-j1t.com", error_code::joiner, 1, 1 },
+            { "abc.xn--ab-.com", error_code::punycode_invalid, 1, 0 },
+            { "abc..com", error_code::label_length, 1, 0 },
+            { "abc.com", error_code::ok, 0, 0 },
+        };
+        std::string output;
+        for (const auto& c : cases) {
+            upa::idna::error_info err;
+            const bool ok = upa::idna::to_ascii(output, c.input, c.input + std::strlen(c.input),
+                options, err);
+            tc.assert_equal(c.code == error_code::ok, ok, c.input);
+            tc.assert_equal(static_cast<int>(c.code), static_cast<int>(err.code), std::string{ c.input } + " code");
+            tc.assert_equal(c.label_index, err.label_index, std::string{ c.input } + " label_index");
+            tc.assert_equal(c.offset, err.offset, std::string{ c.input } + " offset");
+        }
+    });
+
+    // the oversized domains fail early with Option::VerifyDnsLength, and are
+    // converted without it
+    ddt.test_case("to_ascii error_info DNS length", [&](DataDrivenTest::TestCase& tc) {
+        const auto domain_of_length = [](std::size_t length, const std::string& tail = {}) {
+            std::string domain;
+            while (domain.length() + tail.length() < length)
+                domain.append(domain.length() % 64 == 63 ? "." : "a");
+            return domain.append(tail);
+        };
+        std::string nonascii_label;
+        for (int i = 0; i < 64; ++i)
+            nonascii_label.append("\xC3\xA1"); // U+00E1
+        const struct {
+            std::string input;
+            bool input_ascii;
+            error_code code;
+            std::size_t label_index;
+        } cases[] = {
+            { domain_of_length(253), false, error_code::ok, 0 },
+            { domain_of_length(253), true, error_code::ok, 0 },
+            { domain_of_length(254), false, error_code::domain_length, 3 },
+            { domain_of_length(254), true, error_code::domain_length, 3 },
+            { domain_of_length(1000), false, error_code::domain_length, 3 },
+            { domain_of_length(1000), true, error_code::domain_length, 3 },
+            { domain_of_length(65536, "\xC3\xA1"), false, error_code::domain_length, 3 },
+            { nonascii_label + ".com", false, error_code::label_length, 0 },
+            { "com." + nonascii_label, false, error_code::label_length, 1 },
+        };
+        std::string output;
+        for (const auto& c : cases) {
+            const auto* first = c.input.data();
+            const auto* last = first + c.input.length();
+            const std::string name = c.input.substr(0, 16) + "... (" + std::to_string(c.input.length()) + ")";
+            const auto opt = c.input_ascii ? options | upa::idna::Option::InputASCII : options;
+            upa::idna::error_info err;
+            const bool ok = upa::idna::to_ascii(output, first, last, opt, err);
+            tc.assert_equal(c.code == error_code::ok, ok, name);
+            tc.assert_equal(static_cast<int>(c.code), static_cast<int>(err.code), name + " code");
+            tc.assert_equal(c.label_index, err.label_index, name + " label_index");
+            // without Option::VerifyDnsLength
+            const bool ok_nodns = upa::idna::to_ascii(output, first, last,
+                opt & ~upa::idna::Option::VerifyDnsLength);
+            tc.assert_equal(true, ok_nodns, name + " without VerifyDnsLength");
+        }
+    });
+
+    // the labels longer than 128 code points are encoded using the heap
+    // buffers of the Punycode encoder
+    ddt.test_case("to_ascii long label without VerifyDnsLength", [&](DataDrivenTest::TestCase& tc) {
+        const auto opt = options & ~upa::idna::Option::VerifyDnsLength;
+        for (const std::size_t label_length : { 128u, 129u, 300u }) {
+            // "a" and U+00E0 ... U+00F6
+            std::u32string label;
+            for (std::size_t ind = 0; ind < label_length; ++ind)
+                label.push_back(ind % 24 == 0 ? U'a' : static_cast<char32_t>(0xE0 + ind % 24 - 1));
+            std::string alabel{ "xn--" };
+            upa::idna::punycode::encode(alabel, label.data(), label.data() + label.length());
+            const std::u32string domain = label + U".com";
+            const std::string name = "label of " + std::to_string(label_length) + " code points";
+
+            std::string output;
+            const bool ok = upa::idna::to_ascii(output, domain.data(), domain.data() + domain.length(), opt);
+            tc.assert_equal(true, ok, name + " to_ascii success");
+            tc.assert_equal(alabel + ".com", output, name + " to_ascii");
+
+            std::u32string output32;
+            const bool ok32 = upa::idna::to_unicode(output32, output.data(), output.data() + output.length(), opt);
+            tc.assert_equal(true, ok32, name + " to_unicode success");
+            tc.assert_equal(true, domain == output32, name + " to_unicode");
+        }
+    });
+
+    // the limits are measured on the mapped code points before the normalization
+    // in all conversion paths: the ASCII, the non-ASCII and the InputASCII one
+    ddt.test_case("to_ascii error_info limit_exceeded", [&](DataDrivenTest::TestCase& tc) {
+        constexpr auto unlimited = upa::idna::limits::unlimited;
+        const struct {
+            const char* input;
+            bool input_ascii;
+            error_code code;
+            std::size_t max_input_size;
+            std::size_t max_mapped_length;
+            std::size_t max_label_length;
+            std::size_t max_combining_length;
+        } cases[] = {
+            { "abc.com", false, error_code::limit_exceeded, 6, unlimited, unlimited, unlimited },
+            { "abc.com", true, error_code::limit_exceeded, 6, unlimited, unlimited, unlimited },
+            { "abcdefgh.com", false, error_code::limit_exceeded, unlimited, 11, unlimited, unlimited },
+            { "abcdefgh.com", true, error_code::limit_exceeded, unlimited, 11, unlimited, unlimited },
+            { "abcdefghi.com", false, error_code::limit_exceeded, unlimited, unlimited, 8, unlimited },
+            { "abcdefghi.com", true, error_code::limit_exceeded, unlimited, unlimited, 8, unlimited },
+            { "\xC3\xA1" "bcdefghi.com", false, error_code::limit_exceeded, unlimited, 12, unlimited, unlimited },
+            { "\xC3\xA1" "bcdefghi.com", false, error_code::limit_exceeded, unlimited, unlimited, 8, unlimited },
+            // "a" U+0301 is normalized to U+00E1
+            { "a\xCC\x81", false, error_code::limit_exceeded, unlimited, 1, unlimited, unlimited },
+            { "a\xCC\x81", false, error_code::limit_exceeded, unlimited, unlimited, 1, unlimited },
+            { "xa\xCC\x81\xCC\x82\xCC\x81", false, error_code::limit_exceeded, unlimited, unlimited, unlimited, 2 },
+            // the limits are checked before the rules
+            { "ab--cdefghi.com", false, error_code::limit_exceeded, unlimited, unlimited, 8, unlimited },
+            { "ab--c.com", false, error_code::hyphen_3_4, 100, 100, 8, 2 },
+            { "xa\xCC\x81\xCC\x82", false, error_code::ok, 100, 100, 8, 2 },
+        };
+        std::string output;
+        for (const auto& c : cases) {
+            upa::idna::limits lim;
+            lim.max_input_size = c.max_input_size;
+            lim.max_mapped_length = c.max_mapped_length;
+            lim.max_label_length = c.max_label_length;
+            lim.max_combining_length = c.max_combining_length;
+            upa::idna::context ctx(lim);
+            upa::idna::error_info err;
+            const bool ok = upa::idna::to_ascii(ctx, output, c.input, c.input + std::strlen(c.input),
+                c.input_ascii ? options | upa::idna::Option::InputASCII : options, err);
+            tc.assert_equal(c.code == error_code::ok, ok, c.input);
+            tc.assert_equal(static_cast<int>(c.code), static_cast<int>(err.code), std::string{ c.input } + " code");
+        }
+    });
+
+    return ddt.result();
+}
+
+//
+// The result_cache statistics
+//
+
+int run_cache_tests()
+{
+    DataDrivenTest ddt;
+    ddt.config_show_passed(false);
+    ddt.config_debug_break(false);
+
+    std::cout << "========== result_cache ==========\n";
+
+    const auto options = upa::idna::domain_options(false, false);
+
+    const auto assert_stats = [](DataDrivenTest::TestCase& tc, const upa::idna::result_cache& cache,
+        std::uint64_t hits, std::uint64_t misses, std::size_t size, const std::string& name) {
+        const auto st = cache.stats();
+        tc.assert_equal(hits, st.hits, name + " hits");
+        tc.assert_equal(misses, st.misses, name + " misses");
+        tc.assert_equal(size, st.size, name + " size");
+    };
+
+    ddt.test_case("result_cache repeated lookup", [&](DataDrivenTest::TestCase& tc) {
+        upa::idna::result_cache cache(16, 2);
+        const std::string input{ "B\xC3\xBC" "cher.example" };
+        const auto* first = input.data();
+        const auto* last = first + input.length();
+        std::string output;
+        assert_stats(tc, cache, 0, 0, 0, "empty");
+
+        tc.assert_equal(true, cache.to_ascii(output, first, last, options), "first to_ascii success");
+        tc.assert_equal(std::string{ "xn--bcher-kva.example" }, output, "first to_ascii");
+        assert_stats(tc, cache, 0, 1, 1, "first");
+
+        tc.assert_equal(true, cache.to_ascii(output, first, last, options), "second to_ascii success");
+        tc.assert_equal(std::string{ "xn--bcher-kva.example" }, output, "second to_ascii");
+        assert_stats(tc, cache, 1, 1, 1, "second");
+
+        cache.clear();
+        assert_stats(tc, cache, 0, 0, 0, "cleared");
+    });
+
+    // the inputs longer than max_input_size bytes are converted, but not looked
+    // up and not cached
+    ddt.test_case("result_cache input over max_input_size", [&](DataDrivenTest::TestCase& tc) {
+        upa::idna::result_cache cache(16, 2);
+        const auto opt = options & ~upa::idna::Option::VerifyDnsLength;
+        for (const std::size_t input_size : { upa::idna::result_cache::max_input_size,
+            upa::idna::result_cache::max_input_size + 1 }) {
+            std::string input;
+            while (input.length() < input_size)
+                input.append(input.length() % 64 == 63 ? "." : "a");
+            const auto* first = input.data();
+            const auto* last = first + input.length();
+            const bool cached = input_size <= upa::idna::result_cache::max_input_size;
+            const std::string name = "input of " + std::to_string(input_size) + " bytes";
+
+            std::string expected;
+            const bool expected_ok = upa::idna::to_ascii(expected, first, last, opt);
+            tc.assert_equal(true, expected_ok, name + " to_ascii success");
+
+            cache.clear();
+            std::string output;
+            for (int pass = 0; pass < 2; ++pass) {
+                const bool ok = cache.to_ascii(output, first, last, opt);
+                tc.assert_equal(expected_ok, ok, name + " (cache) to_ascii success");
+                tc.assert_equal(expected, output, name + " (cache) to_ascii");
+            }
+            if (cached)
+                assert_stats(tc, cache, 1, 1, 1, name);
+            else
+                assert_stats(tc, cache, 0, 0, 0, name);
+        }
+    });
+
+    return ddt.result();
+}
+
+//
+// Compile-time ToASCII tests
+//
+
+#ifdef UPA_IDNA_CPP_20
+// mapping, NFC normalization and Punycode of UTF-8, UTF-16 and UTF-32 literals
+static_assert(upa::idna::static_to_ascii(u8"bücher.example").view() == "xn--bcher-kva.example");
+static_assert(upa::idna::static_to_ascii(u"ÖBB.at").view() == "xn--bb-eka.at");
+static_assert(upa::idna::static_to_ascii(U"faß.de").view() == "xn--fa-hia.de");
+static_assert(upa::idna::static_to_ascii(u8"Å.example").view() == "xn--5ca.example");
+static_assert(upa::idna::static_to_ascii("EXAMPLE.com").view() == "example.com");
+// the options
+static_assert(upa::idna::static_to_ascii("a_b.com", upa::idna::domain_options(false, true)).view() == "a_b.com");
+static_assert(upa::idna::static_to_ascii(U"faß.de", upa::idna::Option::Transitional).view() == "fass.de");
+// the capacity
+static_assert(upa::idna::static_to_ascii<3>("abc").size() == 3);
+#endif
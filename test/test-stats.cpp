@@ -0,0 +1,104 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+#include "upa/idna.h"
+#include "ddt/DataDrivenTest.hpp"
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+// The processing stage counters; requires the library built with UPA_IDNA_STATS
+
+using upa::idna::stats_quick_check;
+using upa::idna::stats_stage;
+
+struct stage_count {
+    stats_stage stage;
+    std::uint64_t calls;
+    std::uint64_t bytes;
+};
+
+template <typename CharT>
+static void check_stats(DataDrivenTest::TestCase& tc, const std::basic_string<CharT>& input,
+    upa::idna::Option options, const std::string& expected_output,
+    std::initializer_list<stage_count> expected, std::uint64_t qc_yes, std::uint64_t qc_maybe) {
+    std::string output;
+    upa::idna::reset_stats();
+    const bool ok = upa::idna::to_ascii(output, input.data(), input.data() + input.length(), options);
+    const auto stats = upa::idna::get_stats();
+
+    tc.assert_equal(true, ok, "to_ascii success");
+    tc.assert_equal(expected_output, output, "to_ascii output");
+    for (std::size_t ind = 0; ind < static_cast<std::size_t>(stats_stage::count); ++ind) {
+        const auto stage = static_cast<stats_stage>(ind);
+        stage_count exp{ stage, 0, 0 };
+        for (const auto& item : expected) {
+            if (item.stage == stage)
+                exp = item;
+        }
+        const std::string name = upa::idna::stats_stage_name(stage);
+        tc.assert_equal(exp.calls, stats[stage].calls, name + " calls");
+        tc.assert_equal(exp.bytes, stats[stage].bytes, name + " bytes");
+    }
+    tc.assert_equal(qc_yes, stats[stats_quick_check::yes], "quick check yes");
+    tc.assert_equal(qc_maybe, stats[stats_quick_check::maybe], "quick check maybe");
+    tc.assert_equal(std::uint64_t{ 0 }, stats[stats_quick_check::no], "quick check no");
+}
+
+int main()
+{
+    DataDrivenTest ddt;
+    ddt.config_show_passed(false);
+    ddt.config_debug_break(false);
+
+    const auto options = upa::idna::domain_options(true, false);
+
+    ddt.test_case("ASCII fast path", [&](DataDrivenTest::TestCase& tc) {
+        check_stats(tc, std::string{ "Example.com" }, options, "example.com", {}, 0, 0);
+    });
+
+    // The map stage counts the bytes of input, in any encoding
+    ddt.test_case("UTF-8 input", [&](DataDrivenTest::TestCase& tc) {
+        check_stats(tc, std::string{ "b\xC3\xBC" "cher.example" }, options, "xn--bcher-kva.example", {
+            { stats_stage::map, 1, 15 },
+            { stats_stage::punycode_encode, 1, 6 * 4 },
+            { stats_stage::validate_label, 2, 13 * 4 },
+            { stats_stage::validate_bidi, 2, 13 * 4 },
+        }, 2, 0);
+    });
+    ddt.test_case("UTF-16 input", [&](DataDrivenTest::TestCase& tc) {
+        check_stats(tc, std::u16string{ u"bücher.example" }, options, "xn--bcher-kva.example", {
+            { stats_stage::map, 1, 14 * 2 },
+            { stats_stage::punycode_encode, 1, 6 * 4 },
+            { stats_stage::validate_label, 2, 13 * 4 },
+            { stats_stage::validate_bidi, 2, 13 * 4 },
+        }, 2, 0);
+    });
+
+    ddt.test_case("NFC normalization", [&](DataDrivenTest::TestCase& tc) {
+        // U+0075 U+0308 is composed to U+00FC
+        check_stats(tc, std::string{ "Bu\xCC\x88" "cher.de" }, options, "xn--bcher-kva.de", {
+            { stats_stage::map, 1, 11 },
+            { stats_stage::normalize_nfc, 1, 7 * 4 },
+            { stats_stage::canonical_decompose, 1, 7 * 4 },
+            { stats_stage::compose, 1, 7 * 4 },
+            { stats_stage::punycode_encode, 1, 6 * 4 },
+            { stats_stage::validate_label, 2, 8 * 4 },
+            { stats_stage::validate_bidi, 2, 8 * 4 },
+        }, 1, 1);
+    });
+
+    ddt.test_case("Punycode decoding", [&](DataDrivenTest::TestCase& tc) {
+        check_stats(tc, std::string{ "xn--bcher-kva.example" }, upa::idna::domain_options(true, true),
+            "xn--bcher-kva.example", {
+            { stats_stage::map, 1, 21 },
+            { stats_stage::normalize_nfc, 1, 6 * 4 },
+            { stats_stage::punycode_decode, 1, 9 * 4 },
+            { stats_stage::validate_label, 2, 13 * 4 },
+            { stats_stage::validate_bidi, 2, 13 * 4 },
+        }, 1, 0);
+    });
+
+    return ddt.result();
+}
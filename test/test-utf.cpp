@@ -2,10 +2,12 @@
 // Distributed under the BSD-style license that can be
 // found in the LICENSE file.
 //
-#include "../src/iterate_utf.h"
+#include "upa/idna/detail/iterate_utf.h"
 #include "ddt/DataDrivenTest.hpp"
 #include "convert_utf.h"
 #include <iterator>
+#include <random>
+#include <string>
 
 template <class T>
 inline bool is_surrogate(T ch) {
@@ -34,5 +36,66 @@ int main()
         }
     });
 
+    ddt.test_case("UTF-8 block decoding", [&](DataDrivenTest::TestCase& tc) {
+        // Mostly ASCII with valid and invalid UTF-8 sequences
+        static const char* const pieces[] = {
+            "a", "b", ".", "-", "0123456789abcdef", "\xC3\xBC", "\xE6\x97\xA5",
+            "\xF0\x9F\x98\x80", "\x80", "\xC3", "\xE6\x97", "\xF0\x9F\x98", "\xED\xA0\x80",
+            "\xFF", "\xC0\xAF"
+        };
+        std::mt19937 gen(1); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+        for (int n = 0; n < 20000; ++n) {
+            std::string str_utf8;
+            const auto count = gen() % 40;
+            for (std::size_t i = 0; i < count; ++i)
+                str_utf8 += pieces[gen() % std::size(pieces)];
+            const auto* const first = str_utf8.data();
+            const auto* const last = str_utf8.data() + str_utf8.length();
+
+            std::u32string expected;
+            for (const auto* it = first; it != last;)
+                expected.push_back(upa::idna::util::getCodePoint(it, last));
+
+            std::u32string decoded;
+            char32_t block[20];
+            for (const auto* it = first; it != last;) {
+                const auto len = upa::idna::util::decodeBlock(it, last, block, 1 + gen() % std::size(block));
+                decoded.append(block, len);
+            }
+
+            tc.assert_equal(true, expected == decoded, "decoded block");
+        }
+    });
+
+    ddt.test_case("UTF-16 block decoding", [&](DataDrivenTest::TestCase& tc) {
+        // Mostly BMP with surrogate pairs and unpaired surrogates
+        static const char16_t* const pieces[] = {
+            u"a", u".", u"0123456789abcdef", u"\u00FC", u"\u65E5\u672C", u"\uFFFD",
+            u"\U0001F600", u"\xD83D", u"\xDE00", u"\xDBFF\xDFFF"
+        };
+        std::mt19937 gen(1); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+        for (int n = 0; n < 20000; ++n) {
+            std::u16string str_utf16;
+            const auto count = gen() % 40;
+            for (std::size_t i = 0; i < count; ++i)
+                str_utf16 += pieces[gen() % std::size(pieces)];
+            const auto* const first = str_utf16.data();
+            const auto* const last = str_utf16.data() + str_utf16.length();
+
+            std::u32string expected;
+            for (const auto* it = first; it != last;)
+                expected.push_back(upa::idna::util::getCodePoint(it, last));
+
+            std::u32string decoded;
+            char32_t block[20];
+            for (const auto* it = first; it != last;) {
+                const auto len = upa::idna::util::decodeBlock(it, last, block, 1 + gen() % std::size(block));
+                decoded.append(block, len);
+            }
+
+            tc.assert_equal(true, expected == decoded, "decoded block");
+        }
+    });
+
     return ddt.result();
 }
@@ -10,3 +10,4 @@ cd %p%..
 REM Amalgamate
 python tools/amalgamate/amalgamate.py -c tools/amalgamate/config-cpp.json -s . -p tools/amalgamate/config-cpp.prologue --no-duplicates
 python tools/amalgamate/amalgamate.py -c tools/amalgamate/config-h.json -s . --no-duplicates
+python tools/amalgamate/amalgamate.py -c tools/amalgamate/config-static-h.json -s . --no-duplicates
@@ -10,3 +10,4 @@ cd $p/..
 # Amalgamate
 python3 tools/amalgamate/amalgamate.py -c tools/amalgamate/config-cpp.json -s . -p tools/amalgamate/config-cpp.prologue --no-duplicates
 python3 tools/amalgamate/amalgamate.py -c tools/amalgamate/config-h.json -s . --no-duplicates
+python3 tools/amalgamate/amalgamate.py -c tools/amalgamate/config-static-h.json -s . --no-duplicates
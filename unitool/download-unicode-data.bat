@@ -12,7 +12,7 @@ for %%f in (IdnaMappingTable.txt) do (
   curl -fsS -o %p%\data\%%f https://www.unicode.org/Public/%UVER%/idna/%%f
 )
 
-for %%f in (DerivedNormalizationProps.txt UnicodeData.txt) do (
+for %%f in (DerivedNormalizationProps.txt Scripts.txt UnicodeData.txt) do (
   curl -fsS -o %p%\data\%%f https://www.unicode.org/Public/%UVER%/ucd/%%f
 )
 
@@ -14,7 +14,7 @@ do
   curl -fsS -o $p/data/$f https://www.unicode.org/Public/${UVER}/idna/$f
 done
 
-for f in DerivedNormalizationProps.txt UnicodeData.txt
+for f in DerivedNormalizationProps.txt Scripts.txt UnicodeData.txt
 do
   curl -fsS -o $p/data/$f https://www.unicode.org/Public/${UVER}/ucd/$f
 done
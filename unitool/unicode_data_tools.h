@@ -349,7 +349,7 @@ inline std::size_t block_info::calc_mem_size2(const std::vector<T>& arrValues, s
         std::size_t chunk_size = std::min(block_size, arrValues.size() - ind);
         array_view_T block(arrValues.data() + ind, chunk_size);
 
-        auto res = blocks.insert(BlokcsMap::value_type(block, index));
+        auto res = blocks.insert(typename BlokcsMap::value_type(block, index));
         if (res.second) {
             // for (const char_item& chitem : block) out(chitem.value);
             blockIndex.push_back(index);
@@ -385,6 +385,150 @@ inline std::size_t block_info::calc_mem_size2(const std::vector<T>& arrValues, s
     return total_mem();
 }
 
+// Lookup table layouts of the values of code points [0, count)
+
+// Two-level table: the value of the code point `cp` is
+// blocks[(index[cp >> shift] << shift) | (cp & mask)]
+template <class T>
+struct table_layout2 {
+    int shift = 0;
+    std::vector<T> blocks;
+    std::vector<std::uint32_t> index;
+
+    std::size_t mem_size(std::size_t value_size = sizeof(T)) const {
+        return blocks.size() * value_size + index.size() * getUIntSize(index);
+    }
+    std::uint32_t mask() const {
+        return 0xffffffff >> (32 - shift);
+    }
+    T lookup(std::uint32_t cp) const {
+        return blocks[(index[cp >> shift] << shift) | (cp & mask())];
+    }
+};
+
+// Three-level table like the ICU's UCPTrie: the BMP code points are looked up
+// in the two-level "fast" index, and the supplementary ones in the three-level
+// "slow" index. The indexes contain the offsets of blocks:
+// BMP: blocks[bmp_index[cp >> bmp_shift] + (cp & bmp_mask)]
+// supplementary, scp = cp - 0x10000:
+// blocks[supp_index2[supp_index1[scp >> (shift2 + shift3)] + ((scp >> shift3) & mask2)] + (scp & mask3)]
+template <class T>
+struct table_layout3 {
+    int bmp_shift = 0;
+    int supp_shift2 = 0; // index2 block size
+    int supp_shift3 = 0; // data block size
+    std::vector<T> blocks;
+    std::vector<std::uint32_t> bmp_index;
+    std::vector<std::uint32_t> supp_index1;
+    std::vector<std::uint32_t> supp_index2;
+
+    std::size_t mem_size(std::size_t value_size = sizeof(T)) const {
+        return blocks.size() * value_size +
+            bmp_index.size() * getUIntSize(bmp_index) +
+            supp_index1.size() * getUIntSize(supp_index1) +
+            supp_index2.size() * getUIntSize(supp_index2);
+    }
+    static std::uint32_t mask(int shift) {
+        return 0xffffffff >> (32 - shift);
+    }
+    T lookup(std::uint32_t cp) const {
+        if (cp <= 0xFFFF)
+            return blocks[bmp_index[cp >> bmp_shift] + (cp & mask(bmp_shift))];
+        const std::uint32_t scp = cp - 0x10000;
+        const std::uint32_t i2 = supp_index1[scp >> (supp_shift2 + supp_shift3)] +
+            ((scp >> supp_shift3) & mask(supp_shift2));
+        return blocks[supp_index2[i2] + (scp & mask(supp_shift3))];
+    }
+};
+
+// Appends the block of `block_size` items to `arr` if there is no such block
+// already, and returns its offset
+template <class T, class U>
+inline std::uint32_t add_block(std::vector<T>& arr, std::map<std::vector<T>, std::uint32_t>& blocks,
+    const std::vector<U>& values, std::size_t first, std::size_t block_size)
+{
+    std::vector<T> block(block_size);
+    for (std::size_t ind = 0; ind < block_size; ++ind) {
+        block[ind] = first + ind < values.size()
+            ? static_cast<T>(values[first + ind])
+            : static_cast<T>(values.back());
+    }
+    const auto res = blocks.emplace(block, static_cast<std::uint32_t>(arr.size()));
+    if (res.second)
+        arr.insert(arr.end(), block.begin(), block.end());
+    return res.first->second;
+}
+
+template <class T>
+inline table_layout2<T> make_table_layout2(const std::vector<T>& values, std::size_t count, int shift) {
+    table_layout2<T> layout;
+    layout.shift = shift;
+
+    const std::size_t block_size = static_cast<std::size_t>(1) << shift;
+    std::map<std::vector<T>, std::uint32_t> blocks;
+    for (std::size_t cp = 0; cp < count; cp += block_size) {
+        const auto offset = add_block(layout.blocks, blocks, values, cp, block_size);
+        layout.index.push_back(offset >> shift);
+    }
+    return layout;
+}
+
+template <class T>
+inline table_layout3<T> make_table_layout3(const std::vector<T>& values, std::size_t count,
+    int bmp_shift, int supp_shift2, int supp_shift3)
+{
+    table_layout3<T> layout;
+    layout.bmp_shift = bmp_shift;
+    layout.supp_shift2 = supp_shift2;
+    layout.supp_shift3 = supp_shift3;
+
+    std::map<std::vector<T>, std::uint32_t> blocks;
+
+    // BMP
+    const std::size_t bmp_count = std::min<std::size_t>(count, 0x10000);
+    const std::size_t bmp_block_size = static_cast<std::size_t>(1) << bmp_shift;
+    for (std::size_t cp = 0; cp < bmp_count; cp += bmp_block_size)
+        layout.bmp_index.push_back(add_block(layout.blocks, blocks, values, cp, bmp_block_size));
+
+    // Supplementary code points
+    if (count > 0x10000) {
+        const std::size_t block_size = static_cast<std::size_t>(1) << supp_shift3;
+        std::vector<std::uint32_t> index2_full;
+        for (std::size_t cp = 0x10000; cp < count; cp += block_size)
+            index2_full.push_back(add_block(layout.blocks, blocks, values, cp, block_size));
+
+        const std::size_t index2_block_size = static_cast<std::size_t>(1) << supp_shift2;
+        std::map<std::vector<std::uint32_t>, std::uint32_t> index2_blocks;
+        for (std::size_t ind = 0; ind < index2_full.size(); ind += index2_block_size) {
+            layout.supp_index1.push_back(add_block(layout.supp_index2, index2_blocks,
+                index2_full, ind, index2_block_size));
+        }
+    }
+    return layout;
+}
+
+// Finds the parameters of the smallest three-level table
+template <class T>
+inline table_layout3<T> find_smallest_layout3(const std::vector<T>& values, std::size_t count,
+    std::size_t value_size = sizeof(T))
+{
+    table_layout3<T> min_layout;
+    std::size_t min_mem_size = static_cast<std::size_t>(-1);
+    for (int bmp_shift = 4; bmp_shift <= 8; ++bmp_shift) {
+        for (int supp_shift2 = 2; supp_shift2 <= 8; ++supp_shift2) {
+            for (int supp_shift3 = 2; supp_shift3 <= 8; ++supp_shift3) {
+                auto layout = make_table_layout3(values, count, bmp_shift, supp_shift2, supp_shift3);
+                const std::size_t mem_size = layout.mem_size(value_size);
+                if (min_mem_size > mem_size) {
+                    min_mem_size = mem_size;
+                    min_layout = std::move(layout);
+                }
+            }
+        }
+    }
+    return min_layout;
+}
+
 template <typename ValT>
 struct special_ranges {
     using value_type = ValT;
@@ -431,6 +575,46 @@ struct special_ranges {
     }
 };
 
+// Output code point values
+
+inline std::string code_point_to_str(std::size_t cp) {
+    std::string str;
+    unsigned_to_str(cp, str, static_cast<std::size_t>(16));
+    if (str.length() < 4)
+        str.insert(0, 4 - str.length(), '0');
+    return str;
+}
+
+// Outputs the values of all code points in the Unicode data file format, so
+// they can be read by parse_UnicodeData. Each line contains the range of code
+// points having the same value; `value_to_str(str, item)` appends the columns
+// of the value separated by semicolons to `str`.
+template <class T, class FunT>
+inline void output_code_point_values(std::ostream& out, const std::vector<T>& arr, FunT value_to_str) {
+    std::string range_value;
+    std::size_t range_start = 0;
+    const auto output_range = [&](std::size_t range_end) {
+        out << code_point_to_str(range_start);
+        if (range_end != range_start)
+            out << ".." << code_point_to_str(range_end);
+        out << " ; " << range_value << '\n';
+    };
+
+    for (std::size_t cp = 0; cp < arr.size(); ++cp) {
+        std::string value;
+        value_to_str(value, arr[cp]);
+        if (cp == 0) {
+            range_value = std::move(value);
+        } else if (value != range_value) {
+            output_range(cp - 1);
+            range_start = cp;
+            range_value = std::move(value);
+        }
+    }
+    if (!arr.empty())
+        output_range(arr.size() - 1);
+}
+
 // Output result
 
 // OutputFmt class
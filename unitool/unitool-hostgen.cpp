@@ -0,0 +1,452 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+// Generates synthetic hostnames for benchmarks and load tests
+//
+#include "unicode_data_tools.h"
+#include "upa/idna/detail/iterate_utf.h"
+#include "upa/idna/punycode.h"
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <utility>
+
+using namespace upa::tools;
+
+
+// Weighted choice: "name:weight,name:weight,..."
+using weights_t = std::vector<std::pair<std::string, double>>;
+
+struct generator_options {
+    std::uint32_t seed = 1;
+    std::size_t count = 100000;
+    // Real-world like defaults: most hostnames are ASCII
+    weights_t scripts{
+        { "ascii", 900 }, { "latin", 30 }, { "cyrillic", 20 }, { "han", 20 },
+        { "japanese", 5 }, { "hangul", 5 }, { "arabic", 5 }, { "greek", 2 },
+        { "hebrew", 2 }, { "devanagari", 2 }, { "thai", 1 }, { "emoji", 1 }
+    };
+    // Lengths (in code points) of the labels except the top-level domain
+    weights_t lengths{
+        { "1", 1 }, { "2", 2 }, { "3", 5 }, { "4", 7 }, { "5", 9 }, { "6", 11 },
+        { "7", 12 }, { "8", 11 }, { "9", 10 }, { "10", 8 }, { "11", 6 }, { "12", 5 },
+        { "13", 4 }, { "14", 3 }, { "15", 2 }, { "16", 2 }, { "18", 1 }, { "20", 1 },
+        { "25", 1 }
+    };
+    // The number of labels including the top-level domain
+    weights_t labels{ { "2", 55 }, { "3", 35 }, { "4", 10 } };
+    double punycode_percent = 20; // of the non-ASCII hostnames
+    double error_percent = 1;
+};
+
+static bool parse_options(int argc, char* argv[], generator_options& opt);
+static bool generate_hostnames(const std::filesystem::path& data_path,
+    const std::filesystem::path& output_path, const generator_options& opt);
+
+int main(int argc, char* argv[])
+{
+    generator_options opt;
+    if (argc < 3 || !parse_options(argc - 3, argv + 3, opt)) {
+        std::cerr <<
+            "unitool-hostgen <data directory path> <output file> [options]\n"
+            "\n"
+            "Generates the newline-delimited UTF-8 hostnames. Specify the directory path\n"
+            "where the following files are located:\n"
+            " DerivedCombiningClass.txt\n"
+            " DerivedGeneralCategory.txt\n"
+            " DerivedNormalizationProps.txt\n"
+            " IdnaMappingTable.txt\n"
+            " Scripts.txt\n"
+            "\n"
+            "Options:\n"
+            " --seed N         random generator seed (default: 1)\n"
+            " --count N        the number of hostnames (default: 100000)\n"
+            " --scripts LIST   script mix, for example: ascii:90,latin:5,han:5; scripts:\n"
+            "                  ascii, latin, cyrillic, greek, han, japanese, hangul, arabic,\n"
+            "                  hebrew, devanagari, thai, emoji\n"
+            " --lengths LIST   label length histogram, for example: 3:10,8:20,12:5\n"
+            " --labels LIST    label count histogram, for example: 2:60,3:40\n"
+            " --punycode P     percent of the non-ASCII hostnames in the Punycode form (default: 20)\n"
+            " --errors P       percent of invalid hostnames (default: 1)\n"
+            "\n"
+            "Invalid hostnames have one of the errors: disallowed code point, leading\n"
+            "combining mark, ASCII only Punycode label (detected always); bidi rule\n"
+            "violation (Option::CheckBidi); leading hyphen (Option::CheckHyphens);\n"
+            "too long label (Option::VerifyDnsLength).\n";
+        return 1;
+    }
+    try {
+        return generate_hostnames(argv[1], argv[2], opt) ? 0 : 2;
+    }
+    catch (const std::exception& ex) {
+        std::cerr << "ERROR: " << ex.what() << std::endl;
+        return 2;
+    }
+}
+
+
+// ==================================================================
+// Command line
+
+static bool parse_weights(const char* str, weights_t& weights) {
+    weights.clear();
+    const std::string list{ str };
+    bool ok = true;
+    split(list.data(), list.data() + list.length(), ',', [&](const char* first, const char* last) {
+        const std::string item{ first, last };
+        const std::size_t pos = item.find(':');
+        if (pos == item.npos || pos == 0) {
+            ok = false;
+            return;
+        }
+        try {
+            weights.emplace_back(item.substr(0, pos), std::stod(item.substr(pos + 1)));
+        }
+        catch (const std::exception&) {
+            ok = false;
+        }
+    });
+    return ok && !weights.empty();
+}
+
+static bool parse_options(int argc, char* argv[], generator_options& opt) {
+    for (int i = 0; i + 1 < argc; i += 2) {
+        const char* name = argv[i];
+        const char* value = argv[i + 1];
+        try {
+            if (std::strcmp(name, "--seed") == 0) {
+                opt.seed = static_cast<std::uint32_t>(std::stoul(value));
+            } else if (std::strcmp(name, "--count") == 0) {
+                opt.count = static_cast<std::size_t>(std::stoull(value));
+            } else if (std::strcmp(name, "--scripts") == 0) {
+                if (!parse_weights(value, opt.scripts)) return false;
+            } else if (std::strcmp(name, "--lengths") == 0) {
+                if (!parse_weights(value, opt.lengths)) return false;
+            } else if (std::strcmp(name, "--labels") == 0) {
+                if (!parse_weights(value, opt.labels)) return false;
+            } else if (std::strcmp(name, "--punycode") == 0) {
+                opt.punycode_percent = std::stod(value);
+            } else if (std::strcmp(name, "--errors") == 0) {
+                opt.error_percent = std::stod(value);
+            } else {
+                std::cerr << "Unknown option: " << name << std::endl;
+                return false;
+            }
+        }
+        catch (const std::exception&) {
+            std::cerr << "Invalid value of " << name << ": " << value << std::endl;
+            return false;
+        }
+    }
+    return argc % 2 == 0;
+}
+
+
+// ==================================================================
+// Code point pools
+
+struct script_def {
+    const char* name;
+    std::vector<const char*> scripts; // Scripts.txt values; empty for ASCII
+    std::vector<std::u32string> tlds;
+    int ascii_percent;     // percent of ASCII letters and digits in labels
+    int length_divisor;    // labels of ideographic scripts are shorter
+    bool emoji;            // uses So symbols of U+1F300..U+1FAFF
+};
+
+static const script_def script_defs[] = {
+    { "ascii", {}, { U"com", U"net", U"org", U"de", U"uk", U"io" }, 100, 1, false },
+    { "latin", { "Latin" }, { U"com", U"de", U"fr", U"es", U"pl" }, 75, 1, false },
+    { "cyrillic", { "Cyrillic" }, { U"com", U"ru", U"рф", U"бг" }, 0, 1, false },
+    { "greek", { "Greek" }, { U"gr", U"ελ" }, 0, 1, false },
+    { "han", { "Han" }, { U"com", U"cn", U"中国", U"香港" }, 0, 3, false },
+    { "japanese", { "Hiragana", "Katakana", "Han" }, { U"jp", U"com", U"みんな" }, 0, 3, false },
+    { "hangul", { "Hangul" }, { U"kr", U"한국" }, 0, 3, false },
+    { "arabic", { "Arabic" }, { U"com", U"مصر", U"السعودية" }, 0, 1, false },
+    { "hebrew", { "Hebrew" }, { U"il", U"ישראל" }, 0, 1, false },
+    { "devanagari", { "Devanagari" }, { U"in", U"भारत" }, 0, 1, false },
+    { "thai", { "Thai" }, { U"th", U"ไทย" }, 0, 1, false },
+    { "emoji", {}, { U"com", U"ws", U"to" }, 30, 2, true },
+};
+
+struct script_pool {
+    const script_def* def = nullptr;
+    std::vector<char32_t> letters; // valid, NFC_QC=Y, general category L*
+    std::vector<char32_t> marks;   // valid, NFC_QC=Y, ccc=0, general category M*
+};
+
+struct unicode_pools {
+    std::vector<script_pool> scripts;
+    std::vector<char32_t> disallowed; // non-ASCII disallowed, not surrogates
+    std::vector<char32_t> leading_marks; // valid Mn
+};
+
+static bool load_pools(const std::filesystem::path& data_path, unicode_pools& pools) {
+    enum : std::uint8_t {
+        IS_VALID = 0x01, IS_DISALLOWED = 0x02, IS_LETTER = 0x04, IS_MARK = 0x08,
+        IS_NONSPACING = 0x10, IS_SYMBOL = 0x20, NOT_NFC = 0x40, NOT_STARTER = 0x80
+    };
+    std::vector<std::uint8_t> props(MAX_CODE_POINT + 1);
+    std::vector<std::string> script(MAX_CODE_POINT + 1);
+    int files_loaded = 0;
+    const auto parse = [&](const char* name, auto fun) {
+        const auto file_name = data_path / name;
+        if (std::filesystem::exists(file_name)) {
+            parse_UnicodeData<2>(file_name, fun);
+            ++files_loaded;
+        } else {
+            std::cerr << "Can't open data file: " << file_name << std::endl;
+        }
+    };
+
+    parse("IdnaMappingTable.txt", [&](int cp0, int cp1, const auto& col) {
+        const std::uint8_t value =
+            col[0] == "valid" ? IS_VALID : (col[0] == "disallowed" ? IS_DISALLOWED : 0);
+        for (int cp = cp0; cp <= cp1; cp++)
+            props[cp] |= value;
+    });
+    parse("DerivedGeneralCategory.txt", [&](int cp0, int cp1, const auto& col) {
+        std::uint8_t value = 0;
+        if (col[0] == "Lo" || col[0] == "Ll") value = IS_LETTER;
+        else if (col[0] == "Mn") value = IS_MARK | IS_NONSPACING;
+        else if (col[0] == "Mc") value = IS_MARK;
+        else if (col[0] == "So") value = IS_SYMBOL;
+        for (int cp = cp0; cp <= cp1; cp++)
+            props[cp] |= value;
+    });
+    parse("DerivedNormalizationProps.txt", [&](int cp0, int cp1, const auto& col) {
+        if (col[0] == "NFC_QC") {
+            for (int cp = cp0; cp <= cp1; cp++)
+                props[cp] |= NOT_NFC;
+        }
+    });
+    parse("DerivedCombiningClass.txt", [&](int cp0, int cp1, const auto& col) {
+        if (col[0] != "0") {
+            for (int cp = cp0; cp <= cp1; cp++)
+                props[cp] |= NOT_STARTER;
+        }
+    });
+    parse("Scripts.txt", [&](int cp0, int cp1, const auto& col) {
+        for (int cp = cp0; cp <= cp1; cp++)
+            script[cp] = col[0];
+    });
+    if (files_loaded != 5)
+        return false;
+
+    for (const auto& def : script_defs) {
+        script_pool pool;
+        pool.def = &def;
+        for (int cp = 0x80; cp <= MAX_CODE_POINT; cp++) {
+            const std::uint8_t value = props[cp];
+            // Any sequence of these code points is in NFC
+            if (!(value & IS_VALID) || (value & (NOT_NFC | NOT_STARTER)))
+                continue;
+            if (def.emoji) {
+                if (cp >= 0x1F300 && cp <= 0x1FAFF && (value & IS_SYMBOL))
+                    pool.letters.push_back(static_cast<char32_t>(cp));
+            } else if (std::find(def.scripts.begin(), def.scripts.end(), script[cp]) != def.scripts.end()) {
+                if (value & IS_LETTER)
+                    pool.letters.push_back(static_cast<char32_t>(cp));
+                else if (value & IS_MARK)
+                    pool.marks.push_back(static_cast<char32_t>(cp));
+            }
+        }
+        if (def.scripts.empty() || !pool.letters.empty())
+            pools.scripts.push_back(std::move(pool));
+        else
+            std::cerr << "No code points of the script: " << def.name << std::endl;
+    }
+    for (int cp = 0x80; cp <= MAX_CODE_POINT; cp++) {
+        const std::uint8_t value = props[cp];
+        if ((value & IS_DISALLOWED) && !(cp >= 0xD800 && cp <= 0xDFFF))
+            pools.disallowed.push_back(static_cast<char32_t>(cp));
+        if ((value & IS_VALID) && (value & IS_NONSPACING))
+            pools.leading_marks.push_back(static_cast<char32_t>(cp));
+    }
+    return true;
+}
+
+
+// ==================================================================
+// Generator
+
+class weighted_choice {
+public:
+    explicit weighted_choice(const weights_t& weights) {
+        std::vector<double> w;
+        for (const auto& item : weights)
+            w.push_back(item.second);
+        dist_ = std::discrete_distribution<std::size_t>(w.begin(), w.end());
+    }
+    std::size_t operator()(std::mt19937& gen) { return dist_(gen); }
+private:
+    std::discrete_distribution<std::size_t> dist_;
+};
+
+template <class T>
+static T pick(std::mt19937& gen, const std::vector<T>& items) {
+    return items[std::uniform_int_distribution<std::size_t>(0, items.size() - 1)(gen)];
+}
+
+static char32_t ascii_char(std::mt19937& gen) {
+    static const char chars[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+    return static_cast<char32_t>(chars[std::uniform_int_distribution<int>(0, 35)(gen)]);
+}
+
+// Generates the valid label of `length` code points
+static std::u32string make_label(std::mt19937& gen, const script_pool& pool, std::size_t length) {
+    std::u32string label;
+    std::uniform_int_distribution<int> percent(0, 99);
+    for (std::size_t pos = 0; pos < length; ++pos) {
+        if (pool.letters.empty() || percent(gen) < pool.def->ascii_percent) {
+            // hyphen is allowed inside the label, but not at the 3rd and 4th positions
+            if (pos > 0 && pos + 1 < length && pos != 2 && pos != 3 &&
+                label.back() != '-' && percent(gen) < 4)
+                label.push_back('-');
+            else
+                label.push_back(ascii_char(gen));
+        } else if (pos > 0 && !pool.marks.empty() && label.back() >= 0x80 && percent(gen) < 25) {
+            label.push_back(pick(gen, pool.marks));
+        } else {
+            label.push_back(pick(gen, pool.letters));
+        }
+    }
+    return label;
+}
+
+static void append_label(std::string& host, const std::u32string& label, bool to_punycode) {
+    const bool is_ascii = std::all_of(label.begin(), label.end(), [](char32_t cp) { return cp < 0x80; });
+    if (to_punycode && !is_ascii) {
+        host.append("xn--");
+        upa::idna::punycode::encode(host, label.data(), label.data() + label.length());
+    } else {
+        for (const char32_t cp : label)
+            upa::idna::util::appendCodePoint(host, cp);
+    }
+}
+
+enum error_kind {
+    ERR_DISALLOWED, ERR_LEADING_MARK, ERR_ASCII_PUNYCODE, ERR_BIDI, ERR_HYPHEN, ERR_LENGTH,
+    ERR_COUNT
+};
+
+// Makes the first label invalid
+static void make_error(std::mt19937& gen, const unicode_pools& pools, std::u32string& label,
+    error_kind kind) {
+    switch (kind) {
+    case ERR_DISALLOWED:
+        label.insert(label.begin() + std::uniform_int_distribution<std::size_t>(0, label.length())(gen),
+            pick(gen, pools.disallowed));
+        break;
+    case ERR_LEADING_MARK:
+        label.insert(label.begin(), pick(gen, pools.leading_marks));
+        break;
+    case ERR_ASCII_PUNYCODE:
+        // decodes to the ASCII only label
+        label.clear();
+        for (int i = 0; i < 5; ++i)
+            label.push_back(ascii_char(gen));
+        label = U"xn--" + label + U"-";
+        break;
+    case ERR_BIDI:
+        // LTR label having RTL character
+        label = U"aא";
+        break;
+    case ERR_HYPHEN:
+        label.insert(label.begin(), '-');
+        break;
+    default:
+        // ERR_LENGTH
+        label.assign(64, 'a');
+        break;
+    }
+}
+
+static bool generate_hostnames(const std::filesystem::path& data_path,
+    const std::filesystem::path& output_path, const generator_options& opt) {
+    unicode_pools pools;
+    if (!load_pools(data_path, pools))
+        return false;
+
+    // Resolve the script names
+    std::vector<const script_pool*> script_index;
+    weights_t script_weights;
+    for (const auto& item : opt.scripts) {
+        const auto it = std::find_if(pools.scripts.begin(), pools.scripts.end(),
+            [&](const script_pool& pool) { return item.first == pool.def->name; });
+        if (it == pools.scripts.end()) {
+            std::cerr << "Unknown script: " << item.first << std::endl;
+            return false;
+        }
+        script_index.push_back(&*it);
+        script_weights.push_back(item);
+    }
+    std::vector<std::size_t> length_values;
+    for (const auto& item : opt.lengths)
+        length_values.push_back(std::max<std::size_t>(std::stoul(item.first), 1));
+    std::vector<std::size_t> label_count_values;
+    for (const auto& item : opt.labels)
+        label_count_values.push_back(std::max<std::size_t>(std::stoul(item.first), 1));
+
+    std::ofstream fout(output_path, std::ios_base::out | std::ios_base::binary);
+    if (!fout.is_open()) {
+        std::cerr << "Can't open destination file: " << output_path << std::endl;
+        return false;
+    }
+
+    std::mt19937 gen(opt.seed);
+    weighted_choice choose_script(script_weights);
+    weighted_choice choose_length(opt.lengths);
+    weighted_choice choose_label_count(opt.labels);
+    std::uniform_real_distribution<double> percent(0.0, 100.0);
+
+    std::vector<std::size_t> script_counts(script_index.size());
+    std::size_t error_counts[ERR_COUNT] = {};
+    std::size_t punycode_count = 0;
+    std::string host;
+    for (std::size_t ind = 0; ind < opt.count; ++ind) {
+        const std::size_t script_ind = choose_script(gen);
+        const script_pool& pool = *script_index[script_ind];
+        ++script_counts[script_ind];
+
+        // Labels
+        std::vector<std::u32string> labels;
+        const std::size_t label_count = label_count_values[choose_label_count(gen)];
+        for (std::size_t k = 0; k + 1 < label_count; ++k) {
+            const std::size_t length = std::max<std::size_t>(
+                length_values[choose_length(gen)] / pool.def->length_divisor, 1);
+            labels.push_back(make_label(gen, pool, length));
+        }
+        labels.push_back(pick(gen, pool.def->tlds));
+
+        // Errors
+        if (percent(gen) < opt.error_percent) {
+            const auto kind = static_cast<error_kind>(std::uniform_int_distribution<int>(0, ERR_COUNT - 1)(gen));
+            make_error(gen, pools, labels[0], kind);
+            ++error_counts[kind];
+        }
+
+        // Output
+        const bool to_punycode = !pool.letters.empty() && percent(gen) < opt.punycode_percent;
+        punycode_count += to_punycode;
+        host.clear();
+        for (const auto& label : labels) {
+            if (!host.empty()) host.push_back('.');
+            append_label(host, label, to_punycode);
+        }
+        fout << host << '\n';
+    }
+
+    // Summary
+    std::cout << "Hostnames: " << opt.count << "\n";
+    for (std::size_t ind = 0; ind < script_index.size(); ++ind)
+        std::cout << "  " << script_index[ind]->def->name << ": " << script_counts[ind] << "\n";
+    std::cout << "Punycode hostnames: " << punycode_count << "\n";
+    static const char* const error_names[ERR_COUNT] = {
+        "disallowed", "leading mark", "ASCII Punycode", "bidi", "hyphen", "length"
+    };
+    for (int kind = 0; kind < ERR_COUNT; ++kind)
+        std::cout << "Errors (" << error_names[kind] << "): " << error_counts[kind] << "\n";
+    return true;
+}
@@ -36,7 +36,7 @@ int main(int argc, char* argv[])
 // Make all in one mapping table
 
 // Definitions of the CP_... constants
-#include "../src/idna_table.h"
+#include "../include/upa/idna/detail/idna_table.h"
 using namespace upa::idna::util;
 
 // char mapping to char type
@@ -61,7 +61,8 @@ struct char_item {
         return value;
     }
 
-    std::uint32_t value = 0;
+    std::uint32_t value = 0;   // status and flags
+    std::uint32_t mapping = 0; // mapped char or position and length in allCharsTo
     string_to_t charsTo;
 };
 
@@ -80,8 +81,7 @@ struct char_item_less {
 // Make mapping table
 
 static void make_comp_disallowed_tables(const std::filesystem::path& data_path,
-    const std::vector<char_item>& arrChars,
-    std::ostream& fout_head, std::ostream& fout);
+    const std::vector<char_item>& arrChars, std::ostream& fout);
 
 void make_mapping_table(const std::filesystem::path& data_path) {
     // XXX: intentional memory leak to speed up program exit
@@ -175,8 +175,10 @@ void make_mapping_table(const std::filesystem::path& data_path) {
             }
         }
 
-        // sort by charsTo length (longest first)
-        std::sort(arrCharRef.begin(), arrCharRef.end(), [](const char_item* lhs, const char_item* rhs) {
+        // sort by charsTo length (longest first); the stable sort keeps the code
+        // point order of the same length items, so the output does not depend on
+        // the standard library implementation
+        std::stable_sort(arrCharRef.begin(), arrCharRef.end(), [](const char_item* lhs, const char_item* rhs) {
             return lhs->charsTo.length() > rhs->charsTo.length(); // reverse
         });
 
@@ -212,7 +214,8 @@ void make_mapping_table(const std::filesystem::path& data_path) {
                 }
             }
             // save pos, length
-            chitem->value |= (value | flags);
+            chitem->mapping = value;
+            chitem->value |= flags;
         }
     }
 
@@ -252,10 +255,10 @@ void make_mapping_table(const std::filesystem::path& data_path) {
         if (col[0].length() == 1) {
             std::uint32_t flag = 0;
             switch (col[0][0]) {
-            case 'D': flag = CAT_Joiner_D; break;
-            case 'L': flag = CAT_Joiner_L; break;
-            case 'R': flag = CAT_Joiner_R; break;
-            case 'T': flag = CAT_Joiner_T; break;
+            case 'D': flag = JT_D; break;
+            case 'L': flag = JT_L; break;
+            case 'R': flag = JT_R; break;
+            case 'T': flag = JT_T; break;
             }
             if (flag) {
                 for (int cp = cp0; cp <= cp1; cp++) {
@@ -274,17 +277,17 @@ void make_mapping_table(const std::filesystem::path& data_path) {
     parse_UnicodeData<1>(file_name, [&](int cp0, int cp1, const auto& col) {
         std::uint32_t flag = 0;
         if (col[0] == "L") {
-            flag = CAT_Bidi_L;
+            flag = BC_L;
         } else if (col[0] == "R" || col[0] == "AL") {
-            flag = CAT_Bidi_R_AL;
+            flag = BC_R_AL;
         } else if (col[0] == "AN") {
-            flag = CAT_Bidi_AN;
+            flag = BC_AN;
         } else if (col[0] == "EN") {
-            flag = CAT_Bidi_EN;
+            flag = BC_EN;
         } else if (col[0] == "ES" || col[0] == "CS" || col[0] == "ET" || col[0] == "ON" || col[0] == "BN") {
-            flag = CAT_Bidi_ES_CS_ET_ON_BN;
+            flag = BC_ES_CS_ET_ON_BN;
         } else if (col[0] == "NSM") {
-            flag = CAT_Bidi_NSM;
+            flag = BC_NSM;
         } else {
             // Nenaudojama kategorija
         }
@@ -302,151 +305,35 @@ void make_mapping_table(const std::filesystem::path& data_path) {
     //=======================================================================
     // Output Data
 
-    special_ranges<std::uint32_t> spec(arrChars, 2);
-    //TODO spec.range.size() >= 2
-
-    const std::size_t count_chars = spec.m_range[0].from;
-    const int index_levels = 1; // 1 arba 2
-
-    // calculate 32bit block size
-    std::cout << "=== 32 bit BLOCK ===\n";
-    block_info binf = find_block_size(arrChars, count_chars, sizeof(std::uint32_t), index_levels);
-    std::size_t block_size = binf.block_size;
-
     // total memory used
-    std::cout << "block_size=" << block_size << "; mem: " << binf.total_mem() << "\n";
     std::cout << "uni_chars_to size: " << allCharsTo.size() << "; mem: " << allCharsTo.size() * sizeof(allCharsTo[0]) << "\n";
-    std::cout << "TOTAL MEM: " << binf.total_mem() + allCharsTo.size() * sizeof(allCharsTo[0]) << "\n";
-
-#if 0
-    std::cout << "=== 16 bit BLOCK ===\n";
-    std::cout << "--- Flags\n";
-    find_block_size<char_item, char_item_less<0xFFFF0000>>(arrChars, count_chars, sizeof(std::uint16_t), 2);
-    std::cout << "--- Mapping\n";
-    find_block_size<char_item, char_item_less<0xFFFF>>(arrChars, count_chars, sizeof(std::uint16_t), 2);
-    return;
-#endif
 
     //=======================================================================
     // Generate code
 
-    file_name = data_path / "GEN-idna-tables.txt";
-    std::ofstream fout(file_name, std::ios_base::out);
-    if (!fout.is_open()) {
+    // The code point values; unitool-props makes the lookup table of them
+    file_name = data_path / "GEN-idna-props.txt";
+    std::ofstream fout_props(file_name, std::ios_base::out);
+    if (!fout_props.is_open()) {
         std::cerr << "Can't open destination file: " << file_name << std::endl;
         return;
     }
+    output_code_point_values(fout_props, arrChars, [](std::string& str, const char_item& chitem) {
+        unsigned_to_str(chitem.value, str, 16u);
+        str += " ; ";
+        unsigned_to_str(chitem.mapping, str, 16u);
+    });
 
+    // The tables are defined in the header, so they can be used in constant expressions
     file_name = data_path / "GEN-idna-tables.H.txt";
-    std::ofstream fout_head(file_name, std::ios_base::out);
-    if (!fout_head.is_open()) {
+    std::ofstream fout(file_name, std::ios_base::out);
+    if (!fout.is_open()) {
         std::cerr << "Can't open destination file: " << file_name << std::endl;
         return;
     }
 
-    // Constants
-    output_unsigned_constant(fout_head, "std::size_t", "uni_block_shift", binf.size_shift, 10);
-    output_unsigned_constant(fout_head, "std::uint32_t", "uni_block_mask", binf.code_point_mask(), 16);
-    output_unsigned_constant(fout_head, "std::uint32_t", "uni_default_start", count_chars, 16);
-    output_unsigned_constant(fout_head, "std::uint32_t", "uni_default_value", arrChars[count_chars].value, 16);
-    output_unsigned_constant(fout_head, "std::uint32_t", "uni_spec_range1", spec.m_range[1].from /*0xE0100*/, 16);
-    output_unsigned_constant(fout_head, "std::uint32_t", "uni_spec_range2", spec.m_range[1].to /*0xE01EF*/, 16);
-    output_unsigned_constant(fout_head, "std::uint32_t", "uni_spec_value", arrChars[spec.m_range[1].from].value, 16);
-    fout_head << "\n";
-    // ---
-
-    std::vector<int> blockIndex;
-
-    fout_head << "extern const std::uint32_t uni_data[];\n";
-    fout << "const std::uint32_t uni_data[] = {";
-    {
-        OutputFmt outfmt(fout, 100);
-
-        typedef std::map<array_view<char_item>, int> BlokcsMap;
-        BlokcsMap blocks;
-        int index = 0;
-        for (std::size_t ind = 0; ind < count_chars; ind += block_size) {
-            std::size_t chunk_size = std::min(block_size, arrChars.size() - ind);
-            array_view<char_item> block(arrChars.data() + ind, chunk_size);
-
-            auto res = blocks.insert(BlokcsMap::value_type(block, index));
-            if (res.second) {
-                for (const char_item& chitem : block) {
-                    outfmt.output(chitem.value, 16);
-                }
-                blockIndex.push_back(index);
-                index++;
-            } else {
-                // index of previously inserted block
-                blockIndex.push_back(res.first->second);
-            }
-        }
-    }
-    fout << "};\n\n";
-
-    if (index_levels == 1) {
-        // Vieno lygio indeksas
-        const char* sztype = getUIntType(blockIndex);
-        fout_head << "extern const " << sztype << " uni_data_index[];\n";
-        fout << "const " << sztype << " uni_data_index[] = {";
-        {
-            OutputFmt outfmt(fout, 100);
-            for (int index : blockIndex) {
-                outfmt.output(index, 10);
-            }
-        }
-        fout << "};\n\n";
-    }
-
-    if (index_levels == 2) {
-        // Dviejų lygių indeksas
-        std::vector<int> indexToIndex;
-        const char* sztype = getUIntType(blockIndex);
-        fout_head << "extern const " << sztype << " indexToBlock[];\n";
-        fout << "const " << sztype << " indexToBlock[] = {";
-        {
-            std::size_t count = blockIndex.size();
-            std::cout << "=== Index BLOCK ===\n";
-            block_info bi = find_block_size(blockIndex, count, sizeof(std::uint16_t));
-
-            OutputFmt outfmt(fout, 100);
-
-            typedef std::map<array_view<int>, int> BlokcsMap;
-            BlokcsMap blocks;
-            int index = 0;
-            for (std::size_t ind = 0; ind < count; ind += bi.block_size) {
-                std::size_t chunk_size = std::min(bi.block_size, count - ind);
-                array_view<int> block(blockIndex.data() + ind, chunk_size);
-
-                auto res = blocks.insert(BlokcsMap::value_type(block, index));
-                if (res.second) {
-                    for (const int value : block) {
-                        outfmt.output(value, 10);
-                    }
-                    indexToIndex.push_back(index);
-                    index++;
-                } else {
-                    // index of previously inserted block
-                    indexToIndex.push_back(res.first->second);
-                }
-            }
-        }
-        fout << "};\n\n";
-        sztype = getUIntType(indexToIndex);
-        fout_head << "extern const " << sztype << " indexToIndex[];\n";
-        fout << "const " << sztype << " indexToIndex[] = {";
-        {
-            OutputFmt outfmt(fout, 100);
-            for (int ind : indexToIndex) {
-                outfmt.output(ind, 10);
-            }
-        }
-        fout << "};\n\n";
-    }
-
     const char* sztype = getCharType<char_to_t>();
-    fout_head << "extern const " << sztype << " uni_chars_to[];\n";
-    fout << "const " << sztype << " uni_chars_to[] = {";
+    fout << "inline constexpr " << sztype << " uni_chars_to[] = {";
     {
         OutputFmt outfmt(fout, 100);
         for (auto ch : allCharsTo) {
@@ -456,20 +343,17 @@ void make_mapping_table(const std::filesystem::path& data_path) {
     fout << "};\n\n";
 
     // Make table of IDNA disallowed code points that can be changed by NFC
-    fout_head << '\n';
-    make_comp_disallowed_tables(data_path, arrChars, fout_head, fout);
+    make_comp_disallowed_tables(data_path, arrChars, fout);
 
     // ASCII data
-    fout_head << '\n';
-    fout_head << "extern const std::uint8_t ascii_data[128];\n";
-    fout << "const std::uint8_t ascii_data[128] = {";
+    fout << "inline constexpr std::uint8_t ascii_data[128] = {";
     {
         OutputFmt outfmt(fout, 100);
         for (std::uint8_t ch = 0; ch < 128; ++ch) {
-            outfmt.output((arrChars[ch].value >> 16) & 0x07, 16);
+            outfmt.output(arrChars[ch].value & 0x07, 16);
         }
     }
-    fout << "};\n\n";
+    fout << "};\n";
 }
 
 // Make table of IDNA disallowed code points that can be changed by NFC
@@ -499,8 +383,7 @@ bool is_hangul_composable(char32_t cp) {
 }
 
 void make_comp_disallowed_tables(const std::filesystem::path& data_path,
-    const std::vector<char_item>& arrChars,
-    std::ostream& fout_head, std::ostream& fout)
+    const std::vector<char_item>& arrChars, std::ostream& fout)
 {
     // Full composition exclusion
     std::unordered_set<char32_t> composition_exclusion;
@@ -556,8 +439,7 @@ void make_comp_disallowed_tables(const std::filesystem::path& data_path,
     }
 
     if (!comp_disallowed.empty()) {
-        fout_head << "extern const std::uint32_t comp_disallowed[" << comp_disallowed.size() << "];\n";
-        fout << "const std::uint32_t comp_disallowed[" << comp_disallowed.size() << "] = {";
+        fout << "inline constexpr std::uint32_t comp_disallowed[" << comp_disallowed.size() << "] = {";
         {
             OutputFmt outfmt(fout, 100);
             for (auto ch : comp_disallowed) {
@@ -570,8 +452,7 @@ void make_comp_disallowed_tables(const std::filesystem::path& data_path,
     if (!comp_disallowed_std3.empty()) {
         // Starting with Unicode 16.0.0, disallowed STD3 characters are in the ASCII range.
         // See "Validity Criteria" 7.3. in https://www.unicode.org/reports/tr46/tr46-33.html#Validity_Criteria
-        fout_head << "extern const std::uint8_t comp_disallowed_std3[" << comp_disallowed_std3.size() << "];\n";
-        fout << "const std::uint8_t comp_disallowed_std3[" << comp_disallowed_std3.size() << "] = {";
+        fout << "inline constexpr std::uint8_t comp_disallowed_std3[" << comp_disallowed_std3.size() << "] = {";
         {
             OutputFmt outfmt(fout, 100);
             for (auto ch : comp_disallowed_std3) {
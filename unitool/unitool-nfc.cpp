@@ -9,10 +9,25 @@
 using namespace upa::tools;
 
 
-static void output_newline(std::ostream& fout_h, std::ostream& fout_cpp);
-static void make_ccc_table(const std::filesystem::path& data_path, std::ostream& fout_h, std::ostream& fout_cpp);
-static void make_composition_tables(const std::filesystem::path& data_path, std::ostream& fout_h, std::ostream& fout_cpp);
-static void make_quick_check_table(const std::filesystem::path& data_path, std::ostream& fout_h, std::ostream& fout_cpp);
+// The code point values; unitool-props makes the lookup table of them
+struct nfc_values {
+    std::vector<std::uint8_t> ccc;
+    std::vector<std::uint16_t> comp;
+    std::vector<std::uint16_t> decomp;
+    std::vector<std::uint8_t> quick_check;
+
+    nfc_values()
+        : ccc(MAX_CODE_POINT + 1)
+        , comp(MAX_CODE_POINT + 1)
+        , decomp(MAX_CODE_POINT + 1)
+        , quick_check(MAX_CODE_POINT + 1)
+    {}
+};
+
+static void make_ccc_values(const std::filesystem::path& data_path, nfc_values& values);
+static void make_composition_tables(const std::filesystem::path& data_path, std::ostream& fout_h, nfc_values& values);
+static void make_quick_check_values(const std::filesystem::path& data_path, std::ostream& fout_h, nfc_values& values);
+static void output_values(const nfc_values& values, std::ostream& fout);
 
 int main(int argc, char* argv[])
 {
@@ -38,112 +53,37 @@ int main(int argc, char* argv[])
         return 2;
     }
 
-    file_name = data_path / "GEN-nfc-tables.cpp.txt";
-    std::ofstream fout_cpp(file_name, std::ios_base::out);
-    if (!fout_cpp.is_open()) {
+    file_name = data_path / "GEN-nfc-props.txt";
+    std::ofstream fout_props(file_name, std::ios_base::out);
+    if (!fout_props.is_open()) {
         std::cerr << "Can't open destination file: " << file_name << std::endl;
         return 2;
     }
 
-    make_ccc_table(data_path, fout_h, fout_cpp);
-    output_newline(fout_h, fout_cpp);
-    make_composition_tables(data_path, fout_h, fout_cpp);
-    output_newline(fout_h, fout_cpp);
-    make_quick_check_table(data_path, fout_h, fout_cpp);
+    // XXX: intentional memory leak to speed up program exit
+    nfc_values& values(*new nfc_values);
 
-    return 0;
-}
+    make_ccc_values(data_path, values);
+    make_composition_tables(data_path, fout_h, values);
+    fout_h << '\n';
+    make_quick_check_values(data_path, fout_h, values);
+    output_values(values, fout_props);
 
-static void output_newline(std::ostream& fout_h, std::ostream& fout_cpp)
-{
-    fout_h << std::endl;
-    fout_cpp << std::endl;
+    return 0;
 }
 
 // ==================================================================
 // Canonical_Combining_Class (ccc)
 
-static void make_ccc_table(const std::filesystem::path& data_path, std::ostream& fout_h, std::ostream& fout_cpp)
+static void make_ccc_values(const std::filesystem::path& data_path, nfc_values& values)
 {
-    using item_type = std::uint8_t;
-    using item_num_type = item_type;
-
-    std::vector<item_type> arr_ccc(MAX_CODE_POINT + 1);
-
     auto file_name = data_path / "DerivedCombiningClass.txt";
     parse_UnicodeData<1>(file_name,
         [&](int cp0, int cp1, const auto& col) {
             const std::uint8_t value = std::stoi(col[0]);
             for (int cp = cp0; cp <= cp1; cp++)
-                arr_ccc[cp] = value;
+                values.ccc[cp] = value;
         });
-
-    // Special ranges to reduce table size
-    special_ranges<item_num_type> spec_ccc(arr_ccc);
-    const std::size_t count_chars = spec_ccc.m_range[0].from; // MAX_CODE_POINT + 1;
-    const int index_levels = 1; // 1 arba 2
-
-    // Find block size
-    const auto binf = find_block_size(arr_ccc, count_chars, sizeof(item_num_type), index_levels);
-    const std::size_t block_size = binf.block_size;
-
-    // memory used
-    std::cout << "block_size=" << block_size << "; mem=" << binf.total_mem() << "\n";
-
-    //=======================================================================
-    // Generate code
-
-    const char* sz_item_num_type = getUIntType<item_num_type>();
-
-    // Constants
-    output_unsigned_constant(fout_h, "std::size_t", "ccc_block_shift", binf.size_shift, 10);
-    output_unsigned_constant(fout_h, "std::uint32_t", "ccc_block_mask", binf.code_point_mask(), 16);
-    output_unsigned_constant(fout_h, "std::uint32_t", "ccc_default_start", count_chars, 16);
-    output_unsigned_constant(fout_h, sz_item_num_type, "ccc_default_value", arr_ccc[count_chars], 16);
-
-    // CCC blocks
-    std::vector<int> block_index;
-
-    fout_h << "extern const " << sz_item_num_type << " ccc_block[];\n";
-    fout_cpp << "const " << sz_item_num_type << " ccc_block[] = {";
-    {
-        OutputFmt outfmt(fout_cpp, 100);
-
-        typedef std::map<array_view<item_type>, int> BlokcsMap;
-        BlokcsMap blocks;
-        int index = 0;
-        for (std::size_t ind = 0; ind < count_chars; ind += block_size) {
-            std::size_t chunk_size = std::min(block_size, arr_ccc.size() - ind);
-            array_view<item_type> block(arr_ccc.data() + ind, chunk_size);
-
-            auto res = blocks.insert(BlokcsMap::value_type(block, index));
-            if (res.second) {
-                for (const auto& item : block) {
-                    outfmt.output(static_cast<item_num_type>(item), 16);
-                }
-                block_index.push_back(index);
-                index++;
-            } else {
-                // index of previously inserted block
-                block_index.push_back(res.first->second);
-            }
-        }
-    }
-    fout_cpp << "};\n\n";
-
-    {   // Single level index
-        const char* sztype = getUIntType(block_index);
-        fout_h << "extern const " << sztype << " ccc_block_index[];\n";
-        fout_cpp << "const " << sztype << " ccc_block_index[] = {";
-        {
-            OutputFmt outfmt(fout_cpp, 100);
-            for (int index : block_index) {
-                outfmt.output(index, 10);
-            }
-        }
-        fout_cpp << "};\n\n";
-    }
-
 }
 
 // ==================================================================
@@ -159,7 +99,7 @@ inline bool operator==(const codepoint_key_val& lhs, const codepoint_key_val& rh
 }
 
 
-static void make_composition_tables(const std::filesystem::path& data_path, std::ostream& fout_h, std::ostream& fout_cpp)
+static void make_composition_tables(const std::filesystem::path& data_path, std::ostream& fout_h, nfc_values& values)
 {
     using item_num_type = std::uint16_t;
     struct item_type {
@@ -257,75 +197,17 @@ static void make_composition_tables(const std::filesystem::path& data_path, std:
 
         // Output Data
 
-        special_ranges<item_num_type> spec(arr_comp);
-        const std::size_t count_chars = spec.m_range[0].from;
-
-        std::cout << "=== 16 bit BLOCK ===\n";
-        block_info binf = find_block_size(arr_comp, count_chars, sizeof(item_num_type));
-        std::size_t block_size = binf.block_size;
+        for (char32_t cp = 0; cp <= MAX_CODE_POINT; ++cp)
+            values.comp[cp] = arr_comp[cp].value;
 
         // total memory used
-        std::cout << "block_size=" << block_size << "; mem: " << binf.total_mem() << "\n";
         std::cout << "comp_block_data size: " << all_comp_data.size() << "; mem: " << all_comp_data.size() * sizeof(all_comp_data[0]) << "\n";
-        std::cout << "TOTAL MEM: " << binf.total_mem() + all_comp_data.size() * sizeof(all_comp_data[0]) << "\n";
 
         // Generate code
 
-        const char* sz_item_num_type = getUIntType<item_num_type>();
-
-        // Constants
-        output_unsigned_constant(fout_h, "std::size_t", "comp_block_shift", binf.size_shift, 10);
-        output_unsigned_constant(fout_h, "std::uint32_t", "comp_block_mask", binf.code_point_mask(), 16);
-        output_unsigned_constant(fout_h, "std::uint32_t", "comp_default_start", count_chars, 16);
-        output_unsigned_constant(fout_h, sz_item_num_type, "comp_default_value", arr_comp[count_chars].value, 16);
-
-        // Composition blocks
-        std::vector<int> block_index;
-
-        fout_h << "extern const " << sz_item_num_type << " comp_block[];\n";
-        fout_cpp << "const " << sz_item_num_type << " comp_block[] = {";
+        fout_h << "inline constexpr codepoint_key_val comp_block_data[] = {";
         {
-            OutputFmt outfmt(fout_cpp, 100);
-
-            typedef std::map<array_view<comp_item_type>, int> BlokcsMap;
-            BlokcsMap blocks;
-            int index = 0;
-            for (std::size_t ind = 0; ind < count_chars; ind += block_size) {
-                std::size_t chunk_size = std::min(block_size, arr_comp.size() - ind);
-                array_view<comp_item_type> block(arr_comp.data() + ind, chunk_size);
-
-                auto res = blocks.insert(BlokcsMap::value_type(block, index));
-                if (res.second) {
-                    for (const auto& item : block) {
-                        outfmt.output(static_cast<item_num_type>(item), 16);
-                    }
-                    block_index.push_back(index);
-                    index++;
-                } else {
-                    // index of previously inserted block
-                    block_index.push_back(res.first->second);
-                }
-            }
-        }
-        fout_cpp << "};\n\n";
-
-        {   // Single level index
-            const char* sztype = getUIntType(block_index);
-            fout_h << "extern const " << sztype << " comp_block_index[];\n";
-            fout_cpp << "const " << sztype << " comp_block_index[] = {";
-            {
-                OutputFmt outfmt(fout_cpp, 100);
-                for (int index : block_index) {
-                    outfmt.output(index, 10);
-                }
-            }
-            fout_cpp << "};\n\n";
-        }
-
-        fout_h << "extern const codepoint_key_val comp_block_data[];\n";
-        fout_cpp << "const codepoint_key_val comp_block_data[] = {";
-        {
-            OutputFmt outfmt(fout_cpp, 100);
+            OutputFmt outfmt(fout_h, 100);
             for (auto& item : all_comp_data) {
                 std::string str{ '{' };
                 unsigned_to_numstr(item.key, str, 16);
@@ -335,10 +217,10 @@ static void make_composition_tables(const std::filesystem::path& data_path, std:
                 outfmt.output(str);
             }
         }
-        fout_cpp << "};\n\n";
+        fout_h << "};\n";
     }
 
-    output_newline(fout_h, fout_cpp);
+    fout_h << '\n';
 
     //=======================================================================
     // Decomposition data
@@ -383,97 +265,34 @@ static void make_composition_tables(const std::filesystem::path& data_path, std:
 
         // Output Data
 
-        special_ranges<item_num_type> spec(arr_decomp);
-        const std::size_t count_chars = spec.m_range[0].from;
-
-        std::cout << "=== 16 bit BLOCK ===\n";
-        block_info binf = find_block_size(arr_decomp, count_chars, sizeof(item_num_type));
-        std::size_t block_size = binf.block_size;
+        for (char32_t cp = 0; cp <= MAX_CODE_POINT; ++cp)
+            values.decomp[cp] = arr_decomp[cp].value;
 
         // total memory used
-        std::cout << "block_size=" << block_size << "; mem: " << binf.total_mem() << "\n";
         std::cout << "allCharsTo size: " << allCharsTo.size() << "; mem: " << allCharsTo.size() * sizeof(allCharsTo[0]) << "\n";
-        std::cout << "TOTAL MEM: " << binf.total_mem() + allCharsTo.size() * sizeof(allCharsTo[0]) << "\n";
 
         // Generate code
 
-        const char* sz_item_num_type = getUIntType<item_num_type>();
-
-        // Constants
-        output_unsigned_constant(fout_h, "std::size_t", "decomp_block_shift", binf.size_shift, 10);
-        output_unsigned_constant(fout_h, "std::uint32_t", "decomp_block_mask", binf.code_point_mask(), 16);
-        output_unsigned_constant(fout_h, "std::uint32_t", "decomp_default_start", count_chars, 16);
-        output_unsigned_constant(fout_h, sz_item_num_type, "decomp_default_value", arr_decomp[count_chars].value, 16);
-
-        // Decomposition blocks
-        std::vector<int> block_index;
-
-        fout_h << "extern const " << sz_item_num_type << " decomp_block[];\n";
-        fout_cpp << "const " << sz_item_num_type << " decomp_block[] = {";
-        {
-            OutputFmt outfmt(fout_cpp, 100);
-
-            typedef std::map<array_view<decomp_item_type>, int> BlokcsMap;
-            BlokcsMap blocks;
-            int index = 0;
-            for (std::size_t ind = 0; ind < count_chars; ind += block_size) {
-                std::size_t chunk_size = std::min(block_size, arr_decomp.size() - ind);
-                array_view<decomp_item_type> block(arr_decomp.data() + ind, chunk_size);
-
-                auto res = blocks.insert(BlokcsMap::value_type(block, index));
-                if (res.second) {
-                    for (const auto& item : block) {
-                        outfmt.output(static_cast<item_num_type>(item), 16);
-                    }
-                    block_index.push_back(index);
-                    index++;
-                } else {
-                    // index of previously inserted block
-                    block_index.push_back(res.first->second);
-                }
-            }
-        }
-        fout_cpp << "};\n\n";
-
-        {   // Single level index
-            const char* sztype = getUIntType(block_index);
-            fout_h << "extern const " << sztype << " decomp_block_index[];\n";
-            fout_cpp << "const " << sztype << " decomp_block_index[] = {";
-            {
-                OutputFmt outfmt(fout_cpp, 100);
-                for (int index : block_index) {
-                    outfmt.output(index, 10);
-                }
-            }
-            fout_cpp << "};\n\n";
-        }
-
-        fout_h << "extern const char32_t decomp_block_data[];\n";
-        fout_cpp << "const char32_t decomp_block_data[] = {";
+        fout_h << "inline constexpr char32_t decomp_block_data[] = {";
         {
-            OutputFmt outfmt(fout_cpp, 100);
+            OutputFmt outfmt(fout_h, 100);
             for (auto ch : allCharsTo) {
                 outfmt.output(ch, 16);
             }
         }
-        fout_cpp << "};\n\n";
+        fout_h << "};\n";
     }
 }
 
 // ==================================================================
 // Quick Check (NFC_QC) data
 
-static void make_quick_check_table(const std::filesystem::path& data_path, std::ostream& fout_h, std::ostream& fout_cpp)
+static void make_quick_check_values(const std::filesystem::path& data_path, std::ostream& fout_h, nfc_values& values)
 {
-    using item_type = std::uint8_t;
-    using item_num_type = item_type;
-
     constexpr std::uint8_t NO = 1;
     constexpr std::uint8_t YES = 0;
     constexpr std::uint8_t MAYBE = 2;
 
-    std::vector<item_type> arr_quick_check((MAX_CODE_POINT + 1) / 4);
-
     auto file_name = data_path / "DerivedNormalizationProps.txt";
     parse_UnicodeData<2>(file_name,
         [&](int cp0, int cp1, const auto& col) {
@@ -482,83 +301,38 @@ static void make_quick_check_table(const std::filesystem::path& data_path, std::
                 if (col[1] == "N") val = NO;
                 else if (col[1] == "M") val = MAYBE;
 
-                for (auto cp = cp0; cp <= cp1; ++cp) {
-                    auto ind = cp / 4;
-                    auto shift = (cp % 4) * 2;
-                    arr_quick_check[ind] |= val << shift;
-                }
+                for (auto cp = cp0; cp <= cp1; ++cp)
+                    values.quick_check[cp] = val;
             }
         });
 
-    // Special ranges to reduce table size
-    special_ranges<item_num_type> spec_quick_check(arr_quick_check);
-    const std::size_t count_items = spec_quick_check.m_range[0].from; // (MAX_CODE_POINT + 1) / 4;
-    const int index_levels = 1; // 1 or 2
-
-    // Find block size
-    const auto binf = find_block_size(arr_quick_check, count_items, sizeof(item_num_type), index_levels);
-    const std::size_t block_size = binf.block_size;
-
-    // memory used
-    std::cout << "block_size=" << block_size << "; mem=" << binf.total_mem() << "\n";
-
     //=======================================================================
     // Generate code
 
-    const char* sz_item_num_type = getUIntType<item_num_type>();
-
-    // Constants
     fout_h <<
         "enum class qc : std::uint8_t {\n"
         "    no = " << int(NO) << ",\n"
         "    yes = " << int(YES) << ",\n"
         "    maybe = " << int(MAYBE) << ",\n"
         "};\n";
-    output_unsigned_constant(fout_h, "std::size_t", "quick_check_block_shift", binf.size_shift, 10);
-    output_unsigned_constant(fout_h, "std::uint32_t", "quick_check_block_mask", binf.code_point_mask(), 16);
-    output_unsigned_constant(fout_h, "std::uint32_t", "quick_check_default_start", count_items, 16);
-    output_unsigned_constant(fout_h, sz_item_num_type, "quick_check_default_value", arr_quick_check[count_items], 16);
-
-    // quick_check blocks
-    std::vector<int> block_index;
+}
 
-    fout_h << "extern const " << sz_item_num_type << " quick_check_block[];\n";
-    fout_cpp << "const " << sz_item_num_type << " quick_check_block[] = {";
-    {
-        OutputFmt outfmt(fout_cpp, 100);
-
-        typedef std::map<array_view<item_type>, int> BlokcsMap;
-        BlokcsMap blocks;
-        int index = 0;
-        for (std::size_t ind = 0; ind < count_items; ind += block_size) {
-            std::size_t chunk_size = std::min(block_size, arr_quick_check.size() - ind);
-            array_view<item_type> block(arr_quick_check.data() + ind, chunk_size);
-
-            auto res = blocks.insert(BlokcsMap::value_type(block, index));
-            if (res.second) {
-                for (const auto& item : block) {
-                    outfmt.output(static_cast<item_num_type>(item), 16);
-                }
-                block_index.push_back(index);
-                index++;
-            } else {
-                // index of previously inserted block
-                block_index.push_back(res.first->second);
-            }
-        }
-    }
-    fout_cpp << "};\n\n";
+// ==================================================================
+// Output code point values: ccc ; comp ; decomp ; quick_check
 
-    {   // Single level index
-        const char* sztype = getUIntType(block_index);
-        fout_h << "extern const " << sztype << " quick_check_block_index[];\n";
-        fout_cpp << "const " << sztype << " quick_check_block_index[] = {";
-        {
-            OutputFmt outfmt(fout_cpp, 100);
-            for (int index : block_index) {
-                outfmt.output(index, 10);
-            }
-        }
-        fout_cpp << "};\n\n";
-    }
+static void output_values(const nfc_values& values, std::ostream& fout)
+{
+    std::vector<char32_t> arr_cp(MAX_CODE_POINT + 1);
+    for (char32_t cp = 0; cp <= MAX_CODE_POINT; ++cp)
+        arr_cp[cp] = cp;
+
+    output_code_point_values(fout, arr_cp, [&](std::string& str, char32_t cp) {
+        unsigned_to_str<unsigned>(values.ccc[cp], str, 10);
+        str += " ; ";
+        unsigned_to_str<unsigned>(values.comp[cp], str, 16);
+        str += " ; ";
+        unsigned_to_str<unsigned>(values.decomp[cp], str, 16);
+        str += " ; ";
+        unsigned_to_str<unsigned>(values.quick_check[cp], str, 10);
+    });
 }
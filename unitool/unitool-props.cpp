@@ -0,0 +1,330 @@
+// Copyright 2026 Rimas Misevičius
+// Distributed under the BSD-style license that can be
+// found in the LICENSE file.
+//
+// Makes the combined table of the IDNA and NFC code point properties
+//
+#include "unicode_data_tools.h"
+#include "../include/upa/idna/detail/props_table.h"
+#include <chrono>
+#include <filesystem>
+#include <random>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+using namespace upa::tools;
+using upa::idna::props::char_props;
+
+
+static void make_props_table(const std::filesystem::path& data_path, std::ostream& fout, bool benchmark);
+
+int main(int argc, char* argv[])
+{
+    const bool benchmark = argc == 3 && std::string_view{ argv[1] } == "--benchmark";
+    if (argc != 2 && !benchmark) {
+        std::cerr <<
+            "unitool-props [--benchmark] <data directory path>\n"
+            "\n"
+            "Specify the directory path where the following files made by unitool-idna\n"
+            "and unitool-nfc are located:\n"
+            " GEN-idna-props.txt\n"
+            " GEN-nfc-props.txt\n"
+            "\n"
+            "The --benchmark option reports the lookup times of the two-level table\n"
+            "layouts; it does not change the output.\n";
+        return 1;
+    }
+
+    // Data files path
+    const std::filesystem::path data_path{ argv[argc - 1] };
+
+    // Output file; the tables are defined in the header, so they can be used
+    // in constant expressions
+    const auto file_name = data_path / "GEN-props-tables.h.txt";
+    std::ofstream fout(file_name, std::ios_base::out);
+    if (!fout.is_open()) {
+        std::cerr << "Can't open destination file: " << file_name << std::endl;
+        return 2;
+    }
+
+    make_props_table(data_path, fout, benchmark);
+    return 0;
+}
+
+// ==================================================================
+// Combined properties table
+
+namespace upa::idna::props {
+
+inline bool operator<(const char_props& lhs, const char_props& rhs) {
+    return std::tie(lhs.info, lhs.comp, lhs.decomp, lhs.ccc, lhs.qc) <
+        std::tie(rhs.info, rhs.comp, rhs.decomp, rhs.ccc, rhs.qc);
+}
+
+inline bool operator==(const char_props& lhs, const char_props& rhs) {
+    return !(lhs < rhs) && !(rhs < lhs);
+}
+
+} // namespace upa::idna::props
+
+static std::string props_to_str(const char_props& p) {
+    std::string str{ "{ " };
+    unsigned_to_numstr(p.info, str, 16);
+    str += ", ";
+    unsigned_to_numstr(p.comp, str, 16);
+    str += ", ";
+    unsigned_to_numstr(p.decomp, str, 16);
+    str += ", ";
+    unsigned_to_numstr(p.ccc, str, 10);
+    str += ", ";
+    unsigned_to_numstr(p.qc, str, 10);
+    str += " }";
+    return str;
+}
+
+template <class T>
+static void output_array(std::ostream& fout, const char* name, const std::vector<T>& arr) {
+    const char* sztype = getUIntType(arr);
+    fout << "inline constexpr " << sztype << ' ' << name << "[] = {";
+    {
+        OutputFmt outfmt(fout, 100);
+        for (const auto item : arr)
+            outfmt.output(item, 10);
+    }
+    fout << "};\n";
+}
+
+// Layout benchmark
+
+// The code points to look up: runs of 8 code points of the same 128 code
+// point block, which imitate the words of one script; 70% of runs are in
+// the BMP starting from `first_cp`, and 30% in the supplementary planes
+static std::vector<std::uint32_t> make_lookup_sample(std::uint32_t first_cp, std::size_t count) {
+    std::vector<std::uint32_t> sample;
+    std::mt19937 gen(1);
+    while (sample.size() < (1 << 20)) {
+        const auto range = gen() % 100;
+        std::uint32_t first, last;
+        if (range < 70 || count <= 0x10000) {
+            first = first_cp; last = 0x10000;
+        } else {
+            first = 0x10000; last = static_cast<std::uint32_t>(count);
+        }
+        last = std::min(last, static_cast<std::uint32_t>(count));
+        if (first >= last)
+            continue;
+        const std::uint32_t block = first + static_cast<std::uint32_t>(gen() % (last - first)) / 128 * 128;
+        for (int ind = 0; ind < 8; ++ind)
+            sample.push_back(std::min<std::uint32_t>(block + gen() % 128, last - 1));
+    }
+    return sample;
+}
+
+static volatile std::uint32_t lookup_sink;
+
+// Returns the average lookup time in nanoseconds
+template <class Layout>
+static double measure_lookup(const Layout& layout, const std::vector<std::uint32_t>& sample) {
+    std::uint32_t sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto cp : sample)
+        sum += layout.lookup(cp);
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    lookup_sink = sum;
+    return elapsed.count() / static_cast<double>(sample.size());
+}
+
+// Reports the lookup times of the two-level tables of all block shifts, to
+// choose the fast_block_shift
+template <class T>
+static void benchmark_layouts2(const std::vector<T>& values, std::uint32_t first_cp, std::size_t count) {
+    const auto sample = make_lookup_sample(first_cp, count);
+
+    std::vector<table_layout2<T>> layouts;
+    for (int shift = 3; shift <= 9; ++shift)
+        layouts.push_back(make_table_layout2(values, count, shift));
+
+    // the layouts are measured in turn, so the slowdowns of the machine affect all
+    // of them; the minimum of the times is taken
+    std::vector<double> times(layouts.size(), 1e100);
+    for (int rep = 0; rep < 15; ++rep) {
+        for (std::size_t ind = 0; ind < layouts.size(); ++ind)
+            times[ind] = std::min(times[ind], measure_lookup(layouts[ind], sample));
+    }
+
+    std::cout << "=== Two-level tables ===\n";
+    for (std::size_t ind = 0; ind < layouts.size(); ++ind) {
+        std::cout << "block_shift=" << layouts[ind].shift << ": mem: " << layouts[ind].mem_size()
+            << "; lookup: " << times[ind] << " ns\n";
+    }
+}
+
+// The block shift of the default two-level table. It is the smallest of the
+// fastest tables reported by `unitool-props --benchmark`; it is fixed, so the
+// output does not depend on the machine the tool runs on.
+constexpr int fast_block_shift = 5;
+
+static void make_props_table(const std::filesystem::path& data_path, std::ostream& fout, bool benchmark)
+{
+    using item_num_type = std::uint16_t;
+
+    // XXX: intentional memory leak to speed up program exit
+    std::vector<char_props>& arr_chars(*new std::vector<char_props>(MAX_CODE_POINT + 1));
+    std::vector<std::uint16_t>& arr_mapping(*new std::vector<std::uint16_t>(MAX_CODE_POINT + 1));
+
+    auto file_name = data_path / "GEN-idna-props.txt";
+    parse_UnicodeData<2>(file_name,
+        [&](int cp0, int cp1, const auto& col) {
+            const auto info = static_cast<std::uint16_t>(std::stoul(col[0], nullptr, 16));
+            const auto mapping = static_cast<std::uint16_t>(std::stoul(col[1], nullptr, 16));
+            for (int cp = cp0; cp <= cp1; cp++) {
+                arr_chars[cp].info = info;
+                arr_mapping[cp] = mapping;
+            }
+        });
+
+    file_name = data_path / "GEN-nfc-props.txt";
+    parse_UnicodeData<4>(file_name,
+        [&](int cp0, int cp1, const auto& col) {
+            const auto ccc = static_cast<std::uint8_t>(std::stoul(col[0]));
+            const auto comp = static_cast<std::uint16_t>(std::stoul(col[1], nullptr, 16));
+            const auto decomp = static_cast<std::uint16_t>(std::stoul(col[2], nullptr, 16));
+            const auto qc = static_cast<std::uint8_t>(std::stoul(col[3]));
+            for (int cp = cp0; cp <= cp1; cp++) {
+                arr_chars[cp].comp = comp;
+                arr_chars[cp].decomp = decomp;
+                arr_chars[cp].ccc = ccc;
+                arr_chars[cp].qc = qc;
+            }
+        });
+
+    // Unique property records with the mappings of the same index; the first
+    // one is the default
+    std::vector<char_props> arr_props;
+    std::vector<std::uint16_t> arr_props_mapping;
+    std::map<std::pair<char_props, std::uint16_t>, std::size_t> props_index;
+    const auto add_props = [&](std::size_t cp) {
+        const auto res = props_index.emplace(std::make_pair(arr_chars[cp], arr_mapping[cp]), arr_props.size());
+        if (res.second) {
+            arr_props.push_back(arr_chars[cp]);
+            arr_props_mapping.push_back(arr_mapping[cp]);
+        }
+        return res.first->second;
+    };
+
+    std::vector<item_num_type> arr_index(MAX_CODE_POINT + 1);
+    add_props(MAX_CODE_POINT);
+    for (std::size_t cp = 0; cp <= MAX_CODE_POINT; ++cp)
+        arr_index[cp] = static_cast<item_num_type>(add_props(cp));
+
+    if (arr_props.size() > 0xFFFF) {
+        std::cerr << "FATAL: Too many property records: " << arr_props.size() << std::endl;
+        return;
+    }
+
+    // Special ranges to reduce table size
+    special_ranges<item_num_type> spec(arr_index, 2);
+    if (spec.m_range.size() < 2) {
+        std::cerr << "FATAL: The special range not found" << std::endl;
+        return;
+    }
+    const std::size_t count_chars = spec.m_range[0].from;
+
+    // The code points below hot_end are looked up in the direct table, which
+    // takes one load less than the multi-level tables. The range covers the
+    // Latin, Greek, Cyrillic, Armenian, Hebrew and Arabic letters; the width
+    // of entries is the smallest one holding the record indexes.
+    const std::uint32_t hot_end = 0x800;
+    const std::vector<item_num_type> hot_index(arr_index.begin(), arr_index.begin() + hot_end);
+
+    // The multi-level tables are not used for the hot range, so its values
+    // are replaced with the default to share the blocks
+    std::vector<item_num_type> arr_table_index(arr_index);
+    std::fill(arr_table_index.begin(), arr_table_index.begin() + hot_end, arr_index[count_chars]);
+
+    // The fast two-level table is used by default, and the smallest
+    // three-level table if UPA_IDNA_SMALL_TABLES is defined
+    if (benchmark)
+        benchmark_layouts2(arr_table_index, hot_end, count_chars);
+    const auto fast = make_table_layout2(arr_table_index, count_chars, fast_block_shift);
+    const auto small = find_smallest_layout3(arr_table_index, count_chars);
+
+    // memory used
+    const std::size_t data_mem = arr_props.size() * sizeof(char_props) +
+        arr_props_mapping.size() * getUIntSize(arr_props_mapping);
+    const std::size_t hot_mem = hot_index.size() * getUIntSize(hot_index);
+    const std::size_t props_mem = data_mem + hot_mem;
+    std::cout << "props_data count: " << arr_props.size() << "; mem: " << data_mem << "\n";
+    std::cout << "HOT: end=" << unsigned_to_numstr(hot_end, 16) << "; mem: " << hot_mem << "\n";
+    std::cout << "FAST: block_shift=" << fast.shift << "; mem: " << fast.mem_size()
+        << "; TOTAL MEM: " << fast.mem_size() + props_mem << "\n";
+    std::cout << "SMALL: bmp_shift=" << small.bmp_shift << ", supp_shift2=" << small.supp_shift2
+        << ", supp_shift3=" << small.supp_shift3 << "; mem: " << small.mem_size()
+        << "; TOTAL MEM: " << small.mem_size() + props_mem << "\n";
+
+    //=======================================================================
+    // Generate code
+
+    const char* sz_item_num_type = getUIntType<item_num_type>();
+
+    // Constants
+    output_unsigned_constant(fout, "std::uint32_t", "props_default_start", count_chars, 16);
+    output_unsigned_constant(fout, sz_item_num_type, "props_default_index", arr_index[count_chars], 10);
+    output_unsigned_constant(fout, "std::uint32_t", "props_spec_range1", spec.m_range[1].from, 16);
+    output_unsigned_constant(fout, "std::uint32_t", "props_spec_range2", spec.m_range[1].to, 16);
+    output_unsigned_constant(fout, sz_item_num_type, "props_spec_index", arr_index[spec.m_range[1].from], 10);
+
+    // Property records
+    fout << "\ninline constexpr char_props props_data[] = {";
+    {
+        OutputFmt outfmt(fout, 100);
+        for (const auto& p : arr_props)
+            outfmt.output(props_to_str(p));
+    }
+    fout << "};\n\n";
+    output_array(fout, "props_mapping", arr_props_mapping);
+
+    // Direct table of the hot range
+    fout << '\n';
+    output_unsigned_constant(fout, "std::uint32_t", "props_hot_end", hot_end, 16);
+    output_array(fout, "props_hot", hot_index);
+
+    // Record index tables
+    fout << "\n#ifndef UPA_IDNA_SMALL_TABLES\n";
+    output_unsigned_constant(fout, "std::size_t", "props_block_shift", fast.shift, 10);
+    output_unsigned_constant(fout, "std::uint32_t", "props_block_mask", fast.mask(), 16);
+    output_array(fout, "props_block", fast.blocks);
+    output_array(fout, "props_block_index", fast.index);
+    fout << "#else\n";
+    output_unsigned_constant(fout, "std::size_t", "props_bmp_shift", small.bmp_shift, 10);
+    output_unsigned_constant(fout, "std::uint32_t", "props_bmp_mask", small.mask(small.bmp_shift), 16);
+    output_unsigned_constant(fout, "std::size_t", "props_supp_index1_shift", small.supp_shift2 + small.supp_shift3, 10);
+    output_unsigned_constant(fout, "std::uint32_t", "props_supp_index2_mask", small.mask(small.supp_shift2), 16);
+    output_unsigned_constant(fout, "std::size_t", "props_supp_block_shift", small.supp_shift3, 10);
+    output_unsigned_constant(fout, "std::uint32_t", "props_supp_block_mask", small.mask(small.supp_shift3), 16);
+    output_array(fout, "props_block", small.blocks);
+    output_array(fout, "props_bmp_index", small.bmp_index);
+    output_array(fout, "props_supp_index1", small.supp_index1);
+    output_array(fout, "props_supp_index2", small.supp_index2);
+    fout << "#endif // UPA_IDNA_SMALL_TABLES\n";
+
+    // Self check
+    for (std::uint32_t cp = 0; cp <= MAX_CODE_POINT; ++cp) {
+        const bool in_table = cp >= hot_end && cp < count_chars;
+        std::size_t ind;
+        if (cp < hot_end)
+            ind = hot_index[cp];
+        else if (in_table)
+            ind = fast.lookup(cp);
+        else if (cp >= spec.m_range[1].from && cp <= spec.m_range[1].to)
+            ind = arr_index[spec.m_range[1].from];
+        else
+            ind = arr_index[count_chars];
+        if (!(arr_props[ind] == arr_chars[cp]) || arr_props_mapping[ind] != arr_mapping[cp] ||
+            (in_table && small.lookup(cp) != ind)) {
+            std::cerr << "FATAL: Invalid properties of the code point: " << cp << std::endl;
+            return;
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#!/bin/sh
+
+# Replaces the generated parts of the table headers, between the BEGIN-GENERATED
+# and END-GENERATED lines, with the output of unitool-idna, unitool-nfc and
+# unitool-props found in the data directory (the default is unitool/data)
+
+# the directory path of this file
+# https://stackoverflow.com/q/59895
+p="$(dirname "$0")"
+
+data="${1:-$p/data}"
+inc="$p/../include/upa/idna/detail"
+
+replace_generated() {
+  awk -v gen="$2" '
+    /\/\/ END-GENERATED/ { skip = 0 }
+    !skip { print }
+    /\/\/ BEGIN-GENERATED/ {
+      while ((getline line < gen) > 0) print line
+      skip = 1
+    }
+  ' "$1" > "$1.tmp" && mv "$1.tmp" "$1"
+}
+
+for f in GEN-idna-tables.H.txt GEN-nfc-tables.h.txt GEN-props-tables.h.txt
+do
+  if [ ! -f "$data/$f" ]; then
+    echo "Can't find $data/$f" >&2
+    exit 1
+  fi
+done
+
+replace_generated "$inc/idna_table.h" "$data/GEN-idna-tables.H.txt"
+replace_generated "$inc/nfc_table.h" "$data/GEN-nfc-tables.h.txt"
+replace_generated "$inc/props_table.h" "$data/GEN-props-tables.h.txt"